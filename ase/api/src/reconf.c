@@ -38,3 +38,34 @@ fpga_result __FPGA_API__ fpgaReconfigureSlot(fpga_handle fpga,
 {
 	return FPGA_OK;
 }
+
+fpga_result __FPGA_API__ fpgaRegisterImage(fpga_handle fpga,
+					   uint32_t slot,
+					   const char *gbs_path,
+					   uint64_t *image_id)
+{
+	return FPGA_NOT_SUPPORTED;
+}
+
+fpga_result __FPGA_API__ fpgaLoadImage(fpga_handle fpga, uint64_t image_id)
+{
+	return FPGA_NOT_SUPPORTED;
+}
+
+fpga_result __FPGA_API__ fpgaUnregisterImage(fpga_handle fpga,
+					     uint64_t image_id)
+{
+	return FPGA_NOT_SUPPORTED;
+}
+
+fpga_result __FPGA_API__ fpgaSetImageLibraryLimit(fpga_handle fpga,
+						  uint64_t max_bytes)
+{
+	return FPGA_NOT_SUPPORTED;
+}
+
+fpga_result __FPGA_API__ fpgaGetImageLibraryStats(fpga_handle fpga,
+						  fpga_image_stats *stats)
+{
+	return FPGA_NOT_SUPPORTED;
+}
@@ -76,3 +76,15 @@ fpga_result __FPGA_API__ fpgaGetUmsgPtr(fpga_handle handle, uint64_t **umsg_ptr)
 	}
 	return result;
 }
+
+// Trigger Umsg
+fpga_result __FPGA_API__ fpgaTriggerUmsg(fpga_handle handle, uint64_t value)
+{
+	if (umsg_umas_vbase == NULL)
+		return FPGA_EXCEPTION;
+
+	// Write UMsg 0 and ring the doorbell
+	umsg_send(0, &value);
+
+	return FPGA_OK;
+}
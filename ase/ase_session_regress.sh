@@ -0,0 +1,186 @@
+#!/bin/bash
+## Copyright(c) 2015-2017, Intel Corporation
+##
+## Redistribution  and  use  in source  and  binary  forms,  with  or  without
+## modification, are permitted provided that the following conditions are met:
+##
+## * Redistributions of  source code  must retain the  above copyright notice,
+##   this list of conditions and the following disclaimer.
+## * Redistributions in binary form must reproduce the above copyright notice,
+##   this list of conditions and the following disclaimer in the documentation
+##   and/or other materials provided with the distribution.
+## * Neither the name  of Intel Corporation  nor the names of its contributors
+##   may be used to  endorse or promote  products derived  from this  software
+##   without specific prior written permission.
+##
+## THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+## AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+## IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+## ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+## LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+## CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+## SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+## INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+## CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+## ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+## POSSIBILITY OF SUCH DAMAGE.
+## **************************************************************************
+##
+## Concurrent ASE_SESSION regression
+## Starts several simulator/application pairs in one work directory, each
+## pair under its own ASE_SESSION key, checks that every application
+## passes, that each session logs only its own buffers in its session
+## directory, and that a simulator started with a key already in use is
+## refused.
+##
+##   ASE_SESSIONS         Number of pairs (default 4)
+##   ASE_SIM_CMD          Simulator command, run from this directory
+##                        (default "make sim")
+##   ASE_APP_CMD          Application command (default fpgadiag lpbk1 from
+##                        $MYINST_DIR/bin)
+##   ASE_WORKDIR          Simulator work directory (default ./work)
+##   ASE_REGRESS_TIMEOUT  Seconds to wait for each step (default 600)
+## **************************************************************************
+
+ASE_SRCDIR=$(cd "$(dirname "$0")" && pwd)
+NUM_SESSIONS=${ASE_SESSIONS:-4}
+SIM_CMD=${ASE_SIM_CMD:-make sim}
+WORKDIR=${ASE_WORKDIR:-$ASE_SRCDIR/work}
+TIMEOUT=${ASE_REGRESS_TIMEOUT:-600}
+KEY_PREFIX=regress_$$
+
+if [ -z "$ASE_APP_CMD" ]; then
+    if [ -z "$MYINST_DIR" ]; then
+	echo "env(MYINST_DIR) has not been set -- please set it to OPAE install directory, or set ASE_APP_CMD"
+	exit 1
+    fi
+    ASE_APP_CMD="env LD_LIBRARY_PATH=${LD_LIBRARY_PATH}:${MYINST_DIR}/lib/ LD_PRELOAD=libopae-c-ase.so ${MYINST_DIR}/bin/fpgadiag -t ase -m lpbk1 -b 16"
+fi
+
+LOGDIR=$WORKDIR/session_regress_logs
+mkdir -p $LOGDIR || exit 1
+unset ASE_SESSION
+
+SIM_PIDS=()
+FAILED=0
+
+# Each simulator runs in its own process group so 'make sim' and the
+# simulator under it are stopped together
+start_sim()
+{
+    ASE_SESSION=$1 setsid bash -c "cd '$ASE_SRCDIR' && $SIM_CMD" > $2 2>&1 < /dev/null &
+    LAST_SIM_PID=$!
+}
+
+stop_sims()
+{
+    for pid in ${SIM_PIDS[@]}; do
+	kill -TERM -- -$pid 2> /dev/null
+    done
+}
+trap stop_sims EXIT
+
+# Wait until the process exits, returns 1 on timeout
+wait_exit()
+{
+    local t=0
+    while kill -0 $1 2> /dev/null; do
+	if [ $t -ge $TIMEOUT ]; then
+	    return 1
+	fi
+	sleep 1
+	t=$((t + 1))
+    done
+    return 0
+}
+
+fail()
+{
+    echo "  [FAIL] $*"
+    FAILED=1
+}
+
+## Start simulators, one key each
+for i in $(seq 1 $NUM_SESSIONS); do
+    start_sim ${KEY_PREFIX}_$i $LOGDIR/sim_$i.log
+    SIM_PIDS+=($LAST_SIM_PID)
+done
+
+## Wait for every session to be ready
+for i in $(seq 1 $NUM_SESSIONS); do
+    ready=$WORKDIR/session_${KEY_PREFIX}_$i/.ase_ready.pid
+    t=0
+    while [ ! -f $ready ] && [ $t -lt $TIMEOUT ]; do
+	sleep 1
+	t=$((t + 1))
+    done
+    if [ ! -f $ready ]; then
+	fail "session $i simulator not ready, see $LOGDIR/sim_$i.log"
+	exit 1
+    fi
+done
+echo "  [INFO] $NUM_SESSIONS simulators ready in $WORKDIR"
+
+## A second simulator on a key in use must exit, leaving the first alone
+ready=$WORKDIR/session_${KEY_PREFIX}_1/.ase_ready.pid
+ready_before=$(cat $ready)
+start_sim ${KEY_PREFIX}_1 $LOGDIR/sim_reuse.log
+reuse_pid=$LAST_SIM_PID
+if ! wait_exit $reuse_pid; then
+    SIM_PIDS+=($reuse_pid)
+    fail "simulator with reused key ${KEY_PREFIX}_1 was not refused"
+elif [ "$(cat $ready 2> /dev/null)" != "$ready_before" ]; then
+    fail "simulator with reused key ${KEY_PREFIX}_1 replaced the running session"
+else
+    echo "  [PASS] reused key refused"
+fi
+
+## Run the applications concurrently
+APP_PIDS=()
+for i in $(seq 1 $NUM_SESSIONS); do
+    ASE_WORKDIR=$WORKDIR ASE_SESSION=${KEY_PREFIX}_$i bash -c "$ASE_APP_CMD" > $LOGDIR/app_$i.log 2>&1 < /dev/null &
+    APP_PIDS+=($!)
+done
+
+for i in $(seq 1 $NUM_SESSIONS); do
+    if wait ${APP_PIDS[$((i - 1))]}; then
+	echo "  [PASS] session $i"
+    else
+	fail "session $i application, see $LOGDIR/app_$i.log"
+    fi
+done
+
+## Each session logs its buffers in its own directory. Shared memory
+## names end in the session's timestamp, which no other log may list
+for i in $(seq 1 $NUM_SESSIONS); do
+    wslog=$WORKDIR/session_${KEY_PREFIX}_$i/workspace_info.log
+    if [ ! -s $wslog ]; then
+	fail "session $i has no $wslog"
+	continue
+    fi
+    tstamps=$(sed -n 's|.*/dev/shm//[a-z]*[0-9]*\.\([^)]*\)).*|\1|p' $wslog | sort -u)
+    if [ $(echo "$tstamps" | grep -c .) -ne 1 ]; then
+	fail "session $i workspace_info.log lists buffers of other sessions"
+	continue
+    fi
+    for j in $(seq 1 $NUM_SESSIONS); do
+	other=$WORKDIR/session_${KEY_PREFIX}_$j/workspace_info.log
+	if [ $j -ne $i ] && grep -qF ".$tstamps)" $other 2> /dev/null; then
+	    fail "session $i buffers listed in $other"
+	fi
+    done
+done
+
+## Simulators in a regression mode end with the application, stop the rest
+stop_sims
+for pid in ${SIM_PIDS[@]}; do
+    wait $pid 2> /dev/null
+done
+SIM_PIDS=()
+
+if [ $FAILED -ne 0 ]; then
+    echo "  [FAIL] ASE_SESSION regression, logs in $LOGDIR"
+    exit 1
+fi
+echo "  [PASS] ASE_SESSION regression, $NUM_SESSIONS sessions"
+exit 0
@@ -329,6 +329,9 @@ package ase_pkg;
       int 	  enable_cl_view;
       int 	  usr_tps;
       int 	  phys_memory_available_gb;
+      int 	  enable_binary_trace;
+      int 	  enable_random_physaddr;
+      int 	  enable_record;
    } ase_cfg_t;
    ase_cfg_t cfg;
 
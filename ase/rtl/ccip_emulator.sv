@@ -1355,6 +1355,9 @@ module ccip_emulator
 	 cfg.enable_cl_view           = cfg_in.enable_cl_view           ;
 	 cfg.usr_tps                  = cfg_in.usr_tps                  ;
 	 cfg.phys_memory_available_gb = cfg_in.phys_memory_available_gb ;
+	 cfg.enable_binary_trace      = cfg_in.enable_binary_trace      ;
+	 cfg.enable_random_physaddr   = cfg_in.enable_random_physaddr   ;
+	 cfg.enable_record            = cfg_in.enable_record            ;
 	 // Set UsrClk
 	 update_usrclk_delay( cfg.usr_tps );
       end
@@ -2379,7 +2382,7 @@ module ccip_emulator
       ase_ready_pid = ase_instance_running();
       if (ase_ready_pid != 0) begin
 	 `BEGIN_RED_FONTCOLOR;
-	 $display("  [SIM]  An ASE instance is probably still running in current directory !");
+	 $display("  [SIM]  An ASE instance is probably still running in current directory (and ASE_SESSION) !");
 	 $display("  [SIM]  Check for PID %d", ase_ready_pid);
 	 $display("  [SIM]  Simulation will exit... you may use a SIGKILL to kill the simulation process.");
 	 $display("  [SIM]  Also check if '.ase_ready.pid' file is removed before proceeding.");
@@ -2498,6 +2501,7 @@ module ccip_emulator
       // Logger control
       .finish_logger    ( finish_trigger       ),
       .stdout_en        ( cfg.enable_cl_view[0]),
+      .binary_en        ( cfg.enable_binary_trace[0]),
       // Buffer message injection
       .log_string_en    ( buffer_msg_en        ),
       .log_timestamp_en ( buffer_msg_tstamp_en ),
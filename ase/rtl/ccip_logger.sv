@@ -48,6 +48,7 @@ module ccip_logger
     // Configure enable
     input logic finish_logger,
     input logic stdout_en,
+    input logic binary_en,
     // Buffer message injection
     input logic log_timestamp_en,
     input logic log_string_en,
@@ -247,6 +248,39 @@ module ccip_logger
    endfunction
 
 
+   /*
+    * Binary trace (ase_trace.c)
+    * Kind codes mirror ASE_TRACE_* in ase_common.h
+    */
+   import "DPI-C" function void ase_trace_post(int kind, longint tstamp,
+					       int vc, int rtype, int cl,
+					       int meta, longint addr,
+					       int nbytes, bit [511:0] data);
+   import "DPI-C" function void ase_trace_msg(longint tstamp, int tstamp_en,
+					      string msg);
+
+   localparam int TRC_SOFTRESET  = 1;
+   localparam int TRC_C0ALMFULL  = 2;
+   localparam int TRC_C1ALMFULL  = 3;
+   localparam int TRC_MMIOWRREQ  = 5;
+   localparam int TRC_MMIORDREQ  = 6;
+   localparam int TRC_RDRSP      = 7;
+   localparam int TRC_UMSGHINT   = 8;
+   localparam int TRC_UMSGDATA   = 9;
+   localparam int TRC_WRRSP      = 10;
+   localparam int TRC_WRFENCERSP = 11;
+   localparam int TRC_INTRRSP    = 12;
+   localparam int TRC_RDREQ      = 13;
+   localparam int TRC_WRREQ      = 14;
+   localparam int TRC_WRFENCE    = 15;
+   localparam int TRC_INTRREQ    = 16;
+   localparam int TRC_MMIORDRSP  = 17;
+
+   // Strings are only formatted when shown or written to LOGNAME
+   logic 	text_en;
+   assign text_en = stdout_en | ~binary_en;
+
+
    /*
     * FUNCTION: print_and_post_log wrapper function to simplify logging
     */
@@ -254,8 +288,10 @@ module ccip_logger
       begin
 	 if (stdout_en)
 	   $display(formatted_string);
-	 $fwrite(log_fd, formatted_string);
-	 $fflush();
+	 if (~binary_en) begin
+	    $fwrite(log_fd, formatted_string);
+	    $fflush();
+	 end
       end
    endfunction // print_and_post_log
 
@@ -286,40 +322,58 @@ module ccip_logger
 	 // Indicate Software controlled reset
 	 // -------------------------------------------------- //
 	 if (SoftReset_q != SoftReset) begin
-	    $sformat(softreset_str,
-		     "%d\tSoftReset toggled from %b to %b\n",
-		     $time,
-		     SoftReset_q,
-		     SoftReset);
-	    print_and_post_log(softreset_str);
+	    if (binary_en)
+	      ase_trace_post(TRC_SOFTRESET, $time, 0, SoftReset_q, SoftReset,
+			     0, 0, 0, 0);
+	    if (text_en) begin
+	       $sformat(softreset_str,
+			"%d\tSoftReset toggled from %b to %b\n",
+			$time,
+			SoftReset_q,
+			SoftReset);
+	       print_and_post_log(softreset_str);
+	    end
 	 end
 	 // -------------------------------------------------- //
 	 // Track C0TxAlmFull transitions
 	 // -------------------------------------------------- //
 	 if (C0TxAlmFull_q != ccip_rx.c0TxAlmFull) begin
-	    $sformat(c0TxAlmFull_str,
-		     "%d\tC0Tx AlmFull toggled from %b to %b\n",
-		     $time,
-		     C0TxAlmFull_q,
-		     ccip_rx.c0TxAlmFull);
-	    print_and_post_log(c0TxAlmFull_str);
+	    if (binary_en)
+	      ase_trace_post(TRC_C0ALMFULL, $time, 0, C0TxAlmFull_q,
+			     ccip_rx.c0TxAlmFull, 0, 0, 0, 0);
+	    if (text_en) begin
+	       $sformat(c0TxAlmFull_str,
+			"%d\tC0Tx AlmFull toggled from %b to %b\n",
+			$time,
+			C0TxAlmFull_q,
+			ccip_rx.c0TxAlmFull);
+	       print_and_post_log(c0TxAlmFull_str);
+	    end
 	 end
 	 // -------------------------------------------------- //
 	 // Track C1TxAlmFull transitions
 	 // -------------------------------------------------- //
 	 if (C1TxAlmFull_q != ccip_rx.c1TxAlmFull) begin
-	    $sformat(c1TxAlmFull_str,
-		     "%d\tC1Tx AlmFull toggled from %b to %b\n",
-		     $time,
-		     C1TxAlmFull_q,
-		     ccip_rx.c1TxAlmFull);
-	    print_and_post_log(c1TxAlmFull_str);
+	    if (binary_en)
+	      ase_trace_post(TRC_C1ALMFULL, $time, 0, C1TxAlmFull_q,
+			     ccip_rx.c1TxAlmFull, 0, 0, 0, 0);
+	    if (text_en) begin
+	       $sformat(c1TxAlmFull_str,
+			"%d\tC1Tx AlmFull toggled from %b to %b\n",
+			$time,
+			C1TxAlmFull_q,
+			ccip_rx.c1TxAlmFull);
+	       print_and_post_log(c1TxAlmFull_str);
+	    end
 	 end
 	 // -------------------------------------------------- //
 	 // Buffer messages
 	 // -------------------------------------------------- //
 	 if (log_string_en) begin
-	    if (log_timestamp_en) begin
+	    if (binary_en) begin
+	       ase_trace_msg($time, log_timestamp_en, log_string);
+	    end
+	    else if (log_timestamp_en) begin
 	       $fwrite(log_fd, "-----------------------------------------------------\n");
 	       $fwrite(log_fd, "%d\t%s\n", $time, log_string);
 	    end
@@ -333,53 +387,82 @@ module ccip_logger
 	 // -------------------------------------------------- //
 	 // MMIO Write Request
 	 if (ccip_rx.c0.mmioWrValid) begin
-	    $sformat(c0rx_str,
-		     "%d\t   \tMMIOWrReq   \t  \t%x\t%d bytes\t%s\n",
-		     $time,
-		     C0RxMmioHdr.address,
-		     mmioreq_length(C0RxMmioHdr.length),
-		     csr_data(mmioreq_length(C0RxMmioHdr.length), ccip_rx.c0.data) );
-	    print_and_post_log(c0rx_str);
+	    if (binary_en)
+	      ase_trace_post(TRC_MMIOWRREQ, $time, 0, 0,
+			     C0RxMmioHdr.length, 0, C0RxMmioHdr.address,
+			     mmioreq_length(C0RxMmioHdr.length),
+			     ccip_rx.c0.data);
+	    if (text_en) begin
+	       $sformat(c0rx_str,
+			"%d\t   \tMMIOWrReq   \t  \t%x\t%d bytes\t%s\n",
+			$time,
+			C0RxMmioHdr.address,
+			mmioreq_length(C0RxMmioHdr.length),
+			csr_data(mmioreq_length(C0RxMmioHdr.length), ccip_rx.c0.data) );
+	       print_and_post_log(c0rx_str);
+	    end
 	 end
 	 // MMIO Read Request
 	 else if (ccip_rx.c0.mmioRdValid) begin
-	    $sformat(c0rx_str,
-		     "%d\t   \tMMIORdReq   \t%x\t%x\t%d bytes\n",
-	    	     $time,
-	    	     C0RxMmioHdr.tid,
-	    	     C0RxMmioHdr.address,
-	    	     mmioreq_length(C0RxMmioHdr.length));
-	    print_and_post_log(c0rx_str);
+	    if (binary_en)
+	      ase_trace_post(TRC_MMIORDREQ, $time, 0, 0,
+			     C0RxMmioHdr.length, C0RxMmioHdr.tid,
+			     C0RxMmioHdr.address, 0, 0);
+	    if (text_en) begin
+	       $sformat(c0rx_str,
+			"%d\t   \tMMIORdReq   \t%x\t%x\t%d bytes\n",
+	    		$time,
+	    		C0RxMmioHdr.tid,
+	    		C0RxMmioHdr.address,
+	    		mmioreq_length(C0RxMmioHdr.length));
+	       print_and_post_log(c0rx_str);
+	    end
 	 end // if (ccip_rx.c0.mmioRdValid)
 	 // Read Response
 	 else if (ccip_rx.c0.rspValid && isCCIPRdLineResponse(ccip_rx.c0.hdr.resp_type)) begin
-	    $sformat(c0rx_str,
-		     "%d\t%s\t%s\t%x\t%s\t%x\n",
-	 	     $time,
-	 	     print_channel(ccip_rx.c0.hdr.vc_used),
-	 	     print_c0_resptype(ccip_rx.c0.hdr.resp_type),
-	 	     ccip_rx.c0.hdr.mdata,
-		     print_clnum(ccip_rx.c0.hdr.cl_num),
-	 	     ccip_rx.c0.data);
-	    print_and_post_log(c0rx_str);
+	    if (binary_en)
+	      ase_trace_post(TRC_RDRSP, $time, ccip_rx.c0.hdr.vc_used,
+			     ccip_rx.c0.hdr.resp_type, ccip_rx.c0.hdr.cl_num,
+			     ccip_rx.c0.hdr.mdata, 0, 64, ccip_rx.c0.data);
+	    if (text_en) begin
+	       $sformat(c0rx_str,
+			"%d\t%s\t%s\t%x\t%s\t%x\n",
+	 		$time,
+	 		print_channel(ccip_rx.c0.hdr.vc_used),
+	 		print_c0_resptype(ccip_rx.c0.hdr.resp_type),
+	 		ccip_rx.c0.hdr.mdata,
+			print_clnum(ccip_rx.c0.hdr.cl_num),
+	 		ccip_rx.c0.data);
+	       print_and_post_log(c0rx_str);
+	    end
 	 end // if (ccip_tx.c0.rspValid && (ccip_rx.c0.hdr.resptype == eRSP_RDLINE))
 	 /*************** SW -> MEM -> AFU Unordered Message  *************/
 `ifdef ASE_ENABLE_UMSG_FEATURE
 	 else if (ccip_rx.c0.rspValid && isCCIPUmsgResponse(ccip_rx.c0.hdr.resp_type)) begin
 	    if (C0RxUMsgHdr.umsg_type) begin
-	       $sformat(c0rx_str,
-			"%d\t   \tUMsgHint   \t%d\n",
-			$time,
-			C0RxUMsgHdr.umsg_id);
-	       print_and_post_log(c0rx_str);
+	       if (binary_en)
+		 ase_trace_post(TRC_UMSGHINT, $time, 0, 0, 0,
+				C0RxUMsgHdr.umsg_id, 0, 0, 0);
+	       if (text_en) begin
+		  $sformat(c0rx_str,
+			   "%d\t   \tUMsgHint   \t%d\n",
+			   $time,
+			   C0RxUMsgHdr.umsg_id);
+		  print_and_post_log(c0rx_str);
+	       end
 	    end
 	    else if (~C0RxUMsgHdr.umsg_type) begin
-	       $sformat(c0rx_str,
-			"%d\t   \tUMsgData   \t%d\t%x\n",
-			$time,
-			C0RxUMsgHdr.umsg_id,
-			ccip_rx.c0.data);
-	       print_and_post_log(c0rx_str);
+	       if (binary_en)
+		 ase_trace_post(TRC_UMSGDATA, $time, 0, 0, 0,
+				C0RxUMsgHdr.umsg_id, 0, 64, ccip_rx.c0.data);
+	       if (text_en) begin
+		  $sformat(c0rx_str,
+			   "%d\t   \tUMsgData   \t%d\t%x\n",
+			   $time,
+			   C0RxUMsgHdr.umsg_id,
+			   ccip_rx.c0.data);
+		  print_and_post_log(c0rx_str);
+	       end
 	    end
 	 end
 `endif
@@ -388,31 +471,48 @@ module ccip_logger
 	 // -------------------------------------------------- //
 	 // Write response
 	 if (ccip_rx.c1.rspValid && isCCIPWrLineResponse(ccip_rx.c1.hdr.resp_type)) begin
-	    $sformat(c1rx_str,
-		     "%d\t%s\t%s\t%x\t%s\n",
-	 	     $time,
-	 	     print_channel(ccip_rx.c1.hdr.vc_used),
-	 	     print_c1_resptype(ccip_rx.c1.hdr.resp_type),
-	 	     ccip_rx.c1.hdr.mdata,
-	 	     print_clnum(ccip_rx.c1.hdr.cl_num));
-	    print_and_post_log(c1rx_str);
+	    if (binary_en)
+	      ase_trace_post(TRC_WRRSP, $time, ccip_rx.c1.hdr.vc_used,
+			     ccip_rx.c1.hdr.resp_type, ccip_rx.c1.hdr.cl_num,
+			     ccip_rx.c1.hdr.mdata, 0, 0, 0);
+	    if (text_en) begin
+	       $sformat(c1rx_str,
+			"%d\t%s\t%s\t%x\t%s\n",
+	 		$time,
+	 		print_channel(ccip_rx.c1.hdr.vc_used),
+	 		print_c1_resptype(ccip_rx.c1.hdr.resp_type),
+	 		ccip_rx.c1.hdr.mdata,
+	 		print_clnum(ccip_rx.c1.hdr.cl_num));
+	       print_and_post_log(c1rx_str);
+	    end
 	 end
 	 // Write Fence Response
 	 else if (ccip_rx.c1.rspValid && isCCIPWrFenceResponse(ccip_rx.c1.hdr.resp_type)) begin
-	    $sformat(c1rx_str,
-		     "%d\t%s\tWrFenceRsp\t%x\n",
-	 	     $time,
-	 	     print_channel(ccip_rx.c1.hdr.vc_used),
-	 	     ccip_rx.c1.hdr.mdata);
-	    print_and_post_log(c1rx_str);
+	    if (binary_en)
+	      ase_trace_post(TRC_WRFENCERSP, $time, ccip_rx.c1.hdr.vc_used,
+			     ccip_rx.c1.hdr.resp_type, 0,
+			     ccip_rx.c1.hdr.mdata, 0, 0, 0);
+	    if (text_en) begin
+	       $sformat(c1rx_str,
+			"%d\t%s\tWrFenceRsp\t%x\n",
+	 		$time,
+	 		print_channel(ccip_rx.c1.hdr.vc_used),
+	 		ccip_rx.c1.hdr.mdata);
+	       print_and_post_log(c1rx_str);
+	    end
 	 end
 `ifdef ASE_ENABLE_INTR_FEATURE
 	 else if (ccip_rx.c1.rspValid && isCCIPInterruptResponse(ccip_rx.c1.hdr.resp_type)) begin
-	    $sformat(c1rx_str,
-		     "%d\tInterrupt response on ID = %d\n",
-		     $time,
-		     C1RxIntrRspHdr.id);
-	    print_and_post_log(c1rx_str);
+	    if (binary_en)
+	      ase_trace_post(TRC_INTRRSP, $time, 0, 0, 0,
+			     C1RxIntrRspHdr.id, 0, 0, 0);
+	    if (text_en) begin
+	       $sformat(c1rx_str,
+			"%d\tInterrupt response on ID = %d\n",
+			$time,
+			C1RxIntrRspHdr.id);
+	       print_and_post_log(c1rx_str);
+	    end
 	 end
 `endif
 	 // -------------------------------------------------- //
@@ -420,61 +520,91 @@ module ccip_logger
 	 // -------------------------------------------------- //
 	 // AFU -> MEM Read Request
 	 if (ccip_tx.c0.valid && isCCIPRdLineRequest(ccip_tx.c0.hdr.req_type) ) begin
-	    $sformat(c0tx_str,
-		     "%d\t%s\t%s\t%x\t%x\t%s\n",
-	 	     $time,
-	 	     print_channel(ccip_tx.c0.hdr.vc_sel),
-	 	     print_c0_reqtype(ccip_tx.c0.hdr.req_type),
-	 	     ccip_tx.c0.hdr.mdata,
-	 	     ccip_tx.c0.hdr.address,
-		     print_cllen(ccip_tx.c0.hdr.cl_len));
-	    print_and_post_log(c0tx_str);
+	    if (binary_en)
+	      ase_trace_post(TRC_RDREQ, $time, ccip_tx.c0.hdr.vc_sel,
+			     ccip_tx.c0.hdr.req_type, ccip_tx.c0.hdr.cl_len,
+			     ccip_tx.c0.hdr.mdata, ccip_tx.c0.hdr.address,
+			     0, 0);
+	    if (text_en) begin
+	       $sformat(c0tx_str,
+			"%d\t%s\t%s\t%x\t%x\t%s\n",
+	 		$time,
+	 		print_channel(ccip_tx.c0.hdr.vc_sel),
+	 		print_c0_reqtype(ccip_tx.c0.hdr.req_type),
+	 		ccip_tx.c0.hdr.mdata,
+	 		ccip_tx.c0.hdr.address,
+			print_cllen(ccip_tx.c0.hdr.cl_len));
+	       print_and_post_log(c0tx_str);
+	    end
 	 end
 	 // -------------------------------------------------- //
 	 // C1Tx Channel activity
 	 // -------------------------------------------------- //
 	 // Write Request
 	 if (ccip_tx.c1.valid && isCCIPWrLineRequest(ccip_tx.c1.hdr.req_type)) begin
-	    $sformat(c1tx_str,
-		     "%d\t%s\t%s\t%x\t%x\t%x\t%s\n",
-	 	     $time,
-	 	     print_channel(ccip_tx.c1.hdr.vc_sel),
-	 	     print_c1_reqtype(ccip_tx.c1.hdr.req_type),
-	 	     ccip_tx.c1.hdr.mdata,
-	 	     ccip_tx.c1.hdr.address,
-	 	     ccip_tx.c1.data,
-		     print_clnum(ccip_tx.c1.hdr.cl_len));
-	    print_and_post_log(c1tx_str);
+	    if (binary_en)
+	      ase_trace_post(TRC_WRREQ, $time, ccip_tx.c1.hdr.vc_sel,
+			     ccip_tx.c1.hdr.req_type, ccip_tx.c1.hdr.cl_len,
+			     ccip_tx.c1.hdr.mdata, ccip_tx.c1.hdr.address,
+			     64, ccip_tx.c1.data);
+	    if (text_en) begin
+	       $sformat(c1tx_str,
+			"%d\t%s\t%s\t%x\t%x\t%x\t%s\n",
+	 		$time,
+	 		print_channel(ccip_tx.c1.hdr.vc_sel),
+	 		print_c1_reqtype(ccip_tx.c1.hdr.req_type),
+	 		ccip_tx.c1.hdr.mdata,
+	 		ccip_tx.c1.hdr.address,
+	 		ccip_tx.c1.data,
+			print_clnum(ccip_tx.c1.hdr.cl_len));
+	       print_and_post_log(c1tx_str);
+	    end
 	 end // if (ccip_tx.c1.valid && (ccip_tx.c1.hdr.req_type != eREQ_WRFENCE))
 	 // Write Fence
 	 else if (ccip_tx.c1.valid && isCCIPWrFenceRequest(ccip_tx.c1.hdr.req_type)) begin
-	    $sformat(c1tx_str,
-		     "%d\t%s\tWrFence \t%x\n",
-		     $time,
-		     print_channel(ccip_tx.c1.hdr.vc_sel),
-		     ccip_tx.c1.hdr.mdata);
-	    print_and_post_log(c1tx_str);
+	    if (binary_en)
+	      ase_trace_post(TRC_WRFENCE, $time, ccip_tx.c1.hdr.vc_sel,
+			     ccip_tx.c1.hdr.req_type, 0,
+			     ccip_tx.c1.hdr.mdata, 0, 0, 0);
+	    if (text_en) begin
+	       $sformat(c1tx_str,
+			"%d\t%s\tWrFence \t%x\n",
+			$time,
+			print_channel(ccip_tx.c1.hdr.vc_sel),
+			ccip_tx.c1.hdr.mdata);
+	       print_and_post_log(c1tx_str);
+	    end
 	 end
 `ifdef ASE_ENABLE_INTR_FEATURE
 	 else if (ccip_tx.c1.valid && isCCIPInterruptRequest(ccip_tx.c1.hdr.req_type)) begin
-	    $sformat(c1tx_str,
-		     "%d\tInterrupt Requested with ID = %d\n",
-		     $time,
-		     C1TxIntrReqHdr.id
-		     );
-	    print_and_post_log(c1tx_str);
+	    if (binary_en)
+	      ase_trace_post(TRC_INTRREQ, $time, 0, 0, 0,
+			     C1TxIntrReqHdr.id, 0, 0, 0);
+	    if (text_en) begin
+	       $sformat(c1tx_str,
+			"%d\tInterrupt Requested with ID = %d\n",
+			$time,
+			C1TxIntrReqHdr.id
+			);
+	       print_and_post_log(c1tx_str);
+	    end
 	 end
 `endif
 	 // -------------------------------------------------- //
 	 // C2Tx Channel activity
 	 // -------------------------------------------------- //
 	 if (ccip_tx.c2.mmioRdValid) begin
-	    $sformat(c2tx_str,
-		     "%d\t   \tMMIORdRsp   \t%x\t%x\n",
-		     $time,
-		     ccip_tx.c2.hdr.tid,
-		     ccip_tx.c2.data);
-	    print_and_post_log(c2tx_str);
+	    if (binary_en)
+	      ase_trace_post(TRC_MMIORDRSP, $time, 0, 0, 0,
+			     ccip_tx.c2.hdr.tid, 0, 8, ccip_tx.c2.data);
+	    if (text_en) begin
+	       $sformat(c2tx_str,
+			"%d\t   \tMMIORdRsp   \t%x\t%x\n",
+			$time,
+			ccip_tx.c2.hdr.tid,
+			ccip_tx.c2.data);
+	       print_and_post_log(c2tx_str);
+	    end
 	 end
 	 // -------------------------------------------------- //
 	 // FINISH command
@@ -485,7 +615,8 @@ module ccip_logger
 	 // -------------------------------------------------- //
 	 // Wait till next clock
 	 // -------------------------------------------------- //
-	 $fflush(log_fd);
+	 if (~binary_en)
+	   $fflush(log_fd);
 	 @(posedge clk);
       end
    end
@@ -0,0 +1,240 @@
+#!/usr/bin/env python
+## Copyright(c) 2017, Intel Corporation
+##
+## Redistribution  and  use  in source  and  binary  forms,  with  or  without
+## modification, are permitted provided that the following conditions are met:
+##
+## * Redistributions of  source code  must retain the  above copyright notice,
+##   this list of conditions and the following disclaimer.
+## * Redistributions in binary form must reproduce the above copyright notice,
+##   this list of conditions and the following disclaimer in the documentation
+##   and/or other materials provided with the distribution.
+## * Neither the name  of Intel Corporation  nor the names of its contributors
+##   may be used to  endorse or promote  products derived  from this  software
+##   without specific prior written permission.
+##
+## THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+## AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+## IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+## ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+## LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+## CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+## SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+## INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+## CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+## ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+## POSSIBILITY OF SUCH DAMAGE.
+
+########################################################################
+#
+# ASE binary trace decoder
+# Converts ccip_transactions.trc (ENABLE_BINARY_TRACE = 1 in ase.cfg)
+# back to the ccip_transactions.tsv layout, optionally keeping only
+# records in an address range, channel or time window.
+#
+# Layout is described with ASE_TRACE_* in sw/ase_common.h
+#
+########################################################################
+
+from __future__ import print_function
+import argparse
+import binascii
+import errno
+import struct
+import sys
+
+MAGIC = b"ASETRACE"
+VERSION = 1
+FILE_HDR = struct.Struct("<8sII")
+REC_HDR = struct.Struct("<QQIBBBBH6x")
+
+# Record kinds (ASE_TRACE_*)
+SOFTRESET, C0ALMFULL, C1ALMFULL, MSG = 1, 2, 3, 4
+MMIOWRREQ, MMIORDREQ, RDRSP, UMSGHINT, UMSGDATA = 5, 6, 7, 8, 9
+WRRSP, WRFENCERSP, INTRRSP = 10, 11, 12
+RDREQ, WRREQ, WRFENCE, INTRREQ, MMIORDRSP = 13, 14, 15, 16, 17
+
+CHANNELS = {
+    "c0rx": (MMIOWRREQ, MMIORDREQ, RDRSP, UMSGHINT, UMSGDATA),
+    "c1rx": (WRRSP, WRFENCERSP, INTRRSP),
+    "c0tx": (RDREQ,),
+    "c1tx": (WRREQ, WRFENCE, INTRREQ),
+    "c2tx": (MMIORDRSP,),
+}
+
+# Kinds that carry an address
+ADDRESSED = (MMIOWRREQ, MMIORDREQ, RDREQ, WRREQ)
+
+# ccip_logger.sv print_* helpers
+VC_STR = {0: "VA ", 1: "VL0", 2: "VH0", 3: "VH1"}
+C0_REQ_STR = {0: "Rd_I       ", 1: "Rd_S       "}
+C1_REQ_STR = {0: "Wr_I       ", 1: "Wr_M       ", 2: "WrPush_I   ",
+              4: "WrFence    ", 6: "IntrReq    "}
+C0_RSP_STR = {0: "RdResp     "}
+C1_RSP_STR = {0: "WrResp     ", 4: "WrFenceResp", 6: "IntrResp   "}
+CLLEN_STR = {0: "#1CL", 1: "#2CL", 3: "#4CL"}
+CLNUM_STR = {0: "#1CL", 1: "#2CL", 2: "#3CL", 3: "#4CL"}
+MMIO_BYTES = {0: 4, 1: 8, 2: 64}
+MSG_RULE = "-----------------------------------------------------\n"
+
+
+def lookup(table, key, what):
+    return table.get(key, "** ERROR %%m : %s unindentified **" % what)
+
+
+def data_value(payload):
+    if not payload:
+        return 0
+    return int(binascii.hexlify(payload[::-1]), 16)
+
+
+def format_record(kind, tstamp, addr, meta, vc, rtype, cl, payload):
+    # $time is printed with %d, i.e. 20 columns
+    t = "%20d" % tstamp
+    if kind == SOFTRESET:
+        return "%s\tSoftReset toggled from %d to %d\n" % (t, rtype, cl)
+    if kind == C0ALMFULL:
+        return "%s\tC0Tx AlmFull toggled from %d to %d\n" % (t, rtype, cl)
+    if kind == C1ALMFULL:
+        return "%s\tC1Tx AlmFull toggled from %d to %d\n" % (t, rtype, cl)
+    if kind == MSG:
+        text = payload.decode("utf-8", "replace")
+        if cl:
+            return "%s%s\t%s\n" % (MSG_RULE, t, text)
+        return "%s%s\n" % (MSG_RULE, text)
+    if kind == MMIOWRREQ:
+        return "%s\t   \tMMIOWrReq   \t  \t%04x\t%11d bytes\t%x\n" % (
+            t, addr, MMIO_BYTES.get(cl, 0), data_value(payload))
+    if kind == MMIORDREQ:
+        return "%s\t   \tMMIORdReq   \t%03x\t%04x\t%11d bytes\n" % (
+            t, meta, addr, MMIO_BYTES.get(cl, 0))
+    if kind == RDRSP:
+        return "%s\t%s\t%s\t%04x\t%s\t%0128x\n" % (
+            t, VC_STR[vc & 3], lookup(C0_RSP_STR, rtype, "eRSP-CH0"), meta,
+            CLNUM_STR[cl & 3], data_value(payload))
+    if kind == UMSGHINT:
+        return "%s\t   \tUMsgHint   \t%2d\n" % (t, meta)
+    if kind == UMSGDATA:
+        return "%s\t   \tUMsgData   \t%2d\t%0128x\n" % (
+            t, meta, data_value(payload))
+    if kind == WRRSP:
+        return "%s\t%s\t%s\t%04x\t%s\n" % (
+            t, VC_STR[vc & 3], lookup(C1_RSP_STR, rtype, "eRSP-CH1"), meta,
+            CLNUM_STR[cl & 3])
+    if kind == WRFENCERSP:
+        return "%s\t%s\tWrFenceRsp\t%04x\n" % (t, VC_STR[vc & 3], meta)
+    if kind == INTRRSP:
+        return "%s\tInterrupt response on ID = %1d\n" % (t, meta)
+    if kind == RDREQ:
+        return "%s\t%s\t%s\t%04x\t%011x\t%s\n" % (
+            t, VC_STR[vc & 3], lookup(C0_REQ_STR, rtype, "eREQ-CH0"), meta,
+            addr, lookup(CLLEN_STR, cl, "clLen"))
+    if kind == WRREQ:
+        # ccip_logger prints the request cl_len through print_clnum
+        return "%s\t%s\t%s\t%04x\t%011x\t%0128x\t%s\n" % (
+            t, VC_STR[vc & 3], lookup(C1_REQ_STR, rtype, "eREQ-CH1"), meta,
+            addr, data_value(payload), CLNUM_STR[cl & 3])
+    if kind == WRFENCE:
+        return "%s\t%s\tWrFence \t%04x\n" % (t, VC_STR[vc & 3], meta)
+    if kind == INTRREQ:
+        return "%s\tInterrupt Requested with ID = %1d\n" % (t, meta)
+    if kind == MMIORDRSP:
+        return "%s\t   \tMMIORdRsp   \t%03x\t%016x\n" % (
+            t, meta, data_value(payload))
+    return "%s\t** Unknown trace record kind %d **\n" % (t, kind)
+
+
+def read_records(fp):
+    hdr = fp.read(FILE_HDR.size)
+    if len(hdr) < FILE_HDR.size:
+        raise ValueError("file too short for a trace header")
+    magic, version, rec_size = FILE_HDR.unpack(hdr)
+    if magic != MAGIC:
+        raise ValueError("not an ASE binary trace")
+    if version != VERSION or rec_size != REC_HDR.size:
+        raise ValueError("unsupported trace version %d" % version)
+
+    while True:
+        hdr = fp.read(REC_HDR.size)
+        if len(hdr) < REC_HDR.size:
+            if hdr:
+                print("WARNING: trace ends in a partial record",
+                      file=sys.stderr)
+            return
+        tstamp, addr, meta, kind, vc, rtype, cl, length = \
+            REC_HDR.unpack(hdr)
+        padded = (length + 7) & ~7
+        payload = fp.read(padded)
+        if len(payload) < padded:
+            print("WARNING: trace ends in a partial record", file=sys.stderr)
+            return
+        yield (kind, tstamp, addr, meta, vc, rtype, cl, payload[:length])
+
+
+def parse_range(text, what):
+    try:
+        lo, hi = text.split(":")
+        lo = int(lo, 0) if lo else 0
+        hi = int(hi, 0) if hi else None
+    except ValueError:
+        raise argparse.ArgumentTypeError("%s must be LO:HI" % what)
+    return (lo, hi)
+
+
+def in_range(value, rng):
+    lo, hi = rng
+    return value >= lo and (hi is None or value <= hi)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Decode an ASE binary transaction trace to the "
+                    "ccip_transactions.tsv layout")
+    parser.add_argument("trace", help="ccip_transactions.trc file")
+    parser.add_argument("-o", "--output", default="-",
+                        help="output file (default: stdout)")
+    parser.add_argument("-a", "--addr",
+                        type=lambda s: parse_range(s, "--addr"),
+                        help="keep requests with address in LO:HI "
+                             "(line address for memory, byte offset "
+                             "for MMIO); responses carry no address")
+    parser.add_argument("-c", "--channel", action="append",
+                        choices=sorted(CHANNELS.keys()),
+                        help="keep only this channel, may be repeated")
+    parser.add_argument("-t", "--time",
+                        type=lambda s: parse_range(s, "--time"),
+                        help="keep records with $time in START:END")
+    args = parser.parse_args()
+
+    kinds = None
+    if args.channel:
+        kinds = set()
+        for ch in args.channel:
+            kinds.update(CHANNELS[ch])
+
+    out = sys.stdout if args.output == "-" else open(args.output, "w")
+    try:
+        with open(args.trace, "rb") as fp:
+            for rec in read_records(fp):
+                kind, tstamp, addr = rec[0], rec[1], rec[2]
+                if kinds is not None and kind not in kinds:
+                    continue
+                if args.time and not in_range(tstamp, args.time):
+                    continue
+                if args.addr and (kind not in ADDRESSED or
+                                  not in_range(addr, args.addr)):
+                    continue
+                out.write(format_record(*rec))
+    except (IOError, ValueError) as e:
+        if getattr(e, "errno", None) == errno.EPIPE:
+            return 0
+        print("ERROR: %s: %s" % (args.trace, e), file=sys.stderr)
+        return 1
+    finally:
+        if out is not sys.stdout:
+            out.close()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
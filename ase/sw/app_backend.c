@@ -35,6 +35,8 @@
 #define _GNU_SOURCE
 
 #include "ase_common.h"
+#include <linux/futex.h>
+#include <sys/syscall.h>
 
 // Log-level
 int glbl_loglevel = ASE_LOG_MESSAGE;
@@ -42,6 +44,9 @@ int glbl_loglevel = ASE_LOG_MESSAGE;
 // MMIO Mutex Lock, initilize it here
 pthread_mutex_t mmio_port_lock = PTHREAD_MUTEX_INITIALIZER;
 
+// Signalled (under mmio_port_lock) whenever a scoreboard slot frees up
+pthread_cond_t mmio_slot_freed = PTHREAD_COND_INITIALIZER;
+
 // CSR map storage
 struct buffer_t *mmio_region;
 
@@ -63,14 +68,20 @@ char *tstamp_string;
 char app_ready_lockpath[ASE_FILEPATH_LEN];
 
 // MMIO Scoreboard (used in APP-side only)
+// A request's slot is the low MMIO_SLOT_BITWIDTH bits of its TID, so
+// responses index the table directly. rx_flag doubles as the futex the
+// reader sleeps on until its response is in.
 struct mmio_scoreboard_line_t {
 	uint64_t data;
 	int tid;
 	bool tx_flag;
-	bool rx_flag;
+	uint32_t rx_flag;
 };
 volatile struct mmio_scoreboard_line_t mmio_table[MMIO_MAX_OUTSTANDING];
 
+// Free scoreboard slots, bit per slot (protected by mmio_port_lock)
+static uint64_t mmio_free_slots = ~(uint64_t) 0;
+
 // Debug logs
 #ifdef ASE_DEBUG
 FILE *fp_pagetable_log = (FILE *) NULL;
@@ -94,6 +105,8 @@ mmio_t *mmio_rsp_pkt;
  */
 // UMsg Watch TID
 pthread_t umsg_watch_tid;
+static volatile int umsg_watch_running;
+static volatile int umsg_watch_stop;
 
 // UMsg byte offset
 const int umsg_byteindex_arr[] = {
@@ -116,25 +129,54 @@ static uint32_t mq_exist_status;
 static uint32_t mmio_exist_status;
 static uint32_t umas_exist_status;
 
+#ifndef MFD_CLOEXEC
+#define MFD_CLOEXEC  0x0001U
+#endif
+#ifndef MFD_HUGETLB
+#define MFD_HUGETLB  0x0004U
+#endif
+
+// Workspace arena, valid once the simulator has mapped it. Free space
+// is a list of extents sorted by offset (protected by arena_lock).
+struct arena_extent_t {
+	uint64_t offset;
+	uint64_t size;
+	struct arena_extent_t *next;
+};
+static struct buffer_t arena_region;
+static uint64_t arena_size;
+static uint64_t arena_granule;
+static struct arena_extent_t *arena_free_list;
+static pthread_mutex_t arena_lock = PTHREAD_MUTEX_INITIALIZER;
+static void arena_init(void);
+static void arena_deinit(void);
+
 
 /*
  * MMIO Generate TID
- * - Creation of TID must be atomic
+ * - Called with mmio_port_lock held, reserves the scoreboard slot the
+ *   TID points at, waiting for one to free up if all are in flight
  */
 uint32_t generate_mmio_tid(void)
 {
 	// Return value
 	uint32_t ret_mmio_tid;
+	int slot_idx;
 
-	while (count_mmio_tid_used() == MMIO_MAX_OUTSTANDING) {
+	while (mmio_free_slots == 0) {
 #ifdef ASE_DEBUG
 		ASE_INFO("MMIO TIDs have run out --- waiting !\n");
 #endif
-		usleep(10000);
+		pthread_cond_wait(&mmio_slot_freed, &mmio_port_lock);
 	}
 
-	// Increment and mask
-	ret_mmio_tid = glbl_mmio_tid & MMIO_TID_BITMASK;
+	slot_idx = __builtin_ctzll(mmio_free_slots);
+	mmio_free_slots &= ~((uint64_t) 1 << slot_idx);
+
+	// Sequence number above the slot keeps TIDs moving in the logs
+	ret_mmio_tid =
+	    ((glbl_mmio_tid << MMIO_SLOT_BITWIDTH) | slot_idx) &
+	    MMIO_TID_BITMASK;
 	glbl_mmio_tid++;
 
 	// Return ID
@@ -142,6 +184,42 @@ uint32_t generate_mmio_tid(void)
 }
 
 
+/*
+ * MMIO scoreboard slot wait/wake (process-private futex on rx_flag)
+ */
+static void mmio_slot_wait(int slot_idx)
+{
+	uint32_t *rx_flag = (uint32_t *) &mmio_table[slot_idx].rx_flag;
+
+	while (__atomic_load_n(rx_flag, __ATOMIC_ACQUIRE) == 0)
+		syscall(SYS_futex, rx_flag, FUTEX_WAIT_PRIVATE, 0, NULL,
+			NULL, 0);
+}
+
+
+static void mmio_slot_wake(int slot_idx)
+{
+	uint32_t *rx_flag = (uint32_t *) &mmio_table[slot_idx].rx_flag;
+
+	__atomic_store_n(rx_flag, 1, __ATOMIC_RELEASE);
+	syscall(SYS_futex, rx_flag, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+}
+
+
+/*
+ * Return a scoreboard slot to the free pool
+ */
+static void mmio_slot_release(int slot_idx)
+{
+	pthread_mutex_lock(&mmio_port_lock);
+	mmio_table[slot_idx].tx_flag = false;
+	mmio_table[slot_idx].rx_flag = 0;
+	mmio_free_slots |= (uint64_t) 1 << slot_idx;
+	pthread_cond_broadcast(&mmio_slot_freed);
+	pthread_mutex_unlock(&mmio_port_lock);
+}
+
+
 /*
  * THREAD: MMIO Read thread watcher
  */
@@ -160,7 +238,6 @@ void *mmio_response_watcher(void *arg)
 
 	// start watching for messages
 	while (mmio_exist_status == ESTABLISHED) {
-		memset((void *) mmio_rsp_pkt, 0xbc, sizeof(mmio_t));
 
 		// If received, update global message
 		ret =
@@ -197,22 +274,14 @@ void *mmio_response_watcher(void *arg)
 				// MMIO Read response (for credit count only)
 				if (mmio_rsp_pkt->write_en ==
 				    MMIO_READ_REQ) {
-					mmio_table[slot_idx].tid =
-					    mmio_rsp_pkt->tid;
 					mmio_table[slot_idx].data =
 					    mmio_rsp_pkt->qword[0];
-					mmio_table[slot_idx].tx_flag =
-					    true;
-					mmio_table[slot_idx].rx_flag =
-					    true;
+					mmio_slot_wake(slot_idx);
 				}
 				// MMIO Write response (for credit count only)
 				else if (mmio_rsp_pkt->write_en ==
 					 MMIO_WRITE_REQ) {
-					mmio_table[slot_idx].tx_flag =
-					    false;
-					mmio_table[slot_idx].rx_flag =
-					    false;
+					mmio_slot_release(slot_idx);
 				}
 #ifdef ASE_DEBUG
 				else {
@@ -244,18 +313,16 @@ void send_swreset(void)
 {
 	ASE_MSG("\n");
 	ASE_MSG("Issuing Soft Reset... \n");
-	while (count_mmio_tid_used() != 0) {
-		sleep(1);
-	}
+	pthread_mutex_lock(&mmio_port_lock);
+	while (count_mmio_tid_used() != 0)
+		pthread_cond_wait(&mmio_slot_freed, &mmio_port_lock);
+	pthread_mutex_unlock(&mmio_port_lock);
 
 	// Sending reset trigger
-	char ase_reset_msg[ASE_MQ_MSGSIZE];
-	snprintf(ase_reset_msg, ASE_MQ_MSGSIZE, "AFU_RESET 1");
-	ase_portctrl(ase_reset_msg);
+	ase_portctrl(ASE_PORTCTRL_AFU_RESET, 1);
 
 	usleep(1);
-	snprintf(ase_reset_msg, ASE_MQ_MSGSIZE, "AFU_RESET 0");
-	ase_portctrl(ase_reset_msg);
+	ase_portctrl(ASE_PORTCTRL_AFU_RESET, 0);
 }
 
 
@@ -267,10 +334,7 @@ void send_simkill(int n)
 	ASE_ERR("User Interrupt was seen... SW application will exit\n");
 
 	// Simkill
-	char ase_simkill_msg[ASE_MQ_MSGSIZE];
-	memset(ase_simkill_msg, 0, ASE_MQ_MSGSIZE);
-	snprintf(ase_simkill_msg, ASE_MQ_MSGSIZE, "ASE_SIMKILL 0");
-	ase_portctrl(ase_simkill_msg);
+	ase_portctrl(ASE_PORTCTRL_ASE_SIMKILL, 0);
 
 	// Deinitialize session
 	session_exist_status = NOT_ESTABLISHED;
@@ -406,6 +470,9 @@ void session_init(void)
 		sim2app_intr_request_rx =
 		    mqueue_open(mq_array[9].name, mq_array[9].perm_flag);
 
+		// Move traffic onto the simulator's shared memory rings
+		ipc_ring_attach();
+
 		// Message queues have been established
 		mq_exist_status = ESTABLISHED;
 
@@ -447,18 +514,17 @@ void session_init(void)
 		ASE_MSG("Session started\n");
 
 		// Send portctrl command to start a session
-		char session_ctrlcmd[ASE_MQ_MSGSIZE];
-		memset(session_ctrlcmd, 0, ASE_MQ_MSGSIZE);
-		snprintf(session_ctrlcmd, ASE_MQ_MSGSIZE, "ASE_INIT %d",
-			 getpid());
-		ase_portctrl(session_ctrlcmd);
+		ase_portctrl(ASE_PORTCTRL_ASE_INIT, getpid());
 
 		// Wait till session file is created
 		poll_for_session_id();
-		tstamp_string = (char *) ase_malloc(20);
+		tstamp_string = (char *) ase_malloc(ASE_SESSION_ID_LEN);
 		// tstamp_string = get_timestamp(0);
 		get_timestamp(tstamp_string);
 
+		// Workspace arena, before any workspace
+		arena_init();
+
 		// Creating CSR map
 
 		ASE_MSG("Creating MMIO ...\n");
@@ -512,6 +578,7 @@ void session_init(void)
 		ASE_MSG("Starting UMsg watcher ... \n");
 
 		// Initiate UMsg watcher
+		umsg_watch_stop = 0;
 		thr_err = pthread_create(&umsg_watch_tid, NULL, &umsg_watcher,
 					 NULL);
 		if (thr_err != 0) {
@@ -521,6 +588,7 @@ void session_init(void)
 			END_RED_FONTCOLOR;
 			exit(1);
 		} else {
+			umsg_watch_running = 1;
 			ASE_MSG("SUCCESS\n");
 		}
 
@@ -529,12 +597,15 @@ void session_init(void)
 
 		// MMIO Scoreboard setup
 		int ii;
+		pthread_mutex_lock(&mmio_port_lock);
 		for (ii = 0; ii < MMIO_MAX_OUTSTANDING; ii = ii + 1) {
 			mmio_table[ii].tid = 0;
 			mmio_table[ii].data = 0;
 			mmio_table[ii].tx_flag = false;
-			mmio_table[ii].rx_flag = false;
+			mmio_table[ii].rx_flag = 0;
 		}
+		mmio_free_slots = ~(uint64_t) 0;
+		pthread_mutex_unlock(&mmio_port_lock);
 
 		// Session status
 		session_exist_status = ESTABLISHED;
@@ -572,8 +643,10 @@ void session_deinit(void)
 			// Update status
 			umas_exist_status = NOT_ESTABLISHED;
 
-			// Close UMsg thread
-			pthread_cancel(umsg_watch_tid);
+			// Close UMsg thread, it must be gone before the
+			// SIGSEGV hook is dropped and the UMAS unmapped
+			umsg_watcher_stop();
+			umsg_wp_release();
 
 			// Deallocate the region
 			ASE_MSG("Deallocating UMAS\n");
@@ -596,10 +669,8 @@ void session_deinit(void)
 			pthread_cancel(mmio_watch_tid);
 		}
 		// Send SIMKILL
-		char session_ctrlcmd[ASE_MQ_MSGSIZE];
-		memset(session_ctrlcmd, 0, ASE_MQ_MSGSIZE);
-		snprintf(session_ctrlcmd, ASE_MQ_MSGSIZE, "ASE_SIMKILL 0");
-		ase_portctrl(session_ctrlcmd);
+		ase_portctrl(ASE_PORTCTRL_ASE_SIMKILL, 0);
+		arena_deinit();
 
 #ifdef ASE_DEBUG
 		fclose(fp_pagetable_log);
@@ -609,7 +680,8 @@ void session_deinit(void)
 		ASE_MSG("Session already deinitialized, call ignored !\n");
 	}
 
-	// close message queue
+	// Back to pipes, then close message queue
+	ipc_ring_detach();
 	mqueue_close(app2sim_mmioreq_tx);
 	mqueue_close(sim2app_mmiorsp_rx);
 	mqueue_close(app2sim_alloc_tx);
@@ -625,7 +697,7 @@ void session_deinit(void)
 		ASE_MSG("Trying to shutdown mutex unlock\n");
 	}
 	// Stop running threads
-	pthread_cancel(umsg_watch_tid);
+	umsg_watcher_stop();
 	pthread_cancel(mmio_watch_tid);
 
 	// End Clock snapshot
@@ -658,15 +730,9 @@ void session_deinit(void)
  */
 int find_empty_mmio_scoreboard_slot(void)
 {
-	int ii;
-	int idx;
-	for (ii = 0; ii < MMIO_MAX_OUTSTANDING; ii = ii + 1) {
-		idx = ii % MMIO_MAX_OUTSTANDING;
-		if ((mmio_table[idx].tx_flag == false)
-		    && (mmio_table[idx].rx_flag == false))
-			return idx;
-	}
-	return 0xFFFF;
+	if (mmio_free_slots == 0)
+		return 0xFFFF;
+	return __builtin_ctzll(mmio_free_slots);
 }
 
 
@@ -675,12 +741,11 @@ int find_empty_mmio_scoreboard_slot(void)
  */
 int get_scoreboard_slot_by_tid(int in_tid)
 {
-	int ii;
-	for (ii = 0; ii < MMIO_MAX_OUTSTANDING; ii = ii + 1) {
-		if ((mmio_table[ii].tx_flag == true)
-		    && (mmio_table[ii].tid == in_tid))
-			return ii;
-	}
+	int slot_idx = in_tid & MMIO_SLOT_MASK;
+
+	if ((mmio_table[slot_idx].tx_flag == true)
+	    && (mmio_table[slot_idx].tid == in_tid))
+		return slot_idx;
 	return 0xFFFF;
 }
 
@@ -690,14 +755,7 @@ int get_scoreboard_slot_by_tid(int in_tid)
  */
 int count_mmio_tid_used(void)
 {
-	int ii;
-	int cnt = 0;
-
-	for (ii = 0; ii < MMIO_MAX_OUTSTANDING; ii = ii + 1)
-		if (mmio_table[ii].tx_flag == true)
-			cnt++;
-
-	return cnt;
+	return MMIO_MAX_OUTSTANDING - __builtin_popcountll(mmio_free_slots);
 }
 
 
@@ -713,12 +771,12 @@ int mmio_request_put(struct mmio_t *pkt)
 	print_mmiopkt(fp_mmioaccess_log, "Sent", pkt);
 #endif
 
-	// Update scoreboard
+	// Update scoreboard, slot was reserved by generate_mmio_tid()
 	int mmiotable_idx;
-	mmiotable_idx = find_empty_mmio_scoreboard_slot();
-	if (mmiotable_idx != 0xFFFF) {
+	mmiotable_idx = pkt->tid & MMIO_SLOT_MASK;
+	if ((mmio_free_slots & ((uint64_t) 1 << mmiotable_idx)) == 0) {
 		mmio_table[mmiotable_idx].tx_flag = true;
-		mmio_table[mmiotable_idx].rx_flag = false;
+		mmio_table[mmiotable_idx].rx_flag = 0;
 		mmio_table[mmiotable_idx].tid = pkt->tid;
 		mmio_table[mmiotable_idx].data = pkt->qword[0];
 	}
@@ -761,15 +819,14 @@ void mmio_write32(int offset, uint32_t data)
 		ASE_ERR("MMIO Write Error\n");
 		raise(SIGABRT);
 	} else {
-		mmio_t *mmio_pkt;
-		mmio_pkt =
-		    (struct mmio_t *) ase_malloc(sizeof(struct mmio_t));
+		mmio_t mmio_pkt;
+		memset(&mmio_pkt, 0, sizeof(mmio_t));
 
-		mmio_pkt->write_en = MMIO_WRITE_REQ;
-		mmio_pkt->width = MMIO_WIDTH_32;
-		mmio_pkt->addr = offset;
-		ase_memcpy(mmio_pkt->qword, &data, sizeof(uint32_t));
-		mmio_pkt->resp_en = 0;
+		mmio_pkt.write_en = MMIO_WRITE_REQ;
+		mmio_pkt.width = MMIO_WIDTH_32;
+		mmio_pkt.addr = offset;
+		ase_memcpy(mmio_pkt.qword, &data, sizeof(uint32_t));
+		mmio_pkt.resp_en = 0;
 
 		// Critical Section
 		{
@@ -779,11 +836,11 @@ void mmio_write32(int offset, uint32_t data)
 				exit(1);
 			}
 
-			mmio_pkt->tid = generate_mmio_tid();
+			mmio_pkt.tid = generate_mmio_tid();
 #ifdef ASE_DEBUG
-			slot_idx = mmio_request_put(mmio_pkt);
+			slot_idx = mmio_request_put(&mmio_pkt);
 #else
-			mmio_request_put(mmio_pkt);
+			mmio_request_put(&mmio_pkt);
 #endif
 
 			if (pthread_mutex_unlock(&mmio_port_lock) != 0) {
@@ -803,9 +860,7 @@ void mmio_write32(int offset, uint32_t data)
 
 		ASE_MSG
 		    ("MMIO Write     : tid = 0x%03x, offset = 0x%x, data = 0x%08x\n",
-		     mmio_pkt->tid, mmio_pkt->addr, data);
-
-		free(mmio_pkt);
+		     mmio_pkt.tid, mmio_pkt.addr, data);
 	}
 
 	FUNC_CALL_EXIT;
@@ -828,15 +883,14 @@ void mmio_write64(int offset, uint64_t data)
 		ASE_ERR("MMIO Write Error\n");
 		raise(SIGABRT);
 	} else {
-		mmio_t *mmio_pkt;
-		mmio_pkt =
-		    (struct mmio_t *) ase_malloc(sizeof(struct mmio_t));
+		mmio_t mmio_pkt;
+		memset(&mmio_pkt, 0, sizeof(mmio_t));
 
-		mmio_pkt->write_en = MMIO_WRITE_REQ;
-		mmio_pkt->width = MMIO_WIDTH_64;
-		mmio_pkt->addr = offset;
-		ase_memcpy(mmio_pkt->qword, &data, sizeof(uint64_t));
-		mmio_pkt->resp_en = 0;
+		mmio_pkt.write_en = MMIO_WRITE_REQ;
+		mmio_pkt.width = MMIO_WIDTH_64;
+		mmio_pkt.addr = offset;
+		ase_memcpy(mmio_pkt.qword, &data, sizeof(uint64_t));
+		mmio_pkt.resp_en = 0;
 
 		// Critical section
 		{
@@ -846,11 +900,11 @@ void mmio_write64(int offset, uint64_t data)
 				exit(1);
 			}
 
-			mmio_pkt->tid = generate_mmio_tid();
+			mmio_pkt.tid = generate_mmio_tid();
 #ifdef ASE_DEBUG
-			slot_idx = mmio_request_put(mmio_pkt);
+			slot_idx = mmio_request_put(&mmio_pkt);
 #else
-			mmio_request_put(mmio_pkt);
+			mmio_request_put(&mmio_pkt);
 #endif
 
 			if (pthread_mutex_unlock(&mmio_port_lock) != 0) {
@@ -869,11 +923,8 @@ void mmio_write64(int offset, uint64_t data)
 
 		ASE_MSG
 		    ("MMIO Write     : tid = 0x%03x, offset = 0x%x, data = 0x%llx\n",
-		     mmio_pkt->tid, mmio_pkt->addr,
+		     mmio_pkt.tid, mmio_pkt.addr,
 		     (unsigned long long) data);
-
-
-		free(mmio_pkt);
 	}
 
 	FUNC_CALL_EXIT;
@@ -909,14 +960,13 @@ void mmio_read32(int offset, uint32_t *data32)
 		ASE_ERR("MMIO Read Error\n");
 		raise(SIGABRT);
 	} else {
-		mmio_t *mmio_pkt;
-		mmio_pkt =
-		    (struct mmio_t *) ase_malloc(sizeof(struct mmio_t));
+		mmio_t mmio_pkt;
+		memset(&mmio_pkt, 0, sizeof(mmio_t));
 
-		mmio_pkt->write_en = MMIO_READ_REQ;
-		mmio_pkt->width = MMIO_WIDTH_32;
-		mmio_pkt->addr = offset;
-		mmio_pkt->resp_en = 0;
+		mmio_pkt.write_en = MMIO_READ_REQ;
+		mmio_pkt.width = MMIO_WIDTH_32;
+		mmio_pkt.addr = offset;
+		mmio_pkt.resp_en = 0;
 
 		// Critical section
 		{
@@ -926,8 +976,8 @@ void mmio_read32(int offset, uint32_t *data32)
 				exit(1);
 			}
 
-			mmio_pkt->tid = generate_mmio_tid();
-			slot_idx = mmio_request_put(mmio_pkt);
+			mmio_pkt.tid = generate_mmio_tid();
+			slot_idx = mmio_request_put(&mmio_pkt);
 
 			if (pthread_mutex_unlock(&mmio_port_lock) != 0) {
 				ASE_ERR
@@ -937,16 +987,14 @@ void mmio_read32(int offset, uint32_t *data32)
 		}
 
 		ASE_MSG("MMIO Read      : tid = 0x%03x, offset = 0x%x\n",
-			mmio_pkt->tid, mmio_pkt->addr);
+			mmio_pkt.tid, mmio_pkt.addr);
 
 #ifdef ASE_DEBUG
 		ASE_DBG("slot_idx = %d\n", slot_idx);
 #endif
 
 		// Wait until correct response found
-		while (mmio_table[slot_idx].rx_flag != true) {
-			usleep(1);
-		}
+		mmio_slot_wait(slot_idx);
 
 		// Write data
 		*data32 = (uint32_t) mmio_table[slot_idx].data;
@@ -958,10 +1006,7 @@ void mmio_read32(int offset, uint32_t *data32)
 
 
 		// Reset scoreboard flags
-		mmio_table[slot_idx].tx_flag = false;
-		mmio_table[slot_idx].rx_flag = false;
-
-		free(mmio_pkt);
+		mmio_slot_release(slot_idx);
 	}
 
 	FUNC_CALL_EXIT;
@@ -985,14 +1030,13 @@ void mmio_read64(int offset, uint64_t *data64)
 		ASE_ERR("MMIO Read Error\n");
 		raise(SIGABRT);
 	} else {
-		mmio_t *mmio_pkt;
-		mmio_pkt =
-		    (struct mmio_t *) ase_malloc(sizeof(struct mmio_t));
+		mmio_t mmio_pkt;
+		memset(&mmio_pkt, 0, sizeof(mmio_t));
 
-		mmio_pkt->write_en = MMIO_READ_REQ;
-		mmio_pkt->width = MMIO_WIDTH_64;
-		mmio_pkt->addr = offset;
-		mmio_pkt->resp_en = 0;
+		mmio_pkt.write_en = MMIO_READ_REQ;
+		mmio_pkt.width = MMIO_WIDTH_64;
+		mmio_pkt.addr = offset;
+		mmio_pkt.resp_en = 0;
 
 		// Critical section
 		{
@@ -1002,8 +1046,8 @@ void mmio_read64(int offset, uint64_t *data64)
 				exit(1);
 			}
 
-			mmio_pkt->tid = generate_mmio_tid();
-			slot_idx = mmio_request_put(mmio_pkt);
+			mmio_pkt.tid = generate_mmio_tid();
+			slot_idx = mmio_request_put(&mmio_pkt);
 
 			if (pthread_mutex_unlock(&mmio_port_lock) != 0) {
 				ASE_ERR
@@ -1014,16 +1058,14 @@ void mmio_read64(int offset, uint64_t *data64)
 
 		ASE_MSG
 		    ("MMIO Read      : tid = 0x%03x, offset = 0x%x\n",
-		     mmio_pkt->tid, mmio_pkt->addr);
+		     mmio_pkt.tid, mmio_pkt.addr);
 
 #ifdef ASE_DEBUG
 		ASE_DBG("slot_idx = %d\n", slot_idx);
 #endif
 
 		// Wait for correct response to be back
-		while (mmio_table[slot_idx].rx_flag != true) {
-			usleep(1);
-		};
+		mmio_slot_wait(slot_idx);
 
 		// Write data
 		*data64 = mmio_table[slot_idx].data;
@@ -1035,10 +1077,7 @@ void mmio_read64(int offset, uint64_t *data64)
 		     (unsigned long long) *data64);
 
 		// Reset scoreboard flags
-		mmio_table[slot_idx].tx_flag = false;
-		mmio_table[slot_idx].rx_flag = false;
-
-		free(mmio_pkt);
+		mmio_slot_release(slot_idx);
 	}
 
 	FUNC_CALL_EXIT;
@@ -1046,49 +1085,236 @@ void mmio_read64(int offset, uint64_t *data64)
 
 
 /*
- * allocate_buffer: Shared memory allocation and vbase exchange
- * Instantiate a buffer_t structure with given parameters
- * Must be called by ASE_APP
+ * Create a memfd of 'size' bytes and map it, returns the mapping or
+ * MAP_FAILED with arena_fd closed
  */
-void allocate_buffer(struct buffer_t *mem, uint64_t *suggested_vaddr)
+static void *arena_create(unsigned int flags, uint64_t size, int *arena_fd)
 {
-	FUNC_CALL_ENTRY;
+	void *base;
 
-	// pthread_mutex_trylock (&app_lock);
-	int fd_alloc;
+	*arena_fd = -1;
+#ifdef SYS_memfd_create
+	*arena_fd = (int) syscall(SYS_memfd_create, "ase_arena",
+				  MFD_CLOEXEC | flags);
+#endif
+	if (*arena_fd < 0)
+		return MAP_FAILED;
+
+	if (ftruncate(*arena_fd, (off_t) size) == 0) {
+		base = mmap(NULL, (size_t) size, PROT_READ | PROT_WRITE,
+			    MAP_SHARED, *arena_fd, 0);
+		if (base != MAP_FAILED)
+			return base;
+	}
+
+	close(*arena_fd);
+	*arena_fd = -1;
+	return MAP_FAILED;
+}
+
+
+/*
+ * Set up the session's workspace arena (see ASE_ARENA_* in ase_common.h)
+ * Workspaces fall back to their own shm file if it is disabled or
+ * either side fails to map it
+ */
+static void arena_init(void)
+{
 	char tmp_msg[ASE_MQ_MSGSIZE] = { 0, };
+	char *env;
+	void *base;
+	int arena_fd;
+	int hugetlb = 1;
+
+	memset(&arena_region, 0, sizeof(struct buffer_t));
+	arena_size = ASE_ARENA_DEFAULT_MB;
+	env = getenv("ASE_ARENA_SIZE");
+	if ((env != NULL) && (*env != '\0'))
+		arena_size = strtoull(env, NULL, 10);
+	if (arena_size == 0) {
+		ASE_MSG("Workspace arena disabled, ASE_ARENA_SIZE=0\n");
+		return;
+	}
+	arena_size = arena_size << 20;
+	arena_size = (arena_size + CCI_CHUNK_SIZE - 1) &
+	    ~(uint64_t) (CCI_CHUNK_SIZE - 1);
+
+	// Hugetlb reserves the whole arena up front, so fall back to shmem
+	// when the pool is too small
+	arena_granule = CCI_CHUNK_SIZE;
+	base = arena_create(MFD_HUGETLB, arena_size, &arena_fd);
+	if (base == MAP_FAILED) {
+		hugetlb = 0;
+		arena_granule = ASE_PAGESIZE;
+		base = arena_create(0, arena_size, &arena_fd);
+#ifdef MADV_HUGEPAGE
+		if (base != MAP_FAILED)
+			madvise(base, (size_t) arena_size, MADV_HUGEPAGE);
+#endif
+	}
+	if (base == MAP_FAILED) {
+		ASE_MSG("Workspace arena not available, using one shared memory file per workspace\n");
+		return;
+	}
 
+	// Simulator maps it through our fd, and replies whether it could
+	arena_region.arena = ASE_ARENA_REGION;
+	arena_region.vbase = (uint64_t) base;
+	arena_region.valid = ASE_BUFFER_VALID;
+	snprintf(arena_region.memname, ASE_FILENAME_LEN, "/proc/%d/fd/%d",
+		 getpid(), arena_fd);
+	ase_buffer_t_to_str(&arena_region, tmp_msg);
+	mqueue_send(app2sim_alloc_tx, tmp_msg, ASE_MQ_MSGSIZE);
+	while (mqueue_recv(sim2app_alloc_rx, tmp_msg, ASE_MQ_MSGSIZE) == 0) {	/* wait */
+	}
+	ase_str_to_buffer_t(tmp_msg, &arena_region);
+	close(arena_fd);
 
-	ASE_MSG("Attempting to open a shared memory... \n");
+	if (arena_region.valid != ASE_BUFFER_VALID) {
+		ASE_MSG("Simulator could not map the workspace arena, using one shared memory file per workspace\n");
+		munmap(base, (size_t) arena_size);
+		return;
+	}
 
+	arena_free_list = (struct arena_extent_t *)
+	    ase_malloc(sizeof(struct arena_extent_t));
+	arena_free_list->offset = 0;
+	arena_free_list->size = arena_size;
+	ASE_MSG("Workspace arena of %" PRIu64 " MB, %s pages\n",
+		arena_size >> 20, hugetlb ? "2 MB" : "4 KB");
+}
 
-	// Buffer is invalid until successfully allocated
-	mem->valid = ASE_BUFFER_INVALID;
 
-	// If memory size is not set, then exit !!
-	if (mem->memsize <= 0) {
-		ASE_ERR
-		    ("Memory requested must be larger than 0 bytes... exiting...\n");
-		exit(1);
+/*
+ * Unmap the workspace arena, the simulator drops its mapping with the
+ * session
+ */
+static void arena_deinit(void)
+{
+	struct arena_extent_t *ext;
+
+	if (arena_region.valid != ASE_BUFFER_VALID)
+		return;
+
+	pthread_mutex_lock(&arena_lock);
+	arena_region.valid = ASE_BUFFER_INVALID;
+	munmap((void *) arena_region.vbase, (size_t) arena_size);
+	while (arena_free_list != NULL) {
+		ext = arena_free_list;
+		arena_free_list = ext->next;
+		free(ext);
 	}
-	// Autogenerate a memname, by defualt the first region id=0 will be
-	// called "/mmio", subsequent regions will be called strcat("/buf", id)
-	// Initially set all characters to NULL
-	memset(mem->memname, 0, sizeof(mem->memname));
-	if (mem->is_mmiomap == 1) {
-		snprintf(mem->memname, ASE_FILENAME_LEN, "/mmio.%s",
-			 tstamp_string);
-	} else if (mem->is_umas == 1) {
-		snprintf(mem->memname, ASE_FILENAME_LEN, "/umas.%s",
-			 tstamp_string);
+	pthread_mutex_unlock(&arena_lock);
+}
+
+
+/*
+ * Carve 'size' bytes out of the arena (first fit)
+ * Returns 0 and the offset, or -1 if the arena has no room
+ */
+static int arena_alloc(uint64_t size, uint64_t *offset)
+{
+	struct arena_extent_t **pp;
+	struct arena_extent_t *ext;
+	struct arena_extent_t *tail;
+	uint64_t align;
+	uint64_t start;
+	uint64_t end;
+	int ret = -1;
+
+	size = (size + arena_granule - 1) & ~(arena_granule - 1);
+	// Large workspaces start on a 2 MB boundary so THP can back them
+	align = (size >= CCI_CHUNK_SIZE) ? CCI_CHUNK_SIZE : arena_granule;
+
+	pthread_mutex_lock(&arena_lock);
+	if (arena_region.valid == ASE_BUFFER_VALID) {
+		for (pp = &arena_free_list; *pp != NULL; pp = &(*pp)->next) {
+			ext = *pp;
+			start = (ext->offset + align - 1) & ~(align - 1);
+			end = ext->offset + ext->size;
+			if (start + size > end)
+				continue;
+
+			// Keep what is left behind and in front of it
+			if (start + size < end) {
+				tail = (struct arena_extent_t *)
+				    ase_malloc(sizeof(struct arena_extent_t));
+				tail->offset = start + size;
+				tail->size = end - tail->offset;
+				tail->next = ext->next;
+				ext->next = tail;
+			}
+			if (start > ext->offset) {
+				ext->size = start - ext->offset;
+			} else {
+				*pp = ext->next;
+				free(ext);
+			}
+
+			*offset = start;
+			ret = 0;
+			break;
+		}
+	}
+	pthread_mutex_unlock(&arena_lock);
+
+	return ret;
+}
+
+
+/*
+ * Return a workspace to the arena. Its pages are dropped so the next
+ * workspace there starts zeroed, like a new shm file.
+ */
+static void arena_release(uint64_t offset, uint64_t size)
+{
+	struct arena_extent_t *prev = NULL;
+	struct arena_extent_t *next;
+	struct arena_extent_t *ext;
+	char *vaddr;
+
+	size = (size + arena_granule - 1) & ~(arena_granule - 1);
+	vaddr = (char *) arena_region.vbase + offset;
+	if (madvise(vaddr, (size_t) size, MADV_REMOVE) != 0)
+		memset(vaddr, 0, (size_t) size);
+
+	pthread_mutex_lock(&arena_lock);
+	next = arena_free_list;
+	while ((next != NULL) && (next->offset < offset)) {
+		prev = next;
+		next = next->next;
+	}
+
+	// Merge with the neighbouring free extents
+	if ((prev != NULL) && (prev->offset + prev->size == offset)) {
+		prev->size += size;
+		ext = prev;
 	} else {
-		snprintf(mem->memname, ASE_FILENAME_LEN, "/buf%d.%s",
-			 userbuf_index_count, tstamp_string);
-		userbuf_index_count++;
+		ext = (struct arena_extent_t *)
+		    ase_malloc(sizeof(struct arena_extent_t));
+		ext->offset = offset;
+		ext->size = size;
+		ext->next = next;
+		if (prev != NULL)
+			prev->next = ext;
+		else
+			arena_free_list = ext;
 	}
+	if ((next != NULL) && (ext->offset + ext->size == next->offset)) {
+		ext->size += next->size;
+		ext->next = next->next;
+		free(next);
+	}
+	pthread_mutex_unlock(&arena_lock);
+}
 
-	// Disable private memory flag
-	mem->is_privmem = 0;
+
+/*
+ * Give a workspace its own shared memory file, mapped at vbase
+ */
+static void shm_buffer_map(struct buffer_t *mem, uint64_t *suggested_vaddr)
+{
+	int fd_alloc;
 
 	// Obtain a file descriptor for the shared memory region
 	// Tue May  5 19:24:21 PDT 2015
@@ -1136,6 +1362,72 @@ void allocate_buffer(struct buffer_t *mem, uint64_t *suggested_vaddr)
 	}
 #endif
 
+	close(fd_alloc);
+}
+
+
+/*
+ * allocate_buffer: Shared memory allocation and vbase exchange
+ * Instantiate a buffer_t structure with given parameters
+ * Must be called by ASE_APP
+ */
+void allocate_buffer(struct buffer_t *mem, uint64_t *suggested_vaddr)
+{
+	FUNC_CALL_ENTRY;
+
+	// pthread_mutex_trylock (&app_lock);
+	char tmp_msg[ASE_MQ_MSGSIZE] = { 0, };
+
+
+	ASE_MSG("Attempting to open a shared memory... \n");
+
+
+	// Buffer is invalid until successfully allocated
+	mem->valid = ASE_BUFFER_INVALID;
+
+	// If memory size is not set, then exit !!
+	if (mem->memsize <= 0) {
+		ASE_ERR
+		    ("Memory requested must be larger than 0 bytes... exiting...\n");
+		exit(1);
+	}
+	// Autogenerate a memname, by defualt the first region id=0 will be
+	// called "/mmio", subsequent regions will be called strcat("/buf", id)
+	// Initially set all characters to NULL
+	memset(mem->memname, 0, sizeof(mem->memname));
+	if (mem->is_mmiomap == 1) {
+		snprintf(mem->memname, ASE_FILENAME_LEN, "/mmio.%s",
+			 tstamp_string);
+	} else if (mem->is_umas == 1) {
+		snprintf(mem->memname, ASE_FILENAME_LEN, "/umas.%s",
+			 tstamp_string);
+	} else {
+		snprintf(mem->memname, ASE_FILENAME_LEN, "/buf%d.%s",
+			 userbuf_index_count, tstamp_string);
+		userbuf_index_count++;
+	}
+
+	// Disable private memory flag
+	mem->is_privmem = 0;
+
+	// Message queue must be enabled when using DPI (else debug purposes only)
+	if (mq_exist_status == NOT_ESTABLISHED) {
+
+		ASE_MSG("Session not started --- STARTING now\n");
+
+		session_init();
+	}
+	// User workspaces come out of the arena while it has room, the
+	// simulator only needs the offset then
+	if ((mem->is_mmiomap == 0) && (mem->is_umas == 0) &&
+	    (arena_alloc(mem->memsize, &mem->arena_offset) == 0)) {
+		mem->arena = ASE_ARENA_SUBALLOC;
+		mem->vbase = arena_region.vbase + mem->arena_offset;
+	} else {
+		mem->arena = ASE_ARENA_NONE;
+		shm_buffer_map(mem, suggested_vaddr);
+	}
+
 	// Autogenerate buffer index
 	mem->index = asebuf_index_count;
 	asebuf_index_count++;
@@ -1148,13 +1440,6 @@ void allocate_buffer(struct buffer_t *mem, uint64_t *suggested_vaddr)
 	// mem->metadata = HDR_MEM_ALLOC_REQ;
 	mem->next = NULL;
 
-	// Message queue must be enabled when using DPI (else debug purposes only)
-	if (mq_exist_status == NOT_ESTABLISHED) {
-
-		ASE_MSG("Session not started --- STARTING now\n");
-
-		session_init();
-	}
 	// Form message and transmit to DPI
 	ase_buffer_t_to_str(mem, tmp_msg);
 	mqueue_send(app2sim_alloc_tx, tmp_msg, ASE_MQ_MSGSIZE);
@@ -1192,8 +1477,6 @@ void allocate_buffer(struct buffer_t *mem, uint64_t *suggested_vaddr)
 	}
 #endif
 
-	close(fd_alloc);
-
 	FUNC_CALL_EXIT;
 }
 
@@ -1220,12 +1503,16 @@ void deallocate_buffer(struct buffer_t *mem)
 	ase_str_to_buffer_t(tmp_msg, mem);
 
 	// Unmap the memory accordingly
-	ret = munmap((void *) mem->vbase, (size_t) mem->memsize);
-	if (0 != ret) {
-		BEGIN_RED_FONTCOLOR;
-		perror("munmap");
-		END_RED_FONTCOLOR;
-		exit(1);
+	if (mem->arena == ASE_ARENA_SUBALLOC) {
+		arena_release(mem->arena_offset, mem->memsize);
+	} else {
+		ret = munmap((void *) mem->vbase, (size_t) mem->memsize);
+		if (0 != ret) {
+			BEGIN_RED_FONTCOLOR;
+			perror("munmap");
+			END_RED_FONTCOLOR;
+			exit(1);
+		}
 	}
 	// Print if successful
 	ASE_MSG("SUCCESS\n");
@@ -1361,6 +1648,163 @@ uint64_t *umsg_get_address(int umsg_id)
 }
 
 
+/*
+ * UMsg doorbell
+ * Pointer stores are caught by write-protecting each UMsg page: the
+ * first store faults, the handler re-opens the page and rings the
+ * doorbell, and the watcher protects it again before reading the line.
+ * ASE_UMSG_WATCH=poll skips the protection (e.g. under a debugger) and
+ * patrols every UMSG_WATCHER_NAP_NS instead.
+ *
+ * The SIGSEGV hook is process-wide. If the application installs its own
+ * SIGSEGV handler afterwards, a store to a protected UMsg page would go
+ * to that handler instead, so the watcher checks the hook on every
+ * wakeup and falls back to polling once it has been replaced. Stores in
+ * the window before the watcher notices (at most UMSG_WATCHER_NAP_NS)
+ * still fault into the application's handler; applications that manage
+ * SIGSEGV themselves should run with ASE_UMSG_WATCH=poll.
+ */
+static struct umsg_doorbell_t *umsg_doorbell;
+static volatile int umsg_wp_active;
+static struct sigaction umsg_prev_sigsegv;
+
+
+static void umsg_doorbell_ring(void)
+{
+	__atomic_fetch_add(&umsg_doorbell->ring, 1, __ATOMIC_SEQ_CST);
+	if (__atomic_load_n(&umsg_doorbell->waiting, __ATOMIC_SEQ_CST))
+		syscall(SYS_futex, &umsg_doorbell->ring, FUTEX_WAKE, 1,
+			NULL, NULL, 0);
+}
+
+
+static void umsg_page_protect(int umsg_id, int prot)
+{
+	mprotect((char *) umas_region->vbase + umsg_id * ASE_PAGESIZE,
+		 ASE_PAGESIZE, prot);
+}
+
+
+/*
+ * SIGSEGV on a protected UMsg page marks the line written, anything
+ * else goes to the previously installed handler
+ */
+static void umsg_write_fault(int sig, siginfo_t *info, void *ctx)
+{
+	uint64_t base = (uint64_t) umas_region->vbase;
+	uint64_t addr = (uint64_t) info->si_addr;
+	int umsg_id;
+
+	if (umsg_wp_active && (addr >= base)
+	    && (addr < base + UMAS_LENGTH)) {
+		umsg_id = (addr - base) / ASE_PAGESIZE;
+		umsg_page_protect(umsg_id, PROT_READ | PROT_WRITE);
+		__atomic_fetch_or(&umsg_doorbell->written, 1u << umsg_id,
+				  __ATOMIC_SEQ_CST);
+		umsg_doorbell_ring();
+		return;
+	}
+
+	if (umsg_prev_sigsegv.sa_flags & SA_SIGINFO) {
+		umsg_prev_sigsegv.sa_sigaction(sig, info, ctx);
+	} else if ((umsg_prev_sigsegv.sa_handler == SIG_DFL)
+		   || (umsg_prev_sigsegv.sa_handler == SIG_IGN)) {
+		// Re-fault with the default action
+		signal(SIGSEGV, SIG_DFL);
+	} else {
+		umsg_prev_sigsegv.sa_handler(sig);
+	}
+}
+
+
+static void umsg_wp_setup(void)
+{
+	struct sigaction cfg;
+	char *watch_mode;
+	int cl_index;
+
+	watch_mode = getenv("ASE_UMSG_WATCH");
+	if ((watch_mode != NULL) && (strcmp(watch_mode, "poll") == 0)) {
+		ASE_MSG("UMsg watcher polling, ASE_UMSG_WATCH=poll\n");
+		return;
+	}
+
+	memset(&cfg, 0, sizeof(cfg));
+	cfg.sa_sigaction = umsg_write_fault;
+	sigemptyset(&cfg.sa_mask);
+	cfg.sa_flags = SA_SIGINFO | SA_RESTART;
+	if (sigaction(SIGSEGV, &cfg, &umsg_prev_sigsegv) != 0) {
+		ASE_ERR("UMsg SIGSEGV handler not installed, polling\n");
+		return;
+	}
+
+	umsg_wp_active = 1;
+	for (cl_index = 0; cl_index < NUM_UMSG_PER_AFU; cl_index++) {
+		if (mprotect((char *) umas_region->vbase +
+			     cl_index * ASE_PAGESIZE, ASE_PAGESIZE,
+			     PROT_READ) != 0) {
+			ASE_ERR("UMsg page protection failed, polling\n");
+			umsg_wp_release();
+			return;
+		}
+	}
+}
+
+
+/*
+ * Is umsg_write_fault still the installed SIGSEGV handler
+ */
+static int umsg_wp_hooked(void)
+{
+	struct sigaction cur;
+
+	if (sigaction(SIGSEGV, NULL, &cur) != 0)
+		return 0;
+
+	return (cur.sa_flags & SA_SIGINFO)
+	    && (cur.sa_sigaction == umsg_write_fault);
+}
+
+
+/*
+ * Drop UMsg page protection, called before the UMAS is unmapped.
+ * The previous SIGSEGV handler is put back only if ours is still the
+ * installed one, a handler the application set since is left alone.
+ */
+void umsg_wp_release(void)
+{
+	int cl_index;
+
+	if (!umsg_wp_active)
+		return;
+
+	umsg_wp_active = 0;
+	for (cl_index = 0; cl_index < NUM_UMSG_PER_AFU; cl_index++)
+		umsg_page_protect(cl_index, PROT_READ | PROT_WRITE);
+	if (umsg_wp_hooked())
+		sigaction(SIGSEGV, &umsg_prev_sigsegv, NULL);
+}
+
+
+/*
+ * Stop the UMsg watcher and wait for it to exit.
+ * The watcher only sleeps in a timed futex wait, which is not a
+ * cancellation point, so it is told to stop and woken on the doorbell
+ * rather than cancelled.
+ */
+void umsg_watcher_stop(void)
+{
+	if (!umsg_watch_running)
+		return;
+
+	__atomic_store_n(&umsg_watch_stop, 1, __ATOMIC_SEQ_CST);
+	if (umsg_doorbell != NULL)
+		umsg_doorbell_ring();
+	pthread_join(umsg_watch_tid, NULL);
+	umsg_watch_running = 0;
+}
+
+
 /*
  * umsg_send: Write data to umsg region
  */
@@ -1368,50 +1812,53 @@ void umsg_send(int umsg_id, uint64_t *umsg_data)
 {
 	ase_memcpy((char *) umsg_addr_array[umsg_id], (char *) umsg_data,
 		   sizeof(uint64_t));
+	umsg_notify(umsg_id);
 }
 
 
 /*
- * umsg_set_attribute: Set UMSG Hint setting
+ * umsg_notify: Forward a UMsg line even if its contents did not change
  */
-void umsg_set_attribute(uint32_t hint_mask)
+void umsg_notify(int umsg_id)
 {
-	char *umsg_attrib_cmd;
+	__atomic_fetch_or(&umsg_doorbell->trigger, 1u << umsg_id,
+			  __ATOMIC_SEQ_CST);
+	umsg_doorbell_ring();
+}
 
-	// Cast message
-	umsg_attrib_cmd = ase_malloc(ASE_MQ_MSGSIZE);
-	snprintf(umsg_attrib_cmd, ASE_MQ_MSGSIZE, "UMSG_MODE %d",
-		 hint_mask);
 
+/*
+ * umsg_set_attribute: Set UMSG Hint setting
+ */
+void umsg_set_attribute(uint32_t hint_mask)
+{
 	// Send transaction
-	ase_portctrl(umsg_attrib_cmd);
-
-	// Free memory
-	ase_free_buffer(umsg_attrib_cmd);
+	ase_portctrl(ASE_PORTCTRL_UMSG_MODE, hint_mask);
 }
 
 
 /*
  * Umsg watcher thread
- * Setup UMSG tracker addresses, and watch for activity
+ * Setup UMSG tracker addresses, and forward lines as the doorbell rings
  */
 void *umsg_watcher(void *arg)
 {
-	// Mark as thread that can be cancelled anytime
-	pthread_setcanceltype(PTHREAD_CANCEL_ENABLE, NULL);
-
+	// Runs until umsg_watcher_stop(), never cancelled
 	// Generic index
 	int cl_index;
 
 	// UMsg old data
 	char umsg_old_data[NUM_UMSG_PER_AFU][CL_BYTE_WIDTH];
 
-	// Declare and Allocate umsgcmd_t packet
-	umsgcmd_t *umsg_pkt;
-	umsg_pkt =
-	    (struct umsgcmd_t *) ase_malloc(sizeof(struct umsgcmd_t));
+	umsgcmd_t umsg_pkt;
+	uint32_t seen, trigger, written, line_bit;
+	int changed;
+	struct timespec nap = { 0, UMSG_WATCHER_NAP_NS };
 
-	// Patrol each UMSG line
+	umsg_doorbell = (struct umsg_doorbell_t *)
+	    ((uint64_t) umas_region->vbase + UMSG_DOORBELL_OFFSET);
+
+	// Track each UMSG line
 	for (cl_index = 0; cl_index < NUM_UMSG_PER_AFU; cl_index++) {
 		// Original copy
 		ase_memcpy((char *) umsg_old_data[cl_index],
@@ -1431,41 +1878,76 @@ void *umsg_watcher(void *arg)
 #endif
 	}
 
+	umsg_wp_setup();
+
 	// Set UMsg initialized flag
 	umas_init_flag = 1;
 
 	// While application is running
-	while (umas_exist_status == ESTABLISHED) {
-		// Walk through each line
+	while (!__atomic_load_n(&umsg_watch_stop, __ATOMIC_SEQ_CST)) {
+		if (umsg_wp_active && !umsg_wp_hooked()) {
+			ASE_ERR("SIGSEGV handler replaced, UMsg watcher polling\n");
+			umsg_wp_release();
+		}
+
+		seen = __atomic_load_n(&umsg_doorbell->ring,
+				       __ATOMIC_SEQ_CST);
+		trigger = __atomic_exchange_n(&umsg_doorbell->trigger, 0,
+					      __ATOMIC_SEQ_CST);
+		written = __atomic_exchange_n(&umsg_doorbell->written, 0,
+					      __ATOMIC_SEQ_CST);
+		if (!umsg_wp_active)
+			written = (1u << NUM_UMSG_PER_AFU) - 1;
+
 		for (cl_index = 0; cl_index < NUM_UMSG_PER_AFU; cl_index++) {
-			if (memcmp
-			    (umsg_addr_array[cl_index],
-			     umsg_old_data[cl_index],
-			     CL_BYTE_WIDTH) != 0) {
-				// Construct UMsg packet
-				umsg_pkt->id = cl_index;
-				ase_memcpy((char *) umsg_pkt->qword,
-					   (char *)
-					   umsg_addr_array[cl_index],
-					   CL_BYTE_WIDTH);
-
-				// Send UMsg
-				mqueue_send(app2sim_umsg_tx,
-					    (char *) umsg_pkt,
-					    sizeof(struct umsgcmd_t));
-
-				// Update local mirror
-				ase_memcpy((char *)
-					   umsg_old_data[cl_index],
-					   (char *) umsg_pkt->qword,
-					   CL_BYTE_WIDTH);
+			line_bit = 1u << cl_index;
+			if (((trigger | written) & line_bit) == 0)
+				continue;
+
+			changed = memcmp(umsg_addr_array[cl_index],
+					 umsg_old_data[cl_index],
+					 CL_BYTE_WIDTH);
+			if (!changed && (written & line_bit)) {
+				// Fault handler ran ahead of the store
+				sched_yield();
+				changed = memcmp(umsg_addr_array[cl_index],
+						 umsg_old_data[cl_index],
+						 CL_BYTE_WIDTH);
 			}
+
+			// Catch the next store before this one is read
+			if (umsg_wp_active && (written & line_bit))
+				umsg_page_protect(cl_index, PROT_READ);
+
+			if (!changed && ((trigger & line_bit) == 0))
+				continue;
+
+			// Construct UMsg packet
+			umsg_pkt.id = cl_index;
+			umsg_pkt.hint = 0;
+			ase_memcpy((char *) umsg_pkt.qword,
+				   (char *) umsg_addr_array[cl_index],
+				   CL_BYTE_WIDTH);
+
+			// Send UMsg
+			mqueue_send(app2sim_umsg_tx, (char *) &umsg_pkt,
+				    sizeof(struct umsgcmd_t));
+
+			// Update local mirror
+			ase_memcpy((char *) umsg_old_data[cl_index],
+				   (char *) umsg_pkt.qword, CL_BYTE_WIDTH);
 		}
-		usleep(1);
-	}
 
-	// Free memory
-	ase_free_buffer((char *) umsg_pkt);
+		// Sleep until the doorbell rings again
+		__atomic_store_n(&umsg_doorbell->waiting, 1,
+				 __ATOMIC_SEQ_CST);
+		if (__atomic_load_n(&umsg_doorbell->ring, __ATOMIC_SEQ_CST)
+		    == seen)
+			syscall(SYS_futex, &umsg_doorbell->ring, FUTEX_WAIT,
+				seen, &nap, NULL, 0);
+		__atomic_store_n(&umsg_doorbell->waiting, 0,
+				 __ATOMIC_SEQ_CST);
+	}
 
 	return 0;
 }
@@ -1474,26 +1956,25 @@ void *umsg_watcher(void *arg)
 /*
  * ase_portctrl: Send port control message to simulator
  *
- * AFU_RESET   <setting>            | (0,1)
- * UMSG_MODE   <mode_nibbles>[31:0] | (0xF0FF0FF0)
- * ASE_INIT    <dummy number>       | (X)
- * ASE_SIMKILL <dummy number>       | (X)
+ * ASE_PORTCTRL_AFU_RESET   <setting>            | (0,1)
+ * ASE_PORTCTRL_UMSG_MODE   <mode_nibbles>[31:0] | (0xF0FF0FF0)
+ * ASE_PORTCTRL_ASE_INIT    <application PID>    | (X)
+ * ASE_PORTCTRL_ASE_SIMKILL <dummy number>       | (X)
  *
  */
-void __attribute__ ((optimize("O0"))) ase_portctrl(const char *ctrl_msg)
-// void ase_portctrl(const char *ctrl_msg)
+void ase_portctrl(int cmd, int value)
 {
-	// char dummy_rxstr[ASE_MQ_MSGSIZE];
-	// memset(dummy_rxstr, 0, ASE_MQ_MSGSIZE);
-	char *dummy_rxstr;
-	dummy_rxstr = (char *) ase_malloc(ASE_MQ_MSGSIZE);
+	portctrl_cmd_t ctrl_msg;
+	portctrl_cmd_t ctrl_rsp;
+
+	ctrl_msg.cmd = cmd;
+	ctrl_msg.value = value;
 
 	// Send message
-	mqueue_send(app2sim_portctrl_req_tx, ctrl_msg, ASE_MQ_MSGSIZE);
+	mqueue_send(app2sim_portctrl_req_tx, (char *) &ctrl_msg,
+		    sizeof(portctrl_cmd_t));
 
 	// Receive message
-	mqueue_recv(sim2app_portctrl_rsp_rx, dummy_rxstr, ASE_MQ_MSGSIZE);
-
-	// Release memory
-	free(dummy_rxstr);
+	mqueue_recv(sim2app_portctrl_rsp_rx, (char *) &ctrl_rsp,
+		    sizeof(portctrl_cmd_t));
 }
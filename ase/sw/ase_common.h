@@ -75,8 +75,19 @@
 #endif
 
 #ifdef SIM_SIDE
+#ifdef ASE_REPLAY
+// Stand-alone tools (ase_replay.c, ase_dpi_bench.c) run without a simulator
+typedef uint32_t svBitVecVal;
+typedef void *svScope;
+#define svGetScope()    ((svScope) NULL)
+#define svSetScope(s)   ((void) (s))
+#else
 #include "svdpi.h"
 #endif
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#endif
 
 #ifndef SIM_SIDE
 #define APP_SIDE
@@ -106,6 +117,11 @@
 
 // Width of a cache line in bytes
 #define CL_BYTE_WIDTH        64
+
+// Address translation channels, each keeps its own last-hit workspace
+#define ASE_XLATE_CH_RD      0
+#define ASE_XLATE_CH_WR      1
+#define ASE_XLATE_CHANNELS   2
 #define SIZEOF_1GB_BYTES     ((uint64_t)pow(1024, 3))
 
 // Size of page
@@ -120,6 +136,10 @@
 #define MMIO_TID_BITWIDTH          9
 #define MMIO_TID_BITMASK           (uint32_t)(pow((uint32_t)2, MMIO_TID_BITWIDTH)-1)
 #define MMIO_MAX_OUTSTANDING       64
+// Scoreboard slot is the low bits of the TID; one bit per slot in the
+// free-slot bitmap, so MMIO_MAX_OUTSTANDING must stay 64
+#define MMIO_SLOT_BITWIDTH         6
+#define MMIO_SLOT_MASK             (MMIO_MAX_OUTSTANDING - 1)
 
 // Number of UMsgs per AFU
 #define NUM_UMSG_PER_AFU           8
@@ -128,6 +148,11 @@
 #define UMAS_LENGTH                (NUM_UMSG_PER_AFU * ASE_PAGESIZE)
 #define UMAS_REGION_MEMSIZE        (2*1024*1024)
 
+// UMsg doorbell, kept in the UMAS region right after the UMsg pages
+#define UMSG_DOORBELL_OFFSET       UMAS_LENGTH
+// Longest UMsg watcher sleep, bounds polled-mode latency
+#define UMSG_WATCHER_NAP_NS        (10*1000*1000)
+
 // User clock default
 #define DEFAULT_USR_CLK_MHZ        312.500
 #define DEFAULT_USR_CLK_TPS        (int)(1E+12/(DEFAULT_USR_CLK_MHZ*pow(1000, 2)));
@@ -257,7 +282,19 @@ char *ase_workdir_path;
 // Timestamp IPC file
 #define TSTAMP_FILENAME ".ase_timestamp"
 char tstamp_filepath[ASE_FILEPATH_LEN];
-char *glbl_session_id;
+#define ASE_SESSION_ID_LEN 32
+char glbl_session_id[ASE_SESSION_ID_LEN];
+
+/*
+ * Concurrent sessions
+ * ASE_SESSION=<key>, set for both simulator and application, moves the
+ * session's named pipes, rings, lock and timestamp files into
+ * $ASE_WORKDIR/session_<key>, so several simulator/application pairs
+ * can share one work directory. Shared memory names carry the
+ * simulator PID in the session ID.
+ */
+#define ASE_SESSION_DIRPREFIX "session_"
+#define ASE_SESSION_KEY_LEN   32
 
 // CCIP Warnings and Error stat location
 char *ccip_sniffer_file_statpath;
@@ -327,8 +364,20 @@ char *app_run_cmd;
 // Test complete separator
 #define TEST_SEPARATOR       "#####################################################"
 
-// Completed String
-char *completed_str_msg;
+/*
+ * Port control packet --
+ *   Sent on app2sim_portctrl_req, echoed back on sim2app_portctrl_rsp
+ *   once the command has completed.
+ */
+#define ASE_PORTCTRL_AFU_RESET     1	// value: reset asserted (0,1)
+#define ASE_PORTCTRL_UMSG_MODE     2	// value: hint nibbles [31:0]
+#define ASE_PORTCTRL_ASE_INIT      3	// value: application PID
+#define ASE_PORTCTRL_ASE_SIMKILL   4	// value: unused
+
+typedef struct portctrl_cmd_t {
+	int32_t cmd;
+	int32_t value;
+} portctrl_cmd_t;
 
 
 /* *******************************************************************************
@@ -348,9 +397,11 @@ struct buffer_t			//  Descriptiion                    Computed by
 	uint64_t pbase;		// SIM virtual address             |   SIM
 	uint64_t fake_paddr;	// unique low FPGA_ADDR_WIDTH addr |   SIM
 	uint64_t fake_paddr_hi;	// unique hi FPGA_ADDR_WIDTH addr  |   SIM
+	uint64_t arena_offset;	// Offset in workspace arena       |   APP
 	int32_t is_privmem;	// Flag memory as a private memory |
 	int32_t is_mmiomap;	// Flag memory as CSR map          |
 	int32_t is_umas;	// Flag memory as UMAS region      |
+	int32_t arena;		// Backing, see ASE_ARENA_*        |   APP
 	uint32_t memsize;	// Memory size                     |   APP
 	char memname[ASE_FILENAME_LEN];	// Shared memory name              | INTERNAL
 	struct buffer_t *next;
@@ -394,6 +445,19 @@ typedef struct umsgcmd_t {
 } umsgcmd_t;
 
 
+/*
+ * UMsg doorbell
+ * Writers set the line bit, then bump 'ring'; the UMsg watcher sleeps
+ * on 'ring' (futex) while 'waiting' is set.
+ */
+struct umsg_doorbell_t {
+	uint32_t ring;
+	uint32_t waiting;
+	uint32_t trigger;	// Lines to forward even if unchanged
+	uint32_t written;	// Lines stored to through the UMsg pointer
+};
+
+
 // Incoming UMSG packet (allocated in ase_init, deallocated in start_simkill_countdown)
 struct umsgcmd_t *incoming_umsg_pkt;
 
@@ -420,6 +484,22 @@ uint64_t *umsg_umas_vbase;
 #define ASE_BUFFER_VALID        0xFFFF
 #define ASE_BUFFER_INVALID      0x0
 
+/*
+ * Workspace arena
+ * The application creates one memfd per session (hugetlb backed when the
+ * pool allows, else shmem advised for THP) and maps it once; the
+ * simulator maps it once on the ASE_ARENA_REGION message, opening it
+ * through /proc/<app pid>/fd/<fd> given in memname.  Workspaces are then
+ * carved out of it locally by the application and only their offset
+ * travels with the alloc message.  MMIO and UMAS regions, and workspaces
+ * that do not fit, keep their own shm file (ASE_ARENA_NONE).
+ * ASE_ARENA_SIZE (MB, env) sizes the arena, 0 disables it.
+ */
+#define ASE_ARENA_NONE          0	// Own shm file (memname)
+#define ASE_ARENA_REGION        1	// The arena itself
+#define ASE_ARENA_SUBALLOC      2	// Workspace at arena_offset
+#define ASE_ARENA_DEFAULT_MB    1024
+
 // Buffer allocate/deallocate message headers
 #define HDR_MEM_ALLOC_REQ     0x7F7F
 #define HDR_MEM_ALLOC_REPLY   0x77FF
@@ -454,19 +534,23 @@ void ll_print_info(struct buffer_t *);
 void ll_traverse_print(void);
 void ll_append_buffer(struct buffer_t *);
 void ll_remove_buffer(struct buffer_t *);
-uint32_t check_if_physaddr_used(uint64_t);
+uint32_t check_if_physaddr_used(uint64_t, uint64_t);
 struct buffer_t *ll_search_buffer(int);
+struct buffer_t *ll_search_paddr(uint64_t);
 
 // Mem-ops functions
 int ase_recv_msg(struct buffer_t *);
 void ase_alloc_action(struct buffer_t *);
 void ase_dealloc_action(struct buffer_t *, int);
 void ase_destroy(void);
-uint64_t *ase_fakeaddr_to_vaddr(uint64_t);
+uint64_t *ase_fakeaddr_to_vaddr(uint64_t, int);
 void ase_dbg_memtest(struct buffer_t *);
 void ase_perror_teardown(void);
 void ase_empty_buffer(struct buffer_t *);
 uint64_t get_range_checked_physaddr(uint32_t);
+void ase_paddr_frames_init(void);
+void ase_paddr_frames_release(uint64_t, uint32_t);
+void ase_arena_unmap(void);
 void ase_memory_barrier(void);
 #ifdef ASE_DEBUG
 void print_mmiopkt(FILE *, char *, struct mmio_t *);
@@ -488,6 +572,7 @@ void ase_str_to_buffer_t(char *, struct buffer_t *);
 int ase_dump_to_file(struct buffer_t *, char *);
 uint64_t ase_rand64(void);
 void ase_eval_session_directory(void);
+int ase_session_path(char *, const char *);
 int ase_instance_running(void);
 void remove_spaces(char *);
 void remove_tabs(char *);
@@ -506,6 +591,10 @@ void mqueue_close(int);
 void mqueue_destroy(char *);
 void mqueue_send(int, const char *, int);
 int mqueue_recv(int, char *, int);
+void ipc_ring_create(void);
+void ipc_ring_destroy(void);
+void ipc_ring_attach(void);
+void ipc_ring_detach(void);
 
 // Timestamp functions
 void put_timestamp(void);
@@ -563,9 +652,12 @@ struct buffer_t *find_buffer_by_index(uint64_t);
 // UMSG functions
 uint64_t *umsg_get_address(int);
 void umsg_send(int, uint64_t *);
+void umsg_notify(int);
+void umsg_wp_release(void);
+void umsg_watcher_stop(void);
 void umsg_set_attribute(uint32_t);
 // Driver activity
-void ase_portctrl(const char *);
+void ase_portctrl(int, int);
 // Threaded watch processes
 void *mmio_response_watcher(void *);
 // ASE-special malloc
@@ -593,10 +685,41 @@ struct ipc_t {
 	char name[ASE_MQ_NAME_LEN];
 	char path[ASE_FILEPATH_LEN];
 	int perm_flag;
+	int fd;
 };
 struct ipc_t mq_array[ASE_MQ_INSTANCES];
 //struct ipc_t *mq_array;
 
+/*
+ * Shared memory ring transport --
+ *   One single-producer/single-consumer ring of fixed-size packets per
+ *   message queue above, all in one file mapped by simulator and
+ *   application. The simulator creates it, the application attaches at
+ *   session start (unless ASE_IPC_TRANSPORT=pipe) and the named pipes
+ *   carry the traffic whenever no application is attached.
+ */
+#define ASE_RING_FILENAME  ".ase_ipc_rings"
+#define ASE_RING_MAGIC     0x52455341	// "ASER"
+#define ASE_RING_VERSION   1
+#define ASE_RING_SLOTS     64
+// Pause-spins before a receiver sleeps on the ring futex
+#define ASE_RING_SPINS     4096
+struct ase_ring_t {
+	uint32_t head;		// next slot to fill, producer only
+	char pad0[60];
+	uint32_t tail;		// next slot to drain, consumer only
+	uint32_t waiting;	// consumer is asleep on head
+	char pad1[56];
+	char slot[ASE_RING_SLOTS][ASE_MQ_MSGSIZE];
+};
+struct ase_ring_shm_t {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t app_attached;
+	char pad[52];
+	struct ase_ring_t ring[ASE_MQ_INSTANCES];
+};
+
 
 /* ********************************************************************
  *
@@ -664,6 +787,9 @@ struct ase_cfg_t {
 	int enable_cl_view;
 	int usr_tps;
 	int phys_memory_available_gb;
+	int enable_binary_trace;
+	int enable_random_physaddr;
+	int enable_record;
 };
 struct ase_cfg_t *cfg;
 
@@ -710,6 +836,8 @@ int ase_ready(void);
 void ase_write_lock_file(void);
 int ase_listener(void);
 void ase_config_parse(char *);
+void sv2c_config_dex(const char *);
+void calc_phys_memory_ranges(void);
 
 // Simulation control function
 void register_signal(int, void *);
@@ -725,6 +853,48 @@ void rd_memline_dex(cci_pkt *pkt);
 // Write system memory line
 void wr_memline_dex(cci_pkt *pkt);
 
+// Last workspace each channel translated into (mem_model.c)
+extern struct buffer_t *xlate_last_hit[ASE_XLATE_CHANNELS];
+
+/*
+ * Cache line address translation, the channel's last workspace is
+ * checked inline so consecutive lines (mcl bursts, streams) do not
+ * leave the DPI call. Returns NOT_OK on an unallocated address.
+ */
+static inline uint64_t *ase_line_xlate(uint64_t paddr, int ch)
+{
+#ifndef ASE_DEBUG
+	struct buffer_t *buf = xlate_last_hit[ch];
+
+	if ((buf != NULL) && (paddr >= buf->fake_paddr)
+	    && (paddr < buf->fake_paddr_hi))
+		return (uint64_t *) (uintptr_t) (buf->pbase +
+						 (paddr - buf->fake_paddr));
+#endif
+	return ase_fakeaddr_to_vaddr(paddr, ch);
+}
+
+/*
+ * Copy one cache line, neither side needs to be aligned
+ */
+static inline void ase_line_copy(void *dst, const void *src)
+{
+#ifdef __SSE2__
+	__m128i x0, x1, x2, x3;
+
+	x0 = _mm_loadu_si128((const __m128i *) src);
+	x1 = _mm_loadu_si128((const __m128i *) src + 1);
+	x2 = _mm_loadu_si128((const __m128i *) src + 2);
+	x3 = _mm_loadu_si128((const __m128i *) src + 3);
+	_mm_storeu_si128((__m128i *) dst, x0);
+	_mm_storeu_si128((__m128i *) dst + 1, x1);
+	_mm_storeu_si128((__m128i *) dst + 2, x2);
+	_mm_storeu_si128((__m128i *) dst + 3, x3);
+#else
+	memcpy(dst, src, CL_BYTE_WIDTH);
+#endif
+}
+
 // Seed Dex
 uint32_t get_ase_seed(void);
 
@@ -743,6 +913,18 @@ void ase_interrupt_generator(int id);
 // Buffer message injection
 void buffer_msg_inject(int, char *);
 
+// Binary transaction trace (ase_trace.c)
+int ase_trace_open(const char *);
+void ase_trace_close(void);
+void ase_trace_post(int, long long, int, int, int, int, long long, int,
+		    const svBitVecVal *);
+void ase_trace_msg(long long, int, const char *);
+
+// Session recording for ase_replay (ase_record.c)
+int ase_record_open(const char *);
+void ase_record_close(void);
+void ase_record_post(int, uint32_t, uint64_t, uint64_t, const void *, int);
+
 // Count error flag dex
 extern int count_error_flag_ping(void);
 void count_error_flag_pong(int);
@@ -796,6 +978,105 @@ FILE *fp_memaccess_log;		// = (FILE *)NULL;
 FILE *fp_pagetable_log;		// = (FILE *)NULL;
 #endif
 
+/*
+ * Binary transaction trace
+ * File is an ase_trace_file_t header followed by ase_trace_rec_t
+ * records, each trailed by 'len' payload bytes padded to 8 bytes.
+ * Payloads are little-endian (data[7:0] first). Kind codes are
+ * mirrored in ccip_logger.sv and scripts/ase_trace_decode.py.
+ */
+#define ASE_TRACE_FILENAME      "ccip_transactions.trc"
+#define ASE_TRACE_MAGIC         "ASETRACE"
+#define ASE_TRACE_VERSION       1
+#define ASE_TRACE_RING_SIZE     (4*1024*1024)
+#define ASE_TRACE_FLUSH_MS      100
+
+#define ASE_TRACE_SOFTRESET     1
+#define ASE_TRACE_C0ALMFULL     2
+#define ASE_TRACE_C1ALMFULL     3
+#define ASE_TRACE_MSG           4
+#define ASE_TRACE_MMIOWRREQ     5
+#define ASE_TRACE_MMIORDREQ     6
+#define ASE_TRACE_RDRSP         7
+#define ASE_TRACE_UMSGHINT      8
+#define ASE_TRACE_UMSGDATA      9
+#define ASE_TRACE_WRRSP         10
+#define ASE_TRACE_WRFENCERSP    11
+#define ASE_TRACE_INTRRSP       12
+#define ASE_TRACE_RDREQ         13
+#define ASE_TRACE_WRREQ         14
+#define ASE_TRACE_WRFENCE       15
+#define ASE_TRACE_INTRREQ       16
+#define ASE_TRACE_MMIORDRSP     17
+
+struct ase_trace_file_t {
+	char magic[8];
+	uint32_t version;
+	uint32_t rec_size;	// sizeof(struct ase_trace_rec_t)
+};
+
+struct ase_trace_rec_t {
+	uint64_t tstamp;	// Simulation $time
+	uint64_t addr;		// Line or MMIO address
+	uint32_t meta;		// mdata, tid or id
+	uint8_t kind;		// ASE_TRACE_*
+	uint8_t vc;		// VC selected/used
+	uint8_t type;		// Req/Rsp type, old value on toggles
+	uint8_t cl;		// Length code, new value on toggles
+	uint16_t len;		// Payload bytes
+	uint16_t rsvd[3];
+};
+
+/*
+ * CCI-P session recording
+ * File is an ase_record_file_t header followed by ase_record_t
+ * entries, each trailed by 'len' payload bytes padded to 8 bytes.
+ * Timestamps are host nanoseconds since the recording was opened.
+ *
+ * Kind      | meta   | addr        | value   | payload
+ * ----------+--------+-------------+---------+-----------------
+ * PORTCTRL  | cmd    | -           | value   | -
+ * ALLOC     | index  | fake_paddr  | memsize | -
+ * DEALLOC   | index  | -           | -       | -
+ * MMIOREQ   | tid    | offset      | -       | struct mmio_t
+ * UMSG      | id     | -           | -       | struct umsgcmd_t
+ * MMIORSP   | tid    | offset      | -       | struct mmio_t
+ * MEMRD     | -      | phys addr   | -       | line data
+ * MEMWR     | -      | phys addr   | -       | line data
+ * INTR      | id     | -           | -       | -
+ */
+#define ASE_RECORD_FILENAME     "ase_session.rec"
+#define ASE_RECORD_MAGIC        "ASERECRD"
+#define ASE_RECORD_VERSION      1
+#define ASE_RECORD_BUFSIZE      (1024*1024)
+
+// Application to simulator
+#define ASE_RECORD_PORTCTRL     1
+#define ASE_RECORD_ALLOC        2
+#define ASE_RECORD_DEALLOC      3
+#define ASE_RECORD_MMIOREQ      4
+#define ASE_RECORD_UMSG         5
+// Simulator to application
+#define ASE_RECORD_MMIORSP      6
+#define ASE_RECORD_MEMRD        7
+#define ASE_RECORD_MEMWR        8
+#define ASE_RECORD_INTR         9
+
+struct ase_record_file_t {
+	char magic[8];
+	uint32_t version;
+	uint32_t rec_size;	// sizeof(struct ase_record_t)
+};
+
+struct ase_record_t {
+	uint64_t tstamp;
+	uint64_t addr;
+	uint64_t value;
+	uint32_t meta;
+	uint16_t kind;		// ASE_RECORD_*
+	uint16_t len;		// Payload bytes
+};
+
 // Physical address mask - used to constrain generated addresses
 uint64_t PHYS_ADDR_PREFIX_MASK;
 
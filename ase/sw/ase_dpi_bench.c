@@ -0,0 +1,244 @@
+// Copyright(c) 2014-2017, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+// **************************************************************************
+/*
+ * Module Info: DPI data exchange microbenchmark
+ * - Stand-alone program timing the C side of the per-line memory DPI
+ *   calls (rd_memline_dex, wr_memline_dex), no simulator or
+ *   application involved, so host overhead can be tracked over time
+ * - Workspaces are anonymous memory entered in the workspace list the
+ *   way ase_alloc_action does
+ * - Patterns:
+ *   stream  : consecutive lines of one workspace
+ *   mcl4    : 4-line bursts, each burst in the next workspace
+ *   scatter : every line in the next workspace (translation misses)
+ * - Built with SIM_SIDE and ASE_REPLAY set, like ase_replay
+ *
+ * Usage: ase_dpi_bench [-n <lines>] [-w <workspaces>] [-s <workspace KB>]
+ */
+
+#include "ase_common.h"
+#include <getopt.h>
+
+#define BENCH_STREAM   0
+#define BENCH_MCL4     1
+#define BENCH_SCATTER  2
+
+static struct buffer_t **bench_bufs;
+static int bench_num_bufs;
+static uint64_t bench_buf_size;
+
+
+static uint64_t bench_now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+
+/*
+ * Register workspaces with the memory model, no IPC
+ */
+static void bench_setup(void)
+{
+	struct buffer_t *buf;
+	uint64_t span;
+	int ii;
+
+	// Room for every workspace's 2 MB frames plus reserved frame 0
+	span = (bench_buf_size + CCI_CHUNK_SIZE - 1) &
+	    ~(uint64_t) (CCI_CHUNK_SIZE - 1);
+	span = span * bench_num_bufs + CCI_CHUNK_SIZE;
+	cfg = (struct ase_cfg_t *) ase_malloc(sizeof(struct ase_cfg_t));
+	cfg->phys_memory_available_gb = (int) ((span >> 30) + 1);
+	calc_phys_memory_ranges();
+
+	bench_bufs = (struct buffer_t **)
+	    ase_malloc(bench_num_bufs * sizeof(struct buffer_t *));
+	for (ii = 0; ii < bench_num_bufs; ii++) {
+		buf = (struct buffer_t *) ase_malloc(BUFSIZE);
+		buf->index = ii + 2;
+		buf->memsize = (uint32_t) bench_buf_size;
+		buf->pbase = (uint64_t) (uintptr_t)
+		    mmap(NULL, bench_buf_size, PROT_READ | PROT_WRITE,
+			 MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+		if (buf->pbase == (uint64_t) (uintptr_t) MAP_FAILED) {
+			ASE_ERR("Workspace %d not mapped, %s\n", ii,
+				strerror(errno));
+			exit(1);
+		}
+		buf->fake_paddr = get_range_checked_physaddr(buf->memsize);
+		buf->fake_paddr_hi = buf->fake_paddr + buf->memsize;
+		buf->valid = ASE_BUFFER_VALID;
+		snprintf(buf->memname, ASE_FILENAME_LEN, "/bench%d", ii);
+		ll_append_buffer(buf);
+		bench_bufs[ii] = buf;
+	}
+}
+
+
+static void bench_run(const char *name, int pattern, int write,
+		      uint64_t lines)
+{
+	uint64_t lines_per_buf = bench_buf_size / CL_BYTE_WIDTH;
+	uint64_t ii, burst, line, start, elapsed;
+	int bi;
+	cci_pkt pkt;
+
+	memset(&pkt, 0, sizeof(pkt));
+	pkt.mode = write ? CCIPKT_WRITE_MODE : CCIPKT_READ_MODE;
+
+	start = bench_now_ns();
+	for (ii = 0; ii < lines; ii++) {
+		switch (pattern) {
+		case BENCH_MCL4:
+			burst = ii >> 2;
+			bi = burst % bench_num_bufs;
+			line = ((burst / bench_num_bufs) * 4 + (ii & 3))
+			    % lines_per_buf;
+			break;
+		case BENCH_SCATTER:
+			bi = ii % bench_num_bufs;
+			line = (ii / bench_num_bufs) % lines_per_buf;
+			break;
+		default:
+			bi = 0;
+			line = ii % lines_per_buf;
+			break;
+		}
+		pkt.cl_addr = (long long) ((bench_bufs[bi]->fake_paddr >> 6)
+					   + line);
+		pkt.qword[0] = (long long) ii;
+		if (write)
+			wr_memline_dex(&pkt);
+		else
+			rd_memline_dex(&pkt);
+	}
+	elapsed = bench_now_ns() - start;
+
+	ASE_INFO("%-8s %-5s %8.2f ns/line %8.2f GB/s\n", name,
+		 write ? "write" : "read", (double) elapsed / lines,
+		 (double) lines * CL_BYTE_WIDTH / elapsed);
+}
+
+
+/*
+ * Tasks exported by ccip_emulator.sv
+ */
+void ase_config_dex(struct ase_cfg_t *cfg_in)
+{
+}
+
+
+void mmio_dispatch(int init, struct mmio_t *mmio_pkt)
+{
+}
+
+
+void umsg_dispatch(int init, struct umsgcmd_t *umsg_pkt)
+{
+}
+
+
+void afu_softreset_trig(int init, int value)
+{
+}
+
+
+void ase_reset_trig(void)
+{
+}
+
+
+void run_clocks(int num_clocks)
+{
+}
+
+
+void buffer_msg_inject(int logger, char *str)
+{
+}
+
+
+int count_error_flag_ping(void)
+{
+	return 0;
+}
+
+
+void simkill(void)
+{
+	exit(1);
+}
+
+
+int main(int argc, char **argv)
+{
+	uint64_t lines = 10000000;
+	int opt;
+
+	bench_num_bufs = 8;
+	bench_buf_size = 4 << 20;
+	while ((opt = getopt(argc, argv, "n:w:s:h")) != -1) {
+		switch (opt) {
+		case 'n':
+			lines = strtoull(optarg, NULL, 0);
+			break;
+		case 'w':
+			bench_num_bufs = atoi(optarg);
+			break;
+		case 's':
+			bench_buf_size = strtoull(optarg, NULL, 0) << 10;
+			break;
+		default:
+			printf("Usage: %s [-n <lines>] [-w <workspaces>] [-s <workspace KB>]\n",
+			       argv[0]);
+			return (opt == 'h') ? 0 : 1;
+		}
+	}
+	bench_buf_size &= ~(uint64_t) (ASE_PAGESIZE - 1);
+	if ((lines == 0) || (bench_num_bufs <= 0) ||
+	    (bench_buf_size == 0) || (bench_buf_size > UINT32_MAX)) {
+		ASE_ERR("Need at least one line, one workspace and a 4 KB to 4 GB workspace\n");
+		return 1;
+	}
+
+	glbl_loglevel = ase_calc_loglevel();
+	bench_setup();
+	ASE_INFO("%" PRIu64 " lines, %d workspaces of %" PRIu64 " KB\n",
+		 lines, bench_num_bufs, bench_buf_size >> 10);
+
+	bench_run("stream", BENCH_STREAM, 0, lines);
+	bench_run("stream", BENCH_STREAM, 1, lines);
+	bench_run("mcl4", BENCH_MCL4, 0, lines);
+	bench_run("mcl4", BENCH_MCL4, 1, lines);
+	bench_run("scatter", BENCH_SCATTER, 0, lines);
+	bench_run("scatter", BENCH_SCATTER, 1, lines);
+
+	return 0;
+}
@@ -175,47 +175,113 @@ void ase_memory_barrier(void)
 }
 
 
+/*
+ * Session directory for base work directory, keyed by env(ASE_SESSION)
+ * - Without ASE_SESSION the work directory itself is used
+ * - A base that already is the session directory is kept as is, so
+ *   the application may point ASE_WORKDIR at it directly
+ * Returns 0, or -1 if ASE_SESSION is not a usable key
+ */
+int ase_session_path(char *path, const char *base)
+{
+	const char *key;
+	const char *leaf;
+	char dirname[ASE_SESSION_KEY_LEN + sizeof(ASE_SESSION_DIRPREFIX)];
+	size_t i, len;
+
+	key = getenv("ASE_SESSION");
+	if ((key == NULL) || (key[0] == '\0')) {
+		ase_string_copy(path, base, ASE_FILEPATH_LEN);
+		return 0;
+	}
+
+	len = strlen(key);
+	if (len > ASE_SESSION_KEY_LEN) {
+		ASE_ERR("env(ASE_SESSION) is longer than %d characters\n",
+			ASE_SESSION_KEY_LEN);
+		return -1;
+	}
+	for (i = 0; i < len; i++) {
+		if (!isalnum((unsigned char) key[i]) && (key[i] != '_')
+		    && (key[i] != '-')) {
+			ASE_ERR
+			    ("env(ASE_SESSION) may only use [A-Za-z0-9_-]\n");
+			return -1;
+		}
+	}
+
+	snprintf(dirname, sizeof(dirname), "%s%s", ASE_SESSION_DIRPREFIX,
+		 key);
+	leaf = strrchr(base, '/');
+	leaf = (leaf == NULL) ? base : leaf + 1;
+	if (strcmp(leaf, dirname) == 0)
+		ase_string_copy(path, base, ASE_FILEPATH_LEN);
+	else
+		snprintf(path, ASE_FILEPATH_LEN, "%s/%s", base, dirname);
+
+	return 0;
+}
+
+
 /*
  * Evaluate Session directory
- * If SIM_SIDE is set, Return "$ASE_WORKDIR/work/"
- *               else, Return "$PWD/work/"
+ * If SIM_SIDE is set, Return "$PWD[/session_<key>]", created if needed
+ *               else, Return "$ASE_WORKDIR[/session_<key>]"
  *               Both must be the same location
  *
  * PROCEDURE:
  * - Check if PWD/ASE_WORKDIR exists:
  *   - Most cases, it will exist, created by Makefile
- *     - Check if "work" directory already exists, if not create one
  *   - If not Error out
+ * - With env(ASE_SESSION) set, append the session directory
  */
 void ase_eval_session_directory(void)
 {
 	FUNC_CALL_ENTRY;
 
-	// ase_workdir_path = ase_malloc (ASE_FILEPATH_LEN);
+	char *base;
 
 	// Evaluate location of simulator or own location
 #ifdef SIM_SIDE
-	ase_workdir_path = getenv("PWD");
+	base = getenv("PWD");
+	if ((base == NULL)
+	    || (ase_session_path(ase_workdir_path, base) != 0)) {
+		ASE_ERR("Session directory could not be evaluated\n");
+		start_simkill_countdown();
+		return;
+	}
+
+	// Simulator owns the session directory
+	if ((mkdir(ase_workdir_path, 0755) != 0) && (errno != EEXIST)) {
+		ase_error_report("mkdir", errno, ASE_OS_FOPEN_ERR);
+		start_simkill_countdown();
+	}
 #else
-	ase_workdir_path = getenv("ASE_WORKDIR");
+	base = getenv("ASE_WORKDIR");
 
 #ifdef ASE_DEBUG
-	ASE_DBG("env(ASE_WORKDIR) = %s\n", ase_workdir_path);
+	ASE_DBG("env(ASE_WORKDIR) = %s\n", base);
 #endif
 
-	if (ase_workdir_path == NULL) {
+	if (base == NULL) {
 		ASE_ERR
 		    ("**ERROR** Environment variable ASE_WORKDIR could not be evaluated !!\n");
 		ASE_ERR("**ERROR** ASE will exit now !!\n");
 		perror("getenv");
 		exit(1);
+	} else if (ase_session_path(ase_workdir_path, base) != 0) {
+		ASE_ERR("**ERROR** ASE will exit now !!\n");
+		exit(1);
 	} else {
 		// Check if directory exists here
 		DIR *ase_dir;
 		ase_dir = opendir(ase_workdir_path);
 		if (!ase_dir) {
 			ASE_ERR
-			    ("ASE workdir path pointed by env(ASE_WORKDIR) does not exist !\n");
+			    ("ASE workdir path %s does not exist !\n",
+			     ase_workdir_path);
+			ASE_ERR
+			    ("Check env(ASE_WORKDIR) and env(ASE_SESSION) match the simulator\n");
 			ASE_ERR("Cannot continue execution... exiting !");
 			perror("opendir");
 			exit(1);
@@ -224,6 +290,8 @@ void ase_eval_session_directory(void)
 		}
 	}
 #endif
+
+	FUNC_CALL_EXIT;
 }
 
 
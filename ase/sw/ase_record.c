@@ -0,0 +1,117 @@
+// Copyright(c) 2014-2017, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+// **************************************************************************
+/*
+ * Module Info: CCI-P session recorder
+ * - Captures what crosses the protocol backend (port control, buffer
+ *   allocation, MMIO, UMsg, memory lines, interrupts) so a session can
+ *   be replayed against the application without the simulator
+ * - Only ever called from the simulator thread, stdio buffering is
+ *   enough to keep it off the memory line path
+ * - Replay with ase_replay (make replay)
+ */
+
+#include "ase_common.h"
+
+static FILE *record_fp;
+static char *record_buf;
+static struct timespec record_t0;
+
+
+/*
+ * Open recording file and write header
+ */
+int ase_record_open(const char *filename)
+{
+	struct ase_record_file_t hdr;
+
+	record_fp = fopen(filename, "wb");
+	if (record_fp == NULL) {
+		ASE_ERR("Could not open session recording %s, %s\n",
+			filename, strerror(errno));
+		return -1;
+	}
+
+	record_buf = ase_malloc(ASE_RECORD_BUFSIZE);
+	setvbuf(record_fp, record_buf, _IOFBF, ASE_RECORD_BUFSIZE);
+
+	memset(&hdr, 0, sizeof(hdr));
+	memcpy(hdr.magic, ASE_RECORD_MAGIC, sizeof(hdr.magic));
+	hdr.version = ASE_RECORD_VERSION;
+	hdr.rec_size = sizeof(struct ase_record_t);
+	fwrite(&hdr, sizeof(hdr), 1, record_fp);
+
+	clock_gettime(CLOCK_MONOTONIC, &record_t0);
+	return 0;
+}
+
+
+/*
+ * Flush and close recording
+ */
+void ase_record_close(void)
+{
+	if (record_fp == NULL)
+		return;
+
+	if (fclose(record_fp) != 0)
+		ASE_ERR("Session recording could not be completed, %s\n",
+			strerror(errno));
+	record_fp = NULL;
+	ase_free_buffer(record_buf);
+	record_buf = NULL;
+}
+
+
+/*
+ * Append one event, see ase_common.h for the field usage per kind
+ */
+void ase_record_post(int kind, uint32_t meta, uint64_t addr,
+		     uint64_t value, const void *data, int len)
+{
+	struct ase_record_t rec;
+	struct timespec now;
+	static const char pad[8];
+
+	if (record_fp == NULL)
+		return;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	rec.tstamp = (uint64_t) (now.tv_sec - record_t0.tv_sec) * 1000000000ULL
+	    + now.tv_nsec - record_t0.tv_nsec;
+	rec.addr = addr;
+	rec.value = value;
+	rec.meta = meta;
+	rec.kind = (uint16_t) kind;
+	rec.len = (uint16_t) len;
+
+	fwrite(&rec, sizeof(rec), 1, record_fp);
+	if (len) {
+		fwrite(data, len, 1, record_fp);
+		if (len % 8)
+			fwrite(pad, 8 - len % 8, 1, record_fp);
+	}
+}
@@ -0,0 +1,623 @@
+// Copyright(c) 2014-2017, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+// **************************************************************************
+/*
+ * Module Info: CCI-P session replay
+ * - Stand-alone program that takes the simulator's place: the
+ *   application connects as usual (ASE_WORKDIR), the AFU side comes
+ *   from a session recorded with ENABLE_RECORD = 1
+ * - Application requests are matched in order against the recording,
+ *   MMIO responses, memory reads/writes and interrupts are played back
+ * - Recorded think time between events is kept, -f (fast-forward)
+ *   drops it so host software can be regression tested and profiled
+ * - Built with SIM_SIDE and ASE_REPLAY set, the tasks exported by
+ *   ccip_emulator.sv are provided here
+ *
+ * Usage: ase_replay [-f] [-t <idle seconds>] [-c <ase.cfg>] <recording>
+ */
+
+#include "ase_common.h"
+#include <getopt.h>
+
+#define REPLAY_LIVE_DEPTH     256
+#define REPLAY_MAX_BUFFERS    1024
+#define REPLAY_TID_SLOTS      64
+#define REPLAY_POLL_NS        10000
+#define REPLAY_ERR_SHOWN      16
+
+// Application event as seen by the protocol backend
+struct replay_live_t {
+	int kind;
+	uint32_t meta;
+	uint64_t addr;
+	uint64_t value;
+	union {
+		mmio_t mmio;
+		umsgcmd_t umsg;
+	} pkt;
+};
+
+// Recorded workspace and where the live application got it
+struct replay_buf_t {
+	uint32_t rec_index;
+	uint64_t rec_paddr;
+	uint64_t live_paddr;
+	uint64_t size;
+};
+
+static struct replay_live_t live_q[REPLAY_LIVE_DEPTH];
+static uint32_t live_head, live_tail;
+
+static struct replay_buf_t replay_bufs[REPLAY_MAX_BUFFERS];
+static int replay_num_bufs;
+
+static struct {
+	int32_t rec_tid;
+	int32_t live_tid;
+	int valid;
+} replay_tids[REPLAY_TID_SLOTS];
+
+static int replay_fast_forward;
+static int replay_idle_sec = 60;
+static volatile int replay_done;
+
+static uint64_t replay_events;
+static uint64_t replay_mismatches;
+static uint64_t replay_rd_mismatches;
+static uint64_t replay_unmapped;
+
+// Session span, from the first application request
+static uint64_t replay_rec_first, replay_rec_last;
+static uint64_t replay_live_first, replay_live_last;
+
+
+static uint64_t replay_now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+
+static void replay_nap(uint64_t ns)
+{
+	struct timespec ts;
+
+	ts.tv_sec = ns / 1000000000ULL;
+	ts.tv_nsec = ns % 1000000000ULL;
+	nanosleep(&ts, NULL);
+}
+
+
+static const char *replay_kind_name(int kind)
+{
+	switch (kind) {
+	case ASE_RECORD_PORTCTRL:
+		return "PORTCTRL";
+	case ASE_RECORD_ALLOC:
+		return "ALLOC";
+	case ASE_RECORD_DEALLOC:
+		return "DEALLOC";
+	case ASE_RECORD_MMIOREQ:
+		return "MMIOREQ";
+	case ASE_RECORD_UMSG:
+		return "UMSG";
+	case ASE_RECORD_MMIORSP:
+		return "MMIORSP";
+	case ASE_RECORD_MEMRD:
+		return "MEMRD";
+	case ASE_RECORD_MEMWR:
+		return "MEMWR";
+	case ASE_RECORD_INTR:
+		return "INTR";
+	default:
+		return "UNKNOWN";
+	}
+}
+
+
+/*
+ * Report a divergence from the recording, first few in detail
+ */
+static void replay_mismatch(const struct ase_record_t *rec,
+			    const char *what)
+{
+	replay_mismatches++;
+	if (replay_mismatches <= REPLAY_ERR_SHOWN)
+		ASE_ERR("Replay @%" PRIu64 " ns, %s %s\n", rec->tstamp,
+			replay_kind_name(rec->kind), what);
+	if (replay_mismatches == REPLAY_ERR_SHOWN)
+		ASE_ERR("Further mismatches are only counted\n");
+}
+
+
+/*
+ * Protocol backend hook: in replay, the recorder is where application
+ * events are picked up. Simulator side events come from the recording
+ * itself and are dropped.
+ */
+int ase_record_open(const char *filename)
+{
+	return -1;
+}
+
+
+void ase_record_close(void)
+{
+}
+
+
+void ase_record_post(int kind, uint32_t meta, uint64_t addr,
+		     uint64_t value, const void *data, int len)
+{
+	struct replay_live_t *ev;
+
+	if (kind >= ASE_RECORD_MMIORSP)
+		return;
+
+	if (live_head - live_tail == REPLAY_LIVE_DEPTH) {
+		ASE_ERR("Replay event queue overflow, %s dropped\n",
+			replay_kind_name(kind));
+		return;
+	}
+
+	ev = &live_q[live_head % REPLAY_LIVE_DEPTH];
+	ev->kind = kind;
+	ev->meta = meta;
+	ev->addr = addr;
+	ev->value = value;
+	if (len > (int) sizeof(ev->pkt))
+		len = sizeof(ev->pkt);
+	if (len)
+		memcpy(&ev->pkt, data, len);
+	live_head++;
+}
+
+
+/*
+ * Run the protocol backend once, unless enough events are waiting
+ */
+static void replay_pump(void)
+{
+	if (!replay_done && (live_head - live_tail < REPLAY_LIVE_DEPTH - 8))
+		ase_listener();
+}
+
+
+/*
+ * Wait for the next application event, NULL on idle timeout
+ */
+static struct replay_live_t *replay_live_next(void)
+{
+	uint64_t deadline =
+	    replay_now_ns() + (uint64_t) replay_idle_sec * 1000000000ULL;
+
+	while (live_head == live_tail) {
+		if (replay_done)
+			return NULL;
+		ase_listener();
+		if (live_head != live_tail)
+			break;
+		if (replay_now_ns() > deadline)
+			return NULL;
+		replay_nap(REPLAY_POLL_NS);
+	}
+
+	return &live_q[live_tail++ % REPLAY_LIVE_DEPTH];
+}
+
+
+/*
+ * Recorded physical address to the live one, 0 if no workspace
+ */
+static uint64_t replay_xlate(uint64_t rec_paddr)
+{
+	int i;
+
+	for (i = 0; i < replay_num_bufs; i++) {
+		if ((rec_paddr >= replay_bufs[i].rec_paddr) &&
+		    (rec_paddr <
+		     replay_bufs[i].rec_paddr + replay_bufs[i].size))
+			return replay_bufs[i].live_paddr + (rec_paddr -
+							     replay_bufs[i].
+							     rec_paddr);
+	}
+	return 0;
+}
+
+
+/*
+ * Workspace addresses handed to the AFU (byte or line) are expected
+ * to differ between runs, compare them through the workspace table
+ */
+static int replay_same_addr(uint64_t rec_val, uint64_t live_val)
+{
+	uint64_t paddr;
+
+	paddr = replay_xlate(rec_val);
+	if ((paddr != 0) && (paddr == live_val))
+		return 1;
+
+	paddr = replay_xlate(rec_val << 6);
+	return (paddr != 0) && ((paddr >> 6) == live_val);
+}
+
+
+/*
+ * Compare an application event with the recording, keep the state
+ * needed to play back the responses
+ */
+static void replay_match(const struct ase_record_t *rec,
+			 const void *payload, struct replay_live_t *ev)
+{
+	const mmio_t *rec_mmio;
+	const umsgcmd_t *rec_umsg;
+	int slot, i, nbytes;
+
+	if (ev->kind != rec->kind) {
+		replay_mismatch(rec, "expected, application sent a different request");
+		return;
+	}
+
+	switch (rec->kind) {
+	case ASE_RECORD_PORTCTRL:
+		// ASE_INIT carries the application PID
+		if ((ev->meta != rec->meta) ||
+		    ((rec->meta != ASE_PORTCTRL_ASE_INIT) &&
+		     (ev->value != rec->value)))
+			replay_mismatch(rec, "command differs");
+		break;
+
+	case ASE_RECORD_ALLOC:
+		if (ev->value != rec->value)
+			replay_mismatch(rec, "size differs");
+		if (replay_num_bufs == REPLAY_MAX_BUFFERS) {
+			replay_mismatch(rec, "exceeds replay workspace table");
+			break;
+		}
+		replay_bufs[replay_num_bufs].rec_index = rec->meta;
+		replay_bufs[replay_num_bufs].rec_paddr = rec->addr;
+		replay_bufs[replay_num_bufs].live_paddr = ev->addr;
+		replay_bufs[replay_num_bufs].size = rec->value;
+		replay_num_bufs++;
+		break;
+
+	case ASE_RECORD_DEALLOC:
+		for (i = 0; i < replay_num_bufs; i++) {
+			if (replay_bufs[i].rec_index == rec->meta) {
+				replay_bufs[i] =
+				    replay_bufs[--replay_num_bufs];
+				break;
+			}
+		}
+		break;
+
+	case ASE_RECORD_MMIOREQ:
+		rec_mmio = payload;
+		nbytes = (rec_mmio->width == MMIO_WIDTH_32) ? 4 :
+		    (rec_mmio->width == MMIO_WIDTH_64) ? 8 :
+		    sizeof(rec_mmio->qword);
+		if ((ev->pkt.mmio.write_en != rec_mmio->write_en) ||
+		    (ev->pkt.mmio.width != rec_mmio->width) ||
+		    (ev->pkt.mmio.addr != rec_mmio->addr)) {
+			replay_mismatch(rec, "address or type differs");
+		} else if ((rec_mmio->write_en == MMIO_WRITE_REQ) &&
+			   memcmp(ev->pkt.mmio.qword, rec_mmio->qword,
+				  nbytes) &&
+			   !replay_same_addr(rec_mmio->qword[0],
+					     ev->pkt.mmio.qword[0])) {
+			replay_mismatch(rec, "write data differs");
+		}
+		// Responses (writes are acknowledged too) go back under
+		// the live TID
+		slot = rec_mmio->tid % REPLAY_TID_SLOTS;
+		replay_tids[slot].rec_tid = rec_mmio->tid;
+		replay_tids[slot].live_tid = ev->pkt.mmio.tid;
+		replay_tids[slot].valid = 1;
+		break;
+
+	case ASE_RECORD_UMSG:
+		rec_umsg = payload;
+		if ((ev->pkt.umsg.id != rec_umsg->id) ||
+		    memcmp(ev->pkt.umsg.qword, rec_umsg->qword,
+			   sizeof(rec_umsg->qword)))
+			replay_mismatch(rec, "id or data differs");
+		break;
+	}
+}
+
+
+/*
+ * Play back one simulator side event
+ */
+static void replay_perform(const struct ase_record_t *rec,
+			   const void *payload)
+{
+	mmio_t mmio_pkt;
+	cci_pkt pkt;
+	uint64_t paddr;
+	int slot;
+
+	switch (rec->kind) {
+	case ASE_RECORD_MMIORSP:
+		ase_memcpy(&mmio_pkt, payload, sizeof(mmio_t));
+		slot = mmio_pkt.tid % REPLAY_TID_SLOTS;
+		if (!replay_tids[slot].valid ||
+		    (replay_tids[slot].rec_tid != mmio_pkt.tid)) {
+			replay_mismatch(rec, "has no matching request");
+			break;
+		}
+		replay_tids[slot].valid = 0;
+		mmio_pkt.tid = replay_tids[slot].live_tid;
+		mmio_response(&mmio_pkt);
+		break;
+
+	case ASE_RECORD_MEMWR:
+	case ASE_RECORD_MEMRD:
+		paddr = replay_xlate(rec->addr);
+		if (paddr == 0) {
+			replay_unmapped++;
+			replay_mismatch(rec, "address is not in a workspace");
+			break;
+		}
+		memset(&pkt, 0, sizeof(pkt));
+		pkt.cl_addr = paddr >> 6;
+		if (rec->kind == ASE_RECORD_MEMWR) {
+			pkt.mode = CCIPKT_WRITE_MODE;
+			ase_memcpy(pkt.qword, payload, CL_BYTE_WIDTH);
+			wr_memline_dex(&pkt);
+		} else {
+			// Host software wrote something else than it did
+			// when the session was recorded
+			pkt.mode = CCIPKT_READ_MODE;
+			rd_memline_dex(&pkt);
+			if (memcmp(pkt.qword, payload, CL_BYTE_WIDTH)) {
+				replay_rd_mismatches++;
+				if (replay_rd_mismatches <= REPLAY_ERR_SHOWN)
+					ASE_INFO_2
+					    ("Replay @%" PRIu64
+					     " ns, read of 0x%" PRIx64
+					     " returned different data\n",
+					     rec->tstamp, rec->addr);
+			}
+		}
+		break;
+
+	case ASE_RECORD_INTR:
+		ase_interrupt_generator(rec->meta);
+		break;
+	}
+}
+
+
+/*
+ * Walk the recording
+ */
+static void replay_run(const char *base, size_t size)
+{
+	const struct ase_record_t *rec;
+	struct replay_live_t *ev;
+	const char *payload;
+	size_t off = sizeof(struct ase_record_file_t);
+	uint64_t rec_anchor = 0;
+	uint64_t live_anchor = replay_now_ns();
+	uint64_t target, now;
+
+	while (!replay_done && (off + sizeof(*rec) <= size)) {
+		rec = (const struct ase_record_t *) (base + off);
+		payload = base + off + sizeof(*rec);
+		off += sizeof(*rec) + ((rec->len + 7) & ~7);
+		if (off > size) {
+			ASE_ERR("Recording is truncated\n");
+			break;
+		}
+		replay_events++;
+
+		if (rec->kind < ASE_RECORD_MMIORSP) {
+			ev = replay_live_next();
+			if (ev == NULL) {
+				if (!replay_done) {
+					ASE_ERR
+					    ("No request from application in %d s, waiting for %s\n",
+					     replay_idle_sec,
+					     replay_kind_name(rec->kind));
+					replay_mismatches++;
+				}
+				break;
+			}
+			replay_match(rec, payload, ev);
+
+			// Think time is measured from the application
+			rec_anchor = rec->tstamp;
+			live_anchor = replay_now_ns();
+			if (replay_live_first == 0) {
+				replay_rec_first = rec_anchor;
+				replay_live_first = live_anchor;
+			}
+			replay_rec_last = rec->tstamp;
+			replay_live_last = live_anchor;
+			continue;
+		}
+
+		if (!replay_fast_forward) {
+			target = live_anchor + (rec->tstamp - rec_anchor);
+			while ((now = replay_now_ns()) < target) {
+				replay_pump();
+				replay_nap((target - now < REPLAY_POLL_NS) ?
+					   target - now : REPLAY_POLL_NS);
+			}
+		}
+		replay_perform(rec, payload);
+		replay_rec_last = rec->tstamp;
+		replay_live_last = replay_now_ns();
+	}
+
+	if (off >= size)
+		ASE_INFO("Replay reached end of recording\n");
+}
+
+
+/*
+ * Tasks exported by ccip_emulator.sv
+ */
+void ase_config_dex(struct ase_cfg_t *cfg_in)
+{
+	// The session lifetime is the recording's
+	cfg_in->ase_mode = ASE_MODE_DAEMON_NO_SIMKILL;
+	cfg_in->enable_record = 0;
+}
+
+
+void mmio_dispatch(int init, struct mmio_t *mmio_pkt)
+{
+}
+
+
+void umsg_dispatch(int init, struct umsgcmd_t *umsg_pkt)
+{
+}
+
+
+void afu_softreset_trig(int init, int value)
+{
+	sw_reset_response();
+}
+
+
+void ase_reset_trig(void)
+{
+}
+
+
+void run_clocks(int num_clocks)
+{
+}
+
+
+void buffer_msg_inject(int logger, char *str)
+{
+	ASE_INFO_2("%s\n", str);
+}
+
+
+int count_error_flag_ping(void)
+{
+	count_error_flag_pong(0);
+	return 0;
+}
+
+
+void simkill(void)
+{
+	replay_done = 1;
+}
+
+
+int main(int argc, char **argv)
+{
+	const char *cfg_path = "ase.cfg";
+	const struct ase_record_file_t *hdr;
+	struct stat st;
+	char *base;
+	int opt, fd;
+
+	while ((opt = getopt(argc, argv, "ft:c:h")) != -1) {
+		switch (opt) {
+		case 'f':
+			replay_fast_forward = 1;
+			break;
+		case 't':
+			replay_idle_sec = atoi(optarg);
+			break;
+		case 'c':
+			cfg_path = optarg;
+			break;
+		default:
+			printf("Usage: %s [-f] [-t <idle seconds>] [-c <ase.cfg>] <recording>\n",
+			       argv[0]);
+			printf("  -f  fast-forward, drop recorded think time\n");
+			return (opt == 'h') ? 0 : 1;
+		}
+	}
+	if (optind >= argc) {
+		ASE_ERR("No recording given, see %s -h\n", argv[0]);
+		return 1;
+	}
+
+	// Map the recording
+	fd = open(argv[optind], O_RDONLY);
+	if ((fd < 0) || (fstat(fd, &st) != 0)) {
+		ASE_ERR("Could not open %s, %s\n", argv[optind],
+			strerror(errno));
+		return 1;
+	}
+	if ((size_t) st.st_size < sizeof(*hdr)) {
+		ASE_ERR("%s is not an ASE session recording\n",
+			argv[optind]);
+		return 1;
+	}
+	base = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (base == MAP_FAILED) {
+		ASE_ERR("Could not map %s, %s\n", argv[optind],
+			strerror(errno));
+		return 1;
+	}
+	hdr = (const struct ase_record_file_t *) base;
+	if (memcmp(hdr->magic, ASE_RECORD_MAGIC, sizeof(hdr->magic)) ||
+	    (hdr->version != ASE_RECORD_VERSION) ||
+	    (hdr->rec_size != sizeof(struct ase_record_t))) {
+		ASE_ERR("%s is not an ASE session recording (version %d)\n",
+			argv[optind], ASE_RECORD_VERSION);
+		return 1;
+	}
+
+	// Come up the way the simulator does
+	sv2c_config_dex(cfg_path);
+	ase_init();
+	ase_ready();
+	if (replay_fast_forward)
+		ASE_INFO("Replay in fast-forward mode\n");
+
+	replay_run(base, st.st_size);
+
+	ASE_INFO("Replayed %" PRIu64 " events\n", replay_events);
+	ASE_INFO("Session time        => %.3f s (recorded %.3f s)\n",
+		 (replay_live_last - replay_live_first) / 1e9,
+		 (replay_rec_last - replay_rec_first) / 1e9);
+	ASE_INFO("Request mismatches  => %" PRIu64 "\n", replay_mismatches);
+	ASE_INFO("Read data changes   => %" PRIu64 "\n", replay_rd_mismatches);
+	if (replay_unmapped)
+		ASE_INFO("Unmapped addresses  => %" PRIu64 "\n",
+			 replay_unmapped);
+
+	munmap(base, st.st_size);
+	if (!replay_done)
+		start_simkill_countdown();
+
+	return (replay_mismatches != 0) ? 1 : 0;
+}
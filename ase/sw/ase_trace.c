@@ -0,0 +1,344 @@
+// Copyright(c) 2014-2017, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+// **************************************************************************
+/*
+ * Module Info: Binary CCI-P transaction trace
+ * - Records are staged in a per-thread ring, a flusher thread writes
+ *   whole records out, the simulator thread only pays for a copy
+ * - Decode with scripts/ase_trace_decode.py
+ */
+
+#include "ase_common.h"
+#include <pthread.h>
+
+struct ase_trace_ring_t {
+	uint64_t head;		// Bytes produced, owner thread
+	char pad0[56];
+	uint64_t tail;		// Bytes written out, flusher thread
+	char pad1[56];
+	struct ase_trace_ring_t *next;
+	char buf[ASE_TRACE_RING_SIZE];
+};
+
+static __thread struct ase_trace_ring_t *trace_ring;
+static struct ase_trace_ring_t *trace_ring_list;
+
+static int trace_fd = -1;
+static volatile int trace_active;
+static int trace_stop;
+static int trace_kick;
+static uint64_t trace_dropped;
+static pthread_t trace_flusher_tid;
+static pthread_mutex_t trace_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t trace_wakeup = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t trace_space = PTHREAD_COND_INITIALIZER;
+
+
+/*
+ * Write [tail, head) of one ring, returns bytes written
+ */
+static uint64_t trace_ring_drain(struct ase_trace_ring_t *r)
+{
+	uint64_t head = __atomic_load_n(&r->head, __ATOMIC_ACQUIRE);
+	uint64_t tail = r->tail;
+	uint64_t off, chunk, done = 0;
+	ssize_t ret;
+
+	while (tail + done < head) {
+		off = (tail + done) % ASE_TRACE_RING_SIZE;
+		chunk = head - (tail + done);
+		if (chunk > ASE_TRACE_RING_SIZE - off)
+			chunk = ASE_TRACE_RING_SIZE - off;
+		ret = write(trace_fd, r->buf + off, chunk);
+		if (ret < 0) {
+			if (errno == EINTR)
+				continue;
+			// Keep the simulation going, account for the loss
+			ASE_ERR("Trace write failed, %s\n", strerror(errno));
+			trace_dropped += head - (tail + done);
+			done = head - tail;
+			break;
+		}
+		done += ret;
+	}
+
+	__atomic_store_n(&r->tail, tail + done, __ATOMIC_RELEASE);
+	return done;
+}
+
+
+static void trace_drain_all(void)
+{
+	struct ase_trace_ring_t *r;
+	uint64_t done = 0;
+
+	// Rings are only ever prepended, the walk needs no lock
+	pthread_mutex_lock(&trace_lock);
+	r = trace_ring_list;
+	pthread_mutex_unlock(&trace_lock);
+
+	for (; r != NULL; r = r->next)
+		done += trace_ring_drain(r);
+
+	if (done) {
+		pthread_mutex_lock(&trace_lock);
+		pthread_cond_broadcast(&trace_space);
+		pthread_mutex_unlock(&trace_lock);
+	}
+}
+
+
+/*
+ * THREAD: Trace flusher, wakes when a ring is half full or every
+ * ASE_TRACE_FLUSH_MS
+ */
+static void *trace_flusher(void *arg)
+{
+	struct timespec deadline;
+	int stop;
+
+	do {
+		pthread_mutex_lock(&trace_lock);
+		if (!trace_kick && !trace_stop) {
+			clock_gettime(CLOCK_REALTIME, &deadline);
+			deadline.tv_nsec += ASE_TRACE_FLUSH_MS * 1000000L;
+			deadline.tv_sec += deadline.tv_nsec / 1000000000L;
+			deadline.tv_nsec %= 1000000000L;
+			pthread_cond_timedwait(&trace_wakeup, &trace_lock,
+					       &deadline);
+		}
+		trace_kick = 0;
+		stop = trace_stop;
+		pthread_mutex_unlock(&trace_lock);
+
+		trace_drain_all();
+	} while (!stop);
+
+	return 0;
+}
+
+
+static struct ase_trace_ring_t *trace_ring_register(void)
+{
+	struct ase_trace_ring_t *r;
+
+	r = (struct ase_trace_ring_t *)
+	    ase_malloc(sizeof(struct ase_trace_ring_t));
+
+	pthread_mutex_lock(&trace_lock);
+	r->next = trace_ring_list;
+	trace_ring_list = r;
+	pthread_mutex_unlock(&trace_lock);
+
+	trace_ring = r;
+	return r;
+}
+
+
+static void trace_ring_copy(struct ase_trace_ring_t *r, uint64_t pos,
+			    const void *src, size_t len)
+{
+	uint64_t off = pos % ASE_TRACE_RING_SIZE;
+	size_t first = len;
+
+	if (first > ASE_TRACE_RING_SIZE - off)
+		first = ASE_TRACE_RING_SIZE - off;
+	memcpy(r->buf + off, src, first);
+	if (first < len)
+		memcpy(r->buf, (const char *) src + first, len - first);
+}
+
+
+/*
+ * Stage one record and its payload in the calling thread's ring
+ */
+static void trace_put(struct ase_trace_rec_t *rec, const void *payload)
+{
+	struct ase_trace_ring_t *r = trace_ring;
+	uint64_t head, used, len;
+	static const char zero[8];
+
+	if (r == NULL)
+		r = trace_ring_register();
+
+	len = sizeof(struct ase_trace_rec_t) + ((rec->len + 7) & ~7);
+	head = r->head;
+	used = head - __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE);
+
+	// Ring full, hold the simulation until the flusher catches up
+	if (used + len > ASE_TRACE_RING_SIZE) {
+		pthread_mutex_lock(&trace_lock);
+		trace_kick = 1;
+		pthread_cond_signal(&trace_wakeup);
+		while (head - __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE)
+		       + len > ASE_TRACE_RING_SIZE)
+			pthread_cond_wait(&trace_space, &trace_lock);
+		pthread_mutex_unlock(&trace_lock);
+		used = head - r->tail;
+	}
+
+	trace_ring_copy(r, head, rec, sizeof(struct ase_trace_rec_t));
+	if (rec->len) {
+		trace_ring_copy(r, head + sizeof(struct ase_trace_rec_t),
+				payload, rec->len);
+		trace_ring_copy(r, head + sizeof(struct ase_trace_rec_t) +
+				rec->len, zero, (-rec->len) & 7);
+	}
+	__atomic_store_n(&r->head, head + len, __ATOMIC_RELEASE);
+
+	// Kick the flusher once per crossing of the half-way mark
+	if ((used < ASE_TRACE_RING_SIZE / 2)
+	    && (used + len >= ASE_TRACE_RING_SIZE / 2)) {
+		pthread_mutex_lock(&trace_lock);
+		trace_kick = 1;
+		pthread_cond_signal(&trace_wakeup);
+		pthread_mutex_unlock(&trace_lock);
+	}
+}
+
+
+/*
+ * Open trace file and start the flusher
+ */
+int ase_trace_open(const char *filename)
+{
+	struct ase_trace_file_t hdr;
+
+	if (trace_active)
+		return 0;
+
+	trace_fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (trace_fd < 0) {
+		ASE_ERR("Binary trace %s could not be opened, %s\n",
+			filename, strerror(errno));
+		return -1;
+	}
+
+	memset(&hdr, 0, sizeof(hdr));
+	memcpy(hdr.magic, ASE_TRACE_MAGIC, sizeof(hdr.magic));
+	hdr.version = ASE_TRACE_VERSION;
+	hdr.rec_size = sizeof(struct ase_trace_rec_t);
+	if (write(trace_fd, &hdr, sizeof(hdr)) != sizeof(hdr)) {
+		ASE_ERR("Binary trace header write failed\n");
+		close(trace_fd);
+		trace_fd = -1;
+		return -1;
+	}
+
+	trace_stop = 0;
+	trace_kick = 0;
+	trace_dropped = 0;
+	if (pthread_create(&trace_flusher_tid, NULL, &trace_flusher, NULL)
+	    != 0) {
+		ASE_ERR("Binary trace flusher could not be started\n");
+		close(trace_fd);
+		trace_fd = -1;
+		return -1;
+	}
+
+	trace_active = 1;
+	return 0;
+}
+
+
+/*
+ * Flush everything staged, stop the flusher and close the file
+ */
+void ase_trace_close(void)
+{
+	struct ase_trace_ring_t *r;
+
+	if (!trace_active)
+		return;
+	trace_active = 0;
+
+	pthread_mutex_lock(&trace_lock);
+	trace_stop = 1;
+	pthread_cond_signal(&trace_wakeup);
+	pthread_mutex_unlock(&trace_lock);
+	pthread_join(trace_flusher_tid, NULL);
+
+	if (trace_dropped)
+		ASE_ERR("Binary trace lost %" PRIu64 " bytes\n",
+			trace_dropped);
+
+	close(trace_fd);
+	trace_fd = -1;
+
+	// Rings stay owned by their threads' trace_ring, just empty them
+	for (r = trace_ring_list; r != NULL; r = r->next)
+		r->tail = r->head;
+}
+
+
+/*
+ * DPI-C import: CCI-P transaction from ccip_logger
+ * 'data' is the 512-bit data field, 'nbytes' of it are kept
+ */
+void ase_trace_post(int kind, long long tstamp, int vc, int type, int cl,
+		    int meta, long long addr, int nbytes,
+		    const svBitVecVal *data)
+{
+	struct ase_trace_rec_t rec;
+
+	if (!trace_active)
+		return;
+
+	memset(&rec, 0, sizeof(rec));
+	rec.tstamp = (uint64_t) tstamp;
+	rec.addr = (uint64_t) addr;
+	rec.meta = (uint32_t) meta;
+	rec.kind = (uint8_t) kind;
+	rec.vc = (uint8_t) vc;
+	rec.type = (uint8_t) type;
+	rec.cl = (uint8_t) cl;
+	rec.len = (nbytes > CL_BYTE_WIDTH) ? CL_BYTE_WIDTH : nbytes;
+
+	trace_put(&rec, data);
+}
+
+
+/*
+ * DPI-C import: buffer message from ccip_logger
+ */
+void ase_trace_msg(long long tstamp, int tstamp_en, const char *msg)
+{
+	struct ase_trace_rec_t rec;
+	size_t len;
+
+	if (!trace_active)
+		return;
+
+	len = strnlen(msg, UINT16_MAX);
+
+	memset(&rec, 0, sizeof(rec));
+	rec.tstamp = (uint64_t) tstamp;
+	rec.kind = ASE_TRACE_MSG;
+	rec.cl = tstamp_en ? 1 : 0;
+	rec.len = len;
+
+	trace_put(&rec, msg);
+}
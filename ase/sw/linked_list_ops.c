@@ -35,6 +35,88 @@
 
 #include "ase_common.h"
 
+/*
+ * Physical address index
+ * Valid workspaces sorted by fake_paddr, kept in step with the linked
+ * list so that translating an AFU address is a binary search instead of
+ * a list walk. Workspaces never overlap (see check_if_physaddr_used),
+ * so the candidate for an address is the last one starting at or below
+ * it.
+ */
+static struct buffer_t **paddr_index;
+static uint32_t paddr_index_cnt;
+static uint32_t paddr_index_cap;
+
+
+// --------------------------------------------------------------------
+// ll_index_slot : Number of workspaces with fake_paddr <= paddr
+// --------------------------------------------------------------------
+static uint32_t ll_index_slot(uint64_t paddr)
+{
+	uint32_t lo = 0;
+	uint32_t hi = paddr_index_cnt;
+	uint32_t mid;
+
+	while (lo < hi) {
+		mid = lo + (hi - lo) / 2;
+		if (paddr_index[mid]->fake_paddr <= paddr)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return lo;
+}
+
+
+// --------------------------------------------------------------------
+// ll_index_insert : Add a buffer to the physical address index
+// --------------------------------------------------------------------
+static void ll_index_insert(struct buffer_t *new)
+{
+	struct buffer_t **grown;
+	uint32_t slot;
+
+	if (paddr_index_cnt == paddr_index_cap) {
+		paddr_index_cap = (paddr_index_cap == 0) ? 64 : 2 * paddr_index_cap;
+		grown = (struct buffer_t **)
+		    ase_malloc(paddr_index_cap * sizeof(struct buffer_t *));
+		if (paddr_index != NULL) {
+			memcpy(grown, paddr_index,
+			       paddr_index_cnt * sizeof(struct buffer_t *));
+			free(paddr_index);
+		}
+		paddr_index = grown;
+	}
+
+	slot = ll_index_slot(new->fake_paddr);
+	memmove(&paddr_index[slot + 1], &paddr_index[slot],
+		(paddr_index_cnt - slot) * sizeof(struct buffer_t *));
+	paddr_index[slot] = new;
+	paddr_index_cnt++;
+}
+
+
+// --------------------------------------------------------------------
+// ll_index_remove : Drop a buffer from the physical address index
+// --------------------------------------------------------------------
+static void ll_index_remove(struct buffer_t *ptr)
+{
+	uint32_t slot;
+
+	slot = ll_index_slot(ptr->fake_paddr);
+	while (slot > 0) {
+		slot--;
+		if (paddr_index[slot] == ptr) {
+			memmove(&paddr_index[slot], &paddr_index[slot + 1],
+				(paddr_index_cnt - slot - 1) * sizeof(struct buffer_t *));
+			paddr_index_cnt--;
+			return;
+		}
+		if (paddr_index[slot]->fake_paddr != ptr->fake_paddr)
+			return;
+	}
+}
+
 /*
  * ll_print_info: Print linked list node info
  * Thu Oct  2 15:50:06 PDT 2014 : Modified for cleanliness
@@ -98,6 +180,8 @@ void ll_append_buffer(struct buffer_t *new)
 	// Adjust end to point to last node
 	end = new;
 
+	ll_index_insert(new);
+
 	FUNC_CALL_EXIT;
 }
 
@@ -114,6 +198,8 @@ void ll_remove_buffer(struct buffer_t *ptr)
 	// node to be deleted
 	temp = ptr;
 
+	ll_index_remove(temp);
+
 	// Reset linked list traversal
 	prev = head;
 
@@ -174,24 +260,45 @@ struct buffer_t *ll_search_buffer(int search_index)
 }
 
 
+// --------------------------------------------------------------------
+// ll_search_paddr : Find the workspace holding a simulated physical
+// address, NULL if there is none
+// --------------------------------------------------------------------
+struct buffer_t *ll_search_paddr(uint64_t paddr)
+{
+	uint32_t slot;
+	struct buffer_t *buf;
+
+	slot = ll_index_slot(paddr);
+	if (slot == 0)
+		return (struct buffer_t *) NULL;
+
+	buf = paddr_index[slot - 1];
+	if (paddr < buf->fake_paddr_hi)
+		return buf;
+
+	return (struct buffer_t *) NULL;
+}
+
+
 /*
- * Check if physical address is used
- * RETURN 0 if not found, 1 if found
+ * Check if a physical address range overlaps a workspace
+ * RETURN 0 if free, 1 if any part of [paddr, paddr + size) is used
  */
-uint32_t check_if_physaddr_used(uint64_t paddr)
+uint32_t check_if_physaddr_used(uint64_t paddr, uint64_t size)
 {
-	struct buffer_t *search_ptr;
-	int flag = 0;
+	uint32_t slot;
 
-	search_ptr = head;
-	while (search_ptr != NULL) {
-		if ((paddr >= search_ptr->fake_paddr)
-		    && (paddr < search_ptr->fake_paddr_hi)) {
-			flag = 1;
-			break;
-		} else {
-			search_ptr = search_ptr->next;
-		}
-	}
-	return flag;
+	slot = ll_index_slot(paddr);
+
+	// Workspace starting at or below paddr reaches into the range
+	if ((slot > 0) && (paddr < paddr_index[slot - 1]->fake_paddr_hi))
+		return 1;
+
+	// Next workspace starts inside the range
+	if ((slot < paddr_index_cnt)
+	    && (paddr_index[slot]->fake_paddr < paddr + size))
+		return 1;
+
+	return 0;
 }
@@ -38,6 +38,23 @@
 
 #include "ase_common.h"
 
+// Last workspace each channel translated into; AFUs mostly stream
+// through one buffer at a time so this skips the index search
+struct buffer_t *xlate_last_hit[ASE_XLATE_CHANNELS];
+
+// System memory is handed out in 2 MB frames, tracked by a bitmap
+// (1 = used) and a summary bitmap of full words, so a free range is
+// found without walking the workspace list. Frame 0 is kept reserved
+// so no workspace sits at physical address 0.
+static uint64_t *frame_map;
+static uint64_t *frame_full;
+static uint64_t frame_cnt;
+static uint64_t frame_words;
+
+// Application's workspace arena as mapped here, 0 when there is none
+static uint64_t arena_pbase;
+static uint64_t arena_size;
+
 
 // ---------------------------------------------------------------
 // ASE graceful shutdown - Called if: error() occurs
@@ -55,6 +72,105 @@ void ase_perror_teardown(void)
 }
 
 
+/*
+ * Map the application's workspace arena, replacing the previous
+ * session's. memname is the /proc path of the application's memfd and
+ * the reply tells it whether the arena can be used.
+ */
+static void ase_arena_map(struct buffer_t *mem)
+{
+	struct stat st;
+	void *base;
+	int fd;
+
+	ase_arena_unmap();
+	mem->valid = ASE_BUFFER_INVALID;
+
+	fd = open(mem->memname, O_RDWR);
+	if (fd < 0) {
+		ASE_ERR("Workspace arena %s could not be opened: %s\n",
+			mem->memname, strerror(errno));
+	} else {
+		base = MAP_FAILED;
+		if (fstat(fd, &st) == 0) {
+			base = mmap(NULL, (size_t) st.st_size,
+				    PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		}
+		if (base == MAP_FAILED) {
+			ASE_ERR("Workspace arena could not be mapped: %s\n",
+				strerror(errno));
+		} else {
+#ifdef MADV_HUGEPAGE
+			madvise(base, (size_t) st.st_size, MADV_HUGEPAGE);
+#endif
+			arena_pbase = (uint64_t) (uintptr_t) base;
+			arena_size = (uint64_t) st.st_size;
+			mem->pbase = arena_pbase;
+			mem->valid = ASE_BUFFER_VALID;
+			ASE_INFO_2("Workspace arena mapped, %" PRIu64 " MB\n",
+				   arena_size >> 20);
+		}
+		close(fd);
+	}
+
+	mqueue_send(sim2app_alloc_tx, (char *) mem, sizeof(struct buffer_t));
+}
+
+
+/*
+ * Drop the workspace arena mapping, its workspaces must be gone
+ */
+void ase_arena_unmap(void)
+{
+	if (arena_pbase != 0) {
+		munmap((void *) (uintptr_t) arena_pbase, (size_t) arena_size);
+		arena_pbase = 0;
+		arena_size = 0;
+	}
+}
+
+
+/*
+ * Map a workspace kept in its own shared memory file
+ * Returns 0 on success
+ */
+static int ase_shm_map(struct buffer_t *mem)
+{
+	int fd_alloc;
+
+	// Obtain a file descriptor
+	fd_alloc = shm_open(mem->memname, O_RDWR, S_IRUSR | S_IWUSR);
+	if (fd_alloc < 0) {
+		ase_error_report("shm_open", errno, ASE_OS_SHM_ERR);
+		ase_perror_teardown();
+		start_simkill_countdown();
+		return -1;
+	}
+
+	// Add to IPC list
+	add_to_ipc_list("SHM", mem->memname);
+
+	// Mmap to pbase, find one with unique low 38 bit
+	mem->pbase =
+	    (uintptr_t) mmap(NULL, mem->memsize,
+			     PROT_READ | PROT_WRITE, MAP_SHARED,
+			     fd_alloc, 0);
+	if (mem->pbase == 0) {
+		ase_error_report("mmap", errno, ASE_OS_MEMMAP_ERR);
+		ase_perror_teardown();
+		start_simkill_countdown();
+	}
+	if (ftruncate(fd_alloc, (off_t) mem->memsize) != 0) {
+		ase_error_report("ftruncate", errno, ASE_OS_SHM_ERR);
+		ASE_MSG("Running ftruncate to %d bytes\n",
+			(off_t) mem->memsize);
+	}
+	close(fd_alloc);
+
+	return 0;
+}
+
+
 // --------------------------------------------------------------------
 // DPI ALLOC buffer action - Allocate buffer action inside DPI
 // Receive buffer_t pointer with memsize, memname and index populated
@@ -65,40 +181,43 @@ void ase_alloc_action(struct buffer_t *mem)
 	FUNC_CALL_ENTRY;
 
 	struct buffer_t *new_buf;
-	int fd_alloc;
+	int mapped = 0;
 
 	ASE_DBG("SIM-C : Adding a new buffer \"%s\"...\n", mem->memname);
 
-	// Obtain a file descriptor
-	fd_alloc = shm_open(mem->memname, O_RDWR, S_IRUSR | S_IWUSR);
-	if (fd_alloc < 0) {
-		ase_error_report("shm_open", errno, ASE_OS_SHM_ERR);
-		ase_perror_teardown();
-		start_simkill_countdown();
-	} else {
-		// Add to IPC list
-		add_to_ipc_list("SHM", mem->memname);
-
-		// Mmap to pbase, find one with unique low 38 bit
-		mem->pbase =
-		    (uintptr_t) mmap(NULL, mem->memsize,
-				     PROT_READ | PROT_WRITE, MAP_SHARED,
-				     fd_alloc, 0);
-		if (mem->pbase == 0) {
-			ase_error_report("mmap", errno, ASE_OS_MEMMAP_ERR);
+	if (mem->arena == ASE_ARENA_REGION) {
+		ase_arena_map(mem);
+	} else if (mem->arena == ASE_ARENA_SUBALLOC) {
+		// Already mapped, only the offset is new
+		if ((arena_pbase == 0) ||
+		    (mem->arena_offset + mem->memsize > arena_size)) {
+			ASE_ERR("Workspace %d at arena offset 0x%" PRIx64
+				" is outside the arena\n", mem->index,
+				mem->arena_offset);
 			ase_perror_teardown();
 			start_simkill_countdown();
+		} else {
+			mem->pbase = arena_pbase + mem->arena_offset;
+			mapped = 1;
 		}
-		if (ftruncate(fd_alloc, (off_t) mem->memsize) != 0) {
-			ase_error_report("ftruncate", errno,
-					 ASE_OS_SHM_ERR);
-			ASE_MSG("Running ftruncate to %d bytes\n",
-				(off_t) mem->memsize);
-		}
-		close(fd_alloc);
+	} else {
+		mapped = (ase_shm_map(mem) == 0);
+	}
 
-		// Record fake address
+	if (mapped) {
+		// Record fake address, 0 when no range is left and simkill
+		// has started; the workspace is then never handed out
 		mem->fake_paddr = get_range_checked_physaddr(mem->memsize);
+		if (mem->fake_paddr == 0) {
+			if (mem->arena == ASE_ARENA_NONE)
+				munmap((void *) (uintptr_t) mem->pbase,
+				       mem->memsize);
+			mem->valid = ASE_BUFFER_INVALID;
+			mapped = 0;
+		}
+	}
+
+	if (mapped) {
 		mem->fake_paddr_hi =
 		    mem->fake_paddr + (uint64_t) mem->memsize;
 
@@ -162,6 +281,7 @@ void ase_dealloc_action(struct buffer_t *buf, int mq_enable)
 
 	char buf_str[ASE_MQ_MSGSIZE];
 	memset(buf_str, 0, ASE_MQ_MSGSIZE);
+	int ch;
 
 	// Traversal pointer
 	struct buffer_t *dealloc_ptr;
@@ -179,11 +299,20 @@ void ase_dealloc_action(struct buffer_t *buf, int mq_enable)
 			   dealloc_ptr->memname);
 		// Mark buffer as invalid & deallocate
 		dealloc_ptr->valid = ASE_BUFFER_INVALID;
-		munmap((void *) (uintptr_t) dealloc_ptr->pbase,
-		       (size_t) dealloc_ptr->memsize);
-		shm_unlink(dealloc_ptr->memname);
+		// Arena workspaces go with the arena
+		if (dealloc_ptr->arena != ASE_ARENA_SUBALLOC) {
+			munmap((void *) (uintptr_t) dealloc_ptr->pbase,
+			       (size_t) dealloc_ptr->memsize);
+			shm_unlink(dealloc_ptr->memname);
+		}
 		// Respond back
 		ll_remove_buffer(dealloc_ptr);
+		ase_paddr_frames_release(dealloc_ptr->fake_paddr,
+					 dealloc_ptr->memsize);
+		for (ch = 0; ch < ASE_XLATE_CHANNELS; ch++) {
+			if (xlate_last_hit[ch] == dealloc_ptr)
+				xlate_last_hit[ch] = NULL;
+		}
 		ase_memcpy(buf_str, dealloc_ptr, sizeof(struct buffer_t));
 		// If Buffer removal is requested by APP, send back notice, else no response
 		if (mq_enable == 1) {
@@ -214,6 +343,8 @@ void ase_empty_buffer(struct buffer_t *buf)
 	buf->vbase = 0;
 	buf->pbase = 0;
 	buf->fake_paddr = 0;
+	buf->arena = ASE_ARENA_NONE;
+	buf->arena_offset = 0;
 	buf->next = NULL;
 }
 
@@ -246,66 +377,195 @@ void ase_destroy(void)
 			ptr = ptr->next;
 		}
 	}
+	ase_arena_unmap();
 
 	FUNC_CALL_EXIT;
 }
 
 
+static void frame_set(uint64_t frame)
+{
+	uint64_t word = frame >> 6;
+
+	frame_map[word] |= (uint64_t) 1 << (frame & 63);
+	if (frame_map[word] == ~(uint64_t) 0)
+		frame_full[word >> 6] |= (uint64_t) 1 << (word & 63);
+}
+
+
+static void frame_clear(uint64_t frame)
+{
+	uint64_t word = frame >> 6;
+
+	frame_map[word] &= ~((uint64_t) 1 << (frame & 63));
+	frame_full[word >> 6] &= ~((uint64_t) 1 << (word & 63));
+}
+
+
+static int frame_used(uint64_t frame)
+{
+	return (frame_map[frame >> 6] >> (frame & 63)) & 1;
+}
+
+
+/*
+ * First free frame at or after 'frame', frame_cnt if there is none
+ */
+static uint64_t frame_next_free(uint64_t frame)
+{
+	uint64_t word = frame >> 6;
+	uint64_t bits;
+
+	if (frame >= frame_cnt)
+		return frame_cnt;
+
+	bits = ~frame_map[word] & (~(uint64_t) 0 << (frame & 63));
+	if (bits)
+		return (word << 6) + __builtin_ctzll(bits);
+
+	// Skip full words through the summary
+	for (word = word + 1; word < frame_words;
+	     word = ((word >> 6) + 1) << 6) {
+		bits = ~frame_full[word >> 6] & (~(uint64_t) 0 << (word & 63));
+		if (bits) {
+			word = (word & ~(uint64_t) 63) + __builtin_ctzll(bits);
+			if (word >= frame_words)
+				break;
+			return (word << 6) + __builtin_ctzll(~frame_map[word]);
+		}
+	}
+
+	return frame_cnt;
+}
+
+
+/*
+ * Find 'num' contiguous free frames, searching from 'start' and
+ * wrapping around once. RETURN first frame, 0 if none
+ */
+static uint64_t frame_find_run(uint64_t start, uint64_t num)
+{
+	uint64_t frame = start;
+	uint64_t ii;
+	int wrapped = 0;
+
+	while (1) {
+		frame = frame_next_free(frame);
+		if (wrapped && (frame >= start))
+			return 0;
+		if (frame + num > frame_cnt) {
+			if (wrapped)
+				return 0;
+			wrapped = 1;
+			frame = 1;
+			continue;
+		}
+
+		for (ii = 1; ii < num; ii++) {
+			if (frame_used(frame + ii))
+				break;
+		}
+		if (ii == num)
+			return frame;
+		frame = frame + ii + 1;
+	}
+}
+
+
+/*
+ * Set up the frame bitmaps over the system memory window
+ * Called once sysmem_phys_lo/sysmem_size are known
+ */
+void ase_paddr_frames_init(void)
+{
+	uint64_t ii;
+
+	ase_free_buffer((char *) frame_map);
+	ase_free_buffer((char *) frame_full);
+
+	frame_cnt = sysmem_size >> MEMBUF_2MB_ALIGN;
+	if (frame_cnt < 2) {
+		ASE_ERR("System memory must hold at least two 2 MB frames\n");
+		start_simkill_countdown();
+		return;
+	}
+
+	frame_words = (frame_cnt + 63) >> 6;
+	frame_map = (uint64_t *) ase_malloc(frame_words * sizeof(uint64_t));
+	frame_full = (uint64_t *)
+	    ase_malloc(((frame_words + 63) >> 6) * sizeof(uint64_t));
+
+	// Tail of the last word and summary word count as used
+	for (ii = frame_cnt; ii < (frame_words << 6); ii++)
+		frame_set(ii);
+	for (ii = frame_words; ii < (((frame_words + 63) >> 6) << 6); ii++)
+		frame_full[ii >> 6] |= (uint64_t) 1 << (ii & 63);
+
+	// Reserve frame 0
+	frame_set(0);
+}
+
+
+/*
+ * Return the frames of a workspace
+ */
+void ase_paddr_frames_release(uint64_t paddr, uint32_t size)
+{
+	uint64_t frame, last;
+
+	if ((frame_map == NULL) || (paddr < sysmem_phys_lo) || (size == 0))
+		return;
+
+	frame = (paddr - sysmem_phys_lo) >> MEMBUF_2MB_ALIGN;
+	last = (paddr - sysmem_phys_lo + size - 1) >> MEMBUF_2MB_ALIGN;
+	for (; (frame <= last) && (frame < frame_cnt); frame++)
+		frame_clear(frame);
+}
+
+
 /*
  * Range check a Physical address to check if used
  * Created to integrate Sysmem & CAPCM and prevent corner case overwrite
  *   issues (Mon Oct 13 13:33:59 PDT 2014)
  * Operation: When allocating a fake physical address, this function
- * will return an unused physical address range
+ * will return an unused, 2MB aligned physical address range
+ * Placement starts at a seeded random frame (ENABLE_RANDOM_PHYSADDR),
+ * or packs from the bottom of system memory
  * This will be used by SW allocate buffer funtion ONLY
  */
 uint64_t get_range_checked_physaddr(uint32_t size)
 {
-	int unique_physaddr_needed = 1;
 	uint64_t ret_fake_paddr;
-	uint32_t search_flag;
-	uint32_t opposite_flag;
-	uint32_t zero_pbase_flag;
-#ifdef ASE_DEBUG
-	int tries = 0;
-#endif
-
-	// Generate a new address
-	while (unique_physaddr_needed) {
-		// Generate a random physical address for system memory
-		ret_fake_paddr =
-		    sysmem_phys_lo + ase_rand64() % sysmem_size;
-		// 2MB align and sanitize
-		// ret_fake_paddr = ret_fake_paddr & 0x00003FFFE00000 ;
-		ret_fake_paddr = ret_fake_paddr & PHYS_ADDR_PREFIX_MASK;
-
-		// Check for conditions
-		// Is address in sysmem range, go back
-		search_flag = check_if_physaddr_used(ret_fake_paddr);
-
-		// Is HI smaller than LO, go back
-		opposite_flag = 0;
-		if ((ret_fake_paddr + (uint64_t) size) < ret_fake_paddr)
-			opposite_flag = 1;
-
-		// Zero base flag
-		zero_pbase_flag = 0;
-		if (ret_fake_paddr == 0)
-			zero_pbase_flag = 1;
-
-		// If all OK
-		unique_physaddr_needed =
-		    search_flag | opposite_flag | zero_pbase_flag;
-#ifdef ASE_DEBUG
-		tries++;
-#endif
+	uint64_t num, start, frame, ii;
+
+	num = ((uint64_t) size + (1 << MEMBUF_2MB_ALIGN) - 1)
+	    >> MEMBUF_2MB_ALIGN;
+	if (num == 0)
+		num = 1;
+
+	if (cfg->enable_random_physaddr)
+		start = 1 + ase_rand64() % (frame_cnt - 1);
+	else
+		start = 1;
+
+	frame = frame_find_run(start, num);
+	if (frame == 0) {
+		ASE_ERR("No free %u byte range left in %d GB of system memory\n",
+			size, cfg->phys_memory_available_gb);
+		ASE_ERR("        Increase PHYS_MEMORY_AVAILABLE_GB in ase.cfg\n");
+		start_simkill_countdown();
+		return 0;
 	}
 
+	for (ii = 0; ii < num; ii++)
+		frame_set(frame + ii);
+
+	ret_fake_paddr = sysmem_phys_lo + (frame << MEMBUF_2MB_ALIGN);
+
 #ifdef ASE_DEBUG
-	if (fp_memaccess_log != NULL) {
-		fprintf(fp_memaccess_log,
-			"  [DEBUG]  ASE took %d tries to generate phyaddr\n",
-			tries);
+	if (check_if_physaddr_used(ret_fake_paddr, (uint64_t) size)) {
+		ASE_ERR("Physical address 0x%" PRIx64
+			" overlaps a workspace\n", ret_fake_paddr);
 	}
 #endif
 
@@ -317,14 +577,16 @@ uint64_t get_range_checked_physaddr(uint32_t size)
  * ASE Physical address to virtual address converter
  * Takes in a simulated physical address from AFU, converts it
  *   to virtual address
+ * ch selects the last-hit slot (ASE_XLATE_CH_*), a miss falls back to
+ *   a binary search of the workspace index
  */
-uint64_t *ase_fakeaddr_to_vaddr(uint64_t req_paddr)
+uint64_t *ase_fakeaddr_to_vaddr(uint64_t req_paddr, int ch)
 {
 	FUNC_CALL_ENTRY;
 
-	// Traversal ptr
+	// Matching workspace
 	struct buffer_t *trav_ptr = (struct buffer_t *) NULL;
-	// int buffer_found = 0;
+	char error_filepath[ASE_FILEPATH_LEN];
 
 	if (req_paddr != 0) {
 		// Clean up address of signed-ness (limit to CCI-P 42 bits)
@@ -334,7 +596,7 @@ uint64_t *ase_fakeaddr_to_vaddr(uint64_t req_paddr)
 		uint64_t *ase_pbase;
 
 		// This is the real offset to perform read/write
-		uint64_t real_offset, calc_pbase;
+		uint64_t real_offset;
 
 		// For debug only
 #ifdef ASE_DEBUG
@@ -344,36 +606,34 @@ uint64_t *ase_fakeaddr_to_vaddr(uint64_t req_paddr)
 		}
 #endif
 
-		// Search which buffer offset_from_pin lies in
-		trav_ptr = head;
-		while (trav_ptr != NULL) {
-			if ((req_paddr >= trav_ptr->fake_paddr)
-			    && (req_paddr < trav_ptr->fake_paddr_hi)) {
-				real_offset =
-				    (uint64_t) req_paddr -
-				    (uint64_t) trav_ptr->fake_paddr;
-				calc_pbase = trav_ptr->pbase;
-				ase_pbase =
-				    (uint64_t *) (uintptr_t) (calc_pbase +
-							      real_offset);
-
-				// Debug only
+		// Same workspace as last time on this channel?
+		trav_ptr = xlate_last_hit[ch];
+		if ((trav_ptr == NULL)
+		    || (req_paddr < trav_ptr->fake_paddr)
+		    || (req_paddr >= trav_ptr->fake_paddr_hi)) {
+			trav_ptr = ll_search_paddr(req_paddr);
+			xlate_last_hit[ch] = trav_ptr;
+		}
+
+		if (trav_ptr != NULL) {
+			real_offset =
+			    (uint64_t) req_paddr -
+			    (uint64_t) trav_ptr->fake_paddr;
+			ase_pbase =
+			    (uint64_t *) (uintptr_t) (trav_ptr->pbase +
+						      real_offset);
+
+			// Debug only
 #ifdef ASE_DEBUG
-				if (fp_memaccess_log != NULL) {
-					fprintf(fp_memaccess_log,
-						"offset=0x%016" PRIx64
-						" | pbase=%p\n",
-						real_offset, ase_pbase);
-				}
-#endif
-				return ase_pbase;
-			} else {
-				trav_ptr = trav_ptr->next;
+			if (fp_memaccess_log != NULL) {
+				fprintf(fp_memaccess_log,
+					"offset=0x%016" PRIx64
+					" | pbase=%p\n",
+					real_offset, ase_pbase);
 			}
+#endif
+			return ase_pbase;
 		}
-	} else {
-		// buffer_found = 0;
-		trav_ptr = NULL;
 	}
 
 	// If accesses are correct, ASE should not reach this point
@@ -385,7 +645,8 @@ uint64_t *ase_fakeaddr_to_vaddr(uint64_t req_paddr)
 		ASE_ERR("        Failure @ phys_addr = 0x%" PRIx64 "\n",
 			req_paddr);
 		ASE_ERR
-		    ("        See ERROR log file => ase_memory_error.log\n");
+		    ("        See ERROR log file => %s/ase_memory_error.log\n",
+		     ase_workdir_path);
 		ASE_ERR
 		    ("@ERROR: Check that previously requested memories have not been deallocated before an AFU transaction could access them\n");
 		ASE_ERR
@@ -394,8 +655,10 @@ uint64_t *ase_fakeaddr_to_vaddr(uint64_t req_paddr)
 		    ("              The simulator may be committing AFU transactions out of order\n");
 
 		// Write error to file
+		snprintf(error_filepath, ASE_FILEPATH_LEN,
+			 "%s/ase_memory_error.log", ase_workdir_path);
 		error_fp = (FILE *) NULL;
-		error_fp = fopen("ase_memory_error.log", "w");
+		error_fp = fopen(error_filepath, "w");
 		if (error_fp != NULL) {
 			fprintf(error_fp,
 				"*** ASE stopped on an illegal memory access ERROR ***\n"
@@ -33,6 +33,8 @@
  */
 
 #include "ase_common.h"
+#include <linux/futex.h>
+#include <sys/syscall.h>
 
 /*
  * Named pipe string array
@@ -130,6 +132,9 @@ void ipc_init(void)
 
 	// Initialize named pipe array
 	for (ipc_iter = 0; ipc_iter < ASE_MQ_INSTANCES; ipc_iter++) {
+		// Not open yet
+		mq_array[ipc_iter].fd = -1;
+
 		// Set name
 		ase_string_copy(mq_array[ipc_iter].name,
 				mq_name_arr[ipc_iter], ASE_MQ_NAME_LEN);
@@ -243,6 +248,15 @@ int mqueue_open(char *mq_name, int perm_flag)
 	}
 #endif
 
+	// Remember the descriptor so its ring can be found
+	int ipc_iter;
+	for (ipc_iter = 0; ipc_iter < ASE_MQ_INSTANCES; ipc_iter++) {
+		if (ase_strncmp(mq_array[ipc_iter].name, mq_name,
+				ASE_MQ_NAME_LEN) == 0) {
+			mq_array[ipc_iter].fd = mq;
+		}
+	}
+
 	FUNC_CALL_EXIT;
 
 	// Free temp variables
@@ -302,15 +316,402 @@ void mqueue_destroy(char *mq_name_suffix)
 }
 
 
+/*
+ * Shared memory ring transport
+ * ring_shm is set while rings carry the traffic; the mapping itself
+ * stays in ring_shm_map so a thread still waiting on a ring at session
+ * teardown never touches unmapped memory.
+ */
+static struct ase_ring_shm_t *ring_shm;
+static struct ase_ring_shm_t *ring_shm_map;
+#ifndef SIM_SIDE
+// Application threads share each ring end, serialize them
+static pthread_mutex_t ring_lock[ASE_MQ_INSTANCES];
+static pthread_once_t ring_lock_once = PTHREAD_ONCE_INIT;
+// Spinning only pays off if the simulator has a CPU of its own
+static int ring_spins;
+#endif
+
+
+/*
+ * ring_file_path: Ring file lives next to the named pipes
+ */
+static void ring_file_path(char *path)
+{
+	snprintf(path, ASE_FILEPATH_LEN, "%s/%s", ase_workdir_path,
+		 ASE_RING_FILENAME);
+}
+
+
+/*
+ * ring_futex: Wait on / wake a ring head shared between processes
+ */
+static int ring_futex(uint32_t *addr, int op, uint32_t val,
+		      const struct timespec *timeout)
+{
+	return syscall(SYS_futex, addr, op, val, timeout, NULL, 0);
+}
+
+
+/*
+ * mq_ring_index: Ring carrying message queue descriptor mq, -1 when
+ *                the pipe must be used
+ */
+static int mq_ring_index(int mq)
+{
+	int ipc_iter;
+
+	if ((ring_shm == NULL) || (mq < 0))
+		return -1;
+
+#ifdef SIM_SIDE
+	// Only while an application is attached
+	if (__atomic_load_n(&ring_shm->app_attached, __ATOMIC_ACQUIRE) == 0)
+		return -1;
+#endif
+
+	for (ipc_iter = 0; ipc_iter < ASE_MQ_INSTANCES; ipc_iter++) {
+		if (mq_array[ipc_iter].fd == mq)
+			return ipc_iter;
+	}
+
+	return -1;
+}
+
+
+#ifndef SIM_SIDE
+static void ring_lock_init(void)
+{
+	int ipc_iter;
+
+	for (ipc_iter = 0; ipc_iter < ASE_MQ_INSTANCES; ipc_iter++)
+		pthread_mutex_init(&ring_lock[ipc_iter], NULL);
+
+	ring_spins = (sysconf(_SC_NPROCESSORS_ONLN) > 1) ? ASE_RING_SPINS : 0;
+}
+
+
+static void ring_unlock(void *lock)
+{
+	pthread_mutex_unlock((pthread_mutex_t *) lock);
+}
+#endif
+
+
+/*
+ * ring_push: Copy one packet into a ring
+ * Wakes the consumer only if it went to sleep.
+ */
+static void ring_push(int idx, const char *str, int size)
+{
+	struct ase_ring_t *ring = &ring_shm_map->ring[idx];
+	uint32_t head;
+
+	if (size > ASE_MQ_MSGSIZE)
+		size = ASE_MQ_MSGSIZE;
+
+#ifndef SIM_SIDE
+	pthread_mutex_lock(&ring_lock[idx]);
+#endif
+
+	head = ring->head;
+#ifdef SIM_SIDE
+	// The application never has more than a ring's worth of requests
+	// in flight, so a full ring means it stopped draining. Never stall
+	// the simulator on it.
+	if (head - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE) >=
+	    ASE_RING_SLOTS) {
+		ASE_ERR("IPC ring %s is full, message dropped\n",
+			mq_array[idx].name);
+		return;
+	}
+#else
+	while (head - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE) >=
+	       ASE_RING_SLOTS) {
+		sched_yield();
+	}
+#endif
+
+	ase_memcpy(ring->slot[head % ASE_RING_SLOTS], str, size);
+
+	// Publish, then check for a sleeper (pairs with ring_pop)
+	__atomic_store_n(&ring->head, head + 1, __ATOMIC_SEQ_CST);
+	if (__atomic_load_n(&ring->waiting, __ATOMIC_SEQ_CST) != 0)
+		ring_futex(&ring->head, FUTEX_WAKE, 1, NULL);
+
+#ifndef SIM_SIDE
+	pthread_mutex_unlock(&ring_lock[idx]);
+#endif
+}
+
+
+/*
+ * ring_pop: Copy one packet out of a ring
+ * Simulator side polls, like its non-blocking pipes. Application side
+ * blocks like its pipes: pause-spin briefly, then sleep on the ring
+ * head, waking up periodically for cancellation and simulator exit.
+ */
+static int ring_pop(int idx, char *str, int size)
+{
+	struct ase_ring_t *ring = &ring_shm_map->ring[idx];
+	uint32_t tail;
+	int ret = ASE_MSG_PRESENT;
+
+	if (size > ASE_MQ_MSGSIZE)
+		size = ASE_MQ_MSGSIZE;
+
+#ifdef SIM_SIDE
+	tail = ring->tail;
+	if (__atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) == tail)
+		return ASE_MSG_ABSENT;
+#else
+	struct timespec nap = { 0, 10000000 };
+	int spins = ring_spins;
+
+	pthread_mutex_lock(&ring_lock[idx]);
+	pthread_cleanup_push(ring_unlock, &ring_lock[idx]);
+
+	tail = ring->tail;
+	while (__atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) == tail) {
+		if (spins > 0) {
+			spins--;
+#if defined(__x86_64__) || defined(__i386__)
+			__builtin_ia32_pause();
+#endif
+			continue;
+		}
+
+		// Announce the sleep, then recheck (pairs with ring_push)
+		__atomic_store_n(&ring->waiting, 1, __ATOMIC_SEQ_CST);
+		if (__atomic_load_n(&ring->head, __ATOMIC_SEQ_CST) == tail)
+			ring_futex(&ring->head, FUTEX_WAIT, tail, &nap);
+		__atomic_store_n(&ring->waiting, 0, __ATOMIC_RELAXED);
+
+		pthread_testcancel();
+		if (ring_shm_map->magic != ASE_RING_MAGIC) {
+			ret = ASE_MSG_ABSENT;
+			break;
+		}
+	}
+#endif
+
+	if (ret == ASE_MSG_PRESENT) {
+		ase_memcpy(str, ring->slot[tail % ASE_RING_SLOTS], size);
+		__atomic_store_n(&ring->tail, tail + 1, __ATOMIC_RELEASE);
+	}
+
+#ifndef SIM_SIDE
+	pthread_cleanup_pop(1);
+#endif
+
+	return ret;
+}
+
+
+#ifdef SIM_SIDE
+/*
+ * ipc_ring_create: Create and map the ring file (simulator)
+ * On failure the session simply runs over the named pipes.
+ */
+void ipc_ring_create(void)
+{
+	FUNC_CALL_ENTRY;
+
+	char ring_path[ASE_FILEPATH_LEN];
+	struct ase_ring_shm_t *shm;
+	int fd;
+
+	ring_file_path(ring_path);
+	unlink(ring_path);
+
+	fd = open(ring_path, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+	if (fd < 0) {
+		ASE_ERR("Could not create IPC rings, using pipes\n");
+		FUNC_CALL_EXIT;
+		return;
+	}
+
+	if (ftruncate(fd, sizeof(struct ase_ring_shm_t)) != 0) {
+		ASE_ERR("Could not size IPC rings, using pipes\n");
+		close(fd);
+		unlink(ring_path);
+		FUNC_CALL_EXIT;
+		return;
+	}
+
+	shm = (struct ase_ring_shm_t *) mmap(NULL,
+					     sizeof(struct ase_ring_shm_t),
+					     PROT_READ | PROT_WRITE,
+					     MAP_SHARED, fd, 0);
+	close(fd);
+	if (shm == MAP_FAILED) {
+		ASE_ERR("Could not map IPC rings, using pipes\n");
+		unlink(ring_path);
+		FUNC_CALL_EXIT;
+		return;
+	}
+
+	add_to_ipc_list("MQ", ring_path);
+
+	// File starts zeroed, publish the header last
+	shm->version = ASE_RING_VERSION;
+	__atomic_store_n(&shm->magic, ASE_RING_MAGIC, __ATOMIC_RELEASE);
+
+	ring_shm_map = shm;
+	ring_shm = shm;
+
+	FUNC_CALL_EXIT;
+}
+
+
+/*
+ * ipc_ring_destroy: Tell any waiting application, unmap and unlink
+ */
+void ipc_ring_destroy(void)
+{
+	FUNC_CALL_ENTRY;
+
+	char ring_path[ASE_FILEPATH_LEN];
+	int ipc_iter;
+
+	if (ring_shm_map != NULL) {
+		__atomic_store_n(&ring_shm_map->magic, 0, __ATOMIC_SEQ_CST);
+		for (ipc_iter = 0; ipc_iter < ASE_MQ_INSTANCES; ipc_iter++)
+			ring_futex(&ring_shm_map->ring[ipc_iter].head,
+				   FUTEX_WAKE, INT32_MAX, NULL);
+
+		ring_shm = NULL;
+		munmap(ring_shm_map, sizeof(struct ase_ring_shm_t));
+		ring_shm_map = NULL;
+
+		ring_file_path(ring_path);
+		unlink(ring_path);
+	}
+
+	FUNC_CALL_EXIT;
+}
+
+#else
+
+/*
+ * ipc_ring_attach: Switch the session to the simulator's rings
+ * (application). Keeps the pipes if ASE_IPC_TRANSPORT=pipe or the
+ * simulator has no usable rings.
+ */
+void ipc_ring_attach(void)
+{
+	FUNC_CALL_ENTRY;
+
+	char ring_path[ASE_FILEPATH_LEN];
+	struct ase_ring_shm_t *shm;
+	struct stat ring_stat;
+	char *transport;
+	int ipc_iter;
+	int fd;
+
+	transport = getenv("ASE_IPC_TRANSPORT");
+	if ((transport != NULL) && (ase_strncmp(transport, "pipe", 4) == 0)) {
+		ASE_MSG("IPC transport => named pipes\n");
+		FUNC_CALL_EXIT;
+		return;
+	}
+
+	pthread_once(&ring_lock_once, ring_lock_init);
+
+	shm = ring_shm_map;
+	if (shm == NULL) {
+		ring_file_path(ring_path);
+		fd = open(ring_path, O_RDWR);
+		if (fd < 0) {
+			ASE_MSG("IPC transport => named pipes\n");
+			FUNC_CALL_EXIT;
+			return;
+		}
+
+		if ((fstat(fd, &ring_stat) != 0)
+		    || (ring_stat.st_size !=
+			(off_t) sizeof(struct ase_ring_shm_t))) {
+			ASE_MSG
+			    ("IPC rings do not match simulator, using named pipes\n");
+			close(fd);
+			FUNC_CALL_EXIT;
+			return;
+		}
+
+		shm = (struct ase_ring_shm_t *) mmap(NULL,
+						     sizeof(struct
+							    ase_ring_shm_t),
+						     PROT_READ | PROT_WRITE,
+						     MAP_SHARED, fd, 0);
+		close(fd);
+		if (shm == MAP_FAILED) {
+			ASE_MSG("IPC transport => named pipes\n");
+			FUNC_CALL_EXIT;
+			return;
+		}
+		ring_shm_map = shm;
+	}
+
+	if ((__atomic_load_n(&shm->magic, __ATOMIC_ACQUIRE) != ASE_RING_MAGIC)
+	    || (shm->version != ASE_RING_VERSION)) {
+		ASE_MSG
+		    ("IPC rings do not match simulator, using named pipes\n");
+		FUNC_CALL_EXIT;
+		return;
+	}
+
+	// Simulator leaves the rings alone until app_attached is set
+	for (ipc_iter = 0; ipc_iter < ASE_MQ_INSTANCES; ipc_iter++) {
+		shm->ring[ipc_iter].head = 0;
+		shm->ring[ipc_iter].tail = 0;
+		shm->ring[ipc_iter].waiting = 0;
+	}
+	__atomic_store_n(&shm->app_attached, 1, __ATOMIC_SEQ_CST);
+	ring_shm = shm;
+
+	ASE_MSG("IPC transport => shared memory rings\n");
+
+	FUNC_CALL_EXIT;
+}
+
+
+/*
+ * ipc_ring_detach: Hand the session back to the named pipes
+ */
+void ipc_ring_detach(void)
+{
+	FUNC_CALL_ENTRY;
+
+	if (ring_shm != NULL) {
+		__atomic_store_n(&ring_shm->app_attached, 0,
+				 __ATOMIC_SEQ_CST);
+		ring_shm = NULL;
+	}
+
+	FUNC_CALL_EXIT;
+}
+#endif
+
+
 // ------------------------------------------------------------
 // mqueue_send(): Easy send function
 // - Typecast any message as a character array and ram it in.
+// - Goes through the shared memory ring when one is attached
 // ------------------------------------------------------------
 void mqueue_send(int mq, const char *str, int size)
 {
 	FUNC_CALL_ENTRY;
 
 	int ret_tx;
+	int ring_idx;
+
+	ring_idx = mq_ring_index(mq);
+	if (ring_idx >= 0) {
+		ring_push(ring_idx, str, size);
+		FUNC_CALL_EXIT;
+		return;
+	}
+
 	ret_tx = write(mq, (void *) str, size);
 
 	if ((ret_tx == 0) || (ret_tx != size)) {
@@ -327,12 +728,20 @@ void mqueue_send(int mq, const char *str, int size)
 // ------------------------------------------------------------------
 // mqueue_recv(): Easy receive function
 // - Typecast message back to a required type
+// - Goes through the shared memory ring when one is attached
 // ------------------------------------------------------------------
 int mqueue_recv(int mq, char *str, int size)
 {
 	FUNC_CALL_ENTRY;
 
 	int ret;
+	int ring_idx;
+
+	ring_idx = mq_ring_index(mq);
+	if (ring_idx >= 0) {
+		FUNC_CALL_EXIT;
+		return ring_pop(ring_idx, str, size);
+	}
 
 	ret = read(mq, str, size);
 	FUNC_CALL_EXIT;
@@ -78,19 +78,31 @@ int ase_instance_running(void)
 	FUNC_CALL_ENTRY;
 
 	int ase_simv_pid;
-
-	// If Ready file does not exist
-	if (access(ASE_READY_FILENAME, F_OK) == -1) {
+	char *pwd_str;
+	char *session_str;
+	char ready_path[ASE_FILEPATH_LEN];
+
+	// Same session (directory and ASE_SESSION key) only
+	pwd_str = ase_malloc(ASE_FILEPATH_LEN);
+	session_str = ase_malloc(ASE_FILEPATH_LEN);
+	if ((getcwd(pwd_str, ASE_FILEPATH_LEN) == NULL)
+	    || (ase_session_path(session_str, pwd_str) != 0)) {
 		ase_simv_pid = 0;
+	} else {
+		snprintf(ready_path, ASE_FILEPATH_LEN, "%s/%s",
+			 session_str, ASE_READY_FILENAME);
+
+		// If Ready file does not exist
+		if (access(ready_path, F_OK) == -1) {
+			ase_simv_pid = 0;
+		}
+		// If ready file exists
+		else {
+			ase_simv_pid = ase_read_lock_file(session_str);
+		}
 	}
-	// If ready file exists
-	else {
-		char *pwd_str;
-		pwd_str = ase_malloc(ASE_FILEPATH_LEN);
-		ase_simv_pid =
-		    ase_read_lock_file(getcwd(pwd_str, ASE_FILEPATH_LEN));
-		free(pwd_str);
-	}
+	free(pwd_str);
+	free(session_str);
 
 	FUNC_CALL_EXIT;
 	return ase_simv_pid;
@@ -179,11 +191,10 @@ uint32_t get_ase_seed(void)
 
 /*
  * DPI: WriteLine Data exchange
+ * Called once per line, keep it free of allocations and logging
  */
 void wr_memline_dex(cci_pkt *pkt)
 {
-	FUNC_CALL_ENTRY;
-
 	uint64_t phys_addr;
 	uint64_t *wr_target_vaddr = (uint64_t *) NULL;
 	int intr_id;
@@ -202,11 +213,13 @@ void wr_memline_dex(cci_pkt *pkt)
 		// Get cl_addr, deduce wr_target_vaddr
 		phys_addr = (uint64_t) pkt->cl_addr << 6;
 		wr_target_vaddr =
-		    ase_fakeaddr_to_vaddr((uint64_t) phys_addr);
+		    ase_line_xlate(phys_addr, ASE_XLATE_CH_WR);
 
 		// Write to memory
-		ase_memcpy(wr_target_vaddr, (char *) pkt->qword,
-			   CL_BYTE_WIDTH);
+		if (wr_target_vaddr != (uint64_t *) NOT_OK)
+			ase_line_copy(wr_target_vaddr, pkt->qword);
+		ase_record_post(ASE_RECORD_MEMWR, 0, phys_addr, 0,
+				pkt->qword, CL_BYTE_WIDTH);
 
 		// Success
 		pkt->success = 1;
@@ -216,6 +229,7 @@ void wr_memline_dex(cci_pkt *pkt)
 		 */
 		// Trigger interrupt action
 		intr_id = pkt->intr_id;
+		ase_record_post(ASE_RECORD_INTR, intr_id, 0, 0, NULL, 0);
 		ase_interrupt_generator(intr_id);
 
 		// Success
@@ -253,29 +267,27 @@ void wr_memline_dex(cci_pkt *pkt)
 /* #endif */
 /*     } */
 /* #endif */
-
-	FUNC_CALL_EXIT;
 }
 
 
 /*
  * DPI: ReadLine Data exchange
+ * Called once per line, keep it free of allocations and logging
  */
 void rd_memline_dex(cci_pkt *pkt)
 {
-	FUNC_CALL_ENTRY;
-
 	uint64_t phys_addr;
 	uint64_t *rd_target_vaddr = (uint64_t *) NULL;
 
 	// Get cl_addr, deduce rd_target_vaddr
 	phys_addr = (uint64_t) pkt->cl_addr << 6;
-	rd_target_vaddr = ase_fakeaddr_to_vaddr((uint64_t) phys_addr);
+	rd_target_vaddr = ase_line_xlate(phys_addr, ASE_XLATE_CH_RD);
 
 	// Read from memory
-	ase_memcpy((char *) pkt->qword, rd_target_vaddr, CL_BYTE_WIDTH);
-
-	FUNC_CALL_EXIT;
+	if (rd_target_vaddr != (uint64_t *) NOT_OK)
+		ase_line_copy(pkt->qword, rd_target_vaddr);
+	ase_record_post(ASE_RECORD_MEMRD, 0, phys_addr, 0, pkt->qword,
+			CL_BYTE_WIDTH);
 }
 
 
@@ -294,6 +306,8 @@ void mmio_response(struct mmio_t *mmio_pkt)
 #endif
 
 	// Send MMIO Response
+	ase_record_post(ASE_RECORD_MMIORSP, mmio_pkt->tid, mmio_pkt->addr, 0,
+			mmio_pkt, sizeof(mmio_t));
 	mqueue_send(sim2app_mmiorsp_tx, (char *) mmio_pkt, sizeof(mmio_t));
 
 	// Unlock channel
@@ -312,6 +326,20 @@ void ase_interrupt_generator(int id)
 }
 
 
+/*
+ * Port control response: echo the completed command back
+ */
+static void portctrl_respond(int cmd)
+{
+	portctrl_cmd_t portctrl_rsp;
+
+	portctrl_rsp.cmd = cmd;
+	portctrl_rsp.value = 0;
+	mqueue_send(sim2app_portctrl_rsp_tx, (char *) &portctrl_rsp,
+		    sizeof(portctrl_cmd_t));
+}
+
+
 /*
  * DPI: Reset response
  */
@@ -320,8 +348,7 @@ void sw_reset_response(void)
 	FUNC_CALL_ENTRY;
 
 	// Send portctrl_rsp message
-	mqueue_send(sim2app_portctrl_rsp_tx, completed_str_msg,
-		    ASE_MQ_MSGSIZE);
+	portctrl_respond(ASE_PORTCTRL_AFU_RESET);
 
 	FUNC_CALL_EXIT;
 }
@@ -429,36 +456,30 @@ int ase_listener(void)
 	// ---------------------------------------------------------------------- //
 	/*
 	 * Port Control message
-	 * Format: <cmd> <value>
+	 * Format: portctrl_cmd_t { cmd, value }
 	 * -----------------------------------------------------------------
-	 * Supported commands       |
-	 * ASE_INIT   <APP_PID>     | Session control - sends PID to
-	 *                          |
-	 * AFU_RESET  <0,1>         | AFU reset handle
-	 * UMSG_MODE  <8-bit mask>  | UMSG mode control
+	 * Supported commands                 |
+	 * ASE_PORTCTRL_ASE_INIT   <APP_PID>  | Session control - sends PID to
+	 *                                    |
+	 * ASE_PORTCTRL_AFU_RESET  <0,1>      | AFU reset handle
+	 * ASE_PORTCTRL_UMSG_MODE  <mask>     | UMSG mode control
 	 *
-	 * ASE responds with "COMPLETED" as a string, there is no
-	 * expectation of a string check
+	 * ASE echoes the command back once completed, there is no
+	 * expectation of a check
 	 *
 	 */
-	char portctrl_msgstr[ASE_MQ_MSGSIZE];
-	char portctrl_cmd[ASE_MQ_MSGSIZE];
+	portctrl_cmd_t portctrl_req;
 	int portctrl_value;
-	memset(portctrl_msgstr, 0, ASE_MQ_MSGSIZE);
-	memset(portctrl_cmd, 0, ASE_MQ_MSGSIZE);
-
-	// Allocate a completed string
-	completed_str_msg = (char *) ase_malloc(ASE_MQ_MSGSIZE);
-	snprintf(completed_str_msg, 10, "COMPLETED");
 
 	// Simulator is not in lockdown mode (simkill not in progress)
 	if (self_destruct_in_progress == 0) {
 		if (mqueue_recv
-		    (app2sim_portctrl_req_rx, (char *) portctrl_msgstr,
-		     ASE_MQ_MSGSIZE) == ASE_MSG_PRESENT) {
-			sscanf(portctrl_msgstr, "%s %d", portctrl_cmd,
-			       &portctrl_value);
-			if (ase_strncmp(portctrl_cmd, "AFU_RESET", 9) == 0) {
+		    (app2sim_portctrl_req_rx, (char *) &portctrl_req,
+		     sizeof(portctrl_cmd_t)) == ASE_MSG_PRESENT) {
+			portctrl_value = portctrl_req.value;
+			ase_record_post(ASE_RECORD_PORTCTRL, portctrl_req.cmd,
+					0, portctrl_value, NULL, 0);
+			if (portctrl_req.cmd == ASE_PORTCTRL_AFU_RESET) {
 				// AFU Reset control
 				portctrl_value =
 				    (portctrl_value != 0) ? 1 : 0;
@@ -469,9 +490,7 @@ int ase_listener(void)
 
 				// Reset response is returned from simulator once queues are cleared
 				// Simulator cannot be held up here.
-			} else
-			    if (ase_strncmp(portctrl_cmd, "UMSG_MODE", 9)
-				== 0) {
+			} else if (portctrl_req.cmd == ASE_PORTCTRL_UMSG_MODE) {
 				// Umsg mode setting here
 				glbl_umsgmode =
 				    portctrl_value & 0xFFFFFFFF;
@@ -481,11 +500,8 @@ int ase_listener(void)
 				buffer_msg_inject(1, umsg_mode_msg);
 
 				// Send portctrl_rsp message
-				mqueue_send(sim2app_portctrl_rsp_tx,
-					    completed_str_msg,
-					    ASE_MQ_MSGSIZE);
-			} else if (ase_strncmp(portctrl_cmd, "ASE_INIT", 8)
-				   == 0) {
+				portctrl_respond(portctrl_req.cmd);
+			} else if (portctrl_req.cmd == ASE_PORTCTRL_ASE_INIT) {
 				ASE_INFO("Session requested by PID = %d\n",
 					 portctrl_value);
 				// Generate new timestamp
@@ -496,7 +512,6 @@ int ase_listener(void)
 					 "%s/%s", ase_workdir_path,
 					 TSTAMP_FILENAME);
 				// Print timestamp
-				glbl_session_id = ase_malloc(20);
 				get_timestamp(glbl_session_id);
 				ASE_MSG("Session ID => %s\n",
 					glbl_session_id);
@@ -504,12 +519,9 @@ int ase_listener(void)
 				session_empty = 0;
 
 				// Send portctrl_rsp message
-				mqueue_send(sim2app_portctrl_rsp_tx,
-					    completed_str_msg,
-					    ASE_MQ_MSGSIZE);
+				portctrl_respond(portctrl_req.cmd);
 			} else
-			    if (ase_strncmp
-				(portctrl_cmd, "ASE_SIMKILL", 11) == 0) {
+			    if (portctrl_req.cmd == ASE_PORTCTRL_ASE_SIMKILL) {
 #ifdef ASE_DEBUG
 				ASE_MSG
 				    ("ASE_SIMKILL requested, processing options... \n");
@@ -572,20 +584,13 @@ int ase_listener(void)
 #endif
 
 				// Send portctrl_rsp message
-				mqueue_send(sim2app_portctrl_rsp_tx,
-					    completed_str_msg,
-					    ASE_MQ_MSGSIZE);
-
-				// Clean up session OD
-				ase_free_buffer(glbl_session_id);
+				portctrl_respond(portctrl_req.cmd);
 			} else {
 				ASE_ERR
 				    ("Undefined Port Control function ... IGNORING\n");
 
 				// Send portctrl_rsp message
-				mqueue_send(sim2app_portctrl_rsp_tx,
-					    completed_str_msg,
-					    ASE_MQ_MSGSIZE);
+				portctrl_respond(portctrl_req.cmd);
 			}
 		}
 		// ------------------------------------------------------------------------------- //
@@ -596,7 +601,6 @@ int ase_listener(void)
 		struct buffer_t ase_buffer;
 		char logger_str[ASE_LOGGER_LEN];
 		char incoming_alloc_msgstr[ASE_MQ_MSGSIZE];
-		memset(incoming_alloc_msgstr, 0, ASE_MQ_MSGSIZE);
 
 		// Receive a DPI message and get information from replicated buffer
 		ase_empty_buffer(&ase_buffer);
@@ -610,6 +614,13 @@ int ase_listener(void)
 
 			// Allocate action
 			ase_alloc_action(&ase_buffer);
+		}
+		// Log the new workspace, the arena mapping is not one
+		if ((ase_buffer.valid == ASE_BUFFER_VALID) &&
+		    (ase_buffer.arena != ASE_ARENA_REGION)) {
+			ase_record_post(ASE_RECORD_ALLOC, ase_buffer.index,
+					ase_buffer.fake_paddr,
+					ase_buffer.memsize, NULL, 0);
 			ase_buffer.is_privmem = 0;
 			if (ase_buffer.index == 0) {
 				ase_buffer.is_mmiomap = 1;
@@ -635,10 +646,17 @@ int ase_listener(void)
 					 "Buffer %d Allocated ",
 					 ase_buffer.index);
 			}
-			snprintf(logger_str + strlen(logger_str),
-				 ASE_LOGGER_LEN,
-				 " (located /dev/shm/%s) =>\n",
-				 ase_buffer.memname);
+			if (ase_buffer.arena == ASE_ARENA_SUBALLOC) {
+				snprintf(logger_str + strlen(logger_str),
+					 ASE_LOGGER_LEN,
+					 " (arena offset 0x%" PRIx64 ") =>\n",
+					 ase_buffer.arena_offset);
+			} else {
+				snprintf(logger_str + strlen(logger_str),
+					 ASE_LOGGER_LEN,
+					 " (located /dev/shm/%s) =>\n",
+					 ase_buffer.memname);
+			}
 			snprintf(logger_str + strlen(logger_str),
 				 ASE_LOGGER_LEN,
 				 "\t\tHost App Virtual Addr  = 0x%" PRIx64
@@ -681,7 +699,6 @@ int ase_listener(void)
 		}
 		// ------------------------------------------------------------------------------- //
 		char incoming_dealloc_msgstr[ASE_MQ_MSGSIZE];
-		memset(incoming_dealloc_msgstr, 0, ASE_MQ_MSGSIZE);
 
 		ase_empty_buffer(&ase_buffer);
 		if (mqueue_recv
@@ -702,6 +719,8 @@ int ase_listener(void)
 				 ASE_LOGGER_LEN, "\n");
 
 			// Deallocate action
+			ase_record_post(ASE_RECORD_DEALLOC, ase_buffer.index,
+					0, 0, NULL, 0);
 			ase_dealloc_action(&ase_buffer, 1);
 
 			// Inject buffer message
@@ -734,26 +753,26 @@ int ase_listener(void)
 			print_mmiopkt(fp_memaccess_log, "MMIO Sent",
 				      incoming_mmio_pkt);
 #endif
+			ase_record_post(ASE_RECORD_MMIOREQ,
+					incoming_mmio_pkt->tid,
+					incoming_mmio_pkt->addr, 0,
+					incoming_mmio_pkt, sizeof(mmio_t));
 			mmio_dispatch(0, incoming_mmio_pkt);
 		}
 		// ------------------------------------------------------------------------------- //
 		/*
 		 * UMSG engine
 		 */
-		char umsg_mapstr[ASE_MQ_MSGSIZE];
-
-		// cleanse string before reading
 		if (mqueue_recv
-		    (app2sim_umsg_rx, (char *) umsg_mapstr,
+		    (app2sim_umsg_rx, (char *) incoming_umsg_pkt,
 		     sizeof(struct umsgcmd_t)) == ASE_MSG_PRESENT) {
-			ase_memcpy(incoming_umsg_pkt,
-				   (umsgcmd_t *) umsg_mapstr,
-				   sizeof(struct umsgcmd_t));
-
 			// Hint trigger
 			incoming_umsg_pkt->hint =
 			    (glbl_umsgmode >> (4 * incoming_umsg_pkt->id))
 			    & 0xF;
+			ase_record_post(ASE_RECORD_UMSG, incoming_umsg_pkt->id,
+					0, 0, incoming_umsg_pkt,
+					sizeof(struct umsgcmd_t));
 
 			// dispatch to event processing
 #ifdef ASE_ENABLE_UMSG_FEATURE
@@ -802,6 +821,9 @@ void calc_phys_memory_ranges(void)
 		PRIx64 " | %" PRId64 "~%" PRId64 " GB \n", sysmem_phys_lo,
 		sysmem_phys_hi, sysmem_phys_lo / (uint64_t) pow(1024, 3),
 		(uint64_t) (sysmem_phys_hi + 1) / (uint64_t) pow(1024, 3));
+
+	// 2MB frame map for workspace placement
+	ase_paddr_frames_init();
 }
 
 
@@ -814,6 +836,8 @@ int ase_init(void)
 {
 	FUNC_CALL_ENTRY;
 
+	char log_filepath[ASE_FILEPATH_LEN];
+
 	// Set loglevel
 	glbl_loglevel = ase_calc_loglevel();
 
@@ -862,10 +886,33 @@ int ase_init(void)
 	// Create IPC cleanup setup
 	create_ipc_listfile();
 
+	// Binary transaction trace, replaces the .tsv transactions file
+	if (cfg->enable_binary_trace != 0) {
+		snprintf(log_filepath, ASE_FILEPATH_LEN, "%s/%s",
+			 ase_workdir_path, ASE_TRACE_FILENAME);
+		if (ase_trace_open(log_filepath) == 0)
+			ASE_INFO_2
+			    ("ASE Binary trace           ... ENABLED\n");
+		else
+			cfg->enable_binary_trace = 0;
+	}
+
+	// Session recording, replayed with ase_replay
+	if (cfg->enable_record != 0) {
+		snprintf(log_filepath, ASE_FILEPATH_LEN, "%s/%s",
+			 ase_workdir_path, ASE_RECORD_FILENAME);
+		if (ase_record_open(log_filepath) == 0)
+			ASE_INFO_2
+			    ("ASE Session recording      ... ENABLED\n");
+		else
+			cfg->enable_record = 0;
+	}
+
 	// Sniffer file stat path
 	ccip_sniffer_file_statpath = ase_malloc(ASE_FILEPATH_LEN);
+	// Written by the protocol checker in the run directory
 	snprintf(ccip_sniffer_file_statpath, ASE_FILEPATH_LEN,
-		 "%s/ccip_warning_and_errors.txt", ase_workdir_path);
+		 "%s/ccip_warning_and_errors.txt", getenv("PWD"));
 
 	// Remove existing error log files from previous run
 	if (access(ccip_sniffer_file_statpath, F_OK) == 0) {
@@ -880,7 +927,9 @@ int ase_init(void)
 	 */
 #ifdef ASE_DEBUG
 	// Create a memory access log
-	fp_memaccess_log = fopen("aseafu_access.log", "w");
+	snprintf(log_filepath, ASE_FILEPATH_LEN, "%s/aseafu_access.log",
+		 ase_workdir_path);
+	fp_memaccess_log = fopen(log_filepath, "w");
 	if (fp_memaccess_log == NULL) {
 		ASE_ERR
 		    ("  [DEBUG]  Memory access debug logger initialization failed !\n");
@@ -889,7 +938,9 @@ int ase_init(void)
 	}
 
 	// Page table tracker
-	fp_pagetable_log = fopen("ase_pagetable.log", "w");
+	snprintf(log_filepath, ASE_FILEPATH_LEN, "%s/ase_pagetable.log",
+		 ase_workdir_path);
+	fp_pagetable_log = fopen(log_filepath, "w");
 	if (fp_pagetable_log == NULL) {
 		ASE_ERR
 		    ("  [DEBUG]  ASE pagetable logger initialization failed !\n");
@@ -926,6 +977,9 @@ int ase_init(void)
 	sim2app_intr_request_tx =
 	    mqueue_open(mq_array[9].name, mq_array[9].perm_flag);
 
+	// Shared memory rings, used once an application attaches
+	ipc_ring_create();
+
 	// Calculate memory map regions
 	ASE_MSG("Calculating memory map...\n");
 	calc_phys_memory_ranges();
@@ -943,13 +997,16 @@ int ase_init(void)
 	ase_write_seed(cfg->ase_seed);
 	srand(cfg->ase_seed);
 
-	// Open Buffer info log
-	fp_workspace_log = fopen("workspace_info.log", "wb");
+	// Open Buffer info log, one per session directory
+	snprintf(log_filepath, ASE_FILEPATH_LEN,
+		 "%s/workspace_info.log", ase_workdir_path);
+	fp_workspace_log = fopen(log_filepath, "wb");
 	if (fp_workspace_log == (FILE *) NULL) {
 		ase_error_report("fopen", errno, ASE_OS_FOPEN_ERR);
 	} else {
 		ASE_INFO_2
-		    ("Information about allocated buffers => workspace_info.log \n");
+		    ("Information about allocated buffers => %s \n",
+		     log_filepath);
 	}
 
 	fflush(stdout);
@@ -1041,6 +1098,9 @@ void start_simkill_countdown(void)
 	// Close and unlink message queue
 	ASE_MSG("Closing message queue and unlinking...\n");
 
+	// Release IPC rings (wakes up a waiting application)
+	ipc_ring_destroy();
+
 	// Close message queues
 	mqueue_close(app2sim_alloc_rx);
 	mqueue_close(sim2app_alloc_tx);
@@ -1093,10 +1153,19 @@ void start_simkill_countdown(void)
 	}
 	// Print location of log files
 	ASE_INFO("Simulation generated log files\n");
-	ASE_INFO
-	    ("        Transactions file       | $ASE_WORKDIR/ccip_transactions.tsv\n");
+	if (cfg->enable_binary_trace != 0)
+		ASE_INFO
+		    ("        Transactions trace      | $ASE_WORKDIR/%s\n",
+		     ASE_TRACE_FILENAME);
+	else
+		ASE_INFO
+		    ("        Transactions file       | $ASE_WORKDIR/ccip_transactions.tsv\n");
 	ASE_INFO
 	    ("        Workspaces info         | $ASE_WORKDIR/workspace_info.log\n");
+	if (cfg->enable_record != 0)
+		ASE_INFO
+		    ("        Session recording       | $ASE_WORKDIR/%s\n",
+		     ASE_RECORD_FILENAME);
 	if (access(ccip_sniffer_file_statpath, F_OK) != -1) {
 		ASE_INFO
 		    ("        Protocol warning/errors | $ASE_WORKDIR/ccip_warning_and_errors.txt\n");
@@ -1123,6 +1192,10 @@ void start_simkill_countdown(void)
 	ase_free_buffer((char *) incoming_umsg_pkt);
 	// ase_free_buffer (ase_workdir_path);
 
+	// Flush binary trace and session recording
+	ase_trace_close();
+	ase_record_close();
+
 	// Issue Simulation kill
 	simkill();
 
@@ -1163,6 +1236,9 @@ void ase_config_parse(char *filename)
 	cfg->enable_cl_view = 1;
 	cfg->usr_tps = DEFAULT_USR_CLK_TPS;
 	cfg->phys_memory_available_gb = 256;
+	cfg->enable_binary_trace = 0;
+	cfg->enable_random_physaddr = 1;
+	cfg->enable_record = 0;
 
 	// Fclk Mhz
 	f_usrclk = DEFAULT_USR_CLK_MHZ;
@@ -1276,6 +1352,51 @@ void ase_config_parse(char *filename)
 								    atoi
 								    (pch);
 							}
+						} else
+						    if (ase_strncmp
+							(parameter,
+							 "ENABLE_BINARY_TRACE",
+							 19) == 0) {
+							pch =
+							    strtok(NULL,
+								   "");
+							if (pch != NULL) {
+								cfg->
+								    enable_binary_trace
+								    =
+								    atoi
+								    (pch);
+							}
+						} else
+						    if (ase_strncmp
+							(parameter,
+							 "ENABLE_RECORD",
+							 13) == 0) {
+							pch =
+							    strtok(NULL,
+								   "");
+							if (pch != NULL) {
+								cfg->
+								    enable_record
+								    =
+								    atoi
+								    (pch);
+							}
+						} else
+						    if (ase_strncmp
+							(parameter,
+							 "ENABLE_RANDOM_PHYSADDR",
+							 22) == 0) {
+							pch =
+							    strtok(NULL,
+								   "");
+							if (pch != NULL) {
+								cfg->
+								    enable_random_physaddr
+								    =
+								    atoi
+								    (pch);
+							}
 						} else
 						    if (ase_strncmp
 							(parameter,
@@ -1484,6 +1605,10 @@ void ase_config_parse(char *filename)
 	// GBs of physical memory available
 	ASE_INFO_2("Amount of physical memory  ... %d GB\n",
 		   cfg->phys_memory_available_gb);
+	if (cfg->enable_random_physaddr != 0)
+		ASE_INFO_2("Physical address placement ... RANDOM\n");
+	else
+		ASE_INFO_2("Physical address placement ... PACKED\n");
 
 	// Transfer data to hardware (for simulation only)
 	ase_config_dex(cfg);
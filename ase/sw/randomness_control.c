@@ -48,9 +48,12 @@ uint32_t generate_ase_seed(void)
 void ase_write_seed(uint32_t seed)
 {
 	FILE *fp_seed = (FILE *) NULL;
+	char seed_filepath[ASE_FILEPATH_LEN];
 
-	// Open seed file
-	fp_seed = fopen(ASE_SEED_FILE, "w");
+	// Open seed file, kept with the session files
+	snprintf(seed_filepath, ASE_FILEPATH_LEN, "%s/%s",
+		 ase_workdir_path, ASE_SEED_FILE);
+	fp_seed = fopen(seed_filepath, "w");
 
 	// Use no more than 31-bits of seed
 	seed = seed & 0x0000FFFF;
@@ -74,9 +77,13 @@ uint32_t ase_read_seed(void)
 	FILE *fp_seed = (FILE *) NULL;
 	uint32_t new_seed;
 	uint32_t readback_seed;
+	char seed_filepath[ASE_FILEPATH_LEN];
+
+	snprintf(seed_filepath, ASE_FILEPATH_LEN, "%s/%s",
+		 ase_workdir_path, ASE_SEED_FILE);
 
 	// Check if file already exists (FALSE)
-	if (access(ASE_SEED_FILE, F_OK) == -1) {
+	if (access(seed_filepath, F_OK) == -1) {
 		ASE_ERR("ASE Seed file could not be read\n");
 		ASE_ERR("Old seed unusable --- creating a new seed\n");
 
@@ -92,7 +99,7 @@ uint32_t ase_read_seed(void)
 	// If TRUE, read seed file
 	else {
 		// Open file (known to exist)
-		fp_seed = fopen(ASE_SEED_FILE, "r");
+		fp_seed = fopen(seed_filepath, "r");
 		if (fp_seed == NULL) {
 			ASE_ERR
 			    ("ASE Seed file could not be read (NULL seed fileptr) \n");
@@ -88,8 +88,9 @@ void put_timestamp(void)
 		rdtsc_out = rdtsc();
 		ASE_DBG("  rdtsc_out = %lld\n", rdtsc_out);
 
-		// Write session code
-		fprintf(fp, "%lld\n", rdtsc_out);
+		// Write session code, the simulator PID keeps concurrent
+		// sessions apart in the shared memory namespace
+		fprintf(fp, "%x.%llx\n", getpid(), rdtsc_out);
 
 		// Close file
 		fclose(fp);
@@ -131,7 +132,9 @@ void get_timestamp(char *session_str)
 #endif
 			} else {
 				// Read timestamp file
-				if (fgets(session_str, 20, fp) == NULL) {
+				if (fgets
+				    (session_str, ASE_SESSION_ID_LEN,
+				     fp) == NULL) {
 					ase_error_report("fgets", errno,
 							 ASE_OS_MALLOC_ERR);
 #ifdef SIM_SIDE
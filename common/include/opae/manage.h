@@ -131,6 +131,75 @@ fpga_result fpgaReconfigureSlot(fpga_handle fpga,
 				const uint8_t *bitstream,
 				size_t bitstream_len, int flags);
 
+/**
+ * Register an AFU image with the handle's image library
+ *
+ * Reads the green bitstream file, validates it against the FPGA (GUID,
+ * metadata and interface ID) and keeps the validated image, together with
+ * its user clock and power settings, resident and locked in memory. The
+ * image can then be programmed with fpgaLoadImage() without repeating
+ * that work.
+ *
+ * The resident images are bounded by fpgaSetImageLibraryLimit(). When the
+ * limit is exceeded, the least recently loaded images are dropped from
+ * memory; their IDs stay valid and are prepared again on next use.
+ *
+ * @param[in]  fpga      Handle to an FPGA object previously opened
+ * @param[in]  slot      Slot the image will be programmed into
+ * @param[in]  gbs_path  Path to the green bitstream file
+ * @param[out] image_id  ID identifying the image in later calls
+ * @returns FPGA_OK on success. FPGA_INVALID_PARAM if the parameters or the
+ * bitstream are not valid. FPGA_NOT_FOUND if the file cannot be read.
+ * FPGA_NO_MEMORY if the image cannot be stored.
+ */
+fpga_result fpgaRegisterImage(fpga_handle fpga,
+			      uint32_t slot,
+			      const char *gbs_path,
+			      uint64_t *image_id);
+
+/**
+ * Reconfigure a slot from a registered image
+ *
+ * Programs the image into the slot given to fpgaRegisterImage(). If the
+ * image is resident, only the user clock, power threshold and partial
+ * reconfiguration steps of fpgaReconfigureSlot() are performed.
+ *
+ * @param[in]  fpga      Handle to an FPGA object previously opened
+ * @param[in]  image_id  ID returned by fpgaRegisterImage()
+ * @returns See fpgaReconfigureSlot(). FPGA_NOT_FOUND if `image_id` is not
+ * registered.
+ */
+fpga_result fpgaLoadImage(fpga_handle fpga, uint64_t image_id);
+
+/**
+ * Remove an image from the handle's image library
+ *
+ * @param[in]  fpga      Handle to an FPGA object previously opened
+ * @param[in]  image_id  ID returned by fpgaRegisterImage()
+ * @returns FPGA_OK on success. FPGA_NOT_FOUND if `image_id` is not
+ * registered.
+ */
+fpga_result fpgaUnregisterImage(fpga_handle fpga, uint64_t image_id);
+
+/**
+ * Bound the memory held by the handle's image library
+ *
+ * @param[in]  fpga       Handle to an FPGA object previously opened
+ * @param[in]  max_bytes  Maximum bytes of resident images
+ * @returns FPGA_OK on success
+ */
+fpga_result fpgaSetImageLibraryLimit(fpga_handle fpga, uint64_t max_bytes);
+
+/**
+ * Retrieve image library statistics
+ *
+ * @param[in]  fpga   Handle to an FPGA object previously opened
+ * @param[out] stats  Receives the current counters
+ * @returns FPGA_OK on success. FPGA_INVALID_PARAM if `stats` is NULL.
+ */
+fpga_result fpgaGetImageLibraryStats(fpga_handle fpga,
+				     fpga_image_stats *stats);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif // __cplusplus
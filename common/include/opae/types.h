@@ -144,6 +144,23 @@ typedef struct {
 	uint16_t patch;       /**< Revision or patchlevel */
 } fpga_version;
 
+/**
+ * Image library statistics
+ *
+ * Counters maintained by the per-handle AFU image library (see
+ * fpgaRegisterImage()). `prep_ns_saved` accumulates the file read,
+ * validation and metadata parse time that fpgaLoadImage() did not have to
+ * repeat because the prepared image was still resident.
+ */
+typedef struct {
+	uint64_t num_images;    /**< Registered images */
+	uint64_t pinned_bytes;  /**< Bytes of prepared images held in memory */
+	uint64_t hits;          /**< Loads served from a prepared image */
+	uint64_t misses;        /**< Loads that had to prepare the image again */
+	uint64_t evictions;     /**< Prepared images dropped by the LRU */
+	uint64_t prep_ns_saved; /**< Preparation time avoided by hits (ns) */
+} fpga_image_stats;
+
 /** Handle to an event object
  *
  * OPAE provides an interface to asynchronous events that can be generated by
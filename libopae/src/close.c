@@ -30,6 +30,7 @@
 
 #include <opae/access.h>
 #include "common_int.h"
+#include "image_int.h"
 
 #include <stdio.h>
 #include <string.h>
@@ -52,6 +53,8 @@ fpga_result __FPGA_API__ fpgaClose(fpga_handle handle)
 
 	wsid_cleanup(&_handle->wsid_root);
 	free_umsg_buffer(handle);
+	free(_handle->uclock);
+	image_library_free(_handle->images);
 	close(_handle->fddev);
 	if (_handle->fdfpgad >= 0)
 		close(_handle->fdfpgad);
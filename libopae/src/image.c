@@ -0,0 +1,372 @@
+// Copyright(c) 2017, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif // HAVE_CONFIG_H
+
+#include "common_int.h"
+#include <opae/access.h>
+#include <opae/manage.h>
+#include "image_int.h"
+
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static uint64_t image_time_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// Drop the resident copy of an image, keeping its registration.
+static void image_release(struct _fpga_image_library *lib,
+			  struct _fpga_image *img)
+{
+	if (!img->bitstream)
+		return;
+
+	if (img->locked)
+		munlock(img->bitstream, img->bitstream_len);
+	free(img->bitstream);
+	img->bitstream = NULL;
+	img->locked = 0;
+	lib->stats.pinned_bytes -= img->bitstream_len;
+}
+
+// Evict least recently loaded images until the library fits its bound.
+// The image being loaded, if any, is never evicted.
+static void image_evict(struct _fpga_image_library *lib,
+			struct _fpga_image *keep)
+{
+	struct _fpga_image *img;
+	struct _fpga_image *lru;
+
+	while (lib->stats.pinned_bytes > lib->max_bytes) {
+		lru = NULL;
+		for (img = lib->head; img; img = img->next)
+			if (img->bitstream && img != keep)
+				lru = img;
+
+		if (!lru)
+			break;
+
+		image_release(lib, lru);
+		++lib->stats.evictions;
+	}
+}
+
+// Read the bitstream file and validate it. Caller holds the handle lock.
+static fpga_result image_prepare(fpga_handle handle,
+				 struct _fpga_image_library *lib,
+				 struct _fpga_image *img)
+{
+	fpga_result result = FPGA_OK;
+	uint64_t start = image_time_ns();
+	FILE *f;
+	long len;
+
+	f = fopen(img->path, "rb");
+	if (!f) {
+		FPGA_MSG("Failed to open %s: %s", img->path, strerror(errno));
+		return FPGA_NOT_FOUND;
+	}
+
+	if (fseek(f, 0, SEEK_END) || (len = ftell(f)) <= 0 ||
+	    fseek(f, 0, SEEK_SET)) {
+		FPGA_MSG("Failed to size %s", img->path);
+		fclose(f);
+		return FPGA_NOT_FOUND;
+	}
+
+	img->bitstream = malloc(len);
+	if (!img->bitstream) {
+		FPGA_ERR("Failed to allocate memory for image");
+		fclose(f);
+		return FPGA_NO_MEMORY;
+	}
+	img->bitstream_len = len;
+
+	if (fread(img->bitstream, 1, len, f) != (size_t)len) {
+		FPGA_MSG("Failed to read %s", img->path);
+		fclose(f);
+		result = FPGA_NOT_FOUND;
+		goto out_free;
+	}
+	fclose(f);
+
+	result = reconf_prepare(handle, img->bitstream, img->bitstream_len,
+				&img->prep);
+	if (result != FPGA_OK)
+		goto out_free;
+
+	// Keep the payload resident so a load never faults it back in.
+	img->locked = !mlock(img->bitstream, img->bitstream_len);
+	if (!img->locked)
+		FPGA_MSG("mlock failed for %s, image not pinned", img->path);
+
+	lib->stats.pinned_bytes += img->bitstream_len;
+	img->prep_ns = image_time_ns() - start;
+	return FPGA_OK;
+
+out_free:
+	free(img->bitstream);
+	img->bitstream = NULL;
+	return result;
+}
+
+static struct _fpga_image *image_find(struct _fpga_image_library *lib,
+				      uint64_t image_id,
+				      struct _fpga_image ***link)
+{
+	struct _fpga_image **p;
+
+	for (p = &lib->head; *p; p = &(*p)->next) {
+		if ((*p)->id == image_id) {
+			if (link)
+				*link = p;
+			return *p;
+		}
+	}
+
+	return NULL;
+}
+
+// Lock the handle and look up (or create) its image library.
+static fpga_result image_library_lock(fpga_handle handle,
+				      struct _fpga_image_library **lib)
+{
+	struct _fpga_handle *_handle = (struct _fpga_handle *)handle;
+	fpga_result result;
+
+	result = handle_check_and_lock(_handle);
+	if (result)
+		return result;
+
+	if (!_handle->images) {
+		_handle->images = calloc(1, sizeof(struct _fpga_image_library));
+		if (!_handle->images) {
+			FPGA_ERR("Failed to allocate image library");
+			pthread_mutex_unlock(&_handle->lock);
+			return FPGA_NO_MEMORY;
+		}
+		_handle->images->next_id = 1;
+		_handle->images->max_bytes = FPGA_IMAGE_LIBRARY_MAX_BYTES;
+	}
+
+	*lib = _handle->images;
+	return FPGA_OK;
+}
+
+void image_library_free(struct _fpga_image_library *lib)
+{
+	struct _fpga_image *img;
+
+	if (!lib)
+		return;
+
+	while (lib->head) {
+		img = lib->head;
+		lib->head = img->next;
+		image_release(lib, img);
+		free(img->path);
+		free(img);
+	}
+
+	free(lib);
+}
+
+fpga_result __FPGA_API__ fpgaRegisterImage(fpga_handle fpga,
+					   uint32_t slot,
+					   const char *gbs_path,
+					   uint64_t *image_id)
+{
+	struct _fpga_handle *_handle = (struct _fpga_handle *)fpga;
+	struct _fpga_image_library *lib = NULL;
+	struct _fpga_image *img;
+	fpga_result result;
+
+	if (!gbs_path || !image_id) {
+		FPGA_MSG("gbs_path or image_id is NULL");
+		return FPGA_INVALID_PARAM;
+	}
+
+	result = image_library_lock(fpga, &lib);
+	if (result)
+		return result;
+
+	img = calloc(1, sizeof(struct _fpga_image));
+	if (!img || !(img->path = strdup(gbs_path))) {
+		FPGA_ERR("Failed to allocate image");
+		free(img);
+		result = FPGA_NO_MEMORY;
+		goto out_unlock;
+	}
+	img->slot = slot;
+
+	result = image_prepare(fpga, lib, img);
+	if (result != FPGA_OK) {
+		free(img->path);
+		free(img);
+		goto out_unlock;
+	}
+
+	img->id = lib->next_id++;
+	img->next = lib->head;
+	lib->head = img;
+	++lib->stats.num_images;
+	image_evict(lib, img);
+
+	*image_id = img->id;
+
+out_unlock:
+	pthread_mutex_unlock(&_handle->lock);
+	return result;
+}
+
+fpga_result __FPGA_API__ fpgaLoadImage(fpga_handle fpga, uint64_t image_id)
+{
+	struct _fpga_handle *_handle = (struct _fpga_handle *)fpga;
+	struct _fpga_image_library *lib = NULL;
+	struct _fpga_image *img;
+	struct _fpga_image **link;
+	fpga_result result;
+
+	result = image_library_lock(fpga, &lib);
+	if (result)
+		return result;
+
+	if (_handle->fddev < 0) {
+		FPGA_ERR("Invalid handle file descriptor");
+		result = FPGA_INVALID_PARAM;
+		goto out_unlock;
+	}
+
+	img = image_find(lib, image_id, &link);
+	if (!img) {
+		FPGA_MSG("Image %lu not registered", image_id);
+		result = FPGA_NOT_FOUND;
+		goto out_unlock;
+	}
+
+	// move to the front of the LRU order
+	*link = img->next;
+	img->next = lib->head;
+	lib->head = img;
+
+	if (img->bitstream) {
+		++lib->stats.hits;
+		lib->stats.prep_ns_saved += img->prep_ns;
+	} else {
+		++lib->stats.misses;
+		result = image_prepare(fpga, lib, img);
+		if (result != FPGA_OK)
+			goto out_unlock;
+		image_evict(lib, img);
+	}
+
+	result = reconf_program(fpga, img->slot, img->bitstream,
+				img->bitstream_len, &img->prep);
+
+out_unlock:
+	pthread_mutex_unlock(&_handle->lock);
+	return result;
+}
+
+fpga_result __FPGA_API__ fpgaUnregisterImage(fpga_handle fpga,
+					     uint64_t image_id)
+{
+	struct _fpga_handle *_handle = (struct _fpga_handle *)fpga;
+	struct _fpga_image_library *lib = NULL;
+	struct _fpga_image *img;
+	struct _fpga_image **link;
+	fpga_result result;
+
+	result = image_library_lock(fpga, &lib);
+	if (result)
+		return result;
+
+	img = image_find(lib, image_id, &link);
+	if (!img) {
+		FPGA_MSG("Image %lu not registered", image_id);
+		result = FPGA_NOT_FOUND;
+		goto out_unlock;
+	}
+
+	*link = img->next;
+	image_release(lib, img);
+	free(img->path);
+	free(img);
+	--lib->stats.num_images;
+
+out_unlock:
+	pthread_mutex_unlock(&_handle->lock);
+	return result;
+}
+
+fpga_result __FPGA_API__ fpgaSetImageLibraryLimit(fpga_handle fpga,
+						  uint64_t max_bytes)
+{
+	struct _fpga_handle *_handle = (struct _fpga_handle *)fpga;
+	struct _fpga_image_library *lib = NULL;
+	fpga_result result;
+
+	result = image_library_lock(fpga, &lib);
+	if (result)
+		return result;
+
+	lib->max_bytes = max_bytes;
+	image_evict(lib, NULL);
+
+	pthread_mutex_unlock(&_handle->lock);
+	return FPGA_OK;
+}
+
+fpga_result __FPGA_API__ fpgaGetImageLibraryStats(fpga_handle fpga,
+						  fpga_image_stats *stats)
+{
+	struct _fpga_handle *_handle = (struct _fpga_handle *)fpga;
+	struct _fpga_image_library *lib = NULL;
+	fpga_result result;
+
+	if (!stats) {
+		FPGA_MSG("stats is NULL");
+		return FPGA_INVALID_PARAM;
+	}
+
+	result = image_library_lock(fpga, &lib);
+	if (result)
+		return result;
+
+	*stats = lib->stats;
+
+	pthread_mutex_unlock(&_handle->lock);
+	return FPGA_OK;
+}
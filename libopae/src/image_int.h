@@ -0,0 +1,67 @@
+// Copyright(c) 2017, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef __FPGA_IMAGE_INT_H__
+#define __FPGA_IMAGE_INT_H__
+
+#include "opae/types.h"
+#include "reconf_int.h"
+
+// default bound on resident image bytes per handle
+#define FPGA_IMAGE_LIBRARY_MAX_BYTES (256ULL * 1024 * 1024)
+
+/*
+ * A registered AFU image. bitstream is NULL while the image is
+ * evicted; prep is then stale and rebuilt on the next load.
+ */
+struct _fpga_image {
+	uint64_t id;
+	uint32_t slot;
+	char *path;
+	uint8_t *bitstream;
+	size_t bitstream_len;
+	int locked;                 // bitstream is mlock'ed
+	struct reconf_prep prep;
+	uint64_t prep_ns;           // cost of the last preparation
+	struct _fpga_image *next;   // most recently loaded first
+};
+
+/*
+ * Per-handle image library, protected by the handle lock.
+ */
+struct _fpga_image_library {
+	struct _fpga_image *head;
+	uint64_t next_id;
+	uint64_t max_bytes;
+	fpga_image_stats stats;
+};
+
+/*
+ * Release a library and all of its images. NULL is ignored.
+ */
+void image_library_free(struct _fpga_image_library *lib);
+
+#endif // __FPGA_IMAGE_INT_H__
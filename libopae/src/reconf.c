@@ -39,9 +39,9 @@
 #include "opae/access.h"
 #include "opae/utils.h"
 #include "opae/manage.h"
-#include "opae/manage.h"
 #include "bitstream_int.h"
 #include "common_int.h"
+#include "reconf_int.h"
 #include "intel-fpga.h"
 #include "usrclk/user_clk_pgm_uclock.h"
 
@@ -172,32 +172,52 @@ fpga_result set_afu_userclock(fpga_handle handle,
 				uint64_t usrlclock_high,
 				uint64_t usrlclock_low)
 {
+	struct _fpga_handle *_handle      = (struct _fpga_handle *)handle;
 	char syfs_path[SYSFS_PATH_MAX]    = {0};
 	fpga_result result                = FPGA_OK;
 	uint64_t userclk_high             = 0;
 	uint64_t userclk_low              = 0;
 
+	result = handle_check_and_lock(_handle);
+	if (result)
+		return result;
+
 	// Read port sysfs path
 	result = get_port_sysfs(handle, syfs_path);
 	if (result != FPGA_OK) {
 		FPGA_ERR("Failed to get port syfs path");
-		return result;
+		goto out_unlock;
+	}
+
+	// The user clock context is per device, so programming
+	// clocks through different handles can run in parallel.
+	if (!_handle->uclock) {
+		_handle->uclock = calloc(1, sizeof(struct QUCPU_Uclock));
+		if (!_handle->uclock) {
+			FPGA_ERR("Failed to allocate user clock context");
+			result = FPGA_NO_MEMORY;
+			goto out_unlock;
+		}
 	}
 
 	// set user clock
-	result = set_userclock(syfs_path, usrlclock_high, usrlclock_low);
+	result = set_userclock_r(_handle->uclock, syfs_path,
+				 usrlclock_high, usrlclock_low);
 	if (result != FPGA_OK) {
 		FPGA_ERR("Failed to set user clock");
-		return result;
+		goto out_unlock;
 	}
 
 	// read user clock
-	result = get_userclock(syfs_path, &userclk_high, &userclk_low);
+	result = get_userclock_r(_handle->uclock, syfs_path,
+				 &userclk_high, &userclk_low);
 	if (result != FPGA_OK) {
 		FPGA_ERR("Failed to get user clock");
-		return result;
+		goto out_unlock;
 	}
 
+out_unlock:
+	pthread_mutex_unlock(&_handle->lock);
 	return result;
 }
 
@@ -274,93 +294,99 @@ fpga_result set_fpga_pwr_threshold(fpga_handle handle,
 	return result;
 }
 
-fpga_result __FPGA_API__ fpgaReconfigureSlot(fpga_handle fpga,
-						uint32_t slot,
-						const uint8_t *bitstream,
-						size_t bitstream_len,
-						int flags)
+// Caller holds the handle lock.
+fpga_result reconf_prepare(fpga_handle handle,
+			   const uint8_t *bitstream,
+			   size_t bitstream_len,
+			   struct reconf_prep *prep)
 {
-	struct _fpga_handle *_handle    = (struct _fpga_handle *)fpga;
-	fpga_result result              = FPGA_OK;
-	struct fpga_fme_port_pr port_pr = {0};
-	struct reconf_error  error      = {0};
-	struct gbs_metadata  metadata   = {0};
-	int bitstream_header_len        = 0;
-	uint64_t deviceid               = 0;
-
-	result = handle_check_and_lock(_handle);
-	if (result)
-		return result;
+	fpga_result result = FPGA_OK;
 
-	if (_handle->fddev < 0) {
-		FPGA_ERR("Invalid handle file descriptor");
-		result = FPGA_INVALID_PARAM;
-		goto out_unlock;
-	}
+	memset(prep, 0, sizeof(*prep));
 
-	if (validate_bitstream(fpga, bitstream, bitstream_len,
-				&bitstream_header_len) != FPGA_OK) {
+	if (validate_bitstream(handle, bitstream, bitstream_len,
+				&prep->header_len) != FPGA_OK) {
 		FPGA_MSG("Invalid bitstream");
-		result = FPGA_INVALID_PARAM;
-		goto out_unlock;
-	}
-
-	// Clear port errors
-	result = clear_port_errors(fpga);
-	if (result != FPGA_OK) {
-		FPGA_ERR("Failed to clear port errors.");
+		return FPGA_INVALID_PARAM;
 	}
 
 	if (get_bitstream_json_len(bitstream) > 0) {
 
 		// Read GBS json metadata
-		result = read_gbs_metadata(bitstream, &metadata);
+		result = read_gbs_metadata(bitstream, &prep->metadata);
 		if (result != FPGA_OK) {
 			FPGA_ERR("Failed to read metadata");
-			goto out_unlock;
+			return result;
 		}
 
-		FPGA_DBG(" Version                  :%f\n", metadata.version);
+		FPGA_DBG(" Version                  :%f\n", prep->metadata.version);
 		FPGA_DBG(" Magic Num                :%ld\n",
-			 metadata.afu_image.magic_num);
+			 prep->metadata.afu_image.magic_num);
 		FPGA_DBG(" Interface Id             :%s\n",
-			 metadata.afu_image.interface_uuid);
+			 prep->metadata.afu_image.interface_uuid);
 		FPGA_DBG(" Clock_frequency_high     :%d\n",
-			 metadata.afu_image.clock_frequency_high);
+			 prep->metadata.afu_image.clock_frequency_high);
 		FPGA_DBG(" Clock_frequency_low      :%d\n",
-			 metadata.afu_image.clock_frequency_low);
+			 prep->metadata.afu_image.clock_frequency_low);
 		FPGA_DBG(" Power                    :%d\n",
-			 metadata.afu_image.power);
+			 prep->metadata.afu_image.power);
 		FPGA_DBG(" Name                     :%s\n",
-			 metadata.afu_image.afu_clusters.name);
+			 prep->metadata.afu_image.afu_clusters.name);
 		FPGA_DBG(" Total_contexts           :%d\n",
-			 metadata.afu_image.afu_clusters.total_contexts);
+			 prep->metadata.afu_image.afu_clusters.total_contexts);
 		FPGA_DBG(" AFU_uuid                 :%s\n",
-			 metadata.afu_image.afu_clusters.afu_uuid);
+			 prep->metadata.afu_image.afu_clusters.afu_uuid);
+
+		// get fpga device id.
+		result = get_fpga_deviceid(handle, &prep->deviceid);
+		if (result != FPGA_OK) {
+			FPGA_ERR("Failed to read device id.");
+			return result;
+		}
+
+		prep->has_metadata = 1;
+	}
+
+	return FPGA_OK;
+}
+
+// Caller holds the handle lock.
+fpga_result reconf_program(fpga_handle handle,
+			   uint32_t slot,
+			   const uint8_t *bitstream,
+			   size_t bitstream_len,
+			   const struct reconf_prep *prep)
+{
+	struct _fpga_handle *_handle    = (struct _fpga_handle *)handle;
+	fpga_result result              = FPGA_OK;
+	struct fpga_fme_port_pr port_pr = {0};
+	struct reconf_error  error      = {0};
+	const struct afu_image_content *afu_image = &prep->metadata.afu_image;
+
+	// Clear port errors
+	result = clear_port_errors(handle);
+	if (result != FPGA_OK) {
+		FPGA_ERR("Failed to clear port errors.");
+	}
+
+	if (prep->has_metadata) {
 
 		// Set AFU user clock
-		if (metadata.afu_image.clock_frequency_high > 0 && metadata.afu_image.clock_frequency_low > 0) {
-			result = set_afu_userclock(fpga, metadata.afu_image.clock_frequency_high, metadata.afu_image.clock_frequency_low);
+		if (afu_image->clock_frequency_high > 0 && afu_image->clock_frequency_low > 0) {
+			result = set_afu_userclock(handle, afu_image->clock_frequency_high, afu_image->clock_frequency_low);
 			if (result != FPGA_OK) {
 				FPGA_ERR("Failed to set user clock");
-				goto out_unlock;
+				return result;
 			}
 		}
 
-		// get fpga device id.
-		result = get_fpga_deviceid(fpga, &deviceid);
-		if (result != FPGA_OK) {
-			FPGA_ERR("Failed to read device id.");
-			goto out_unlock;
-		}
-
 		// Set power threshold for integrated fpga.
-		if (deviceid == FPGA_INTEGRATED_DEVICEID) {
+		if (prep->deviceid == FPGA_INTEGRATED_DEVICEID) {
 
-			result = set_fpga_pwr_threshold(fpga, metadata.afu_image.power);
+			result = set_fpga_pwr_threshold(handle, afu_image->power);
 			if (result != FPGA_OK) {
 				FPGA_ERR("Failed to set threshold.");
-				goto out_unlock;
+				return result;
 			}
 
 		} // device id
@@ -369,8 +395,8 @@ fpga_result __FPGA_API__ fpgaReconfigureSlot(fpga_handle fpga,
 
 	port_pr.flags                 = 0;
 	port_pr.argsz                 = sizeof(struct fpga_fme_port_pr);
-	port_pr.buffer_address        = (__u64)bitstream + bitstream_header_len;
-	port_pr.buffer_size           = (__u32) bitstream_len - bitstream_header_len;
+	port_pr.buffer_address        = (__u64)bitstream + prep->header_len;
+	port_pr.buffer_size           = (__u32) bitstream_len - prep->header_len;
 	port_pr.port_id               = slot;
 
 	result = ioctl(_handle->fddev, FPGA_FME_PORT_PR, &port_pr);
@@ -383,7 +409,7 @@ fpga_result __FPGA_API__ fpgaReconfigureSlot(fpga_handle fpga,
 		} else {
 			result = FPGA_EXCEPTION;
 		}
-		goto out_unlock;
+		return result;
 	}
 
 	// PR error
@@ -424,6 +450,35 @@ fpga_result __FPGA_API__ fpgaReconfigureSlot(fpga_handle fpga,
 		result = FPGA_RECONF_ERROR;
 	}
 
+	return result;
+}
+
+fpga_result __FPGA_API__ fpgaReconfigureSlot(fpga_handle fpga,
+						uint32_t slot,
+						const uint8_t *bitstream,
+						size_t bitstream_len,
+						int flags)
+{
+	struct _fpga_handle *_handle    = (struct _fpga_handle *)fpga;
+	fpga_result result              = FPGA_OK;
+	struct reconf_prep prep;
+
+	result = handle_check_and_lock(_handle);
+	if (result)
+		return result;
+
+	if (_handle->fddev < 0) {
+		FPGA_ERR("Invalid handle file descriptor");
+		result = FPGA_INVALID_PARAM;
+		goto out_unlock;
+	}
+
+	result = reconf_prepare(fpga, bitstream, bitstream_len, &prep);
+	if (result != FPGA_OK)
+		goto out_unlock;
+
+	result = reconf_program(fpga, slot, bitstream, bitstream_len, &prep);
+
 out_unlock:
 	pthread_mutex_unlock(&_handle->lock);
 	return result;
@@ -38,11 +38,20 @@
 #include "opae/utils.h"
 #include "opae/manage.h"
 #include "common_int.h"
+#include "bitstream_int.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif // __cplusplus
 
+// Bitstream state derived before the PR ioctl
+struct reconf_prep {
+	int header_len;               // bytes ahead of the PR payload
+	int has_metadata;             // metadata below is valid
+	struct gbs_metadata metadata; // parsed GBS json metadata
+	uint64_t deviceid;            // fpga device id
+};
+
 /**
 * @brief set afu user clock
 *
@@ -67,6 +76,41 @@ fpga_result set_afu_userclock(fpga_handle handle,
 fpga_result set_fpga_pwr_threshold(fpga_handle handle,
 				uint64_t gbs_power);
 
+/**
+* @brief Validates a bitstream and parses its metadata
+*
+* @param handle
+* @param bitstream pointer to the bitstream
+* @param bitstream_len length of the bitstream in bytes
+* @param prep receives the validated bitstream state
+*
+* @return error code
+*/
+fpga_result reconf_prepare(fpga_handle handle,
+			   const uint8_t *bitstream,
+			   size_t bitstream_len,
+			   struct reconf_prep *prep);
+
+/**
+* @brief Programs a bitstream previously validated by reconf_prepare()
+*
+* Sets the user clock and power threshold from the metadata,
+* then starts partial reconfiguration of the slot.
+*
+* @param handle
+* @param slot port to reconfigure
+* @param bitstream pointer to the bitstream
+* @param bitstream_len length of the bitstream in bytes
+* @param prep state returned by reconf_prepare()
+*
+* @return error code
+*/
+fpga_result reconf_program(fpga_handle handle,
+			   uint32_t slot,
+			   const uint8_t *bitstream,
+			   size_t bitstream_len,
+			   const struct reconf_prep *prep);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif // __cplusplus
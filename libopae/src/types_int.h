@@ -95,6 +95,9 @@ struct _fpga_token {
 	char devpath[DEV_PATH_MAX];
 };
 
+struct QUCPU_Uclock;
+struct _fpga_image_library;
+
 /** Process-wide unique FPGA handle */
 struct _fpga_handle {
 	pthread_mutex_t lock;
@@ -107,6 +110,8 @@ struct _fpga_handle {
 	void *umsg_virt;	    // umsg Virtual Memory pointer
 	uint64_t umsg_size;	    // umsg Virtual Memory Size
 	uint64_t *umsg_iova;	    // umsg IOVA from driver
+	struct QUCPU_Uclock *uclock; // user clock context, allocated on first use
+	struct _fpga_image_library *images; // AFU image library, allocated on first use
 };
 
 /** Object property struct
@@ -40,6 +40,7 @@
 #include <fcntl.h>
 #include <stdarg.h>
 #include <time.h>
+#include <sys/types.h>
 
 #include "user_clk_pgm_uclock.h"
 #include "user_clk_pgm_uclock_freq_template.h"
@@ -57,16 +58,59 @@
 #define  USRCLK_SLEEEP_1MS           1000000
 #define  USRCLK_SLEEEP_10MS          10000000
 
-struct  QUCPU_Uclock   gQUCPU_Uclock;
+// User clock poll timeouts
+#define  USRCLK_POLL_100MS           100000000LLU
+#define  USRCLK_POLL_1000MS          1000000000LLU
+
+// Port register sysfs names and open flags, indexed by QUCPU_INT_PRT_*
+static const char *pac_PrtSysfs[QUCPU_INT_PRT_NUMREG] = {
+	USER_CLOCK_CMD0,
+	USER_CLOCK_CMD1,
+	USER_CLOCK_STS0,
+	USER_CLOCK_STS1
+};
+
+static const int ai_PrtFlags[QUCPU_INT_PRT_NUMREG] = {
+	O_WRONLY,
+	O_WRONLY,
+	O_RDONLY,
+	O_RDONLY
+};
 
 //Get fpga user clock
 fpga_result __FIXME_MAKE_VISIBLE__ get_userclock(const char* sys_path,
 					uint64_t* userclk_high,
 					uint64_t* userclk_low)
+{
+	struct QUCPU_Uclock uclock;
+
+	memset(&uclock, 0, sizeof(uclock));
+
+	return get_userclock_r(&uclock, sys_path, userclk_high, userclk_low);
+}
+
+// set fpga user clock
+fpga_result __FIXME_MAKE_VISIBLE__ set_userclock(const char* sysfs_path,
+					uint64_t userclk_high,
+					uint64_t userclk_low)
+{
+	struct QUCPU_Uclock uclock;
+
+	memset(&uclock, 0, sizeof(uclock));
+
+	return set_userclock_r(&uclock, sysfs_path, userclk_high, userclk_low);
+}
+
+//Get fpga user clock, caller-owned context
+fpga_result get_userclock_r(struct QUCPU_Uclock *pUclock,
+					const char* sys_path,
+					uint64_t* userclk_high,
+					uint64_t* userclk_low)
 {
 	QUCPU_tFreqs userClock;
 
-	if ((sys_path == NULL) ||
+	if ((pUclock == NULL) ||
+		(sys_path == NULL) ||
 		(userclk_high == NULL) ||
 		(userclk_low == NULL)) {
 		FPGA_ERR("Invalid input parameters");
@@ -74,29 +118,35 @@ fpga_result __FIXME_MAKE_VISIBLE__ get_userclock(const char* sys_path,
 	}
 
 	// Initialize
-	if (fi_RunInitz(sys_path) != 0) {
+	if (fi_RunInitz(pUclock, sys_path) != 0) {
 		FPGA_ERR("Failed to initialize user clock ");
+		fv_PrtClose(pUclock);
 		return FPGA_NOT_SUPPORTED;
 	}
 
 	// get user clock
-	if (fi_GetFreqs(&userClock) != 0) {
+	if (fi_GetFreqs(pUclock, &userClock) != 0) {
 		FPGA_ERR("Failed to get user clock Frequency ");
+		fv_PrtClose(pUclock);
 		return FPGA_NOT_SUPPORTED;
 	}
 
+	fv_PrtClose(pUclock);
+
 	*userclk_high = userClock.u64i_Frq_ClkUsr;
 	*userclk_low = userClock.u64i_Frq_DivBy2;
 
 	return FPGA_OK;
 }
 
-// set fpga user clock
-fpga_result __FIXME_MAKE_VISIBLE__ set_userclock(const char* sysfs_path,
+// set fpga user clock, caller-owned context
+fpga_result set_userclock_r(struct QUCPU_Uclock *pUclock,
+					const char* sysfs_path,
 					uint64_t userclk_high,
 					uint64_t userclk_low)
 {
-	if (sysfs_path == NULL) {
+	if ((pUclock == NULL) ||
+		(sysfs_path == NULL)) {
 		FPGA_ERR("Invalid input parameters");
 		return FPGA_INVALID_PARAM;
 	}
@@ -117,101 +167,110 @@ fpga_result __FIXME_MAKE_VISIBLE__ set_userclock(const char* sysfs_path,
 	}
 
 	// Initialize
-	if (fi_RunInitz(sysfs_path) != 0) {
+	if (fi_RunInitz(pUclock, sysfs_path) != 0) {
 		FPGA_ERR("Failed to initialize user clock ");
+		fv_PrtClose(pUclock);
 		return FPGA_NOT_SUPPORTED;
 	}
 
 	FPGA_DBG("User clock high: %ld \n", userclk_high);
 
 	// set user clock
-	if (fi_SetFreqs(0, userclk_high) != 0) {
+	if (fi_SetFreqs(pUclock, 0, userclk_high) != 0) {
 		FPGA_ERR("Failed to set user clock frequency ");
+		fv_PrtClose(pUclock);
 		return FPGA_NOT_SUPPORTED;
 	}
 
+	fv_PrtClose(pUclock);
+
 	return FPGA_OK;
 }
 
 //fi_RunInitz
-int fi_RunInitz(const char* sysfs_path)
+int fi_RunInitz(struct QUCPU_Uclock *pUclock, const char* sysfs_path)
 {
 	// fi_RunInitz
 	// Initialize
 	// Reinitialization okay too, since will issue machine reset
 
-	uint64_t u64i_PrtAddr, u64i_PrtData;
+	uint64_t u64i_PrtData;
 	uint64_t u64i_AvmmAdr, u64i_AvmmDat;
 	int      i_ReturnErr;
-	char syfs_usrpath[SYSFS_PATH_MAX]; 
-
-	gQUCPU_Uclock.i_InitzState = 0;
-	gQUCPU_Uclock.tInitz_InitialParams.u64i_Version = (uint64_t) 0;
-	gQUCPU_Uclock.tInitz_InitialParams.u64i_PLL_ID = (uint64_t) 0;
-	gQUCPU_Uclock.tInitz_InitialParams.u64i_NumFrq_Intg_End = (uint64_t) 0;
-	gQUCPU_Uclock.tInitz_InitialParams.u64i_NumFrq_Frac_Beg = (uint64_t) 0;
-	gQUCPU_Uclock.tInitz_InitialParams.u64i_NumFrq_Frac_End = (uint64_t) 0;
-	gQUCPU_Uclock.tInitz_InitialParams.u64i_NumFrq = (uint64_t) 0;
-	gQUCPU_Uclock.tInitz_InitialParams.u64i_NumReg = (uint64_t) 0;
-	gQUCPU_Uclock.tInitz_InitialParams.u64i_NumRck = (uint64_t) 0;
-	gQUCPU_Uclock.u64i_cmd_reg_0 = (uint64_t) 0x0LLU;
-	gQUCPU_Uclock.u64i_cmd_reg_1 = (uint64_t) 0x0LLU;
-	gQUCPU_Uclock.u64i_AVMM_seq = (uint64_t) 0x0LLU;
-	gQUCPU_Uclock.i_Bug_First = 0;
-	gQUCPU_Uclock.i_Bug_Last = 0;
+	int      i_PrtReg;
+
+	pUclock->i_InitzState = 0;
+	pUclock->tInitz_InitialParams.u64i_Version = (uint64_t) 0;
+	pUclock->tInitz_InitialParams.u64i_PLL_ID = (uint64_t) 0;
+	pUclock->tInitz_InitialParams.u64i_NumFrq_Intg_End = (uint64_t) 0;
+	pUclock->tInitz_InitialParams.u64i_NumFrq_Frac_Beg = (uint64_t) 0;
+	pUclock->tInitz_InitialParams.u64i_NumFrq_Frac_End = (uint64_t) 0;
+	pUclock->tInitz_InitialParams.u64i_NumFrq = (uint64_t) 0;
+	pUclock->tInitz_InitialParams.u64i_NumReg = (uint64_t) 0;
+	pUclock->tInitz_InitialParams.u64i_NumRck = (uint64_t) 0;
+	pUclock->u64i_cmd_reg_0 = (uint64_t) 0x0LLU;
+	pUclock->u64i_cmd_reg_1 = (uint64_t) 0x0LLU;
+	pUclock->u64i_AVMM_seq = (uint64_t) 0x0LLU;
+	pUclock->i_Bug_First = 0;
+	pUclock->i_Bug_Last = 0;
+	for (i_PrtReg = 0; i_PrtReg < QUCPU_INT_PRT_NUMREG; ++i_PrtReg)
+		pUclock->i_PrtFd[i_PrtReg] = -1;
 
 
 	if (sysfs_path == NULL) {
 		printf(" Invalid input sysfs path \n");
 		return -1;
 	}
-	snprintf(gQUCPU_Uclock.sysfs_path, sizeof(gQUCPU_Uclock.sysfs_path), "%s", sysfs_path);
+	snprintf(pUclock->sysfs_path, sizeof(pUclock->sysfs_path), "%s", sysfs_path);
 
-	// Assume return error okay, for now
-	i_ReturnErr = 0;
+	// Open the port registers once for the whole session
+	i_ReturnErr = fi_PrtOpen(pUclock);
+	if (i_ReturnErr != 0)
+		return (i_ReturnErr);
 
 	// Initialize default values (for error abort)
-	gQUCPU_Uclock.tInitz_InitialParams.u64i_Version = 0;
-	gQUCPU_Uclock.tInitz_InitialParams.u64i_PLL_ID = 0;
+	pUclock->tInitz_InitialParams.u64i_Version = 0;
+	pUclock->tInitz_InitialParams.u64i_PLL_ID = 0;
 
 	// Initialize command shadow registers
-	gQUCPU_Uclock.u64i_cmd_reg_0 = ((uint64_t) 0x0LLU);
-	gQUCPU_Uclock.u64i_cmd_reg_1 = ((uint64_t) 0x0LLU);
+	pUclock->u64i_cmd_reg_0 = ((uint64_t) 0x0LLU);
+	pUclock->u64i_cmd_reg_1 = ((uint64_t) 0x0LLU);
 
 	// Initialize sequence IO
-	gQUCPU_Uclock.u64i_AVMM_seq = ((uint64_t) 0x0LLU);
+	pUclock->u64i_AVMM_seq = ((uint64_t) 0x0LLU);
 
 	// Static values
-	gQUCPU_Uclock.tInitz_InitialParams.u64i_NumFrq_Intg_End = (uint64_t) QUCPU_INT_NUMFRQ_INTG_END;
-	gQUCPU_Uclock.tInitz_InitialParams.u64i_NumFrq_Frac_Beg = (uint64_t) QUCPU_INT_NUMFRQ_FRAC_BEG;
-	gQUCPU_Uclock.tInitz_InitialParams.u64i_NumFrq_Frac_End = (uint64_t) QUCPU_INT_NUMFRQ_FRAC_END;
-	gQUCPU_Uclock.tInitz_InitialParams.u64i_NumFrq = (uint64_t) QUCPU_INT_NUMFRQ;
-	gQUCPU_Uclock.tInitz_InitialParams.u64i_NumReg = (uint64_t) QUCPU_INT_NUMREG;
-	gQUCPU_Uclock.tInitz_InitialParams.u64i_NumRck = (uint64_t) QUCPU_INT_NUMRCK;
+	pUclock->tInitz_InitialParams.u64i_NumFrq_Intg_End = (uint64_t) QUCPU_INT_NUMFRQ_INTG_END;
+	pUclock->tInitz_InitialParams.u64i_NumFrq_Frac_Beg = (uint64_t) QUCPU_INT_NUMFRQ_FRAC_BEG;
+	pUclock->tInitz_InitialParams.u64i_NumFrq_Frac_End = (uint64_t) QUCPU_INT_NUMFRQ_FRAC_END;
+	pUclock->tInitz_InitialParams.u64i_NumFrq = (uint64_t) QUCPU_INT_NUMFRQ;
+	pUclock->tInitz_InitialParams.u64i_NumReg = (uint64_t) QUCPU_INT_NUMREG;
+	pUclock->tInitz_InitialParams.u64i_NumRck = (uint64_t) QUCPU_INT_NUMRCK;
 
 
 	// Read version number
 	if (i_ReturnErr == 0) // This always true; added for future safety
 	{
 		// Verifying User Clock version number
-		snprintf(syfs_usrpath, sizeof(syfs_usrpath), "%s/%s", gQUCPU_Uclock.sysfs_path, USER_CLOCK_STS1);
-		sysfs_read_u64(syfs_usrpath, &u64i_PrtData);
+		i_ReturnErr = fi_PrtRead(pUclock, QUCPU_INT_PRT_STS_1, &u64i_PrtData);
 		//printf(" fi_RunInitz u64i_PrtData %llx  \n", u64i_PrtData);
+		if (i_ReturnErr != 0)
+			return (i_ReturnErr);
 
-		gQUCPU_Uclock.tInitz_InitialParams.u64i_Version = (u64i_PrtData & QUCPU_UI64_STS_1_VER_b63t60) >> 60;
-		if (gQUCPU_Uclock.tInitz_InitialParams.u64i_Version != QUCPU_UI64_STS_1_VER_version)
+		pUclock->tInitz_InitialParams.u64i_Version = (u64i_PrtData & QUCPU_UI64_STS_1_VER_b63t60) >> 60;
+		if (pUclock->tInitz_InitialParams.u64i_Version != QUCPU_UI64_STS_1_VER_version)
 		{ // User Clock wrong version number
 			i_ReturnErr = QUCPU_INT_UCLOCK_RUNINITZ_ERR_VER;
 
 		} // User Clock wrong version number
 	} // Verifying User Clock version number
 
-	FPGA_DBG("User clock version = %lx \n", gQUCPU_Uclock.tInitz_InitialParams.u64i_Version);
+	FPGA_DBG("User clock version = %lx \n", pUclock->tInitz_InitialParams.u64i_Version);
 
 	// Read PLL ID
 	if (i_ReturnErr == 0)
 	{ // Waiting for fcr PLL calibration not to be busy
-		i_ReturnErr = fi_WaitCalDone();
+		i_ReturnErr = fi_WaitCalDone(pUclock);
 	} // Waiting for fcr PLL calibration not to be busy
 
 	if (i_ReturnErr == 0)
@@ -219,35 +278,36 @@ int fi_RunInitz(const char* sysfs_path)
 		// Cycle reset and wait for any calibration to finish
 		// Activating management & machine reset
 
-		gQUCPU_Uclock.u64i_cmd_reg_0 |= (QUCPU_UI64_CMD_0_PRS_b56);
-		gQUCPU_Uclock.u64i_cmd_reg_0 &= ~(QUCPU_UI64_CMD_0_MRN_b52);
-		u64i_PrtData = gQUCPU_Uclock.u64i_cmd_reg_0;
+		pUclock->u64i_cmd_reg_0 |= (QUCPU_UI64_CMD_0_PRS_b56);
+		pUclock->u64i_cmd_reg_0 &= ~(QUCPU_UI64_CMD_0_MRN_b52);
+		u64i_PrtData = pUclock->u64i_cmd_reg_0;
 
-		snprintf(syfs_usrpath, sizeof(syfs_usrpath), "%s/%s", gQUCPU_Uclock.sysfs_path, USER_CLOCK_CMD0);
-		sysfs_write_u64(syfs_usrpath, u64i_PrtData);
+		i_ReturnErr = fi_PrtWrite(pUclock, QUCPU_INT_PRT_CMD_0, u64i_PrtData);
 
 		// Deasserting management & machine reset
-		gQUCPU_Uclock.u64i_cmd_reg_0 |= (QUCPU_UI64_CMD_0_MRN_b52);
-		gQUCPU_Uclock.u64i_cmd_reg_0 &= ~(QUCPU_UI64_CMD_0_PRS_b56);
-		u64i_PrtData = gQUCPU_Uclock.u64i_cmd_reg_0;
+		pUclock->u64i_cmd_reg_0 |= (QUCPU_UI64_CMD_0_MRN_b52);
+		pUclock->u64i_cmd_reg_0 &= ~(QUCPU_UI64_CMD_0_PRS_b56);
+		u64i_PrtData = pUclock->u64i_cmd_reg_0;
 
-		sysfs_write_u64(syfs_usrpath, u64i_PrtData);
+		if (i_ReturnErr == 0)
+			i_ReturnErr = fi_PrtWrite(pUclock, QUCPU_INT_PRT_CMD_0, u64i_PrtData);
 		//printf(" fi_RunInitz u64i_PrtData %llx  \n", u64i_PrtData);
 
 		// Waiting for fcr PLL calibration not to be busy
-		i_ReturnErr = fi_WaitCalDone();
+		if (i_ReturnErr == 0)
+			i_ReturnErr = fi_WaitCalDone(pUclock);
 	} // Cycle reset and wait for any calibration to finish
 
 	if (i_ReturnErr == 0)
 	{ // Checking fPLL ID
 		u64i_AvmmAdr = QUCPU_UI64_AVMM_FPLL_IPI_200;
-		i_ReturnErr = fi_AvmmRead(u64i_AvmmAdr, &u64i_AvmmDat);
+		i_ReturnErr = fi_AvmmRead(pUclock, u64i_AvmmAdr, &u64i_AvmmDat);
 		if (i_ReturnErr == 0)
 		{ // Check identifier
-			gQUCPU_Uclock.tInitz_InitialParams.u64i_PLL_ID = u64i_AvmmDat & 0xffLLU;
-			if (!(gQUCPU_Uclock.tInitz_InitialParams.u64i_PLL_ID == QUCPU_UI64_AVMM_FPLL_IPI_200_IDI_RFDUAL
-				|| gQUCPU_Uclock.tInitz_InitialParams.u64i_PLL_ID == QUCPU_UI64_AVMM_FPLL_IPI_200_IDI_RF100M
-				|| gQUCPU_Uclock.tInitz_InitialParams.u64i_PLL_ID == QUCPU_UI64_AVMM_FPLL_IPI_200_IDI_RF322M))
+			pUclock->tInitz_InitialParams.u64i_PLL_ID = u64i_AvmmDat & 0xffLLU;
+			if (!(pUclock->tInitz_InitialParams.u64i_PLL_ID == QUCPU_UI64_AVMM_FPLL_IPI_200_IDI_RFDUAL
+				|| pUclock->tInitz_InitialParams.u64i_PLL_ID == QUCPU_UI64_AVMM_FPLL_IPI_200_IDI_RF100M
+				|| pUclock->tInitz_InitialParams.u64i_PLL_ID == QUCPU_UI64_AVMM_FPLL_IPI_200_IDI_RF322M))
 			{ // ERROR: Wrong fPLL ID Identifer
 				printf(" ERROR  \n");
 				i_ReturnErr = QUCPU_INT_UCLOCK_RUNINITZ_ERR_FPLL_ID_ILLEGAL;
@@ -256,26 +316,159 @@ int fi_RunInitz(const char* sysfs_path)
 	} // Checking fPLL ID
 
 	// Copy structure, initialize, and return based on error status
-	//*ptInitz_retInitz = gQUCPU_Uclock.tInitz_InitialParams;
-	gQUCPU_Uclock.i_InitzState = !i_ReturnErr; // Set InitzState to 0 or 1
+	//*ptInitz_retInitz = pUclock->tInitz_InitialParams;
+	pUclock->i_InitzState = !i_ReturnErr; // Set InitzState to 0 or 1
 
 	return  (i_ReturnErr);
 } // fi_RunInitz
 
+//fi_PrtOpen
+int fi_PrtOpen(struct QUCPU_Uclock *pUclock)
+{
+	// fi_PrtOpen
+	// Open the port registers used by the session, keeping the fds
+	// so that each register access is a single pread/pwrite
+	int      i_PrtReg;
+	int      i_Len;
+	char syfs_usrpath[SYSFS_PATH_MAX];
+
+	for (i_PrtReg = 0; i_PrtReg < QUCPU_INT_PRT_NUMREG; ++i_PrtReg)
+	{ // Open each register
+		i_Len = snprintf(syfs_usrpath, sizeof(syfs_usrpath), "%s/%s", pUclock->sysfs_path, pac_PrtSysfs[i_PrtReg]);
+		if (i_Len < 0 || i_Len >= (int) sizeof(syfs_usrpath))
+		{ // ERROR: path truncated
+			FPGA_MSG("sysfs path too long: %s/%s", pUclock->sysfs_path, pac_PrtSysfs[i_PrtReg]);
+			fv_PrtClose(pUclock);
+			return (QUCPU_INT_UCLOCK_PRT_ERR_IO);
+		} // ERROR: path truncated
+		pUclock->i_PrtFd[i_PrtReg] = open(syfs_usrpath, ai_PrtFlags[i_PrtReg]);
+		if (pUclock->i_PrtFd[i_PrtReg] < 0)
+		{ // ERROR: register not accessible
+			FPGA_MSG("open(%s) failed", syfs_usrpath);
+			fv_PrtClose(pUclock);
+			return (QUCPU_INT_UCLOCK_PRT_ERR_IO);
+		} // ERROR: register not accessible
+	} // Open each register
+
+	return (0);
+} // fi_PrtOpen
+
+//fv_PrtClose
+void fv_PrtClose(struct QUCPU_Uclock *pUclock)
+{
+	// fv_PrtClose
+	int      i_PrtReg;
+
+	for (i_PrtReg = 0; i_PrtReg < QUCPU_INT_PRT_NUMREG; ++i_PrtReg)
+	{
+		if (pUclock->i_PrtFd[i_PrtReg] >= 0)
+			close(pUclock->i_PrtFd[i_PrtReg]);
+		pUclock->i_PrtFd[i_PrtReg] = -1;
+	}
+
+	return;
+} // fv_PrtClose
+
+//fi_PrtRead
+int fi_PrtRead(struct QUCPU_Uclock *pUclock, int i_PrtReg, uint64_t *pu64i_PrtData)
+{
+	// fi_PrtRead
+	char     ac_Buf[32] = {0};
+	ssize_t  res        = 0;
+
+	// sysfs re-generates the attribute on every read from offset 0
+	res = pread(pUclock->i_PrtFd[i_PrtReg], ac_Buf, sizeof(ac_Buf) - 1, 0);
+	if (res <= 0)
+	{ // ERROR: read failed
+		FPGA_MSG("Read from %s failed", pac_PrtSysfs[i_PrtReg]);
+		return (QUCPU_INT_UCLOCK_PRT_ERR_IO);
+	} // ERROR: read failed
+
+	ac_Buf[res] = '\0';
+	*pu64i_PrtData = strtoull(ac_Buf, NULL, 0);
+
+	return (0);
+} // fi_PrtRead
+
+//fi_PrtWrite
+int fi_PrtWrite(struct QUCPU_Uclock *pUclock, int i_PrtReg, uint64_t u64i_PrtData)
+{
+	// fi_PrtWrite
+	char     ac_Buf[32] = {0};
+	int      i_Len      = 0;
+
+	i_Len = snprintf(ac_Buf, sizeof(ac_Buf), "0x%lx", u64i_PrtData);
+	if (pwrite(pUclock->i_PrtFd[i_PrtReg], ac_Buf, i_Len, 0) != i_Len)
+	{ // ERROR: write failed
+		FPGA_MSG("Write to %s failed", pac_PrtSysfs[i_PrtReg]);
+		return (QUCPU_INT_UCLOCK_PRT_ERR_IO);
+	} // ERROR: write failed
+
+	return (0);
+} // fi_PrtWrite
+
+//fu64i_GetTimeNs
+static uint64_t fu64i_GetTimeNs(void)
+{
+	struct timespec timespecNow = {0};
+
+	clock_gettime(CLOCK_MONOTONIC, &timespecNow);
+	return ((uint64_t) timespecNow.tv_sec * 1000000000LLU + (uint64_t) timespecNow.tv_nsec);
+} // fu64i_GetTimeNs
+
+//fi_PrtPoll
+int fi_PrtPoll(struct QUCPU_Uclock *pUclock, int i_PrtReg,
+		uint64_t u64i_PollMsk,
+		uint64_t u64i_PollVal,
+		uint64_t u64i_TimeoutNs,
+		int      i_TimeoutErr,
+		uint64_t *pu64i_PrtData)
+{
+	// fi_PrtPoll
+	// Poll a port register until (data & mask) == value.
+	// Spin for the first few polls, which is where nearly all
+	// AVMM transactions complete, then back off exponentially.
+	uint64_t u64i_Deadline;
+	long int li_sleep_nanoseconds;
+	int      i_Poll;
+	int      res;
+
+	u64i_Deadline = fu64i_GetTimeNs() + u64i_TimeoutNs;
+	li_sleep_nanoseconds = QUCPU_LI_POLL_SLEEP_MIN_NS;
+
+	for (i_Poll = 0; ; ++i_Poll)
+	{ // Poll until match or deadline
+		res = fi_PrtRead(pUclock, i_PrtReg, pu64i_PrtData);
+		if (res != 0) return (res);
+
+		if ((*pu64i_PrtData & u64i_PollMsk) == u64i_PollVal) return (0);
+
+		if (fu64i_GetTimeNs() > u64i_Deadline) return (i_TimeoutErr);
+
+		if (i_Poll >= QUCPU_INT_POLL_SPIN)
+		{ // Backoff
+			fv_SleepShort(pUclock, li_sleep_nanoseconds);
+			li_sleep_nanoseconds <<= 1;
+			if (li_sleep_nanoseconds > QUCPU_LI_POLL_SLEEP_MAX_NS)
+				li_sleep_nanoseconds = QUCPU_LI_POLL_SLEEP_MAX_NS;
+		} // Backoff
+	} // Poll until match or deadline
+} // fi_PrtPoll
+
 //fu64i_GetAVMM_seq
-uint64_t fu64i_GetAVMM_seq()
+uint64_t fu64i_GetAVMM_seq(struct QUCPU_Uclock *pUclock)
 {
 	// fu64i_GetAVMM_seq
 	// Increment seq
-	gQUCPU_Uclock.u64i_AVMM_seq++;
-	gQUCPU_Uclock.u64i_AVMM_seq &= 0x03LLU;
+	pUclock->u64i_AVMM_seq++;
+	pUclock->u64i_AVMM_seq &= 0x03LLU;
 
-	return(gQUCPU_Uclock.u64i_AVMM_seq);
+	return(pUclock->u64i_AVMM_seq);
 } // fu64i_GetAVMM_seq
 
 
 //fi_AvmmRWcom
-int fi_AvmmRWcom(int i_CmdWrite,
+int fi_AvmmRWcom(struct QUCPU_Uclock *pUclock, int i_CmdWrite,
 		uint64_t   u64i_AvmmAdr,
 		uint64_t   u64i_WriteData,
 		uint64_t *pu64i_ReadData)
@@ -283,18 +476,15 @@ int fi_AvmmRWcom(int i_CmdWrite,
 	// fi_AvmmRWcom
 	uint64_t u64i_SeqCmdAddrData, u64i_SeqCmdAddrData_seq_2, u64i_SeqCmdAddrData_wrt_1;
 	uint64_t u64i_SeqCmdAddrData_adr_10, u64i_SeqCmdAddrData_dat_32;
-	uint64_t u64i_PrtAddr, u64i_PrtData;
+	uint64_t u64i_PrtData;
 	uint64_t u64i_DataX;
-	uint64_t u64i_FastPoll, u64i_SlowPoll;
-	long int li_sleep_nanoseconds;
 	int      i_ReturnErr;
-	char syfs_usrpath[SYSFS_PATH_MAX];
 
 	// Assume return error okay, for now
 	i_ReturnErr = 0;
 
 	// Common portion
-	u64i_SeqCmdAddrData_seq_2 = fu64i_GetAVMM_seq();
+	u64i_SeqCmdAddrData_seq_2 = fu64i_GetAVMM_seq(pUclock);
 	u64i_SeqCmdAddrData_adr_10 = u64i_AvmmAdr;
 
 	if (i_CmdWrite == 1)
@@ -314,53 +504,33 @@ int fi_AvmmRWcom(int i_CmdWrite,
 							| (u64i_SeqCmdAddrData_adr_10 & 0x000003ffLLU) << 32  // [41:32]
 							| (u64i_SeqCmdAddrData_dat_32 & 0xffffffffLLU) << 0; // [31:00]
 
-	gQUCPU_Uclock.u64i_cmd_reg_0 &= ~QUCPU_UI64_CMD_0_AMM_b51t00;
-	gQUCPU_Uclock.u64i_cmd_reg_0 |= u64i_SeqCmdAddrData;
+	pUclock->u64i_cmd_reg_0 &= ~QUCPU_UI64_CMD_0_AMM_b51t00;
+	pUclock->u64i_cmd_reg_0 |= u64i_SeqCmdAddrData;
 
 	// Write register 0 to kick it off
 
-	u64i_PrtData = gQUCPU_Uclock.u64i_cmd_reg_0;
-	snprintf(syfs_usrpath, sizeof(syfs_usrpath), "%s/%s", gQUCPU_Uclock.sysfs_path, USER_CLOCK_CMD0);
-	sysfs_write_u64(syfs_usrpath, u64i_PrtData);
-
-	li_sleep_nanoseconds = USRCLK_SLEEEP_1MS;
-	fv_SleepShort(li_sleep_nanoseconds);
-
-	snprintf(syfs_usrpath, sizeof(syfs_usrpath), "%s/%s", gQUCPU_Uclock.sysfs_path, USER_CLOCK_STS0);
+	u64i_PrtData = pUclock->u64i_cmd_reg_0;
+	i_ReturnErr = fi_PrtWrite(pUclock, QUCPU_INT_PRT_CMD_0, u64i_PrtData);
+	if (i_ReturnErr != 0) return(i_ReturnErr);
 
 	// Poll register 0 for completion.
-	// CCI is synchronous and needs only 1 read with matching sequence.
-	// u64i_PrtAddr      = QUCPU_UI64_PRT_UCLK_STS_0;
-	for (u64i_SlowPoll = 0; u64i_SlowPoll<100; ++u64i_SlowPoll)  // 100 ms
-	{ // Poll 0, slow outer loop with 1 ms sleep
-		for (u64i_FastPoll = 0; u64i_FastPoll<100; ++u64i_FastPoll)
-		{
-			// Poll 0, fast inner loop with no sleep
-			sysfs_read_u64(syfs_usrpath, &u64i_DataX);
-
-			if ((u64i_DataX & QUCPU_UI64_STS_0_SEQ_b49t48) == (u64i_SeqCmdAddrData & QUCPU_UI64_STS_0_SEQ_b49t48))
-			{ // Have result
-				goto GOTO_LABEL_HAVE_RESULT;
-			} // Have result
-		} // Poll 0, fast inner loop with no sleep
-
-		// Sleep 1 ms
-		li_sleep_nanoseconds = USRCLK_SLEEEP_1MS;
-		fv_SleepShort(li_sleep_nanoseconds);
-	} // Poll 0, slow outer loop with 1 ms sleep
-
-	i_ReturnErr = QUCPU_INT_UCLOCK_AVMMRWCOM_ERR_TIMEOUT; // Error
-
-GOTO_LABEL_HAVE_RESULT: // No error
-
-	if (i_CmdWrite == 0) *pu64i_ReadData = u64i_DataX;
+	// CCI is synchronous and needs only 1 read with matching sequence,
+	// so poll immediately rather than sleeping first.
+	i_ReturnErr = fi_PrtPoll(pUclock, QUCPU_INT_PRT_STS_0,
+				QUCPU_UI64_STS_0_SEQ_b49t48,
+				u64i_SeqCmdAddrData & QUCPU_UI64_STS_0_SEQ_b49t48,
+				USRCLK_POLL_100MS,
+				QUCPU_INT_UCLOCK_AVMMRWCOM_ERR_TIMEOUT,
+				&u64i_DataX);
+
+	if (i_ReturnErr == 0 && i_CmdWrite == 0) *pu64i_ReadData = u64i_DataX;
 	return(i_ReturnErr);
 
 } // fi_AvmmRWcom
 
 
 //fi_AvmmRead
-int fi_AvmmRead(uint64_t u64i_AvmmAdr, uint64_t *pu64i_ReadData)
+int fi_AvmmRead(struct QUCPU_Uclock *pUclock, uint64_t u64i_AvmmAdr, uint64_t *pu64i_ReadData)
 {
 	// fi_AvmmRead
 	int         i_CmdWrite    = 0;
@@ -370,14 +540,14 @@ int fi_AvmmRead(uint64_t u64i_AvmmAdr, uint64_t *pu64i_ReadData)
 	// Perform read with common code
 	i_CmdWrite = 0;
 	u64i_WriteData = 0; // Not used for read
-	res = fi_AvmmRWcom(i_CmdWrite, u64i_AvmmAdr, u64i_WriteData, pu64i_ReadData);
+	res = fi_AvmmRWcom(pUclock, i_CmdWrite, u64i_AvmmAdr, u64i_WriteData, pu64i_ReadData);
 
 	// Return error status
 	return(res);
 } // fi_AvmmRead
 
 //fi_AvmmWrite
-int fi_AvmmWrite(uint64_t u64i_AvmmAdr, uint64_t u64i_WriteData)
+int fi_AvmmWrite(struct QUCPU_Uclock *pUclock, uint64_t u64i_AvmmAdr, uint64_t u64i_WriteData)
 {
 	// fi_AvmmWrite
 	int         i_CmdWrite   = 0;
@@ -386,7 +556,7 @@ int fi_AvmmWrite(uint64_t u64i_AvmmAdr, uint64_t u64i_WriteData)
 
 	// Perform write with common code
 	i_CmdWrite = 1;
-	res = fi_AvmmRWcom(i_CmdWrite, u64i_AvmmAdr, u64i_WriteData, &u64i_ReadData);
+	res = fi_AvmmRWcom(pUclock, i_CmdWrite, u64i_AvmmAdr, u64i_WriteData, &u64i_ReadData);
 
 	// Return error status
 	return(res);
@@ -394,7 +564,7 @@ int fi_AvmmWrite(uint64_t u64i_AvmmAdr, uint64_t u64i_WriteData)
 
 
 //Sleep for nanoseconds
-void fv_SleepShort(long int li_sleep_nanoseconds)
+void fv_SleepShort(struct QUCPU_Uclock *pUclock, long int li_sleep_nanoseconds)
 {
 	// fv_SleepShort
 	// Sleep for nanoseconds
@@ -410,7 +580,7 @@ void fv_SleepShort(long int li_sleep_nanoseconds)
 		res = (int) nanosleep(&timespecWait, &timespecRemaining);
 		if (res != 0 && res != -1)
 		{ // BUG: unexpected nanosleep return value
-			fv_BugLog((int) QUCPU_INT_UCLOCK_BUG_SLEEP_SHORT);
+			fv_BugLog(pUclock, (int) QUCPU_INT_UCLOCK_BUG_SLEEP_SHORT);
 		} // BUG: unexpected nanosleep return value
 	} // Wait, and retry if wait ended early
 	while (res != 0);
@@ -420,61 +590,58 @@ void fv_SleepShort(long int li_sleep_nanoseconds)
 
 // get user clock
 // Read the frequency for the User clock and div2 clock
-int fi_GetFreqs(QUCPU_tFreqs *ptFreqs_retFreqs)
+int fi_GetFreqs(struct QUCPU_Uclock *pUclock, QUCPU_tFreqs *ptFreqs_retFreqs)
 {
 	// fi_GetFreqs
 	// Read the frequency for the User clock and div2 clock
 	
-	uint64_t u64i_PrtAddr                 = 0,
-	u64i_PrtData                          = 0;
+	uint64_t u64i_PrtData                 = 0;
 	long int li_sleep_nanoseconds         = 0;
 	int      res                          = 0;
-	char syfs_usrpath[SYSFS_PATH_MAX]     = {0}; 
 	
 	// Assume return error okay, for now
 	res                           = 0;
 
-	if (!gQUCPU_Uclock.i_InitzState) res = QUCPU_INT_UCLOCK_GETFREQS_ERR_INITZSTATE;
+	if (!pUclock->i_InitzState) res = QUCPU_INT_UCLOCK_GETFREQS_ERR_INITZSTATE;
 
 	if (res == 0)
 	{ // Read div2 and 1x user clock frequency
 		// Low frequency
-		gQUCPU_Uclock.u64i_cmd_reg_1 &= ~QUCPU_UI64_CMD_1_MEA_b32;
+		pUclock->u64i_cmd_reg_1 &= ~QUCPU_UI64_CMD_1_MEA_b32;
 
-		u64i_PrtData = gQUCPU_Uclock.u64i_cmd_reg_1;
-		snprintf(syfs_usrpath, sizeof(syfs_usrpath), "%s/%s", gQUCPU_Uclock.sysfs_path, USER_CLOCK_CMD1);
-		sysfs_write_u64(syfs_usrpath, u64i_PrtData);
+		u64i_PrtData = pUclock->u64i_cmd_reg_1;
+		res = fi_PrtWrite(pUclock, QUCPU_INT_PRT_CMD_1, u64i_PrtData);
 
 
 		li_sleep_nanoseconds = USRCLK_SLEEEP_10MS;            // 10 ms for frequency counter
-		fv_SleepShort(li_sleep_nanoseconds);
+		fv_SleepShort(pUclock, li_sleep_nanoseconds);
 
-		snprintf(syfs_usrpath, sizeof(syfs_usrpath), "%s/%s", gQUCPU_Uclock.sysfs_path, USER_CLOCK_STS1);
-		sysfs_read_u64(syfs_usrpath,  &u64i_PrtData);
+		if (res == 0)
+			res = fi_PrtRead(pUclock, QUCPU_INT_PRT_STS_1, &u64i_PrtData);
 
 
 		ptFreqs_retFreqs->u64i_Frq_DivBy2 = (u64i_PrtData & QUCPU_UI64_STS_1_FRQ_b16t00) * 10000; // Hz
 		//printf(" ptFreqs_retFreqs->u64i_Frq_ClkUsr %llx \n", ptFreqs_retFreqs->u64i_Frq_DivBy2);
 		li_sleep_nanoseconds = USRCLK_SLEEEP_10MS;
-		fv_SleepShort(li_sleep_nanoseconds);
+		fv_SleepShort(pUclock, li_sleep_nanoseconds);
 
 		// High frequency
-		gQUCPU_Uclock.u64i_cmd_reg_1 |= QUCPU_UI64_CMD_1_MEA_b32;
+		pUclock->u64i_cmd_reg_1 |= QUCPU_UI64_CMD_1_MEA_b32;
 
-		u64i_PrtData = gQUCPU_Uclock.u64i_cmd_reg_1;
+		u64i_PrtData = pUclock->u64i_cmd_reg_1;
 
-		snprintf(syfs_usrpath, sizeof(syfs_usrpath), "%s/%s", gQUCPU_Uclock.sysfs_path, USER_CLOCK_CMD1);
-		sysfs_write_u64(syfs_usrpath,  u64i_PrtData);
+		if (res == 0)
+			res = fi_PrtWrite(pUclock, QUCPU_INT_PRT_CMD_1, u64i_PrtData);
 
 		li_sleep_nanoseconds = USRCLK_SLEEEP_10MS; // 10 ms for frequency counter
-		fv_SleepShort(li_sleep_nanoseconds);
+		fv_SleepShort(pUclock, li_sleep_nanoseconds);
 
-		snprintf(syfs_usrpath, sizeof(syfs_usrpath), "%s/%s", gQUCPU_Uclock.sysfs_path, USER_CLOCK_STS1);
-		sysfs_read_u64(syfs_usrpath,  &u64i_PrtData);
+		if (res == 0)
+			res = fi_PrtRead(pUclock, QUCPU_INT_PRT_STS_1, &u64i_PrtData);
 		ptFreqs_retFreqs->u64i_Frq_ClkUsr = (u64i_PrtData & QUCPU_UI64_STS_1_FRQ_b16t00) * 10000; // Hz
 		//printf(" ptFreqs_retFreqs->u64i_Frq_ClkUsr %llx \n", ptFreqs_retFreqs->u64i_Frq_ClkUsr);
 
-		fv_SleepShort(li_sleep_nanoseconds);
+		fv_SleepShort(pUclock, li_sleep_nanoseconds);
 
 	} // Read div2 and 1x user clock frequency
 
@@ -488,34 +655,34 @@ int fi_GetFreqs(QUCPU_tFreqs *ptFreqs_retFreqs)
 } // fi_GetFreqs
 
 // set user clock
-int fi_SetFreqs(uint64_t u64i_Refclk,
+int fi_SetFreqs(struct QUCPU_Uclock *pUclock, uint64_t u64i_Refclk,
 		uint64_t u64i_FrqInx)
 {
 	// fi_SetFreqs
 	// Set the user clock frequency
-	uint64_t u64i_I, u64i_MifReg, u64i_PrtAddr, u64i_PrtData;
+	uint64_t u64i_MifReg, u64i_PrtData;
+	uint32_t u32i_MifEntry;
 	uint64_t u64i_AvmmAdr, u64i_AvmmDat, u64i_AvmmMsk;
 	long int li_sleep_nanoseconds;
 	int      i_ReturnErr;
-	char syfs_usrpath[SYSFS_PATH_MAX]; 
 
 	// Assume return error okay, for now
 	i_ReturnErr = 0;
 
-	if (!gQUCPU_Uclock.i_InitzState) i_ReturnErr = QUCPU_INT_UCLOCK_SETFREQS_ERR_INITZSTATE;
+	if (!pUclock->i_InitzState) i_ReturnErr = QUCPU_INT_UCLOCK_SETFREQS_ERR_INITZSTATE;
 
 	if (i_ReturnErr == 0)
 	{ // Check REFCLK
 		if (u64i_Refclk == 0)
 		{ // 100 MHz REFCLK requested
-			if (!(gQUCPU_Uclock.tInitz_InitialParams.u64i_PLL_ID == QUCPU_UI64_AVMM_FPLL_IPI_200_IDI_RFDUAL
-				|| gQUCPU_Uclock.tInitz_InitialParams.u64i_PLL_ID == QUCPU_UI64_AVMM_FPLL_IPI_200_IDI_RF100M))
+			if (!(pUclock->tInitz_InitialParams.u64i_PLL_ID == QUCPU_UI64_AVMM_FPLL_IPI_200_IDI_RFDUAL
+				|| pUclock->tInitz_InitialParams.u64i_PLL_ID == QUCPU_UI64_AVMM_FPLL_IPI_200_IDI_RF100M))
 				i_ReturnErr = QUCPU_INT_UCLOCK_SETFREQS_ERR_REFCLK_100M_MISSING;
 		} // 100 MHz REFCLK requested
 		else if (u64i_Refclk == 1)
 		{ // 322.265625 MHz REFCLK requested
-			if (!(gQUCPU_Uclock.tInitz_InitialParams.u64i_PLL_ID == QUCPU_UI64_AVMM_FPLL_IPI_200_IDI_RFDUAL
-				|| gQUCPU_Uclock.tInitz_InitialParams.u64i_PLL_ID == QUCPU_UI64_AVMM_FPLL_IPI_200_IDI_RF322M))
+			if (!(pUclock->tInitz_InitialParams.u64i_PLL_ID == QUCPU_UI64_AVMM_FPLL_IPI_200_IDI_RFDUAL
+				|| pUclock->tInitz_InitialParams.u64i_PLL_ID == QUCPU_UI64_AVMM_FPLL_IPI_200_IDI_RF322M))
 				i_ReturnErr = QUCPU_INT_UCLOCK_SETFREQS_ERR_REFCLK_322M_MISSING;
 		} // 322.265625 MHz REFCLK requested
 		else i_ReturnErr = QUCPU_INT_UCLOCK_SETFREQS_ERR_REFCLK_ILLEGAL;
@@ -523,12 +690,12 @@ int fi_SetFreqs(uint64_t u64i_Refclk,
 
 	if (i_ReturnErr == 0)
 	{ // Check frequency index
-		if (u64i_FrqInx > gQUCPU_Uclock.tInitz_InitialParams.u64i_NumFrq_Frac_End)
+		if (u64i_FrqInx > pUclock->tInitz_InitialParams.u64i_NumFrq_Frac_End)
 			i_ReturnErr = QUCPU_INT_UCLOCK_SETFREQS_ERR_FINDEX_OVERRANGE;
-		else if (u64i_FrqInx   < gQUCPU_Uclock.tInitz_InitialParams.u64i_NumFrq_Frac_Beg
-			&& u64i_FrqInx   > gQUCPU_Uclock.tInitz_InitialParams.u64i_NumFrq_Intg_End)
+		else if (u64i_FrqInx   < pUclock->tInitz_InitialParams.u64i_NumFrq_Frac_Beg
+			&& u64i_FrqInx   > pUclock->tInitz_InitialParams.u64i_NumFrq_Intg_End)
 			i_ReturnErr = QUCPU_INT_UCLOCK_SETFREQS_ERR_FINDEX_INTG_RANGE_BAD;
-		else if (u64i_FrqInx   < gQUCPU_Uclock.tInitz_InitialParams.u64i_NumFrq_Frac_Beg
+		else if (u64i_FrqInx   < pUclock->tInitz_InitialParams.u64i_NumFrq_Frac_Beg
 			&& u64i_Refclk != 1) // Integer-PLL mode, exact requires 322.265625 MHz
 			i_ReturnErr = QUCPU_INT_UCLOCK_SETFREQS_ERR_FINDEX_INTG_NEEDS_322M;
 	} // Check frequency index
@@ -542,21 +709,19 @@ int fi_SetFreqs(uint64_t u64i_Refclk,
 		u64i_AvmmDat = 0x03LLU;
 		u64i_AvmmMsk = 0x03LLU;
 
-		i_ReturnErr = fi_AvmmReadModifyWriteVerify(u64i_AvmmAdr, u64i_AvmmDat, u64i_AvmmMsk);
+		i_ReturnErr = fi_AvmmReadModifyWriteVerify(pUclock, u64i_AvmmAdr, u64i_AvmmDat, u64i_AvmmMsk);
 
 		// Sleep 1 ms
 		li_sleep_nanoseconds = USRCLK_SLEEEP_1MS;
-		fv_SleepShort(li_sleep_nanoseconds);
+		fv_SleepShort(pUclock, li_sleep_nanoseconds);
 	} // Power down PLL
 
 	if (i_ReturnErr == 0)
 	{ // Verifying fcr PLL not locking
 
-		snprintf(syfs_usrpath, sizeof(syfs_usrpath), "%s/%s", gQUCPU_Uclock.sysfs_path, USER_CLOCK_STS0);
-		sysfs_read_u64(syfs_usrpath,  &u64i_PrtData);
-		//sysfs_read_uint64(gQUCPU_Uclock.sys_path, USER_CLOCK_STS0, &u64i_PrtData);
+		i_ReturnErr = fi_PrtRead(pUclock, QUCPU_INT_PRT_STS_0, &u64i_PrtData);
 
-		if ((u64i_PrtData & QUCPU_UI64_STS_0_LCK_b60) != 0)
+		if (i_ReturnErr == 0 && (u64i_PrtData & QUCPU_UI64_STS_0_LCK_b60) != 0)
 		{ // fcr PLL is locked but should be unlocked
 			i_ReturnErr = QUCPU_INT_UCLOCK_SETFREQS_ERR_PLL_NO_UNLOCK;
 		} // fcr PLL is locked but should be unlocked
@@ -565,25 +730,25 @@ int fi_SetFreqs(uint64_t u64i_Refclk,
 	if (i_ReturnErr == 0)
 	{ // Select reference and push table
 		// Selecting desired reference clock
-		gQUCPU_Uclock.u64i_cmd_reg_0 &= ~QUCPU_UI64_CMD_0_SR1_b58;
-		if (u64i_Refclk) gQUCPU_Uclock.u64i_cmd_reg_0 |= QUCPU_UI64_CMD_0_SR1_b58;
-		u64i_PrtData = gQUCPU_Uclock.u64i_cmd_reg_0;
+		pUclock->u64i_cmd_reg_0 &= ~QUCPU_UI64_CMD_0_SR1_b58;
+		if (u64i_Refclk) pUclock->u64i_cmd_reg_0 |= QUCPU_UI64_CMD_0_SR1_b58;
+		u64i_PrtData = pUclock->u64i_cmd_reg_0;
 
-		snprintf(syfs_usrpath, sizeof(syfs_usrpath), "%s/%s", gQUCPU_Uclock.sysfs_path, USER_CLOCK_CMD0);
-		sysfs_write_u64(syfs_usrpath,  u64i_PrtData);
+		i_ReturnErr = fi_PrtWrite(pUclock, QUCPU_INT_PRT_CMD_0, u64i_PrtData);
 
 		// Sleep 1 ms
 		li_sleep_nanoseconds = USRCLK_SLEEEP_1MS;
-		fv_SleepShort(li_sleep_nanoseconds);
+		fv_SleepShort(pUclock, li_sleep_nanoseconds);
 
 		// Pushing the table
-		for (u64i_MifReg = 0; u64i_MifReg<gQUCPU_Uclock.tInitz_InitialParams.u64i_NumReg; u64i_MifReg++)
+		for (u64i_MifReg = 0; i_ReturnErr == 0 && u64i_MifReg<pUclock->tInitz_InitialParams.u64i_NumReg; u64i_MifReg++)
 		{ // Write each register in the diff mif
 
-			u64i_AvmmAdr = (uint64_t) (scu32ia3d_DiffMifTbl[(int) u64i_FrqInx][(int) u64i_MifReg][(int) u64i_Refclk]) >> 16;
-			u64i_AvmmDat = (uint64_t) (scu32ia3d_DiffMifTbl[(int) u64i_FrqInx][(int) u64i_MifReg][(int) u64i_Refclk] & 0x000000ff);
-			u64i_AvmmMsk = (uint64_t) (scu32ia3d_DiffMifTbl[(int) u64i_FrqInx][(int) u64i_MifReg][(int) u64i_Refclk] & 0x0000ff00) >> 8;
-			i_ReturnErr = fi_AvmmReadModifyWriteVerify(u64i_AvmmAdr, u64i_AvmmDat, u64i_AvmmMsk);
+			u32i_MifEntry = fu32i_GetDiffMif(u64i_FrqInx, u64i_MifReg, u64i_Refclk);
+			u64i_AvmmAdr = (uint64_t) (u32i_MifEntry) >> 16;
+			u64i_AvmmDat = (uint64_t) (u32i_MifEntry & 0x000000ff);
+			u64i_AvmmMsk = (uint64_t) (u32i_MifEntry & 0x0000ff00) >> 8;
+			i_ReturnErr = fi_AvmmReadModifyWriteVerify(pUclock, u64i_AvmmAdr, u64i_AvmmDat, u64i_AvmmMsk);
 
 			if (i_ReturnErr) break;
 		} // Write each register in the diff mif
@@ -591,7 +756,7 @@ int fi_SetFreqs(uint64_t u64i_Refclk,
 
 	if (i_ReturnErr == 0)
 	{ // Waiting for fcr PLL calibration not to be busy
-		i_ReturnErr = fi_WaitCalDone();
+		i_ReturnErr = fi_WaitCalDone(pUclock);
 	} // Waiting for fcr PLL calibration not to be busy
 
 	if (i_ReturnErr == 0)
@@ -604,31 +769,31 @@ int fi_SetFreqs(uint64_t u64i_Refclk,
 		u64i_AvmmAdr = 0x000LLU;
 		u64i_AvmmDat = 0x02LLU;
 		u64i_AvmmMsk = 0xffLLU;
-		i_ReturnErr = fi_AvmmReadModifyWriteVerify(u64i_AvmmAdr, u64i_AvmmDat, u64i_AvmmMsk);
+		i_ReturnErr = fi_AvmmReadModifyWriteVerify(pUclock, u64i_AvmmAdr, u64i_AvmmDat, u64i_AvmmMsk);
 
 		if (i_ReturnErr == 0)
 		{ // "To calibrate the fPLL, Read-Modify-Write:" set B1 of 0x100 high
 			u64i_AvmmAdr = 0x100LLU;
 			u64i_AvmmDat = 0x02LLU;
 			u64i_AvmmMsk = 0x02LLU;
-			i_ReturnErr = fi_AvmmReadModifyWrite(u64i_AvmmAdr, u64i_AvmmDat, u64i_AvmmMsk);
+			i_ReturnErr = fi_AvmmReadModifyWrite(pUclock, u64i_AvmmAdr, u64i_AvmmDat, u64i_AvmmMsk);
 		} // "To calibrate the fPLL, Read-Modify-Write:" set B1 of 0x100 high
 
 		if (i_ReturnErr == 0)
 		{ // "Release the internal configuraiton bus to PreSICE to perform recalibration"
 			u64i_AvmmAdr = 0x000LLU;
 			u64i_AvmmDat = 0x01LLU;
-			i_ReturnErr = fi_AvmmWrite(u64i_AvmmAdr, u64i_AvmmDat);
+			i_ReturnErr = fi_AvmmWrite(pUclock, u64i_AvmmAdr, u64i_AvmmDat);
 
 			// Sleep 1 ms
 			li_sleep_nanoseconds = USRCLK_SLEEEP_1MS;
-			fv_SleepShort(li_sleep_nanoseconds);
+			fv_SleepShort(pUclock, li_sleep_nanoseconds);
 		} // "Release the internal configuraiton bus to PreSICE to perform recalibration"
 	} // Recalibrating
 
 	if (i_ReturnErr == 0)
 	{ // Waiting for fcr PLL calibration not to be busy
-		i_ReturnErr = fi_WaitCalDone();
+		i_ReturnErr = fi_WaitCalDone(pUclock);
 	} // Waiting for fcr PLL calibration not to be busy
 
 	if (i_ReturnErr == 0)
@@ -638,32 +803,17 @@ int fi_SetFreqs(uint64_t u64i_Refclk,
 		u64i_AvmmAdr = 0x2e0LLU;
 		u64i_AvmmDat = 0x02LLU;
 		u64i_AvmmMsk = 0x03LLU;
-		i_ReturnErr = fi_AvmmReadModifyWriteVerify(u64i_AvmmAdr, u64i_AvmmDat, u64i_AvmmMsk);
+		i_ReturnErr = fi_AvmmReadModifyWriteVerify(pUclock, u64i_AvmmAdr, u64i_AvmmDat, u64i_AvmmMsk);
 	} // Power up PLL
 
 	if (i_ReturnErr == 0)
-	{ // Wait for PLL to lock
-		// u64i_PrtAddr      = QUCPU_UI64_PRT_UCLK_STS_0;
-		for (u64i_I = 0; u64i_I<100; u64i_I++)
-		{ // Poll with 100 ms timeout
-			// u64i_PrtData      = fu64i_PrtMmioRead(u64i_PrtAddr);
-
-			snprintf(syfs_usrpath, sizeof(syfs_usrpath), "%s/%s", gQUCPU_Uclock.sysfs_path, USER_CLOCK_STS0);
-			sysfs_read_u64(syfs_usrpath,  &u64i_PrtData);
-			//sysfs_read_uint64(gQUCPU_Uclock.sys_path, USER_CLOCK_STS0, &u64i_PrtData);
-
-			if ((u64i_PrtData & QUCPU_UI64_STS_0_LCK_b60) != 0) break;
-
-			// Sleep 1 ms
-			li_sleep_nanoseconds = USRCLK_SLEEEP_1MS;
-			fv_SleepShort(li_sleep_nanoseconds);
-		} // Poll with 100 ms timeout
-
-		if ((u64i_PrtData & QUCPU_UI64_STS_0_LCK_b60) == 0)
-		{ // fcr PLL lock error
-
-			i_ReturnErr = QUCPU_INT_UCLOCK_SETFREQS_ERR_PLL_LOCK_TO;
-		} // fcr PLL lock error
+	{ // Wait for PLL to lock, 100 ms timeout
+		i_ReturnErr = fi_PrtPoll(pUclock, QUCPU_INT_PRT_STS_0,
+					QUCPU_UI64_STS_0_LCK_b60,
+					QUCPU_UI64_STS_0_LCK_b60,
+					USRCLK_POLL_100MS,
+					QUCPU_INT_UCLOCK_SETFREQS_ERR_PLL_LOCK_TO,
+					&u64i_PrtData);
 	} // Verifying fcr PLL is locking
 
 	return (i_ReturnErr);
@@ -691,7 +841,7 @@ const char * fpac_GetErrMsg(int i_ErrMsgInx)
 } // fpac_GetErrMsg
 
 // fi_AvmmReadModifyWriteVerify
-int fi_AvmmReadModifyWriteVerify(uint64_t u64i_AvmmAdr,
+int fi_AvmmReadModifyWriteVerify(struct QUCPU_Uclock *pUclock, uint64_t u64i_AvmmAdr,
 				uint64_t u64i_AvmmDat,
 				uint64_t u64i_AvmmMsk)
 {
@@ -699,12 +849,12 @@ int fi_AvmmReadModifyWriteVerify(uint64_t u64i_AvmmAdr,
 	int      res                 = 0;
 	uint64_t u64i_VerifyData     = 0;
 
-	res = fi_AvmmReadModifyWrite(u64i_AvmmAdr, u64i_AvmmDat, u64i_AvmmMsk);
+	res = fi_AvmmReadModifyWrite(pUclock, u64i_AvmmAdr, u64i_AvmmDat, u64i_AvmmMsk);
 
 	if (res == 0)
 	{ // Read back the data and verify mask-enabled bits
 
-		res = fi_AvmmRead(u64i_AvmmAdr, &u64i_VerifyData);
+		res = fi_AvmmRead(pUclock, u64i_AvmmAdr, &u64i_VerifyData);
 
 		if (res == 0)
 		{ // Perform verify
@@ -720,7 +870,7 @@ int fi_AvmmReadModifyWriteVerify(uint64_t u64i_AvmmAdr,
 
 
 // fi_AvmmReadModifyWrite
-int fi_AvmmReadModifyWrite(uint64_t u64i_AvmmAdr,
+int fi_AvmmReadModifyWrite(struct QUCPU_Uclock *pUclock, uint64_t u64i_AvmmAdr,
 			uint64_t u64i_AvmmDat,
 			uint64_t u64i_AvmmMsk)
 {
@@ -729,12 +879,12 @@ int fi_AvmmReadModifyWrite(uint64_t u64i_AvmmAdr,
 	int      res              = 0;
 
 	// Read data
-	res = fi_AvmmRead(u64i_AvmmAdr, &u64i_ReadData);
+	res = fi_AvmmRead(pUclock, u64i_AvmmAdr, &u64i_ReadData);
 
 	if (res == 0)
 	{ // Modify the read data and write it
 		u64i_WriteData = (u64i_ReadData & ~u64i_AvmmMsk) | (u64i_AvmmDat & u64i_AvmmMsk);
-		res = fi_AvmmWrite(u64i_AvmmAdr, u64i_WriteData);
+		res = fi_AvmmWrite(pUclock, u64i_AvmmAdr, u64i_WriteData);
 	} // Modify the read data and write it
 
 	return(res);
@@ -742,15 +892,15 @@ int fi_AvmmReadModifyWrite(uint64_t u64i_AvmmAdr,
 
 // fv_BugLog
 // Logs first and last bugs
-void fv_BugLog(int i_BugID)
+void fv_BugLog(struct QUCPU_Uclock *pUclock, int i_BugID)
 {
-	if (gQUCPU_Uclock.i_Bug_First)
+	if (pUclock->i_Bug_First)
 	{ // This is not the first bug
-		gQUCPU_Uclock.i_Bug_Last = i_BugID;
+		pUclock->i_Bug_Last = i_BugID;
 	} // This is not the first bug
 	else
 	{ // This is the first bug
-		gQUCPU_Uclock.i_Bug_First = i_BugID;
+		pUclock->i_Bug_First = i_BugID;
 	} // This is the first bug
 
 	return;
@@ -758,36 +908,20 @@ void fv_BugLog(int i_BugID)
 
 // wait caldone
 // Wait for calibration to be done
-int fi_WaitCalDone(void)
+int fi_WaitCalDone(struct QUCPU_Uclock *pUclock)
 {
 	// fi_WaitCalDone
 	// Wait for calibration to be done
-	uint64_t u64i_PrtAddr                = 0;
 	uint64_t u64i_PrtData                = 0;
-	uint64_t u64i_I                      = 0;
-	long int li_sleep_nanoseconds        = 0;
 	int      res                         = 0;
-	char syfs_usrpath[SYSFS_PATH_MAX]    = {0};
-
-	// Waiting for fcr PLL calibration not to be busy
-	for (u64i_I = 0; u64i_I<1000; u64i_I++)
-	{ // Poll with 1000 ms timeout
-
-		snprintf(syfs_usrpath, sizeof(syfs_usrpath), "%s/%s", gQUCPU_Uclock.sysfs_path, USER_CLOCK_STS0);
-		sysfs_read_u64(syfs_usrpath,  &u64i_PrtData);
-
-		if ((u64i_PrtData & QUCPU_UI64_STS_0_BSY_b61) == 0) break;
-
-		// Sleep 1 ms
-		li_sleep_nanoseconds = USRCLK_SLEEEP_1MS;
-		fv_SleepShort(li_sleep_nanoseconds);
-	} // Poll with 1000 ms timeout
-
 
-	if ((u64i_PrtData & QUCPU_UI64_STS_0_BSY_b61) != 0)
-	{ // ERROR: calibration busy too long
-		res = QUCPU_INT_UCLOCK_WAITCALDONE_ERR_BSY_TO;
-	} // ERROR: calibration busy too long
+	// Waiting for fcr PLL calibration not to be busy, 1000 ms timeout
+	res = fi_PrtPoll(pUclock, QUCPU_INT_PRT_STS_0,
+			QUCPU_UI64_STS_0_BSY_b61,
+			0,
+			USRCLK_POLL_1000MS,
+			QUCPU_INT_UCLOCK_WAITCALDONE_ERR_BSY_TO,
+			&u64i_PrtData);
 
 	return(res);
 } // fi_WaitCalDone
@@ -106,6 +106,18 @@
 #define QUCPU_UI64_AVMM_FPLL_GPR_280_PDN_b00                     ((uint64_t)0x0000000000000001LLU) // Powerdown when override set
 #define QUCPU_UI64_AVMM_FPLL_GPR_280_ADM_b01                     ((uint64_t)0x0000000000000001LLU) // 1: Override listen to ADME; 0: listen to powerdown port
 
+// Port register access
+#define QUCPU_INT_PRT_CMD_0                                      ((int)   0)                       // userclk_freqcmd
+#define QUCPU_INT_PRT_CMD_1                                      ((int)   1)                       // userclk_freqcntrcmd
+#define QUCPU_INT_PRT_STS_0                                      ((int)   2)                       // userclk_freqsts
+#define QUCPU_INT_PRT_STS_1                                      ((int)   3)                       // userclk_freqcntrsts
+#define QUCPU_INT_PRT_NUMREG                                     ((int)   4)                       // Number of port registers
+
+// Status polling: spin first, then back off exponentially
+#define QUCPU_INT_POLL_SPIN                                      ((int)  32)                       // Polls before first sleep
+#define QUCPU_LI_POLL_SLEEP_MIN_NS                               ((long int)    1000)              // First backoff sleep, 1 us
+#define QUCPU_LI_POLL_SLEEP_MAX_NS                               ((long int) 1000000)              // Backoff ceiling, 1 ms
+
 // Bugs, decimal code
 #define QUCPU_INT_UCLOCK_BUG_SLEEP_SHORT                         ((int)   1)                       // Bug in fv_SleepShort
 
@@ -130,7 +142,8 @@ typedef struct QUCPU_sInitz QUCPU_tInitz;
 
 typedef struct QUCPU_sFreqs QUCPU_tFreqs;
 
-
+// Per-device user clock programming context.
+// Holds all state of one programming session; nothing is global.
 struct  QUCPU_Uclock
 {
 	char          sysfs_path[SYSFS_PATH_MAX];          // Port sysfs path
@@ -141,35 +154,51 @@ struct  QUCPU_Uclock
 	uint64_t     u64i_cmd_reg_0;                       // Command register 0
 	uint64_t     u64i_cmd_reg_1;                       // Command register 1
 	uint64_t     u64i_AVMM_seq ;                       // Sequence ID
+	int           i_PrtFd[QUCPU_INT_PRT_NUMREG];       // Open sysfs fds, indexed by QUCPU_INT_PRT_*
 };
 
-int fi_GetFreqs(QUCPU_tFreqs *ptFreqs_retFreqs);
+int fi_GetFreqs(struct QUCPU_Uclock *pUclock, QUCPU_tFreqs *ptFreqs_retFreqs);
+
+int fi_SetFreqs(struct QUCPU_Uclock *pUclock, uint64_t u64i_Refclk, uint64_t u64i_FrqInx);
+
+int fi_RunInitz(struct QUCPU_Uclock *pUclock, const char* sysfs_path);
+
+int fi_PrtOpen(struct QUCPU_Uclock *pUclock);
+
+void fv_PrtClose(struct QUCPU_Uclock *pUclock);
+
+int fi_PrtRead(struct QUCPU_Uclock *pUclock, int i_PrtReg, uint64_t *pu64i_PrtData);
 
-int fi_SetFreqs(uint64_t u64i_Refclk, uint64_t u64i_FrqInx);
+int fi_PrtWrite(struct QUCPU_Uclock *pUclock, int i_PrtReg, uint64_t u64i_PrtData);
 
-int fi_RunInitz(const char* sysfs_path);
+int fi_PrtPoll(struct QUCPU_Uclock *pUclock, int i_PrtReg,
+		uint64_t u64i_PollMsk,
+		uint64_t u64i_PollVal,
+		uint64_t u64i_TimeoutNs,
+		int      i_TimeoutErr,
+		uint64_t *pu64i_PrtData);
 
 int sysfs_read_file(const char *sysfs_path, const char * csr_path, uint64_t * value );
 
 int sysfs_write_file(const char *sysfs_path, const char * csr_path, uint64_t value);
 
-int fi_WaitCalDone(void);
+int fi_WaitCalDone(struct QUCPU_Uclock *pUclock);
 
-void fv_BugLog(int i_BugID);
+void fv_BugLog(struct QUCPU_Uclock *pUclock, int i_BugID);
 
-int fi_AvmmReadModifyWrite(uint64_t u64i_AvmmAdr,
+int fi_AvmmReadModifyWrite(struct QUCPU_Uclock *pUclock, uint64_t u64i_AvmmAdr,
 				uint64_t u64i_AvmmDat,
 				uint64_t u64i_AvmmMsk);
 
-int fi_AvmmReadModifyWriteVerify(uint64_t u64i_AvmmAdr,
+int fi_AvmmReadModifyWriteVerify(struct QUCPU_Uclock *pUclock, uint64_t u64i_AvmmAdr,
 				uint64_t u64i_AvmmDat,
 				uint64_t u64i_AvmmMsk);
 
-void fv_SleepShort(long int li_sleep_nanoseconds);
+void fv_SleepShort(struct QUCPU_Uclock *pUclock, long int li_sleep_nanoseconds);
 
-int fi_AvmmWrite(uint64_t u64i_AvmmAdr, uint64_t u64i_WriteData);
+int fi_AvmmWrite(struct QUCPU_Uclock *pUclock, uint64_t u64i_AvmmAdr, uint64_t u64i_WriteData);
 
-int fi_AvmmRead(uint64_t u64i_AvmmAdr, uint64_t *pu64i_ReadData);
+int fi_AvmmRead(struct QUCPU_Uclock *pUclock, uint64_t u64i_AvmmAdr, uint64_t *pu64i_ReadData);
 
 #ifdef __cplusplus
 extern "C" {
@@ -197,6 +226,35 @@ fpga_result get_userclock(const char* sysfs_path, uint64_t *userclk_high, uint64
 */
 fpga_result set_userclock(const char* sysfs_path, uint64_t userclk_high, uint64_t userclk_low);
 
+/**
+* @brief Get fpga user clock using a caller-owned context
+*
+* All programming state lives in the context, so calls on distinct
+* contexts may run concurrently.
+*
+* @param pUclock    user clock context
+* @param syfs_path  port sysfs path
+* @parm  pointer to  high user clock
+* @parm  pointer to  low user clock
+*
+* @return error code
+*/
+fpga_result get_userclock_r(struct QUCPU_Uclock *pUclock, const char* sysfs_path,
+				uint64_t *userclk_high, uint64_t *userclk_low);
+
+/**
+* @brief set fpga user clock using a caller-owned context
+*
+* @param pUclock    user clock context
+* @param syfs_path  port sysfs path
+* @parm  high user clock
+* @parm  low user clock
+*
+* @return error code
+*/
+fpga_result set_userclock_r(struct QUCPU_Uclock *pUclock, const char* sysfs_path,
+				uint64_t userclk_high, uint64_t userclk_low);
+
 #ifdef __cplusplus
 }
 #endif
@@ -45,5 +45,6 @@ const char * pac_UclockErrorMsg[] = {
 	"SetFreqs: Use 322.265625 MHz refclk for ExactFreq mode.\0",
 	"SetFreqs: PLL did unlock during power down.\0",
 	"SetFreqs: Timeout waiting for PLL to lock.\0",
+	"Prt: Port register access failed.\0",
 	"ERROR: MSG INDEX OUT OF RANGE\0"  // "+1" message
 };
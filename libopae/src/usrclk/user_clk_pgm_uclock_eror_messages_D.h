@@ -45,4 +45,5 @@
 #define QUCPU_INT_UCLOCK_SETFREQS_ERR_FINDEX_INTG_NEEDS_322M     ((int)  13)                       // SetFreqs:    integer-PLL mode needs 322 MHz ref
 #define QUCPU_INT_UCLOCK_SETFREQS_ERR_PLL_NO_UNLOCK              ((int)  14)                       // SetFreqs:    PLL would not unlock
 #define QUCPU_INT_UCLOCK_SETFREQS_ERR_PLL_LOCK_TO                ((int)  15)                       // SetFreqs:    timed out waiting for lock
-#define QUCPU_INT_UCLOCK_NUM_ERROR_MESSAGES                      ((int)  16)                       // Number of error messages
+#define QUCPU_INT_UCLOCK_PRT_ERR_IO                              ((int)  16)                       // Prt:         port register access failed
+#define QUCPU_INT_UCLOCK_NUM_ERROR_MESSAGES                      ((int)  17)                       // Number of error messages
@@ -26,18021 +26,2431 @@
 
 // Arthur.Sheiman@Intel.com   Created: 09-08-16
 // Revision: 03-21-17  19:51
+//
+// Every entry of the diff mif table is (AVMM address << 16) | (mask << 8) | data.
+// The address and mask depend only on the register index, so they are stored
+// once per register and only the data byte is stored per frequency and refclk.
+// fu32i_GetDiffMif() reassembles the original 32-bit entry.
+
+
+const uint32_t scu32ia1d_DiffMifAdrMsk [QUCPU_INT_NUMREG] = {
+  0x10fff00,
+  0x110ff00,
+  0x111ff00,
+  0x12afc00,
+  0x12bff00,
+  0x12cff00,
+  0x12dff00,
+  0x12eff00,
+  0x12fff00,
+  0x130ff00,
+  0x1337f00,
+  0x1347c00,
+  0x135ff00,
+  0x1427f00
+};
 
-
-const uint32_t scu32ia3d_DiffMifTbl [QUCPU_INT_NUMFRQ] [QUCPU_INT_NUMREG] [QUCPU_INT_NUMRCK] = {
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0b},
-    {0x110ff1e, 0x110ff16},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff40},
-    {0x12cff08, 0x12cff18},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f46},
-    {0x1347c30, 0x1347c50},
-    {0x135ff03, 0x135ff03},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff05},
-    {0x110ff1e, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff0a},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c30},
-    {0x135ff03, 0x135ff03},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0a},
-    {0x110ff1e, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afc04, 0x12afc04},
-    {0x12bff1e, 0x12bff10},
-    {0x12cff08, 0x12cff08},
-    {0x12dff01, 0x12dff01},
-    {0x12eff00, 0x12eff00},
-    {0x12fff00, 0x12fff00},
-    {0x130ff00, 0x130ff00},
-    {0x1337f42, 0x1337f4a},
-    {0x1347c30, 0x1347c40},
-    {0x135ff03, 0x135ff04},
-    {0x1427f00, 0x1427f00} },
-
-  { {0x10fff0f, 0x10fff0f},
-    {0x110ff1e, 0x110ff1e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dffe4},
-    {0x12eff00, 0x12eff29},
-    {0x12fff00, 0x12fff41},
-    {0x130ff00, 0x130ff9e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0f, 0x10fff0f},
-    {0x110ff1e, 0x110ff1e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff78},
-    {0x12effcc, 0x12effc6},
-    {0x12fffcc, 0x12fffea},
-    {0x130ff4c, 0x130ffcd},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0f, 0x10fff0f},
-    {0x110ff1e, 0x110ff1e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff0c},
-    {0x12eff99, 0x12eff63},
-    {0x12fff99, 0x12fff94},
-    {0x130ff99, 0x130fffd},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0f, 0x10fff0f},
-    {0x110ff1e, 0x110ff1e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dffa0},
-    {0x12eff66, 0x12effff},
-    {0x12fff66, 0x12fff3d},
-    {0x130ffe6, 0x130ff2d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0f, 0x10fff0f},
-    {0x110ff1e, 0x110ff1e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff34},
-    {0x12eff33, 0x12eff9c},
-    {0x12fff33, 0x12fffe7},
-    {0x130ff33, 0x130ff5c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0f, 0x10fff0f},
-    {0x110ff1e, 0x110ff1e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dffc9},
-    {0x12eff00, 0x12eff38},
-    {0x12fff00, 0x12fff91},
-    {0x130ff80, 0x130ff8c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0f, 0x10fff0f},
-    {0x110ff1e, 0x110ff1e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff5d},
-    {0x12effcc, 0x12effd5},
-    {0x12fffcc, 0x12fff3a},
-    {0x130ffcc, 0x130ffbc},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0f, 0x10fff0f},
-    {0x110ff1e, 0x110ff1e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dfff1},
-    {0x12eff99, 0x12eff71},
-    {0x12fff99, 0x12fffe4},
-    {0x130ff19, 0x130ffeb},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0e, 0x10fff0e},
-    {0x110ff1c, 0x110ff1c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dfff4},
-    {0x12effa3, 0x12eff73},
-    {0x12fff70, 0x12fff62},
-    {0x130ff3d, 0x130ffc4},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0e, 0x10fff0e},
-    {0x110ff1c, 0x110ff1c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dffb1},
-    {0x12effb8, 0x12eff9f},
-    {0x12fff1e, 0x12fffde},
-    {0x130ff85, 0x130fff0},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0e, 0x10fff0e},
-    {0x110ff1c, 0x110ff1c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff6f},
-    {0x12effcc, 0x12effcb},
-    {0x12fffcc, 0x12fff5a},
-    {0x130ffcc, 0x130ff1d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0e, 0x10fff0e},
-    {0x110ff1c, 0x110ff1c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dff2c},
-    {0x12effe1, 0x12efff7},
-    {0x12fff7a, 0x12fffd6},
-    {0x130ff14, 0x130ff49},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0e, 0x10fff0e},
-    {0x110ff1c, 0x110ff1c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dffea},
-    {0x12efff5, 0x12eff22},
-    {0x12fff28, 0x12fff53},
-    {0x130ff5c, 0x130ff76},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0e, 0x10fff0e},
-    {0x110ff1c, 0x110ff1c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dffa7},
-    {0x12eff0a, 0x12eff4e},
-    {0x12fffd7, 0x12fffcf},
-    {0x130ffa3, 0x130ffa2},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0e, 0x10fff0e},
-    {0x110ff1c, 0x110ff1c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dff65},
-    {0x12eff1e, 0x12eff7a},
-    {0x12fff85, 0x12fff4b},
-    {0x130ffeb, 0x130ffcf},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0e, 0x10fff0e},
-    {0x110ff1c, 0x110ff1c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff22},
-    {0x12eff33, 0x12effa6},
-    {0x12fff33, 0x12fffc7},
-    {0x130ff33, 0x130fffb},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0d, 0x10fff0d},
-    {0x110ff1a, 0x110ff1a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dff99},
-    {0x12effc2, 0x12effb0},
-    {0x12ffff5, 0x12fffac},
-    {0x130ff28, 0x130ffb7},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0d, 0x10fff0d},
-    {0x110ff1a, 0x110ff1a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dff80},
-    {0x12eff1e, 0x12eff6b},
-    {0x12fff85, 0x12ffffb},
-    {0x130ff6b, 0x130ffe0},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0d, 0x10fff0d},
-    {0x110ff1a, 0x110ff1a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dff67},
-    {0x12eff7a, 0x12eff26},
-    {0x12fff14, 0x12fff4a},
-    {0x130ffae, 0x130ff0a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0d, 0x10fff0d},
-    {0x110ff1a, 0x110ff1a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dff4e},
-    {0x12effd7, 0x12effe1},
-    {0x12fffa3, 0x12fff98},
-    {0x130fff0, 0x130ff33},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0d, 0x10fff0d},
-    {0x110ff1a, 0x110ff1a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff34},
-    {0x12eff33, 0x12eff9c},
-    {0x12fff33, 0x12fffe7},
-    {0x130ff33, 0x130ff5c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0d, 0x10fff0d},
-    {0x110ff1a, 0x110ff1a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dff1b},
-    {0x12eff8f, 0x12eff57},
-    {0x12fffc2, 0x12fff36},
-    {0x130ff75, 0x130ff86},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0d, 0x10fff0d},
-    {0x110ff1a, 0x110ff1a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dff02},
-    {0x12effeb, 0x12eff12},
-    {0x12fff51, 0x12fff85},
-    {0x130ffb8, 0x130ffaf},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0d, 0x10fff0d},
-    {0x110ff1a, 0x110ff1a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dffe9},
-    {0x12eff47, 0x12effcc},
-    {0x12fffe1, 0x12fffd3},
-    {0x130fffa, 0x130ffd8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0d, 0x10fff0d},
-    {0x110ff1a, 0x110ff1a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dffd0},
-    {0x12effa3, 0x12eff87},
-    {0x12fff70, 0x12fff22},
-    {0x130ff3d, 0x130ff02},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0c, 0x10fff0c},
-    {0x110ff18, 0x110ff18},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dffe4},
-    {0x12eff00, 0x12eff29},
-    {0x12fff00, 0x12fff41},
-    {0x130ff00, 0x130ff9e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0c, 0x10fff0c},
-    {0x110ff18, 0x110ff18},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dfff4},
-    {0x12effa3, 0x12eff73},
-    {0x12fff70, 0x12fff62},
-    {0x130ff3d, 0x130ffc4},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0c, 0x10fff0c},
-    {0x110ff18, 0x110ff18},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dff04},
-    {0x12eff47, 0x12effbe},
-    {0x12fffe1, 0x12fff83},
-    {0x130ff7a, 0x130ffea},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0c, 0x10fff0c},
-    {0x110ff18, 0x110ff18},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dff14},
-    {0x12effeb, 0x12eff08},
-    {0x12fff51, 0x12fffa5},
-    {0x130ffb8, 0x130ff10},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0c, 0x10fff0c},
-    {0x110ff18, 0x110ff18},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dff24},
-    {0x12eff8f, 0x12eff52},
-    {0x12fffc2, 0x12fffc6},
-    {0x130fff5, 0x130ff36},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0c, 0x10fff0c},
-    {0x110ff18, 0x110ff18},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff34},
-    {0x12eff33, 0x12eff9c},
-    {0x12fff33, 0x12fffe7},
-    {0x130ff33, 0x130ff5c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0c, 0x10fff0c},
-    {0x110ff18, 0x110ff18},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dff45},
-    {0x12effd7, 0x12effe6},
-    {0x12fffa3, 0x12fff08},
-    {0x130ff70, 0x130ff83},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0c, 0x10fff0c},
-    {0x110ff18, 0x110ff18},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dff55},
-    {0x12eff7a, 0x12eff30},
-    {0x12fff14, 0x12fff2a},
-    {0x130ffae, 0x130ffa9},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0c, 0x10fff0c},
-    {0x110ff18, 0x110ff18},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dff65},
-    {0x12eff1e, 0x12eff7a},
-    {0x12fff85, 0x12fff4b},
-    {0x130ffeb, 0x130ffcf},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0c, 0x10fff0c},
-    {0x110ff18, 0x110ff18},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dff75},
-    {0x12effc2, 0x12effc4},
-    {0x12ffff5, 0x12fff6c},
-    {0x130ff28, 0x130fff5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0c, 0x10fff0c},
-    {0x110ff18, 0x110ff18},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff85},
-    {0x12eff66, 0x12eff0e},
-    {0x12fff66, 0x12fff8e},
-    {0x130ff66, 0x130ff1b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0c, 0x10fff0c},
-    {0x110ff18, 0x110ff18},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dff95},
-    {0x12eff0a, 0x12eff58},
-    {0x12fffd7, 0x12fffaf},
-    {0x130ffa3, 0x130ff41},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0b, 0x10fff0b},
-    {0x110ff16, 0x110ff16},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dffc2},
-    {0x12eff0a, 0x12eff3f},
-    {0x12fffd7, 0x12fff7f},
-    {0x130ff23, 0x130ffb4},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0b, 0x10fff0b},
-    {0x110ff16, 0x110ff16},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dfffc},
-    {0x12efff5, 0x12eff18},
-    {0x12fff28, 0x12fff73},
-    {0x130ff5c, 0x130ffd7},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0b, 0x10fff0b},
-    {0x110ff16, 0x110ff16},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dff35},
-    {0x12effe1, 0x12efff2},
-    {0x12fff7a, 0x12fff66},
-    {0x130ff94, 0x130fffa},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0b, 0x10fff0b},
-    {0x110ff16, 0x110ff16},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff6f},
-    {0x12effcc, 0x12effcb},
-    {0x12fffcc, 0x12fff5a},
-    {0x130ffcc, 0x130ff1d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0b, 0x10fff0b},
-    {0x110ff16, 0x110ff16},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dffa8},
-    {0x12effb8, 0x12effa4},
-    {0x12fff1e, 0x12fff4e},
-    {0x130ff05, 0x130ff40},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0b, 0x10fff0b},
-    {0x110ff16, 0x110ff16},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dffe2},
-    {0x12effa3, 0x12eff7d},
-    {0x12fff70, 0x12fff42},
-    {0x130ff3d, 0x130ff63},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0b, 0x10fff0b},
-    {0x110ff16, 0x110ff16},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dff1b},
-    {0x12eff8f, 0x12eff57},
-    {0x12fffc2, 0x12fff36},
-    {0x130ff75, 0x130ff86},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0b, 0x10fff0b},
-    {0x110ff16, 0x110ff16},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dff55},
-    {0x12eff7a, 0x12eff30},
-    {0x12fff14, 0x12fff2a},
-    {0x130ffae, 0x130ffa9},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0b, 0x10fff0b},
-    {0x110ff16, 0x110ff16},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff8e},
-    {0x12eff66, 0x12eff09},
-    {0x12fff66, 0x12fff1e},
-    {0x130ffe6, 0x130ffcc},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0b, 0x10fff0b},
-    {0x110ff16, 0x110ff16},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dffc8},
-    {0x12eff51, 0x12effe2},
-    {0x12fffb8, 0x12fff11},
-    {0x130ff1e, 0x130ffef},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0b, 0x10fff0b},
-    {0x110ff16, 0x110ff16},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dff01},
-    {0x12eff3d, 0x12effbc},
-    {0x12fff0a, 0x12fff05},
-    {0x130ff57, 0x130ff12},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0b, 0x10fff0b},
-    {0x110ff16, 0x110ff16},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dff3b},
-    {0x12eff28, 0x12eff95},
-    {0x12fff5c, 0x12ffff9},
-    {0x130ff8f, 0x130ff34},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0b, 0x10fff0b},
-    {0x110ff16, 0x110ff16},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dff74},
-    {0x12eff14, 0x12eff6e},
-    {0x12fffae, 0x12fffed},
-    {0x130ffc7, 0x130ff57},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0a, 0x10fff0a},
-    {0x110ff14, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dffe4},
-    {0x12eff00, 0x12eff29},
-    {0x12fff00, 0x12fff41},
-    {0x130ff00, 0x130ff9e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0a, 0x10fff0a},
-    {0x110ff14, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff46},
-    {0x12eff33, 0x12eff92},
-    {0x12fff33, 0x12fff07},
-    {0x130ff33, 0x130ffbe},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0a, 0x10fff0a},
-    {0x110ff14, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dffa9},
-    {0x12eff66, 0x12efffa},
-    {0x12fff66, 0x12fffcd},
-    {0x130ff66, 0x130ffdd},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0a, 0x10fff0a},
-    {0x110ff14, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff0c},
-    {0x12eff99, 0x12eff63},
-    {0x12fff99, 0x12fff94},
-    {0x130ff99, 0x130fffd},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0a, 0x10fff0a},
-    {0x110ff14, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff6f},
-    {0x12effcc, 0x12effcb},
-    {0x12fffcc, 0x12fff5a},
-    {0x130ffcc, 0x130ff1d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0a, 0x10fff0a},
-    {0x110ff14, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dffd2},
-    {0x12eff00, 0x12eff33},
-    {0x12fff00, 0x12fff21},
-    {0x130ff00, 0x130ff3d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0a, 0x10fff0a},
-    {0x110ff14, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff34},
-    {0x12eff33, 0x12eff9c},
-    {0x12fff33, 0x12fffe7},
-    {0x130ff33, 0x130ff5c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0a, 0x10fff0a},
-    {0x110ff14, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff97},
-    {0x12eff66, 0x12eff04},
-    {0x12fff66, 0x12fffae},
-    {0x130ff66, 0x130ff7c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0a, 0x10fff0a},
-    {0x110ff14, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dfffa},
-    {0x12eff99, 0x12eff6c},
-    {0x12fff99, 0x12fff74},
-    {0x130ff99, 0x130ff9c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0a, 0x10fff0a},
-    {0x110ff14, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff5d},
-    {0x12effcc, 0x12effd5},
-    {0x12fffcc, 0x12fff3a},
-    {0x130ffcc, 0x130ffbc},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0a, 0x10fff0a},
-    {0x110ff14, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dffc0},
-    {0x12eff00, 0x12eff3d},
-    {0x12fff00, 0x12fff01},
-    {0x130ff00, 0x130ffdc},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0a, 0x10fff0a},
-    {0x110ff14, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff22},
-    {0x12eff33, 0x12effa6},
-    {0x12fff33, 0x12fffc7},
-    {0x130ff33, 0x130fffb},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0a, 0x10fff0a},
-    {0x110ff14, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff85},
-    {0x12eff66, 0x12eff0e},
-    {0x12fff66, 0x12fff8e},
-    {0x130ff66, 0x130ff1b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0a, 0x10fff0a},
-    {0x110ff14, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffe8},
-    {0x12eff99, 0x12eff76},
-    {0x12fff99, 0x12fff54},
-    {0x130ff99, 0x130ff3b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0a, 0x10fff0a},
-    {0x110ff14, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff4b},
-    {0x12effcc, 0x12effdf},
-    {0x12fffcc, 0x12fff1a},
-    {0x130ffcc, 0x130ff5b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0a, 0x10fff0a},
-    {0x110ff14, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dffae},
-    {0x12eff00, 0x12eff47},
-    {0x12fff00, 0x12fffe1},
-    {0x130ff00, 0x130ff7a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff0a, 0x10fff0a},
-    {0x110ff14, 0x110ff14},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff10},
-    {0x12eff33, 0x12effb0},
-    {0x12fff33, 0x12fffa7},
-    {0x130ff33, 0x130ff9a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff09, 0x10fff09},
-    {0x110ff12, 0x110ff12},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dff68},
-    {0x12eff28, 0x12eff7c},
-    {0x12fff5c, 0x12fffc9},
-    {0x130ff0f, 0x130ffa7},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff09, 0x10fff09},
-    {0x110ff12, 0x110ff12},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dfff4},
-    {0x12effa3, 0x12eff73},
-    {0x12fff70, 0x12fff62},
-    {0x130ff3d, 0x130ffc4},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff09, 0x10fff09},
-    {0x110ff12, 0x110ff12},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dff80},
-    {0x12eff1e, 0x12eff6b},
-    {0x12fff85, 0x12ffffb},
-    {0x130ff6b, 0x130ffe0},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff09, 0x10fff09},
-    {0x110ff12, 0x110ff12},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff0c},
-    {0x12eff99, 0x12eff63},
-    {0x12fff99, 0x12fff94},
-    {0x130ff99, 0x130fffd},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff09, 0x10fff09},
-    {0x110ff12, 0x110ff12},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dff98},
-    {0x12eff14, 0x12eff5a},
-    {0x12fffae, 0x12fff2d},
-    {0x130ffc7, 0x130ff1a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff09, 0x10fff09},
-    {0x110ff12, 0x110ff12},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dff24},
-    {0x12eff8f, 0x12eff52},
-    {0x12fffc2, 0x12fffc6},
-    {0x130fff5, 0x130ff36},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff09, 0x10fff09},
-    {0x110ff12, 0x110ff12},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dffb0},
-    {0x12eff0a, 0x12eff49},
-    {0x12fffd7, 0x12fff5f},
-    {0x130ff23, 0x130ff53},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff09, 0x10fff09},
-    {0x110ff12, 0x110ff12},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dff3c},
-    {0x12eff85, 0x12eff41},
-    {0x12fffeb, 0x12ffff8},
-    {0x130ff51, 0x130ff6f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff09, 0x10fff09},
-    {0x110ff12, 0x110ff12},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dffc9},
-    {0x12eff00, 0x12eff38},
-    {0x12fff00, 0x12fff91},
-    {0x130ff80, 0x130ff8c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff09, 0x10fff09},
-    {0x110ff12, 0x110ff12},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dff55},
-    {0x12eff7a, 0x12eff30},
-    {0x12fff14, 0x12fff2a},
-    {0x130ffae, 0x130ffa9},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff09, 0x10fff09},
-    {0x110ff12, 0x110ff12},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dffe1},
-    {0x12efff5, 0x12eff27},
-    {0x12fff28, 0x12fffc3},
-    {0x130ffdc, 0x130ffc5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff09, 0x10fff09},
-    {0x110ff12, 0x110ff12},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dff6d},
-    {0x12eff70, 0x12eff1f},
-    {0x12fff3d, 0x12fff5c},
-    {0x130ff0a, 0x130ffe2},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff09, 0x10fff09},
-    {0x110ff12, 0x110ff12},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dfff9},
-    {0x12effeb, 0x12eff16},
-    {0x12fff51, 0x12ffff5},
-    {0x130ff38, 0x130fffe},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff09, 0x10fff09},
-    {0x110ff12, 0x110ff12},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff85},
-    {0x12eff66, 0x12eff0e},
-    {0x12fff66, 0x12fff8e},
-    {0x130ff66, 0x130ff1b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff09, 0x10fff09},
-    {0x110ff12, 0x110ff12},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dff11},
-    {0x12effe1, 0x12eff06},
-    {0x12fff7a, 0x12fff27},
-    {0x130ff94, 0x130ff38},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff09, 0x10fff09},
-    {0x110ff12, 0x110ff12},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dff9d},
-    {0x12eff5c, 0x12efffd},
-    {0x12fff8f, 0x12fffbf},
-    {0x130ffc2, 0x130ff54},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff09, 0x10fff09},
-    {0x110ff12, 0x110ff12},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dff2a},
-    {0x12effd7, 0x12efff5},
-    {0x12fffa3, 0x12fff58},
-    {0x130fff0, 0x130ff71},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff09, 0x10fff09},
-    {0x110ff12, 0x110ff12},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dffb6},
-    {0x12eff51, 0x12effec},
-    {0x12fffb8, 0x12ffff1},
-    {0x130ff1e, 0x130ff8d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff09, 0x10fff09},
-    {0x110ff12, 0x110ff12},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff42},
-    {0x12effcc, 0x12effe4},
-    {0x12fffcc, 0x12fff8a},
-    {0x130ff4c, 0x130ffaa},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff09, 0x10fff09},
-    {0x110ff12, 0x110ff12},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dffce},
-    {0x12eff47, 0x12effdb},
-    {0x12fffe1, 0x12fff23},
-    {0x130ff7a, 0x130ffc7},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff09, 0x10fff09},
-    {0x110ff12, 0x110ff12},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dff5a},
-    {0x12effc2, 0x12effd3},
-    {0x12ffff5, 0x12fffbc},
-    {0x130ffa8, 0x130ffe3},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff08, 0x10fff08},
-    {0x110ff10, 0x110ff10},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dff3e},
-    {0x12effe1, 0x12effed},
-    {0x12fff7a, 0x12ffff6},
-    {0x130ff14, 0x130ffaa},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff08, 0x10fff08},
-    {0x110ff10, 0x110ff10},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dfff4},
-    {0x12effa3, 0x12eff73},
-    {0x12fff70, 0x12fff62},
-    {0x130ff3d, 0x130ffc4},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff08, 0x10fff08},
-    {0x110ff10, 0x110ff10},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dffa9},
-    {0x12eff66, 0x12efffa},
-    {0x12fff66, 0x12fffcd},
-    {0x130ff66, 0x130ffdd},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff08, 0x10fff08},
-    {0x110ff10, 0x110ff10},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dff5f},
-    {0x12eff28, 0x12eff81},
-    {0x12fff5c, 0x12fff39},
-    {0x130ff8f, 0x130fff7},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff08, 0x10fff08},
-    {0x110ff10, 0x110ff10},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dff14},
-    {0x12effeb, 0x12eff08},
-    {0x12fff51, 0x12fffa5},
-    {0x130ffb8, 0x130ff10},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff08, 0x10fff08},
-    {0x110ff10, 0x110ff10},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dffc9},
-    {0x12effae, 0x12eff8e},
-    {0x12fff47, 0x12fff10},
-    {0x130ffe1, 0x130ff2a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff08, 0x10fff08},
-    {0x110ff10, 0x110ff10},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dff7f},
-    {0x12eff70, 0x12eff15},
-    {0x12fff3d, 0x12fff7c},
-    {0x130ff0a, 0x130ff43},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff08, 0x10fff08},
-    {0x110ff10, 0x110ff10},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff34},
-    {0x12eff33, 0x12eff9c},
-    {0x12fff33, 0x12fffe7},
-    {0x130ff33, 0x130ff5c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff08, 0x10fff08},
-    {0x110ff10, 0x110ff10},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dffea},
-    {0x12efff5, 0x12eff22},
-    {0x12fff28, 0x12fff53},
-    {0x130ff5c, 0x130ff76},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff08, 0x10fff08},
-    {0x110ff10, 0x110ff10},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dff9f},
-    {0x12effb8, 0x12effa9},
-    {0x12fff1e, 0x12fffbe},
-    {0x130ff85, 0x130ff8f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff08, 0x10fff08},
-    {0x110ff10, 0x110ff10},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dff55},
-    {0x12eff7a, 0x12eff30},
-    {0x12fff14, 0x12fff2a},
-    {0x130ffae, 0x130ffa9},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff08, 0x10fff08},
-    {0x110ff10, 0x110ff10},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dff0a},
-    {0x12eff3d, 0x12effb7},
-    {0x12fff0a, 0x12fff95},
-    {0x130ffd7, 0x130ffc2},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff08, 0x10fff08},
-    {0x110ff10, 0x110ff10},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dffc0},
-    {0x12eff00, 0x12eff3d},
-    {0x12fff00, 0x12fff01},
-    {0x130ff00, 0x130ffdc},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff08, 0x10fff08},
-    {0x110ff10, 0x110ff10},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dff75},
-    {0x12effc2, 0x12effc4},
-    {0x12ffff5, 0x12fff6c},
-    {0x130ff28, 0x130fff5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff08, 0x10fff08},
-    {0x110ff10, 0x110ff10},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dff2a},
-    {0x12eff85, 0x12eff4b},
-    {0x12fffeb, 0x12fffd8},
-    {0x130ff51, 0x130ff0e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff08, 0x10fff08},
-    {0x110ff10, 0x110ff10},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dffe0},
-    {0x12eff47, 0x12effd1},
-    {0x12fffe1, 0x12fff43},
-    {0x130ff7a, 0x130ff28},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff08, 0x10fff08},
-    {0x110ff10, 0x110ff10},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dff95},
-    {0x12eff0a, 0x12eff58},
-    {0x12fffd7, 0x12fffaf},
-    {0x130ffa3, 0x130ff41},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff08, 0x10fff08},
-    {0x110ff10, 0x110ff10},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff4b},
-    {0x12effcc, 0x12effdf},
-    {0x12fffcc, 0x12fff1a},
-    {0x130ffcc, 0x130ff5b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff08, 0x10fff08},
-    {0x110ff10, 0x110ff10},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dff00},
-    {0x12eff8f, 0x12eff66},
-    {0x12fffc2, 0x12fff86},
-    {0x130fff5, 0x130ff74},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff08, 0x10fff08},
-    {0x110ff10, 0x110ff10},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dffb6},
-    {0x12eff51, 0x12effec},
-    {0x12fffb8, 0x12ffff1},
-    {0x130ff1e, 0x130ff8d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff08, 0x10fff08},
-    {0x110ff10, 0x110ff10},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dff6b},
-    {0x12eff14, 0x12eff73},
-    {0x12fffae, 0x12fff5d},
-    {0x130ff47, 0x130ffa7},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff08, 0x10fff08},
-    {0x110ff10, 0x110ff10},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dff21},
-    {0x12effd7, 0x12efffa},
-    {0x12fffa3, 0x12fffc8},
-    {0x130ff70, 0x130ffc0},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff08, 0x10fff08},
-    {0x110ff10, 0x110ff10},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffd6},
-    {0x12eff99, 0x12eff80},
-    {0x12fff99, 0x12fff34},
-    {0x130ff99, 0x130ffda},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff08, 0x10fff08},
-    {0x110ff10, 0x110ff10},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dff8b},
-    {0x12eff5c, 0x12eff07},
-    {0x12fff8f, 0x12fffa0},
-    {0x130ffc2, 0x130fff3},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff08, 0x10fff08},
-    {0x110ff10, 0x110ff10},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dff41},
-    {0x12eff1e, 0x12eff8e},
-    {0x12fff85, 0x12fff0b},
-    {0x130ffeb, 0x130ff0d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff08, 0x10fff08},
-    {0x110ff10, 0x110ff10},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dfff6},
-    {0x12effe1, 0x12eff14},
-    {0x12fff7a, 0x12fff77},
-    {0x130ff14, 0x130ff26},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff08, 0x10fff08},
-    {0x110ff10, 0x110ff10},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dffac},
-    {0x12effa3, 0x12eff9b},
-    {0x12fff70, 0x12fffe2},
-    {0x130ff3d, 0x130ff3f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff15},
-    {0x12eff99, 0x12eff5e},
-    {0x12fff99, 0x12fff24},
-    {0x130ff19, 0x130ffae},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dfff4},
-    {0x12effa3, 0x12eff73},
-    {0x12fff70, 0x12fff62},
-    {0x130ff3d, 0x130ffc4},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dffd2},
-    {0x12effae, 0x12eff89},
-    {0x12fff47, 0x12fffa0},
-    {0x130ff61, 0x130ffda},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dffb1},
-    {0x12effb8, 0x12eff9f},
-    {0x12fff1e, 0x12fffde},
-    {0x130ff85, 0x130fff0},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dff90},
-    {0x12effc2, 0x12effb5},
-    {0x12ffff5, 0x12fff1c},
-    {0x130ffa8, 0x130ff07},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff6f},
-    {0x12effcc, 0x12effcb},
-    {0x12fffcc, 0x12fff5a},
-    {0x130ffcc, 0x130ff1d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dff4e},
-    {0x12effd7, 0x12effe1},
-    {0x12fffa3, 0x12fff98},
-    {0x130fff0, 0x130ff33},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dff2c},
-    {0x12effe1, 0x12efff7},
-    {0x12fff7a, 0x12fffd6},
-    {0x130ff14, 0x130ff49},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dff0b},
-    {0x12effeb, 0x12eff0d},
-    {0x12fff51, 0x12fff15},
-    {0x130ff38, 0x130ff60},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dffea},
-    {0x12efff5, 0x12eff22},
-    {0x12fff28, 0x12fff53},
-    {0x130ff5c, 0x130ff76},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dffc9},
-    {0x12eff00, 0x12eff38},
-    {0x12fff00, 0x12fff91},
-    {0x130ff80, 0x130ff8c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dffa7},
-    {0x12eff0a, 0x12eff4e},
-    {0x12fffd7, 0x12fffcf},
-    {0x130ffa3, 0x130ffa2},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dff86},
-    {0x12eff14, 0x12eff64},
-    {0x12fffae, 0x12fff0d},
-    {0x130ffc7, 0x130ffb9},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dff65},
-    {0x12eff1e, 0x12eff7a},
-    {0x12fff85, 0x12fff4b},
-    {0x130ffeb, 0x130ffcf},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dff44},
-    {0x12eff28, 0x12eff90},
-    {0x12fff5c, 0x12fff89},
-    {0x130ff0f, 0x130ffe5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff22},
-    {0x12eff33, 0x12effa6},
-    {0x12fff33, 0x12fffc7},
-    {0x130ff33, 0x130fffb},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dff01},
-    {0x12eff3d, 0x12effbc},
-    {0x12fff0a, 0x12fff05},
-    {0x130ff57, 0x130ff12},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dffe0},
-    {0x12eff47, 0x12effd1},
-    {0x12fffe1, 0x12fff43},
-    {0x130ff7a, 0x130ff28},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dffbf},
-    {0x12eff51, 0x12effe7},
-    {0x12fffb8, 0x12fff81},
-    {0x130ff9e, 0x130ff3e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dff9d},
-    {0x12eff5c, 0x12efffd},
-    {0x12fff8f, 0x12fffbf},
-    {0x130ffc2, 0x130ff54},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff7c},
-    {0x12eff66, 0x12eff13},
-    {0x12fff66, 0x12ffffe},
-    {0x130ffe6, 0x130ff6a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dff5b},
-    {0x12eff70, 0x12eff29},
-    {0x12fff3d, 0x12fff3c},
-    {0x130ff0a, 0x130ff81},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dff3a},
-    {0x12eff7a, 0x12eff3f},
-    {0x12fff14, 0x12fff7a},
-    {0x130ff2e, 0x130ff97},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dff18},
-    {0x12eff85, 0x12eff55},
-    {0x12fffeb, 0x12fffb8},
-    {0x130ff51, 0x130ffad},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dfff7},
-    {0x12eff8f, 0x12eff6a},
-    {0x12fffc2, 0x12ffff6},
-    {0x130ff75, 0x130ffc3},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffd6},
-    {0x12eff99, 0x12eff80},
-    {0x12fff99, 0x12fff34},
-    {0x130ff99, 0x130ffda},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dffb5},
-    {0x12effa3, 0x12eff96},
-    {0x12fff70, 0x12fff72},
-    {0x130ffbd, 0x130fff0},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dff94},
-    {0x12effae, 0x12effac},
-    {0x12fff47, 0x12fffb0},
-    {0x130ffe1, 0x130ff06},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dff72},
-    {0x12effb8, 0x12effc2},
-    {0x12fff1e, 0x12fffee},
-    {0x130ff05, 0x130ff1c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dff51},
-    {0x12effc2, 0x12effd8},
-    {0x12ffff5, 0x12fff2c},
-    {0x130ff28, 0x130ff33},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff30},
-    {0x12effcc, 0x12effee},
-    {0x12fffcc, 0x12fff6a},
-    {0x130ff4c, 0x130ff49},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dff0f},
-    {0x12effd7, 0x12eff04},
-    {0x12fffa3, 0x12fffa9},
-    {0x130ff70, 0x130ff5f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dffed},
-    {0x12effe1, 0x12eff19},
-    {0x12fff7a, 0x12fffe7},
-    {0x130ff94, 0x130ff75},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dffcc},
-    {0x12effeb, 0x12eff2f},
-    {0x12fff51, 0x12fff25},
-    {0x130ffb8, 0x130ff8c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff07, 0x10fff07},
-    {0x110ff0e, 0x110ff0e},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dffab},
-    {0x12efff5, 0x12eff45},
-    {0x12fff28, 0x12fff63},
-    {0x130ffdc, 0x130ffa2},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dffe4},
-    {0x12eff00, 0x12eff29},
-    {0x12fff00, 0x12fff41},
-    {0x130ff00, 0x130ff9e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dffec},
-    {0x12eff51, 0x12effce},
-    {0x12fffb8, 0x12fff51},
-    {0x130ff1e, 0x130ffb1},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dfff4},
-    {0x12effa3, 0x12eff73},
-    {0x12fff70, 0x12fff62},
-    {0x130ff3d, 0x130ffc4},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dfffc},
-    {0x12efff5, 0x12eff18},
-    {0x12fff28, 0x12fff73},
-    {0x130ff5c, 0x130ffd7},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dff04},
-    {0x12eff47, 0x12effbe},
-    {0x12fffe1, 0x12fff83},
-    {0x130ff7a, 0x130ffea},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff0c},
-    {0x12eff99, 0x12eff63},
-    {0x12fff99, 0x12fff94},
-    {0x130ff99, 0x130fffd},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dff14},
-    {0x12effeb, 0x12eff08},
-    {0x12fff51, 0x12fffa5},
-    {0x130ffb8, 0x130ff10},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dff1c},
-    {0x12eff3d, 0x12effad},
-    {0x12fff0a, 0x12fffb5},
-    {0x130ffd7, 0x130ff23},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dff24},
-    {0x12eff8f, 0x12eff52},
-    {0x12fffc2, 0x12fffc6},
-    {0x130fff5, 0x130ff36},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dff2c},
-    {0x12effe1, 0x12efff7},
-    {0x12fff7a, 0x12fffd6},
-    {0x130ff14, 0x130ff49},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff34},
-    {0x12eff33, 0x12eff9c},
-    {0x12fff33, 0x12fffe7},
-    {0x130ff33, 0x130ff5c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dff3c},
-    {0x12eff85, 0x12eff41},
-    {0x12fffeb, 0x12ffff8},
-    {0x130ff51, 0x130ff6f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dff45},
-    {0x12effd7, 0x12effe6},
-    {0x12fffa3, 0x12fff08},
-    {0x130ff70, 0x130ff83},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dff4d},
-    {0x12eff28, 0x12eff8b},
-    {0x12fff5c, 0x12fff19},
-    {0x130ff8f, 0x130ff96},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dff55},
-    {0x12eff7a, 0x12eff30},
-    {0x12fff14, 0x12fff2a},
-    {0x130ffae, 0x130ffa9},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff5d},
-    {0x12effcc, 0x12effd5},
-    {0x12fffcc, 0x12fff3a},
-    {0x130ffcc, 0x130ffbc},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dff65},
-    {0x12eff1e, 0x12eff7a},
-    {0x12fff85, 0x12fff4b},
-    {0x130ffeb, 0x130ffcf},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dff6d},
-    {0x12eff70, 0x12eff1f},
-    {0x12fff3d, 0x12fff5c},
-    {0x130ff0a, 0x130ffe2},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dff75},
-    {0x12effc2, 0x12effc4},
-    {0x12ffff5, 0x12fff6c},
-    {0x130ff28, 0x130fff5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dff7d},
-    {0x12eff14, 0x12eff69},
-    {0x12fffae, 0x12fff7d},
-    {0x130ff47, 0x130ff08},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff85},
-    {0x12eff66, 0x12eff0e},
-    {0x12fff66, 0x12fff8e},
-    {0x130ff66, 0x130ff1b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dff8d},
-    {0x12effb8, 0x12effb3},
-    {0x12fff1e, 0x12fff9e},
-    {0x130ff85, 0x130ff2e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dff95},
-    {0x12eff0a, 0x12eff58},
-    {0x12fffd7, 0x12fffaf},
-    {0x130ffa3, 0x130ff41},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dff9d},
-    {0x12eff5c, 0x12efffd},
-    {0x12fff8f, 0x12fffbf},
-    {0x130ffc2, 0x130ff54},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dffa5},
-    {0x12effae, 0x12effa2},
-    {0x12fff47, 0x12fffd0},
-    {0x130ffe1, 0x130ff67},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dffae},
-    {0x12eff00, 0x12eff47},
-    {0x12fff00, 0x12fffe1},
-    {0x130ff00, 0x130ff7a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dffb6},
-    {0x12eff51, 0x12effec},
-    {0x12fffb8, 0x12ffff1},
-    {0x130ff1e, 0x130ff8d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dffbe},
-    {0x12effa3, 0x12eff91},
-    {0x12fff70, 0x12fff02},
-    {0x130ff3d, 0x130ffa1},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dffc6},
-    {0x12efff5, 0x12eff36},
-    {0x12fff28, 0x12fff13},
-    {0x130ff5c, 0x130ffb4},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dffce},
-    {0x12eff47, 0x12effdb},
-    {0x12fffe1, 0x12fff23},
-    {0x130ff7a, 0x130ffc7},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffd6},
-    {0x12eff99, 0x12eff80},
-    {0x12fff99, 0x12fff34},
-    {0x130ff99, 0x130ffda},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dffde},
-    {0x12effeb, 0x12eff25},
-    {0x12fff51, 0x12fff45},
-    {0x130ffb8, 0x130ffed},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dffe6},
-    {0x12eff3d, 0x12effca},
-    {0x12fff0a, 0x12fff55},
-    {0x130ffd7, 0x130ff00},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dffee},
-    {0x12eff8f, 0x12eff6f},
-    {0x12fffc2, 0x12fff66},
-    {0x130fff5, 0x130ff13},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dfff6},
-    {0x12effe1, 0x12eff14},
-    {0x12fff7a, 0x12fff77},
-    {0x130ff14, 0x130ff26},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dfffe},
-    {0x12eff33, 0x12effb9},
-    {0x12fff33, 0x12fff87},
-    {0x130ff33, 0x130ff39},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dff06},
-    {0x12eff85, 0x12eff5f},
-    {0x12fffeb, 0x12fff98},
-    {0x130ff51, 0x130ff4c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dff0f},
-    {0x12effd7, 0x12eff04},
-    {0x12fffa3, 0x12fffa9},
-    {0x130ff70, 0x130ff5f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dff17},
-    {0x12eff28, 0x12effa9},
-    {0x12fff5c, 0x12fffb9},
-    {0x130ff8f, 0x130ff72},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dff1f},
-    {0x12eff7a, 0x12eff4e},
-    {0x12fff14, 0x12fffca},
-    {0x130ffae, 0x130ff85},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff27},
-    {0x12effcc, 0x12efff3},
-    {0x12fffcc, 0x12fffda},
-    {0x130ffcc, 0x130ff98},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dff2f},
-    {0x12eff1e, 0x12eff98},
-    {0x12fff85, 0x12fffeb},
-    {0x130ffeb, 0x130ffab},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dff37},
-    {0x12eff70, 0x12eff3d},
-    {0x12fff3d, 0x12ffffc},
-    {0x130ff0a, 0x130ffbe},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dff3f},
-    {0x12effc2, 0x12effe2},
-    {0x12ffff5, 0x12fff0c},
-    {0x130ff28, 0x130ffd2},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dff47},
-    {0x12eff14, 0x12eff87},
-    {0x12fffae, 0x12fff1d},
-    {0x130ff47, 0x130ffe5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff4f},
-    {0x12eff66, 0x12eff2c},
-    {0x12fff66, 0x12fff2e},
-    {0x130ff66, 0x130fff8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dff57},
-    {0x12effb8, 0x12effd1},
-    {0x12fff1e, 0x12fff3e},
-    {0x130ff85, 0x130ff0b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dff5f},
-    {0x12eff0a, 0x12eff76},
-    {0x12fffd7, 0x12fff4f},
-    {0x130ffa3, 0x130ff1e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dff67},
-    {0x12eff5c, 0x12eff1b},
-    {0x12fff8f, 0x12fff60},
-    {0x130ffc2, 0x130ff31},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff06, 0x10fff06},
-    {0x110ff0c, 0x110ff0c},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dff70},
-    {0x12effae, 0x12effc0},
-    {0x12fff47, 0x12fff70},
-    {0x130ffe1, 0x130ff44},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dffe4},
-    {0x12eff00, 0x12eff29},
-    {0x12fff00, 0x12fff41},
-    {0x130ff00, 0x130ff9e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff15},
-    {0x12eff99, 0x12eff5e},
-    {0x12fff99, 0x12fff24},
-    {0x130ff19, 0x130ffae},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff46},
-    {0x12eff33, 0x12eff92},
-    {0x12fff33, 0x12fff07},
-    {0x130ff33, 0x130ffbe},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff78},
-    {0x12effcc, 0x12effc6},
-    {0x12fffcc, 0x12fffea},
-    {0x130ff4c, 0x130ffcd},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dffa9},
-    {0x12eff66, 0x12efffa},
-    {0x12fff66, 0x12fffcd},
-    {0x130ff66, 0x130ffdd},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dffdb},
-    {0x12eff00, 0x12eff2e},
-    {0x12fff00, 0x12fffb1},
-    {0x130ff80, 0x130ffed},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff0c},
-    {0x12eff99, 0x12eff63},
-    {0x12fff99, 0x12fff94},
-    {0x130ff99, 0x130fffd},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff3d},
-    {0x12eff33, 0x12eff97},
-    {0x12fff33, 0x12fff77},
-    {0x130ffb3, 0x130ff0d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff6f},
-    {0x12effcc, 0x12effcb},
-    {0x12fffcc, 0x12fff5a},
-    {0x130ffcc, 0x130ff1d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dffa0},
-    {0x12eff66, 0x12effff},
-    {0x12fff66, 0x12fff3d},
-    {0x130ffe6, 0x130ff2d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dffd2},
-    {0x12eff00, 0x12eff33},
-    {0x12fff00, 0x12fff21},
-    {0x130ff00, 0x130ff3d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff03},
-    {0x12eff99, 0x12eff68},
-    {0x12fff99, 0x12fff04},
-    {0x130ff19, 0x130ff4d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff34},
-    {0x12eff33, 0x12eff9c},
-    {0x12fff33, 0x12fffe7},
-    {0x130ff33, 0x130ff5c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff66},
-    {0x12effcc, 0x12effd0},
-    {0x12fffcc, 0x12fffca},
-    {0x130ff4c, 0x130ff6c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff97},
-    {0x12eff66, 0x12eff04},
-    {0x12fff66, 0x12fffae},
-    {0x130ff66, 0x130ff7c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dffc9},
-    {0x12eff00, 0x12eff38},
-    {0x12fff00, 0x12fff91},
-    {0x130ff80, 0x130ff8c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dfffa},
-    {0x12eff99, 0x12eff6c},
-    {0x12fff99, 0x12fff74},
-    {0x130ff99, 0x130ff9c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff2b},
-    {0x12eff33, 0x12effa1},
-    {0x12fff33, 0x12fff57},
-    {0x130ffb3, 0x130ffac},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff5d},
-    {0x12effcc, 0x12effd5},
-    {0x12fffcc, 0x12fff3a},
-    {0x130ffcc, 0x130ffbc},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff8e},
-    {0x12eff66, 0x12eff09},
-    {0x12fff66, 0x12fff1e},
-    {0x130ffe6, 0x130ffcc},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dffc0},
-    {0x12eff00, 0x12eff3d},
-    {0x12fff00, 0x12fff01},
-    {0x130ff00, 0x130ffdc},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dfff1},
-    {0x12eff99, 0x12eff71},
-    {0x12fff99, 0x12fffe4},
-    {0x130ff19, 0x130ffeb},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff22},
-    {0x12eff33, 0x12effa6},
-    {0x12fff33, 0x12fffc7},
-    {0x130ff33, 0x130fffb},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff54},
-    {0x12effcc, 0x12effda},
-    {0x12fffcc, 0x12fffaa},
-    {0x130ff4c, 0x130ff0b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff85},
-    {0x12eff66, 0x12eff0e},
-    {0x12fff66, 0x12fff8e},
-    {0x130ff66, 0x130ff1b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dffb7},
-    {0x12eff00, 0x12eff42},
-    {0x12fff00, 0x12fff71},
-    {0x130ff80, 0x130ff2b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffe8},
-    {0x12eff99, 0x12eff76},
-    {0x12fff99, 0x12fff54},
-    {0x130ff99, 0x130ff3b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff19},
-    {0x12eff33, 0x12effab},
-    {0x12fff33, 0x12fff37},
-    {0x130ffb3, 0x130ff4b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff4b},
-    {0x12effcc, 0x12effdf},
-    {0x12fffcc, 0x12fff1a},
-    {0x130ffcc, 0x130ff5b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff7c},
-    {0x12eff66, 0x12eff13},
-    {0x12fff66, 0x12ffffe},
-    {0x130ffe6, 0x130ff6a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dffae},
-    {0x12eff00, 0x12eff47},
-    {0x12fff00, 0x12fffe1},
-    {0x130ff00, 0x130ff7a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffdf},
-    {0x12eff99, 0x12eff7b},
-    {0x12fff99, 0x12fffc4},
-    {0x130ff19, 0x130ff8a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff10},
-    {0x12eff33, 0x12effb0},
-    {0x12fff33, 0x12fffa7},
-    {0x130ff33, 0x130ff9a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff42},
-    {0x12effcc, 0x12effe4},
-    {0x12fffcc, 0x12fff8a},
-    {0x130ff4c, 0x130ffaa},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff73},
-    {0x12eff66, 0x12eff18},
-    {0x12fff66, 0x12fff6e},
-    {0x130ff66, 0x130ffba},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dffa5},
-    {0x12eff00, 0x12eff4c},
-    {0x12fff00, 0x12fff51},
-    {0x130ff80, 0x130ffca},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffd6},
-    {0x12eff99, 0x12eff80},
-    {0x12fff99, 0x12fff34},
-    {0x130ff99, 0x130ffda},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff07},
-    {0x12eff33, 0x12effb5},
-    {0x12fff33, 0x12fff17},
-    {0x130ffb3, 0x130ffea},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff39},
-    {0x12effcc, 0x12effe9},
-    {0x12fffcc, 0x12ffffa},
-    {0x130ffcc, 0x130fff9},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff6a},
-    {0x12eff66, 0x12eff1d},
-    {0x12fff66, 0x12fffde},
-    {0x130ffe6, 0x130ff09},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dff9c},
-    {0x12eff00, 0x12eff51},
-    {0x12fff00, 0x12fffc1},
-    {0x130ff00, 0x130ff19},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffcd},
-    {0x12eff99, 0x12eff85},
-    {0x12fff99, 0x12fffa4},
-    {0x130ff19, 0x130ff29},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dfffe},
-    {0x12eff33, 0x12effb9},
-    {0x12fff33, 0x12fff87},
-    {0x130ff33, 0x130ff39},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff30},
-    {0x12effcc, 0x12effee},
-    {0x12fffcc, 0x12fff6a},
-    {0x130ff4c, 0x130ff49},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff61},
-    {0x12eff66, 0x12eff22},
-    {0x12fff66, 0x12fff4e},
-    {0x130ff66, 0x130ff59},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dff93},
-    {0x12eff00, 0x12eff56},
-    {0x12fff00, 0x12fff31},
-    {0x130ff80, 0x130ff69},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffc4},
-    {0x12eff99, 0x12eff8a},
-    {0x12fff99, 0x12fff14},
-    {0x130ff99, 0x130ff79},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dfff5},
-    {0x12eff33, 0x12effbe},
-    {0x12fff33, 0x12ffff7},
-    {0x130ffb3, 0x130ff88},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff27},
-    {0x12effcc, 0x12efff3},
-    {0x12fffcc, 0x12fffda},
-    {0x130ffcc, 0x130ff98},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff58},
-    {0x12eff66, 0x12eff27},
-    {0x12fff66, 0x12fffbe},
-    {0x130ffe6, 0x130ffa8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dff8a},
-    {0x12eff00, 0x12eff5b},
-    {0x12fff00, 0x12fffa1},
-    {0x130ff00, 0x130ffb8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffbb},
-    {0x12eff99, 0x12eff8f},
-    {0x12fff99, 0x12fff84},
-    {0x130ff19, 0x130ffc8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dffec},
-    {0x12eff33, 0x12effc3},
-    {0x12fff33, 0x12fff67},
-    {0x130ff33, 0x130ffd8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff1e},
-    {0x12effcc, 0x12efff8},
-    {0x12fffcc, 0x12fff4a},
-    {0x130ff4c, 0x130ffe8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff4f},
-    {0x12eff66, 0x12eff2c},
-    {0x12fff66, 0x12fff2e},
-    {0x130ff66, 0x130fff8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dff81},
-    {0x12eff00, 0x12eff60},
-    {0x12fff00, 0x12fff11},
-    {0x130ff80, 0x130ff08},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffb2},
-    {0x12eff99, 0x12eff94},
-    {0x12fff99, 0x12ffff4},
-    {0x130ff99, 0x130ff17},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dffe3},
-    {0x12eff33, 0x12effc8},
-    {0x12fff33, 0x12fffd7},
-    {0x130ffb3, 0x130ff27},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff15},
-    {0x12effcc, 0x12efffd},
-    {0x12fffcc, 0x12fffba},
-    {0x130ffcc, 0x130ff37},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff46},
-    {0x12eff66, 0x12eff31},
-    {0x12fff66, 0x12fff9e},
-    {0x130ffe6, 0x130ff47},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dff78},
-    {0x12eff00, 0x12eff65},
-    {0x12fff00, 0x12fff81},
-    {0x130ff00, 0x130ff57},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffa9},
-    {0x12eff99, 0x12eff99},
-    {0x12fff99, 0x12fff64},
-    {0x130ff19, 0x130ff67},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dffda},
-    {0x12eff33, 0x12effcd},
-    {0x12fff33, 0x12fff47},
-    {0x130ff33, 0x130ff77},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff0c},
-    {0x12effcc, 0x12eff02},
-    {0x12fffcc, 0x12fff2b},
-    {0x130ff4c, 0x130ff87},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff3d},
-    {0x12eff66, 0x12eff36},
-    {0x12fff66, 0x12fff0e},
-    {0x130ff66, 0x130ff97},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dff6f},
-    {0x12eff00, 0x12eff6a},
-    {0x12fff00, 0x12ffff1},
-    {0x130ff80, 0x130ffa6},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffa0},
-    {0x12eff99, 0x12eff9e},
-    {0x12fff99, 0x12fffd4},
-    {0x130ff99, 0x130ffb6},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dffd1},
-    {0x12eff33, 0x12effd2},
-    {0x12fff33, 0x12fffb7},
-    {0x130ffb3, 0x130ffc6},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff03},
-    {0x12effcc, 0x12eff07},
-    {0x12fffcc, 0x12fff9b},
-    {0x130ffcc, 0x130ffd6},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff34},
-    {0x12eff66, 0x12eff3b},
-    {0x12fff66, 0x12fff7e},
-    {0x130ffe6, 0x130ffe6},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dff66},
-    {0x12eff00, 0x12eff6f},
-    {0x12fff00, 0x12fff61},
-    {0x130ff00, 0x130fff6},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff97},
-    {0x12eff99, 0x12effa3},
-    {0x12fff99, 0x12fff44},
-    {0x130ff19, 0x130ff06},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dffc8},
-    {0x12eff33, 0x12effd7},
-    {0x12fff33, 0x12fff27},
-    {0x130ff33, 0x130ff16},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dfffa},
-    {0x12effcc, 0x12eff0b},
-    {0x12fffcc, 0x12fff0b},
-    {0x130ff4c, 0x130ff26},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff05, 0x10fff05},
-    {0x110ff0a, 0x110ff0a},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff2b},
-    {0x12eff66, 0x12eff40},
-    {0x12fff66, 0x12fffee},
-    {0x130ff66, 0x130ff35},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dffe4},
-    {0x12eff00, 0x12eff29},
-    {0x12fff00, 0x12fff41},
-    {0x130ff00, 0x130ff9e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dff3e},
-    {0x12effe1, 0x12effed},
-    {0x12fff7a, 0x12ffff6},
-    {0x130ff14, 0x130ffaa},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dff99},
-    {0x12effc2, 0x12effb0},
-    {0x12ffff5, 0x12fffac},
-    {0x130ff28, 0x130ffb7},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dfff4},
-    {0x12effa3, 0x12eff73},
-    {0x12fff70, 0x12fff62},
-    {0x130ff3d, 0x130ffc4},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dff4e},
-    {0x12eff85, 0x12eff37},
-    {0x12fffeb, 0x12fff18},
-    {0x130ff51, 0x130ffd1},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dffa9},
-    {0x12eff66, 0x12efffa},
-    {0x12fff66, 0x12fffcd},
-    {0x130ff66, 0x130ffdd},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dff04},
-    {0x12eff47, 0x12effbe},
-    {0x12fffe1, 0x12fff83},
-    {0x130ff7a, 0x130ffea},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dff5f},
-    {0x12eff28, 0x12eff81},
-    {0x12fff5c, 0x12fff39},
-    {0x130ff8f, 0x130fff7},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dffb9},
-    {0x12eff0a, 0x12eff44},
-    {0x12fffd7, 0x12fffef},
-    {0x130ffa3, 0x130ff03},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dff14},
-    {0x12effeb, 0x12eff08},
-    {0x12fff51, 0x12fffa5},
-    {0x130ffb8, 0x130ff10},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff6f},
-    {0x12effcc, 0x12effcb},
-    {0x12fffcc, 0x12fff5a},
-    {0x130ffcc, 0x130ff1d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dffc9},
-    {0x12effae, 0x12eff8e},
-    {0x12fff47, 0x12fff10},
-    {0x130ffe1, 0x130ff2a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dff24},
-    {0x12eff8f, 0x12eff52},
-    {0x12fffc2, 0x12fffc6},
-    {0x130fff5, 0x130ff36},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dff7f},
-    {0x12eff70, 0x12eff15},
-    {0x12fff3d, 0x12fff7c},
-    {0x130ff0a, 0x130ff43},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dffda},
-    {0x12eff51, 0x12effd8},
-    {0x12fffb8, 0x12fff31},
-    {0x130ff1e, 0x130ff50},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff34},
-    {0x12eff33, 0x12eff9c},
-    {0x12fff33, 0x12fffe7},
-    {0x130ff33, 0x130ff5c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dff8f},
-    {0x12eff14, 0x12eff5f},
-    {0x12fffae, 0x12fff9d},
-    {0x130ff47, 0x130ff69},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dffea},
-    {0x12efff5, 0x12eff22},
-    {0x12fff28, 0x12fff53},
-    {0x130ff5c, 0x130ff76},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dff45},
-    {0x12effd7, 0x12effe6},
-    {0x12fffa3, 0x12fff08},
-    {0x130ff70, 0x130ff83},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dff9f},
-    {0x12effb8, 0x12effa9},
-    {0x12fff1e, 0x12fffbe},
-    {0x130ff85, 0x130ff8f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dfffa},
-    {0x12eff99, 0x12eff6c},
-    {0x12fff99, 0x12fff74},
-    {0x130ff99, 0x130ff9c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dff55},
-    {0x12eff7a, 0x12eff30},
-    {0x12fff14, 0x12fff2a},
-    {0x130ffae, 0x130ffa9},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dffaf},
-    {0x12eff5c, 0x12efff3},
-    {0x12fff8f, 0x12fffdf},
-    {0x130ffc2, 0x130ffb5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dff0a},
-    {0x12eff3d, 0x12effb7},
-    {0x12fff0a, 0x12fff95},
-    {0x130ffd7, 0x130ffc2},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dff65},
-    {0x12eff1e, 0x12eff7a},
-    {0x12fff85, 0x12fff4b},
-    {0x130ffeb, 0x130ffcf},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dffc0},
-    {0x12eff00, 0x12eff3d},
-    {0x12fff00, 0x12fff01},
-    {0x130ff00, 0x130ffdc},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dff1a},
-    {0x12effe1, 0x12eff01},
-    {0x12fff7a, 0x12fffb7},
-    {0x130ff14, 0x130ffe8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dff75},
-    {0x12effc2, 0x12effc4},
-    {0x12ffff5, 0x12fff6c},
-    {0x130ff28, 0x130fff5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dffd0},
-    {0x12effa3, 0x12eff87},
-    {0x12fff70, 0x12fff22},
-    {0x130ff3d, 0x130ff02},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dff2a},
-    {0x12eff85, 0x12eff4b},
-    {0x12fffeb, 0x12fffd8},
-    {0x130ff51, 0x130ff0e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff85},
-    {0x12eff66, 0x12eff0e},
-    {0x12fff66, 0x12fff8e},
-    {0x130ff66, 0x130ff1b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dffe0},
-    {0x12eff47, 0x12effd1},
-    {0x12fffe1, 0x12fff43},
-    {0x130ff7a, 0x130ff28},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dff3b},
-    {0x12eff28, 0x12eff95},
-    {0x12fff5c, 0x12ffff9},
-    {0x130ff8f, 0x130ff34},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dff95},
-    {0x12eff0a, 0x12eff58},
-    {0x12fffd7, 0x12fffaf},
-    {0x130ffa3, 0x130ff41},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dfff0},
-    {0x12effeb, 0x12eff1b},
-    {0x12fff51, 0x12fff65},
-    {0x130ffb8, 0x130ff4e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff4b},
-    {0x12effcc, 0x12effdf},
-    {0x12fffcc, 0x12fff1a},
-    {0x130ffcc, 0x130ff5b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dffa5},
-    {0x12effae, 0x12effa2},
-    {0x12fff47, 0x12fffd0},
-    {0x130ffe1, 0x130ff67},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dff00},
-    {0x12eff8f, 0x12eff66},
-    {0x12fffc2, 0x12fff86},
-    {0x130fff5, 0x130ff74},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dff5b},
-    {0x12eff70, 0x12eff29},
-    {0x12fff3d, 0x12fff3c},
-    {0x130ff0a, 0x130ff81},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dffb6},
-    {0x12eff51, 0x12effec},
-    {0x12fffb8, 0x12ffff1},
-    {0x130ff1e, 0x130ff8d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff10},
-    {0x12eff33, 0x12effb0},
-    {0x12fff33, 0x12fffa7},
-    {0x130ff33, 0x130ff9a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dff6b},
-    {0x12eff14, 0x12eff73},
-    {0x12fffae, 0x12fff5d},
-    {0x130ff47, 0x130ffa7},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dffc6},
-    {0x12efff5, 0x12eff36},
-    {0x12fff28, 0x12fff13},
-    {0x130ff5c, 0x130ffb4},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dff21},
-    {0x12effd7, 0x12efffa},
-    {0x12fffa3, 0x12fffc8},
-    {0x130ff70, 0x130ffc0},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dff7b},
-    {0x12effb8, 0x12effbd},
-    {0x12fff1e, 0x12fff7e},
-    {0x130ff85, 0x130ffcd},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffd6},
-    {0x12eff99, 0x12eff80},
-    {0x12fff99, 0x12fff34},
-    {0x130ff99, 0x130ffda},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dff31},
-    {0x12eff7a, 0x12eff44},
-    {0x12fff14, 0x12fffea},
-    {0x130ffae, 0x130ffe6},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dff8b},
-    {0x12eff5c, 0x12eff07},
-    {0x12fff8f, 0x12fffa0},
-    {0x130ffc2, 0x130fff3},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dffe6},
-    {0x12eff3d, 0x12effca},
-    {0x12fff0a, 0x12fff55},
-    {0x130ffd7, 0x130ff00},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dff41},
-    {0x12eff1e, 0x12eff8e},
-    {0x12fff85, 0x12fff0b},
-    {0x130ffeb, 0x130ff0d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dff9c},
-    {0x12eff00, 0x12eff51},
-    {0x12fff00, 0x12fffc1},
-    {0x130ff00, 0x130ff19},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dfff6},
-    {0x12effe1, 0x12eff14},
-    {0x12fff7a, 0x12fff77},
-    {0x130ff14, 0x130ff26},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dff51},
-    {0x12effc2, 0x12effd8},
-    {0x12ffff5, 0x12fff2c},
-    {0x130ff28, 0x130ff33},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dffac},
-    {0x12effa3, 0x12eff9b},
-    {0x12fff70, 0x12fffe2},
-    {0x130ff3d, 0x130ff3f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dff06},
-    {0x12eff85, 0x12eff5f},
-    {0x12fffeb, 0x12fff98},
-    {0x130ff51, 0x130ff4c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff61},
-    {0x12eff66, 0x12eff22},
-    {0x12fff66, 0x12fff4e},
-    {0x130ff66, 0x130ff59},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dffbc},
-    {0x12eff47, 0x12effe5},
-    {0x12fffe1, 0x12fff03},
-    {0x130ff7a, 0x130ff66},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dff17},
-    {0x12eff28, 0x12effa9},
-    {0x12fff5c, 0x12fffb9},
-    {0x130ff8f, 0x130ff72},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dff71},
-    {0x12eff0a, 0x12eff6c},
-    {0x12fffd7, 0x12fff6f},
-    {0x130ffa3, 0x130ff7f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dffcc},
-    {0x12effeb, 0x12eff2f},
-    {0x12fff51, 0x12fff25},
-    {0x130ffb8, 0x130ff8c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff27},
-    {0x12effcc, 0x12efff3},
-    {0x12fffcc, 0x12fffda},
-    {0x130ffcc, 0x130ff98},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dff82},
-    {0x12effae, 0x12effb6},
-    {0x12fff47, 0x12fff90},
-    {0x130ffe1, 0x130ffa5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dffdc},
-    {0x12eff8f, 0x12eff79},
-    {0x12fffc2, 0x12fff46},
-    {0x130fff5, 0x130ffb2},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dff37},
-    {0x12eff70, 0x12eff3d},
-    {0x12fff3d, 0x12ffffc},
-    {0x130ff0a, 0x130ffbe},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dff92},
-    {0x12eff51, 0x12eff00},
-    {0x12fffb8, 0x12fffb2},
-    {0x130ff1e, 0x130ffcb},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dffec},
-    {0x12eff33, 0x12effc3},
-    {0x12fff33, 0x12fff67},
-    {0x130ff33, 0x130ffd8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dff47},
-    {0x12eff14, 0x12eff87},
-    {0x12fffae, 0x12fff1d},
-    {0x130ff47, 0x130ffe5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dffa2},
-    {0x12efff5, 0x12eff4a},
-    {0x12fff28, 0x12fffd3},
-    {0x130ff5c, 0x130fff1},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dfffd},
-    {0x12effd7, 0x12eff0d},
-    {0x12fffa3, 0x12fff89},
-    {0x130ff70, 0x130fffe},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dff57},
-    {0x12effb8, 0x12effd1},
-    {0x12fff1e, 0x12fff3e},
-    {0x130ff85, 0x130ff0b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffb2},
-    {0x12eff99, 0x12eff94},
-    {0x12fff99, 0x12ffff4},
-    {0x130ff99, 0x130ff17},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dff0d},
-    {0x12eff7a, 0x12eff58},
-    {0x12fff14, 0x12fffaa},
-    {0x130ffae, 0x130ff24},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dff67},
-    {0x12eff5c, 0x12eff1b},
-    {0x12fff8f, 0x12fff60},
-    {0x130ffc2, 0x130ff31},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dffc2},
-    {0x12eff3d, 0x12effde},
-    {0x12fff0a, 0x12fff15},
-    {0x130ffd7, 0x130ff3e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dff1d},
-    {0x12eff1e, 0x12effa2},
-    {0x12fff85, 0x12fffcb},
-    {0x130ffeb, 0x130ff4a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dff78},
-    {0x12eff00, 0x12eff65},
-    {0x12fff00, 0x12fff81},
-    {0x130ff00, 0x130ff57},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dffd2},
-    {0x12effe1, 0x12eff28},
-    {0x12fff7a, 0x12fff37},
-    {0x130ff14, 0x130ff64},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dff2d},
-    {0x12effc2, 0x12effec},
-    {0x12ffff5, 0x12fffec},
-    {0x130ff28, 0x130ff70},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dff88},
-    {0x12effa3, 0x12effaf},
-    {0x12fff70, 0x12fffa2},
-    {0x130ff3d, 0x130ff7d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dffe2},
-    {0x12eff85, 0x12eff72},
-    {0x12fffeb, 0x12fff58},
-    {0x130ff51, 0x130ff8a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff3d},
-    {0x12eff66, 0x12eff36},
-    {0x12fff66, 0x12fff0e},
-    {0x130ff66, 0x130ff97},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dff98},
-    {0x12eff47, 0x12efff9},
-    {0x12fffe1, 0x12fffc3},
-    {0x130ff7a, 0x130ffa3},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dfff3},
-    {0x12eff28, 0x12effbc},
-    {0x12fff5c, 0x12fff79},
-    {0x130ff8f, 0x130ffb0},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dff4d},
-    {0x12eff0a, 0x12eff80},
-    {0x12fffd7, 0x12fff2f},
-    {0x130ffa3, 0x130ffbd},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dffa8},
-    {0x12effeb, 0x12eff43},
-    {0x12fff51, 0x12fffe5},
-    {0x130ffb8, 0x130ffc9},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff03},
-    {0x12effcc, 0x12eff07},
-    {0x12fffcc, 0x12fff9b},
-    {0x130ffcc, 0x130ffd6},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dff5e},
-    {0x12effae, 0x12effca},
-    {0x12fff47, 0x12fff50},
-    {0x130ffe1, 0x130ffe3},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dffb8},
-    {0x12eff8f, 0x12eff8d},
-    {0x12fffc2, 0x12fff06},
-    {0x130fff5, 0x130fff0},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dff13},
-    {0x12eff70, 0x12eff51},
-    {0x12fff3d, 0x12fffbc},
-    {0x130ff0a, 0x130fffc},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dff6e},
-    {0x12eff51, 0x12eff14},
-    {0x12fffb8, 0x12fff72},
-    {0x130ff1e, 0x130ff09},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dffc8},
-    {0x12eff33, 0x12effd7},
-    {0x12fff33, 0x12fff27},
-    {0x130ff33, 0x130ff16},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dff23},
-    {0x12eff14, 0x12eff9b},
-    {0x12fffae, 0x12fffdd},
-    {0x130ff47, 0x130ff22},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dff7e},
-    {0x12efff5, 0x12eff5e},
-    {0x12fff28, 0x12fff93},
-    {0x130ff5c, 0x130ff2f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dffd9},
-    {0x12effd7, 0x12eff21},
-    {0x12fffa3, 0x12fff49},
-    {0x130ff70, 0x130ff3c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dff33},
-    {0x12effb8, 0x12effe5},
-    {0x12fff1e, 0x12ffffe},
-    {0x130ff85, 0x130ff48},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff8e},
-    {0x12eff99, 0x12effa8},
-    {0x12fff99, 0x12fffb4},
-    {0x130ff99, 0x130ff55},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dffe9},
-    {0x12eff7a, 0x12eff6b},
-    {0x12fff14, 0x12fff6a},
-    {0x130ffae, 0x130ff62},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dff43},
-    {0x12eff5c, 0x12eff2f},
-    {0x12fff8f, 0x12fff20},
-    {0x130ffc2, 0x130ff6f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dff9e},
-    {0x12eff3d, 0x12efff2},
-    {0x12fff0a, 0x12fffd5},
-    {0x130ffd7, 0x130ff7b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dfff9},
-    {0x12eff1e, 0x12effb5},
-    {0x12fff85, 0x12fff8b},
-    {0x130ffeb, 0x130ff88},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dff54},
-    {0x12eff00, 0x12eff79},
-    {0x12fff00, 0x12fff41},
-    {0x130ff00, 0x130ff95},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dffae},
-    {0x12effe1, 0x12eff3c},
-    {0x12fff7a, 0x12ffff7},
-    {0x130ff14, 0x130ffa1},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dff09},
-    {0x12effc2, 0x12eff00},
-    {0x12ffff5, 0x12fffad},
-    {0x130ff28, 0x130ffae},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dff64},
-    {0x12effa3, 0x12effc3},
-    {0x12fff70, 0x12fff62},
-    {0x130ff3d, 0x130ffbb},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dffbe},
-    {0x12eff85, 0x12eff86},
-    {0x12fffeb, 0x12fff18},
-    {0x130ff51, 0x130ffc8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff19},
-    {0x12eff66, 0x12eff4a},
-    {0x12fff66, 0x12fffce},
-    {0x130ff66, 0x130ffd4},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dff74},
-    {0x12eff47, 0x12eff0d},
-    {0x12fffe1, 0x12fff84},
-    {0x130ff7a, 0x130ffe1},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dffcf},
-    {0x12eff28, 0x12effd0},
-    {0x12fff5c, 0x12fff39},
-    {0x130ff8f, 0x130ffee},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dff29},
-    {0x12eff0a, 0x12eff94},
-    {0x12fffd7, 0x12fffef},
-    {0x130ffa3, 0x130fffa},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dff84},
-    {0x12effeb, 0x12eff57},
-    {0x12fff51, 0x12fffa5},
-    {0x130ffb8, 0x130ff07},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dffdf},
-    {0x12effcc, 0x12eff1a},
-    {0x12fffcc, 0x12fff5b},
-    {0x130ffcc, 0x130ff14},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dff3a},
-    {0x12effae, 0x12effde},
-    {0x12fff47, 0x12fff10},
-    {0x130ffe1, 0x130ff21},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dff94},
-    {0x12eff8f, 0x12effa1},
-    {0x12fffc2, 0x12fffc6},
-    {0x130fff5, 0x130ff2d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dffef},
-    {0x12eff70, 0x12eff64},
-    {0x12fff3d, 0x12fff7c},
-    {0x130ff0a, 0x130ff3a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dff4a},
-    {0x12eff51, 0x12eff28},
-    {0x12fffb8, 0x12fff32},
-    {0x130ff1e, 0x130ff47},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dffa4},
-    {0x12eff33, 0x12effeb},
-    {0x12fff33, 0x12fffe7},
-    {0x130ff33, 0x130ff53},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dffff},
-    {0x12eff14, 0x12effae},
-    {0x12fffae, 0x12fff9d},
-    {0x130ff47, 0x130ff60},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dff5a},
-    {0x12efff5, 0x12eff72},
-    {0x12fff28, 0x12fff53},
-    {0x130ff5c, 0x130ff6d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dffb5},
-    {0x12effd7, 0x12eff35},
-    {0x12fffa3, 0x12fff09},
-    {0x130ff70, 0x130ff7a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dff0f},
-    {0x12effb8, 0x12efff9},
-    {0x12fff1e, 0x12fffbe},
-    {0x130ff85, 0x130ff86},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff6a},
-    {0x12eff99, 0x12effbc},
-    {0x12fff99, 0x12fff74},
-    {0x130ff99, 0x130ff93},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dffc5},
-    {0x12eff7a, 0x12eff7f},
-    {0x12fff14, 0x12fff2a},
-    {0x130ffae, 0x130ffa0},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dff1f},
-    {0x12eff5c, 0x12eff43},
-    {0x12fff8f, 0x12fffe0},
-    {0x130ffc2, 0x130ffac},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dff7a},
-    {0x12eff3d, 0x12eff06},
-    {0x12fff0a, 0x12fff96},
-    {0x130ffd7, 0x130ffb9},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff04, 0x10fff04},
-    {0x110ff08, 0x110ff08},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dffd5},
-    {0x12eff1e, 0x12effc9},
-    {0x12fff85, 0x12fff4b},
-    {0x130ffeb, 0x130ffc6},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dffe4},
-    {0x12eff00, 0x12eff29},
-    {0x12fff00, 0x12fff41},
-    {0x130ff00, 0x130ff9e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dff68},
-    {0x12eff28, 0x12eff7c},
-    {0x12fff5c, 0x12fffc9},
-    {0x130ff0f, 0x130ffa7},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dffec},
-    {0x12eff51, 0x12effce},
-    {0x12fffb8, 0x12fff51},
-    {0x130ff1e, 0x130ffb1},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dff70},
-    {0x12eff7a, 0x12eff21},
-    {0x12fff14, 0x12fffda},
-    {0x130ff2e, 0x130ffba},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dfff4},
-    {0x12effa3, 0x12eff73},
-    {0x12fff70, 0x12fff62},
-    {0x130ff3d, 0x130ffc4},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff78},
-    {0x12effcc, 0x12effc6},
-    {0x12fffcc, 0x12fffea},
-    {0x130ff4c, 0x130ffcd},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dfffc},
-    {0x12efff5, 0x12eff18},
-    {0x12fff28, 0x12fff73},
-    {0x130ff5c, 0x130ffd7},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dff80},
-    {0x12eff1e, 0x12eff6b},
-    {0x12fff85, 0x12ffffb},
-    {0x130ff6b, 0x130ffe0},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dff04},
-    {0x12eff47, 0x12effbe},
-    {0x12fffe1, 0x12fff83},
-    {0x130ff7a, 0x130ffea},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dff88},
-    {0x12eff70, 0x12eff10},
-    {0x12fff3d, 0x12fff0c},
-    {0x130ff8a, 0x130fff4},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff0c},
-    {0x12eff99, 0x12eff63},
-    {0x12fff99, 0x12fff94},
-    {0x130ff99, 0x130fffd},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dff90},
-    {0x12effc2, 0x12effb5},
-    {0x12ffff5, 0x12fff1c},
-    {0x130ffa8, 0x130ff07},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dff14},
-    {0x12effeb, 0x12eff08},
-    {0x12fff51, 0x12fffa5},
-    {0x130ffb8, 0x130ff10},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dff98},
-    {0x12eff14, 0x12eff5a},
-    {0x12fffae, 0x12fff2d},
-    {0x130ffc7, 0x130ff1a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dff1c},
-    {0x12eff3d, 0x12effad},
-    {0x12fff0a, 0x12fffb5},
-    {0x130ffd7, 0x130ff23},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dffa0},
-    {0x12eff66, 0x12effff},
-    {0x12fff66, 0x12fff3d},
-    {0x130ffe6, 0x130ff2d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dff24},
-    {0x12eff8f, 0x12eff52},
-    {0x12fffc2, 0x12fffc6},
-    {0x130fff5, 0x130ff36},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dffa8},
-    {0x12effb8, 0x12effa4},
-    {0x12fff1e, 0x12fff4e},
-    {0x130ff05, 0x130ff40},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dff2c},
-    {0x12effe1, 0x12efff7},
-    {0x12fff7a, 0x12fffd6},
-    {0x130ff14, 0x130ff49},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dffb0},
-    {0x12eff0a, 0x12eff49},
-    {0x12fffd7, 0x12fff5f},
-    {0x130ff23, 0x130ff53},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff34},
-    {0x12eff33, 0x12eff9c},
-    {0x12fff33, 0x12fffe7},
-    {0x130ff33, 0x130ff5c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dffb8},
-    {0x12eff5c, 0x12effee},
-    {0x12fff8f, 0x12fff6f},
-    {0x130ff42, 0x130ff66},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dff3c},
-    {0x12eff85, 0x12eff41},
-    {0x12fffeb, 0x12ffff8},
-    {0x130ff51, 0x130ff6f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dffc0},
-    {0x12effae, 0x12eff93},
-    {0x12fff47, 0x12fff80},
-    {0x130ff61, 0x130ff79},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dff45},
-    {0x12effd7, 0x12effe6},
-    {0x12fffa3, 0x12fff08},
-    {0x130ff70, 0x130ff83},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dffc9},
-    {0x12eff00, 0x12eff38},
-    {0x12fff00, 0x12fff91},
-    {0x130ff80, 0x130ff8c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dff4d},
-    {0x12eff28, 0x12eff8b},
-    {0x12fff5c, 0x12fff19},
-    {0x130ff8f, 0x130ff96},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dffd1},
-    {0x12eff51, 0x12effdd},
-    {0x12fffb8, 0x12fffa1},
-    {0x130ff9e, 0x130ff9f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dff55},
-    {0x12eff7a, 0x12eff30},
-    {0x12fff14, 0x12fff2a},
-    {0x130ffae, 0x130ffa9},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dffd9},
-    {0x12effa3, 0x12eff82},
-    {0x12fff70, 0x12fffb2},
-    {0x130ffbd, 0x130ffb2},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff5d},
-    {0x12effcc, 0x12effd5},
-    {0x12fffcc, 0x12fff3a},
-    {0x130ffcc, 0x130ffbc},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dffe1},
-    {0x12efff5, 0x12eff27},
-    {0x12fff28, 0x12fffc3},
-    {0x130ffdc, 0x130ffc5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dff65},
-    {0x12eff1e, 0x12eff7a},
-    {0x12fff85, 0x12fff4b},
-    {0x130ffeb, 0x130ffcf},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dffe9},
-    {0x12eff47, 0x12effcc},
-    {0x12fffe1, 0x12fffd3},
-    {0x130fffa, 0x130ffd8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dff6d},
-    {0x12eff70, 0x12eff1f},
-    {0x12fff3d, 0x12fff5c},
-    {0x130ff0a, 0x130ffe2},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dfff1},
-    {0x12eff99, 0x12eff71},
-    {0x12fff99, 0x12fffe4},
-    {0x130ff19, 0x130ffeb},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dff75},
-    {0x12effc2, 0x12effc4},
-    {0x12ffff5, 0x12fff6c},
-    {0x130ff28, 0x130fff5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dfff9},
-    {0x12effeb, 0x12eff16},
-    {0x12fff51, 0x12ffff5},
-    {0x130ff38, 0x130fffe},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dff7d},
-    {0x12eff14, 0x12eff69},
-    {0x12fffae, 0x12fff7d},
-    {0x130ff47, 0x130ff08},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dff01},
-    {0x12eff3d, 0x12effbc},
-    {0x12fff0a, 0x12fff05},
-    {0x130ff57, 0x130ff12},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff85},
-    {0x12eff66, 0x12eff0e},
-    {0x12fff66, 0x12fff8e},
-    {0x130ff66, 0x130ff1b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dff09},
-    {0x12eff8f, 0x12eff61},
-    {0x12fffc2, 0x12fff16},
-    {0x130ff75, 0x130ff25},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dff8d},
-    {0x12effb8, 0x12effb3},
-    {0x12fff1e, 0x12fff9e},
-    {0x130ff85, 0x130ff2e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dff11},
-    {0x12effe1, 0x12eff06},
-    {0x12fff7a, 0x12fff27},
-    {0x130ff94, 0x130ff38},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dff95},
-    {0x12eff0a, 0x12eff58},
-    {0x12fffd7, 0x12fffaf},
-    {0x130ffa3, 0x130ff41},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff19},
-    {0x12eff33, 0x12effab},
-    {0x12fff33, 0x12fff37},
-    {0x130ffb3, 0x130ff4b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dff9d},
-    {0x12eff5c, 0x12efffd},
-    {0x12fff8f, 0x12fffbf},
-    {0x130ffc2, 0x130ff54},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dff21},
-    {0x12eff85, 0x12eff50},
-    {0x12fffeb, 0x12fff48},
-    {0x130ffd1, 0x130ff5e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dffa5},
-    {0x12effae, 0x12effa2},
-    {0x12fff47, 0x12fffd0},
-    {0x130ffe1, 0x130ff67},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dff2a},
-    {0x12effd7, 0x12efff5},
-    {0x12fffa3, 0x12fff58},
-    {0x130fff0, 0x130ff71},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dffae},
-    {0x12eff00, 0x12eff47},
-    {0x12fff00, 0x12fffe1},
-    {0x130ff00, 0x130ff7a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dff32},
-    {0x12eff28, 0x12eff9a},
-    {0x12fff5c, 0x12fff69},
-    {0x130ff0f, 0x130ff84},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dffb6},
-    {0x12eff51, 0x12effec},
-    {0x12fffb8, 0x12ffff1},
-    {0x130ff1e, 0x130ff8d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dff3a},
-    {0x12eff7a, 0x12eff3f},
-    {0x12fff14, 0x12fff7a},
-    {0x130ff2e, 0x130ff97},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dffbe},
-    {0x12effa3, 0x12eff91},
-    {0x12fff70, 0x12fff02},
-    {0x130ff3d, 0x130ffa1},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff42},
-    {0x12effcc, 0x12effe4},
-    {0x12fffcc, 0x12fff8a},
-    {0x130ff4c, 0x130ffaa},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dffc6},
-    {0x12efff5, 0x12eff36},
-    {0x12fff28, 0x12fff13},
-    {0x130ff5c, 0x130ffb4},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dff4a},
-    {0x12eff1e, 0x12eff89},
-    {0x12fff85, 0x12fff9b},
-    {0x130ff6b, 0x130ffbd},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dffce},
-    {0x12eff47, 0x12effdb},
-    {0x12fffe1, 0x12fff23},
-    {0x130ff7a, 0x130ffc7},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dff52},
-    {0x12eff70, 0x12eff2e},
-    {0x12fff3d, 0x12fffac},
-    {0x130ff8a, 0x130ffd0},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffd6},
-    {0x12eff99, 0x12eff80},
-    {0x12fff99, 0x12fff34},
-    {0x130ff99, 0x130ffda},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dff5a},
-    {0x12effc2, 0x12effd3},
-    {0x12ffff5, 0x12fffbc},
-    {0x130ffa8, 0x130ffe3},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dffde},
-    {0x12effeb, 0x12eff25},
-    {0x12fff51, 0x12fff45},
-    {0x130ffb8, 0x130ffed},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dff62},
-    {0x12eff14, 0x12eff78},
-    {0x12fffae, 0x12fffcd},
-    {0x130ffc7, 0x130fff6},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dffe6},
-    {0x12eff3d, 0x12effca},
-    {0x12fff0a, 0x12fff55},
-    {0x130ffd7, 0x130ff00},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff6a},
-    {0x12eff66, 0x12eff1d},
-    {0x12fff66, 0x12fffde},
-    {0x130ffe6, 0x130ff09},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dffee},
-    {0x12eff8f, 0x12eff6f},
-    {0x12fffc2, 0x12fff66},
-    {0x130fff5, 0x130ff13},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dff72},
-    {0x12effb8, 0x12effc2},
-    {0x12fff1e, 0x12fffee},
-    {0x130ff05, 0x130ff1c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dfff6},
-    {0x12effe1, 0x12eff14},
-    {0x12fff7a, 0x12fff77},
-    {0x130ff14, 0x130ff26},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dff7a},
-    {0x12eff0a, 0x12eff67},
-    {0x12fffd7, 0x12fffff},
-    {0x130ff23, 0x130ff2f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dfffe},
-    {0x12eff33, 0x12effb9},
-    {0x12fff33, 0x12fff87},
-    {0x130ff33, 0x130ff39},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dff82},
-    {0x12eff5c, 0x12eff0c},
-    {0x12fff8f, 0x12fff10},
-    {0x130ff42, 0x130ff43},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dff06},
-    {0x12eff85, 0x12eff5f},
-    {0x12fffeb, 0x12fff98},
-    {0x130ff51, 0x130ff4c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dff8b},
-    {0x12effae, 0x12effb1},
-    {0x12fff47, 0x12fff20},
-    {0x130ff61, 0x130ff56},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dff0f},
-    {0x12effd7, 0x12eff04},
-    {0x12fffa3, 0x12fffa9},
-    {0x130ff70, 0x130ff5f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dff93},
-    {0x12eff00, 0x12eff56},
-    {0x12fff00, 0x12fff31},
-    {0x130ff80, 0x130ff69},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dff17},
-    {0x12eff28, 0x12effa9},
-    {0x12fff5c, 0x12fffb9},
-    {0x130ff8f, 0x130ff72},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dff9b},
-    {0x12eff51, 0x12efffb},
-    {0x12fffb8, 0x12fff41},
-    {0x130ff9e, 0x130ff7c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dff1f},
-    {0x12eff7a, 0x12eff4e},
-    {0x12fff14, 0x12fffca},
-    {0x130ffae, 0x130ff85},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dffa3},
-    {0x12effa3, 0x12effa0},
-    {0x12fff70, 0x12fff52},
-    {0x130ffbd, 0x130ff8f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff27},
-    {0x12effcc, 0x12efff3},
-    {0x12fffcc, 0x12fffda},
-    {0x130ffcc, 0x130ff98},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dffab},
-    {0x12efff5, 0x12eff45},
-    {0x12fff28, 0x12fff63},
-    {0x130ffdc, 0x130ffa2},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dff2f},
-    {0x12eff1e, 0x12eff98},
-    {0x12fff85, 0x12fffeb},
-    {0x130ffeb, 0x130ffab},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dffb3},
-    {0x12eff47, 0x12effea},
-    {0x12fffe1, 0x12fff73},
-    {0x130fffa, 0x130ffb5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dff37},
-    {0x12eff70, 0x12eff3d},
-    {0x12fff3d, 0x12ffffc},
-    {0x130ff0a, 0x130ffbe},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffbb},
-    {0x12eff99, 0x12eff8f},
-    {0x12fff99, 0x12fff84},
-    {0x130ff19, 0x130ffc8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dff3f},
-    {0x12effc2, 0x12effe2},
-    {0x12ffff5, 0x12fff0c},
-    {0x130ff28, 0x130ffd2},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dffc3},
-    {0x12effeb, 0x12eff34},
-    {0x12fff51, 0x12fff95},
-    {0x130ff38, 0x130ffdb},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dff47},
-    {0x12eff14, 0x12eff87},
-    {0x12fffae, 0x12fff1d},
-    {0x130ff47, 0x130ffe5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dffcb},
-    {0x12eff3d, 0x12effd9},
-    {0x12fff0a, 0x12fffa5},
-    {0x130ff57, 0x130ffee},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff4f},
-    {0x12eff66, 0x12eff2c},
-    {0x12fff66, 0x12fff2e},
-    {0x130ff66, 0x130fff8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dffd3},
-    {0x12eff8f, 0x12eff7e},
-    {0x12fffc2, 0x12fffb6},
-    {0x130ff75, 0x130ff01},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dff57},
-    {0x12effb8, 0x12effd1},
-    {0x12fff1e, 0x12fff3e},
-    {0x130ff85, 0x130ff0b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dffdb},
-    {0x12effe1, 0x12eff23},
-    {0x12fff7a, 0x12fffc7},
-    {0x130ff94, 0x130ff14},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dff5f},
-    {0x12eff0a, 0x12eff76},
-    {0x12fffd7, 0x12fff4f},
-    {0x130ffa3, 0x130ff1e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dffe3},
-    {0x12eff33, 0x12effc8},
-    {0x12fff33, 0x12fffd7},
-    {0x130ffb3, 0x130ff27},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dff67},
-    {0x12eff5c, 0x12eff1b},
-    {0x12fff8f, 0x12fff60},
-    {0x130ffc2, 0x130ff31},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dffeb},
-    {0x12eff85, 0x12eff6d},
-    {0x12fffeb, 0x12fffe8},
-    {0x130ffd1, 0x130ff3a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dff70},
-    {0x12effae, 0x12effc0},
-    {0x12fff47, 0x12fff70},
-    {0x130ffe1, 0x130ff44},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dfff4},
-    {0x12effd7, 0x12eff12},
-    {0x12fffa3, 0x12ffff9},
-    {0x130fff0, 0x130ff4d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fff03, 0x10fff03},
-    {0x110ff06, 0x110ff06},
-    {0x111ff30, 0x111ff30},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dff78},
-    {0x12eff00, 0x12eff65},
-    {0x12fff00, 0x12fff81},
-    {0x130ff00, 0x130ff57},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dfffc},
-    {0x12effcc, 0x12effc3},
-    {0x12fffcc, 0x12fff32},
-    {0x130ff0c, 0x130ffa6},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff15},
-    {0x12eff99, 0x12eff5e},
-    {0x12fff99, 0x12fff24},
-    {0x130ff19, 0x130ffae},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff2e},
-    {0x12eff66, 0x12efff8},
-    {0x12fff66, 0x12fff15},
-    {0x130ff26, 0x130ffb6},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff46},
-    {0x12eff33, 0x12eff92},
-    {0x12fff33, 0x12fff07},
-    {0x130ff33, 0x130ffbe},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dff5f},
-    {0x12eff00, 0x12eff2c},
-    {0x12fff00, 0x12ffff9},
-    {0x130ff40, 0x130ffc5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff78},
-    {0x12effcc, 0x12effc6},
-    {0x12fffcc, 0x12fffea},
-    {0x130ff4c, 0x130ffcd},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff90},
-    {0x12eff99, 0x12eff60},
-    {0x12fff99, 0x12fffdc},
-    {0x130ff59, 0x130ffd5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dffa9},
-    {0x12eff66, 0x12efffa},
-    {0x12fff66, 0x12fffcd},
-    {0x130ff66, 0x130ffdd},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dffc2},
-    {0x12eff33, 0x12eff94},
-    {0x12fff33, 0x12fffbf},
-    {0x130ff73, 0x130ffe5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dffdb},
-    {0x12eff00, 0x12eff2e},
-    {0x12fff00, 0x12fffb1},
-    {0x130ff80, 0x130ffed},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dfff3},
-    {0x12effcc, 0x12effc8},
-    {0x12fffcc, 0x12fffa2},
-    {0x130ff8c, 0x130fff5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff0c},
-    {0x12eff99, 0x12eff63},
-    {0x12fff99, 0x12fff94},
-    {0x130ff99, 0x130fffd},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff25},
-    {0x12eff66, 0x12efffd},
-    {0x12fff66, 0x12fff85},
-    {0x130ffa6, 0x130ff05},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff3d},
-    {0x12eff33, 0x12eff97},
-    {0x12fff33, 0x12fff77},
-    {0x130ffb3, 0x130ff0d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dff56},
-    {0x12eff00, 0x12eff31},
-    {0x12fff00, 0x12fff69},
-    {0x130ffc0, 0x130ff15},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff6f},
-    {0x12effcc, 0x12effcb},
-    {0x12fffcc, 0x12fff5a},
-    {0x130ffcc, 0x130ff1d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff87},
-    {0x12eff99, 0x12eff65},
-    {0x12fff99, 0x12fff4c},
-    {0x130ffd9, 0x130ff25},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dffa0},
-    {0x12eff66, 0x12effff},
-    {0x12fff66, 0x12fff3d},
-    {0x130ffe6, 0x130ff2d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dffb9},
-    {0x12eff33, 0x12eff99},
-    {0x12fff33, 0x12fff2f},
-    {0x130fff3, 0x130ff35},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dffd2},
-    {0x12eff00, 0x12eff33},
-    {0x12fff00, 0x12fff21},
-    {0x130ff00, 0x130ff3d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dffea},
-    {0x12effcc, 0x12effcd},
-    {0x12fffcc, 0x12fff12},
-    {0x130ff0c, 0x130ff45},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff03},
-    {0x12eff99, 0x12eff68},
-    {0x12fff99, 0x12fff04},
-    {0x130ff19, 0x130ff4d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff1c},
-    {0x12eff66, 0x12eff02},
-    {0x12fff66, 0x12ffff6},
-    {0x130ff26, 0x130ff54},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff34},
-    {0x12eff33, 0x12eff9c},
-    {0x12fff33, 0x12fffe7},
-    {0x130ff33, 0x130ff5c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dff4d},
-    {0x12eff00, 0x12eff36},
-    {0x12fff00, 0x12fffd9},
-    {0x130ff40, 0x130ff64},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff66},
-    {0x12effcc, 0x12effd0},
-    {0x12fffcc, 0x12fffca},
-    {0x130ff4c, 0x130ff6c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff7e},
-    {0x12eff99, 0x12eff6a},
-    {0x12fff99, 0x12fffbc},
-    {0x130ff59, 0x130ff74},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff97},
-    {0x12eff66, 0x12eff04},
-    {0x12fff66, 0x12fffae},
-    {0x130ff66, 0x130ff7c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dffb0},
-    {0x12eff33, 0x12eff9e},
-    {0x12fff33, 0x12fff9f},
-    {0x130ff73, 0x130ff84},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dffc9},
-    {0x12eff00, 0x12eff38},
-    {0x12fff00, 0x12fff91},
-    {0x130ff80, 0x130ff8c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dffe1},
-    {0x12effcc, 0x12effd2},
-    {0x12fffcc, 0x12fff82},
-    {0x130ff8c, 0x130ff94},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dfffa},
-    {0x12eff99, 0x12eff6c},
-    {0x12fff99, 0x12fff74},
-    {0x130ff99, 0x130ff9c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff13},
-    {0x12eff66, 0x12eff07},
-    {0x12fff66, 0x12fff66},
-    {0x130ffa6, 0x130ffa4},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff2b},
-    {0x12eff33, 0x12effa1},
-    {0x12fff33, 0x12fff57},
-    {0x130ffb3, 0x130ffac},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dff44},
-    {0x12eff00, 0x12eff3b},
-    {0x12fff00, 0x12fff49},
-    {0x130ffc0, 0x130ffb4},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff5d},
-    {0x12effcc, 0x12effd5},
-    {0x12fffcc, 0x12fff3a},
-    {0x130ffcc, 0x130ffbc},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff75},
-    {0x12eff99, 0x12eff6f},
-    {0x12fff99, 0x12fff2c},
-    {0x130ffd9, 0x130ffc4},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff8e},
-    {0x12eff66, 0x12eff09},
-    {0x12fff66, 0x12fff1e},
-    {0x130ffe6, 0x130ffcc},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dffa7},
-    {0x12eff33, 0x12effa3},
-    {0x12fff33, 0x12fff0f},
-    {0x130fff3, 0x130ffd4},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dffc0},
-    {0x12eff00, 0x12eff3d},
-    {0x12fff00, 0x12fff01},
-    {0x130ff00, 0x130ffdc},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dffd8},
-    {0x12effcc, 0x12effd7},
-    {0x12fffcc, 0x12ffff2},
-    {0x130ff0c, 0x130ffe3},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dfff1},
-    {0x12eff99, 0x12eff71},
-    {0x12fff99, 0x12fffe4},
-    {0x130ff19, 0x130ffeb},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff0a},
-    {0x12eff66, 0x12eff0c},
-    {0x12fff66, 0x12fffd6},
-    {0x130ff26, 0x130fff3},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff22},
-    {0x12eff33, 0x12effa6},
-    {0x12fff33, 0x12fffc7},
-    {0x130ff33, 0x130fffb},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dff3b},
-    {0x12eff00, 0x12eff40},
-    {0x12fff00, 0x12fffb9},
-    {0x130ff40, 0x130ff03},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff54},
-    {0x12effcc, 0x12effda},
-    {0x12fffcc, 0x12fffaa},
-    {0x130ff4c, 0x130ff0b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff6c},
-    {0x12eff99, 0x12eff74},
-    {0x12fff99, 0x12fff9c},
-    {0x130ff59, 0x130ff13},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff85},
-    {0x12eff66, 0x12eff0e},
-    {0x12fff66, 0x12fff8e},
-    {0x130ff66, 0x130ff1b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff9e},
-    {0x12eff33, 0x12effa8},
-    {0x12fff33, 0x12fff7f},
-    {0x130ff73, 0x130ff23},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dffb7},
-    {0x12eff00, 0x12eff42},
-    {0x12fff00, 0x12fff71},
-    {0x130ff80, 0x130ff2b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dffcf},
-    {0x12effcc, 0x12effdc},
-    {0x12fffcc, 0x12fff62},
-    {0x130ff8c, 0x130ff33},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffe8},
-    {0x12eff99, 0x12eff76},
-    {0x12fff99, 0x12fff54},
-    {0x130ff99, 0x130ff3b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff01},
-    {0x12eff66, 0x12eff11},
-    {0x12fff66, 0x12fff46},
-    {0x130ffa6, 0x130ff43},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff19},
-    {0x12eff33, 0x12effab},
-    {0x12fff33, 0x12fff37},
-    {0x130ffb3, 0x130ff4b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dff32},
-    {0x12eff00, 0x12eff45},
-    {0x12fff00, 0x12fff29},
-    {0x130ffc0, 0x130ff53},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff4b},
-    {0x12effcc, 0x12effdf},
-    {0x12fffcc, 0x12fff1a},
-    {0x130ffcc, 0x130ff5b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff63},
-    {0x12eff99, 0x12eff79},
-    {0x12fff99, 0x12fff0c},
-    {0x130ffd9, 0x130ff63},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff7c},
-    {0x12eff66, 0x12eff13},
-    {0x12fff66, 0x12ffffe},
-    {0x130ffe6, 0x130ff6a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff95},
-    {0x12eff33, 0x12effad},
-    {0x12fff33, 0x12fffef},
-    {0x130fff3, 0x130ff72},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dffae},
-    {0x12eff00, 0x12eff47},
-    {0x12fff00, 0x12fffe1},
-    {0x130ff00, 0x130ff7a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dffc6},
-    {0x12effcc, 0x12effe1},
-    {0x12fffcc, 0x12fffd2},
-    {0x130ff0c, 0x130ff82},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffdf},
-    {0x12eff99, 0x12eff7b},
-    {0x12fff99, 0x12fffc4},
-    {0x130ff19, 0x130ff8a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dfff8},
-    {0x12eff66, 0x12eff15},
-    {0x12fff66, 0x12fffb6},
-    {0x130ff26, 0x130ff92},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff10},
-    {0x12eff33, 0x12effb0},
-    {0x12fff33, 0x12fffa7},
-    {0x130ff33, 0x130ff9a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dff29},
-    {0x12eff00, 0x12eff4a},
-    {0x12fff00, 0x12fff99},
-    {0x130ff40, 0x130ffa2},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff42},
-    {0x12effcc, 0x12effe4},
-    {0x12fffcc, 0x12fff8a},
-    {0x130ff4c, 0x130ffaa},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff5a},
-    {0x12eff99, 0x12eff7e},
-    {0x12fff99, 0x12fff7c},
-    {0x130ff59, 0x130ffb2},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff73},
-    {0x12eff66, 0x12eff18},
-    {0x12fff66, 0x12fff6e},
-    {0x130ff66, 0x130ffba},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff8c},
-    {0x12eff33, 0x12effb2},
-    {0x12fff33, 0x12fff5f},
-    {0x130ff73, 0x130ffc2},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dffa5},
-    {0x12eff00, 0x12eff4c},
-    {0x12fff00, 0x12fff51},
-    {0x130ff80, 0x130ffca},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dffbd},
-    {0x12effcc, 0x12effe6},
-    {0x12fffcc, 0x12fff42},
-    {0x130ff8c, 0x130ffd2},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffd6},
-    {0x12eff99, 0x12eff80},
-    {0x12fff99, 0x12fff34},
-    {0x130ff99, 0x130ffda},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dffef},
-    {0x12eff66, 0x12eff1a},
-    {0x12fff66, 0x12fff26},
-    {0x130ffa6, 0x130ffe2},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff07},
-    {0x12eff33, 0x12effb5},
-    {0x12fff33, 0x12fff17},
-    {0x130ffb3, 0x130ffea},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dff20},
-    {0x12eff00, 0x12eff4f},
-    {0x12fff00, 0x12fff09},
-    {0x130ffc0, 0x130fff2},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff39},
-    {0x12effcc, 0x12effe9},
-    {0x12fffcc, 0x12ffffa},
-    {0x130ffcc, 0x130fff9},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff51},
-    {0x12eff99, 0x12eff83},
-    {0x12fff99, 0x12fffec},
-    {0x130ffd9, 0x130ff01},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff6a},
-    {0x12eff66, 0x12eff1d},
-    {0x12fff66, 0x12fffde},
-    {0x130ffe6, 0x130ff09},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff83},
-    {0x12eff33, 0x12effb7},
-    {0x12fff33, 0x12fffcf},
-    {0x130fff3, 0x130ff11},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dff9c},
-    {0x12eff00, 0x12eff51},
-    {0x12fff00, 0x12fffc1},
-    {0x130ff00, 0x130ff19},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dffb4},
-    {0x12effcc, 0x12effeb},
-    {0x12fffcc, 0x12fffb2},
-    {0x130ff0c, 0x130ff21},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffcd},
-    {0x12eff99, 0x12eff85},
-    {0x12fff99, 0x12fffa4},
-    {0x130ff19, 0x130ff29},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dffe6},
-    {0x12eff66, 0x12eff1f},
-    {0x12fff66, 0x12fff96},
-    {0x130ff26, 0x130ff31},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dfffe},
-    {0x12eff33, 0x12effb9},
-    {0x12fff33, 0x12fff87},
-    {0x130ff33, 0x130ff39},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dff17},
-    {0x12eff00, 0x12eff54},
-    {0x12fff00, 0x12fff79},
-    {0x130ff40, 0x130ff41},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff30},
-    {0x12effcc, 0x12effee},
-    {0x12fffcc, 0x12fff6a},
-    {0x130ff4c, 0x130ff49},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff48},
-    {0x12eff99, 0x12eff88},
-    {0x12fff99, 0x12fff5c},
-    {0x130ff59, 0x130ff51},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff61},
-    {0x12eff66, 0x12eff22},
-    {0x12fff66, 0x12fff4e},
-    {0x130ff66, 0x130ff59},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff7a},
-    {0x12eff33, 0x12effbc},
-    {0x12fff33, 0x12fff3f},
-    {0x130ff73, 0x130ff61},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dff93},
-    {0x12eff00, 0x12eff56},
-    {0x12fff00, 0x12fff31},
-    {0x130ff80, 0x130ff69},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dffab},
-    {0x12effcc, 0x12efff0},
-    {0x12fffcc, 0x12fff22},
-    {0x130ff8c, 0x130ff71},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffc4},
-    {0x12eff99, 0x12eff8a},
-    {0x12fff99, 0x12fff14},
-    {0x130ff99, 0x130ff79},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dffdd},
-    {0x12eff66, 0x12eff24},
-    {0x12fff66, 0x12fff06},
-    {0x130ffa6, 0x130ff81},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dfff5},
-    {0x12eff33, 0x12effbe},
-    {0x12fff33, 0x12ffff7},
-    {0x130ffb3, 0x130ff88},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dff0e},
-    {0x12eff00, 0x12eff59},
-    {0x12fff00, 0x12fffe9},
-    {0x130ffc0, 0x130ff90},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff27},
-    {0x12effcc, 0x12efff3},
-    {0x12fffcc, 0x12fffda},
-    {0x130ffcc, 0x130ff98},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff3f},
-    {0x12eff99, 0x12eff8d},
-    {0x12fff99, 0x12fffcc},
-    {0x130ffd9, 0x130ffa0},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff58},
-    {0x12eff66, 0x12eff27},
-    {0x12fff66, 0x12fffbe},
-    {0x130ffe6, 0x130ffa8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff71},
-    {0x12eff33, 0x12effc1},
-    {0x12fff33, 0x12fffaf},
-    {0x130fff3, 0x130ffb0},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dff8a},
-    {0x12eff00, 0x12eff5b},
-    {0x12fff00, 0x12fffa1},
-    {0x130ff00, 0x130ffb8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dffa2},
-    {0x12effcc, 0x12efff5},
-    {0x12fffcc, 0x12fff92},
-    {0x130ff0c, 0x130ffc0},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffbb},
-    {0x12eff99, 0x12eff8f},
-    {0x12fff99, 0x12fff84},
-    {0x130ff19, 0x130ffc8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dffd4},
-    {0x12eff66, 0x12eff29},
-    {0x12fff66, 0x12fff76},
-    {0x130ff26, 0x130ffd0},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dffec},
-    {0x12eff33, 0x12effc3},
-    {0x12fff33, 0x12fff67},
-    {0x130ff33, 0x130ffd8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dff05},
-    {0x12eff00, 0x12eff5e},
-    {0x12fff00, 0x12fff59},
-    {0x130ff40, 0x130ffe0},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff1e},
-    {0x12effcc, 0x12efff8},
-    {0x12fffcc, 0x12fff4a},
-    {0x130ff4c, 0x130ffe8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff36},
-    {0x12eff99, 0x12eff92},
-    {0x12fff99, 0x12fff3c},
-    {0x130ff59, 0x130fff0},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff4f},
-    {0x12eff66, 0x12eff2c},
-    {0x12fff66, 0x12fff2e},
-    {0x130ff66, 0x130fff8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff68},
-    {0x12eff33, 0x12effc6},
-    {0x12fff33, 0x12fff1f},
-    {0x130ff73, 0x130ff00},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dff81},
-    {0x12eff00, 0x12eff60},
-    {0x12fff00, 0x12fff11},
-    {0x130ff80, 0x130ff08},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff99},
-    {0x12effcc, 0x12efffa},
-    {0x12fffcc, 0x12fff02},
-    {0x130ff8c, 0x130ff10},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffb2},
-    {0x12eff99, 0x12eff94},
-    {0x12fff99, 0x12ffff4},
-    {0x130ff99, 0x130ff17},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dffcb},
-    {0x12eff66, 0x12eff2e},
-    {0x12fff66, 0x12fffe6},
-    {0x130ffa6, 0x130ff1f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dffe3},
-    {0x12eff33, 0x12effc8},
-    {0x12fff33, 0x12fffd7},
-    {0x130ffb3, 0x130ff27},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dfffc},
-    {0x12eff00, 0x12eff62},
-    {0x12fff00, 0x12fffc9},
-    {0x130ffc0, 0x130ff2f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff15},
-    {0x12effcc, 0x12efffd},
-    {0x12fffcc, 0x12fffba},
-    {0x130ffcc, 0x130ff37},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff2d},
-    {0x12eff99, 0x12eff97},
-    {0x12fff99, 0x12fffac},
-    {0x130ffd9, 0x130ff3f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff46},
-    {0x12eff66, 0x12eff31},
-    {0x12fff66, 0x12fff9e},
-    {0x130ffe6, 0x130ff47},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff5f},
-    {0x12eff33, 0x12effcb},
-    {0x12fff33, 0x12fff8f},
-    {0x130fff3, 0x130ff4f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dff78},
-    {0x12eff00, 0x12eff65},
-    {0x12fff00, 0x12fff81},
-    {0x130ff00, 0x130ff57},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff90},
-    {0x12effcc, 0x12effff},
-    {0x12fffcc, 0x12fff72},
-    {0x130ff0c, 0x130ff5f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffa9},
-    {0x12eff99, 0x12eff99},
-    {0x12fff99, 0x12fff64},
-    {0x130ff19, 0x130ff67},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dffc2},
-    {0x12eff66, 0x12eff33},
-    {0x12fff66, 0x12fff56},
-    {0x130ff26, 0x130ff6f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dffda},
-    {0x12eff33, 0x12effcd},
-    {0x12fff33, 0x12fff47},
-    {0x130ff33, 0x130ff77},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dfff3},
-    {0x12eff00, 0x12eff67},
-    {0x12fff00, 0x12fff39},
-    {0x130ff40, 0x130ff7f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff0c},
-    {0x12effcc, 0x12eff02},
-    {0x12fffcc, 0x12fff2b},
-    {0x130ff4c, 0x130ff87},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff24},
-    {0x12eff99, 0x12eff9c},
-    {0x12fff99, 0x12fff1c},
-    {0x130ff59, 0x130ff8f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff3d},
-    {0x12eff66, 0x12eff36},
-    {0x12fff66, 0x12fff0e},
-    {0x130ff66, 0x130ff97},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff56},
-    {0x12eff33, 0x12effd0},
-    {0x12fff33, 0x12fffff},
-    {0x130ff73, 0x130ff9e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dff6f},
-    {0x12eff00, 0x12eff6a},
-    {0x12fff00, 0x12ffff1},
-    {0x130ff80, 0x130ffa6},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff87},
-    {0x12effcc, 0x12eff04},
-    {0x12fffcc, 0x12fffe3},
-    {0x130ff8c, 0x130ffae},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffa0},
-    {0x12eff99, 0x12eff9e},
-    {0x12fff99, 0x12fffd4},
-    {0x130ff99, 0x130ffb6},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dffb9},
-    {0x12eff66, 0x12eff38},
-    {0x12fff66, 0x12fffc6},
-    {0x130ffa6, 0x130ffbe},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dffd1},
-    {0x12eff33, 0x12effd2},
-    {0x12fff33, 0x12fffb7},
-    {0x130ffb3, 0x130ffc6},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dffea},
-    {0x12eff00, 0x12eff6c},
-    {0x12fff00, 0x12fffa9},
-    {0x130ffc0, 0x130ffce},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff03},
-    {0x12effcc, 0x12eff07},
-    {0x12fffcc, 0x12fff9b},
-    {0x130ffcc, 0x130ffd6},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff1b},
-    {0x12eff99, 0x12effa1},
-    {0x12fff99, 0x12fff8c},
-    {0x130ffd9, 0x130ffde},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff34},
-    {0x12eff66, 0x12eff3b},
-    {0x12fff66, 0x12fff7e},
-    {0x130ffe6, 0x130ffe6},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff4d},
-    {0x12eff33, 0x12effd5},
-    {0x12fff33, 0x12fff6f},
-    {0x130fff3, 0x130ffee},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dff66},
-    {0x12eff00, 0x12eff6f},
-    {0x12fff00, 0x12fff61},
-    {0x130ff00, 0x130fff6},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff7e},
-    {0x12effcc, 0x12eff09},
-    {0x12fffcc, 0x12fff53},
-    {0x130ff0c, 0x130fffe},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff97},
-    {0x12eff99, 0x12effa3},
-    {0x12fff99, 0x12fff44},
-    {0x130ff19, 0x130ff06},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dffb0},
-    {0x12eff66, 0x12eff3d},
-    {0x12fff66, 0x12fff36},
-    {0x130ff26, 0x130ff0e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dffc8},
-    {0x12eff33, 0x12effd7},
-    {0x12fff33, 0x12fff27},
-    {0x130ff33, 0x130ff16},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dffe1},
-    {0x12eff00, 0x12eff71},
-    {0x12fff00, 0x12fff19},
-    {0x130ff40, 0x130ff1e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dfffa},
-    {0x12effcc, 0x12eff0b},
-    {0x12fffcc, 0x12fff0b},
-    {0x130ff4c, 0x130ff26},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff12},
-    {0x12eff99, 0x12effa6},
-    {0x12fff99, 0x12ffffc},
-    {0x130ff59, 0x130ff2d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff2b},
-    {0x12eff66, 0x12eff40},
-    {0x12fff66, 0x12fffee},
-    {0x130ff66, 0x130ff35},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff05, 0x110ff05},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff44},
-    {0x12eff33, 0x12effda},
-    {0x12fff33, 0x12fffdf},
-    {0x130ff73, 0x130ff3d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dffe4},
-    {0x12eff00, 0x12eff29},
-    {0x12fff00, 0x12fff41},
-    {0x130ff00, 0x130ff9e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dff91},
-    {0x12eff70, 0x12eff0b},
-    {0x12fff3d, 0x12fff9c},
-    {0x130ff0a, 0x130ffa4},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dff3e},
-    {0x12effe1, 0x12effed},
-    {0x12fff7a, 0x12ffff6},
-    {0x130ff14, 0x130ffaa},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dffec},
-    {0x12eff51, 0x12effce},
-    {0x12fffb8, 0x12fff51},
-    {0x130ff1e, 0x130ffb1},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dff99},
-    {0x12effc2, 0x12effb0},
-    {0x12ffff5, 0x12fffac},
-    {0x130ff28, 0x130ffb7},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff46},
-    {0x12eff33, 0x12eff92},
-    {0x12fff33, 0x12fff07},
-    {0x130ff33, 0x130ffbe},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dfff4},
-    {0x12effa3, 0x12eff73},
-    {0x12fff70, 0x12fff62},
-    {0x130ff3d, 0x130ffc4},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dffa1},
-    {0x12eff14, 0x12eff55},
-    {0x12fffae, 0x12fffbd},
-    {0x130ff47, 0x130ffca},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dff4e},
-    {0x12eff85, 0x12eff37},
-    {0x12fffeb, 0x12fff18},
-    {0x130ff51, 0x130ffd1},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dfffc},
-    {0x12efff5, 0x12eff18},
-    {0x12fff28, 0x12fff73},
-    {0x130ff5c, 0x130ffd7},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dffa9},
-    {0x12eff66, 0x12efffa},
-    {0x12fff66, 0x12fffcd},
-    {0x130ff66, 0x130ffdd},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dff57},
-    {0x12effd7, 0x12effdc},
-    {0x12fffa3, 0x12fff28},
-    {0x130ff70, 0x130ffe4},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dff04},
-    {0x12eff47, 0x12effbe},
-    {0x12fffe1, 0x12fff83},
-    {0x130ff7a, 0x130ffea},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dffb1},
-    {0x12effb8, 0x12eff9f},
-    {0x12fff1e, 0x12fffde},
-    {0x130ff85, 0x130fff0},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dff5f},
-    {0x12eff28, 0x12eff81},
-    {0x12fff5c, 0x12fff39},
-    {0x130ff8f, 0x130fff7},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff0c},
-    {0x12eff99, 0x12eff63},
-    {0x12fff99, 0x12fff94},
-    {0x130ff99, 0x130fffd},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dffb9},
-    {0x12eff0a, 0x12eff44},
-    {0x12fffd7, 0x12fffef},
-    {0x130ffa3, 0x130ff03},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dff67},
-    {0x12eff7a, 0x12eff26},
-    {0x12fff14, 0x12fff4a},
-    {0x130ffae, 0x130ff0a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dff14},
-    {0x12effeb, 0x12eff08},
-    {0x12fff51, 0x12fffa5},
-    {0x130ffb8, 0x130ff10},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dffc1},
-    {0x12eff5c, 0x12effe9},
-    {0x12fff8f, 0x12fffff},
-    {0x130ffc2, 0x130ff16},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff6f},
-    {0x12effcc, 0x12effcb},
-    {0x12fffcc, 0x12fff5a},
-    {0x130ffcc, 0x130ff1d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dff1c},
-    {0x12eff3d, 0x12effad},
-    {0x12fff0a, 0x12fffb5},
-    {0x130ffd7, 0x130ff23},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dffc9},
-    {0x12effae, 0x12eff8e},
-    {0x12fff47, 0x12fff10},
-    {0x130ffe1, 0x130ff2a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dff77},
-    {0x12eff1e, 0x12eff70},
-    {0x12fff85, 0x12fff6b},
-    {0x130ffeb, 0x130ff30},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dff24},
-    {0x12eff8f, 0x12eff52},
-    {0x12fffc2, 0x12fffc6},
-    {0x130fff5, 0x130ff36},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dffd2},
-    {0x12eff00, 0x12eff33},
-    {0x12fff00, 0x12fff21},
-    {0x130ff00, 0x130ff3d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dff7f},
-    {0x12eff70, 0x12eff15},
-    {0x12fff3d, 0x12fff7c},
-    {0x130ff0a, 0x130ff43},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dff2c},
-    {0x12effe1, 0x12efff7},
-    {0x12fff7a, 0x12fffd6},
-    {0x130ff14, 0x130ff49},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dffda},
-    {0x12eff51, 0x12effd8},
-    {0x12fffb8, 0x12fff31},
-    {0x130ff1e, 0x130ff50},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dff87},
-    {0x12effc2, 0x12effba},
-    {0x12ffff5, 0x12fff8c},
-    {0x130ff28, 0x130ff56},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff34},
-    {0x12eff33, 0x12eff9c},
-    {0x12fff33, 0x12fffe7},
-    {0x130ff33, 0x130ff5c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dffe2},
-    {0x12effa3, 0x12eff7d},
-    {0x12fff70, 0x12fff42},
-    {0x130ff3d, 0x130ff63},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dff8f},
-    {0x12eff14, 0x12eff5f},
-    {0x12fffae, 0x12fff9d},
-    {0x130ff47, 0x130ff69},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dff3c},
-    {0x12eff85, 0x12eff41},
-    {0x12fffeb, 0x12ffff8},
-    {0x130ff51, 0x130ff6f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dffea},
-    {0x12efff5, 0x12eff22},
-    {0x12fff28, 0x12fff53},
-    {0x130ff5c, 0x130ff76},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff97},
-    {0x12eff66, 0x12eff04},
-    {0x12fff66, 0x12fffae},
-    {0x130ff66, 0x130ff7c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dff45},
-    {0x12effd7, 0x12effe6},
-    {0x12fffa3, 0x12fff08},
-    {0x130ff70, 0x130ff83},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dfff2},
-    {0x12eff47, 0x12effc7},
-    {0x12fffe1, 0x12fff63},
-    {0x130ff7a, 0x130ff89},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dff9f},
-    {0x12effb8, 0x12effa9},
-    {0x12fff1e, 0x12fffbe},
-    {0x130ff85, 0x130ff8f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dff4d},
-    {0x12eff28, 0x12eff8b},
-    {0x12fff5c, 0x12fff19},
-    {0x130ff8f, 0x130ff96},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dfffa},
-    {0x12eff99, 0x12eff6c},
-    {0x12fff99, 0x12fff74},
-    {0x130ff99, 0x130ff9c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dffa7},
-    {0x12eff0a, 0x12eff4e},
-    {0x12fffd7, 0x12fffcf},
-    {0x130ffa3, 0x130ffa2},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dff55},
-    {0x12eff7a, 0x12eff30},
-    {0x12fff14, 0x12fff2a},
-    {0x130ffae, 0x130ffa9},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dff02},
-    {0x12effeb, 0x12eff12},
-    {0x12fff51, 0x12fff85},
-    {0x130ffb8, 0x130ffaf},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dffaf},
-    {0x12eff5c, 0x12efff3},
-    {0x12fff8f, 0x12fffdf},
-    {0x130ffc2, 0x130ffb5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff5d},
-    {0x12effcc, 0x12effd5},
-    {0x12fffcc, 0x12fff3a},
-    {0x130ffcc, 0x130ffbc},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dff0a},
-    {0x12eff3d, 0x12effb7},
-    {0x12fff0a, 0x12fff95},
-    {0x130ffd7, 0x130ffc2},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dffb7},
-    {0x12effae, 0x12eff98},
-    {0x12fff47, 0x12ffff0},
-    {0x130ffe1, 0x130ffc8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dff65},
-    {0x12eff1e, 0x12eff7a},
-    {0x12fff85, 0x12fff4b},
-    {0x130ffeb, 0x130ffcf},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dff12},
-    {0x12eff8f, 0x12eff5c},
-    {0x12fffc2, 0x12fffa6},
-    {0x130fff5, 0x130ffd5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dffc0},
-    {0x12eff00, 0x12eff3d},
-    {0x12fff00, 0x12fff01},
-    {0x130ff00, 0x130ffdc},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dff6d},
-    {0x12eff70, 0x12eff1f},
-    {0x12fff3d, 0x12fff5c},
-    {0x130ff0a, 0x130ffe2},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dff1a},
-    {0x12effe1, 0x12eff01},
-    {0x12fff7a, 0x12fffb7},
-    {0x130ff14, 0x130ffe8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dffc8},
-    {0x12eff51, 0x12effe2},
-    {0x12fffb8, 0x12fff11},
-    {0x130ff1e, 0x130ffef},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dff75},
-    {0x12effc2, 0x12effc4},
-    {0x12ffff5, 0x12fff6c},
-    {0x130ff28, 0x130fff5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff22},
-    {0x12eff33, 0x12effa6},
-    {0x12fff33, 0x12fffc7},
-    {0x130ff33, 0x130fffb},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dffd0},
-    {0x12effa3, 0x12eff87},
-    {0x12fff70, 0x12fff22},
-    {0x130ff3d, 0x130ff02},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dff7d},
-    {0x12eff14, 0x12eff69},
-    {0x12fffae, 0x12fff7d},
-    {0x130ff47, 0x130ff08},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dff2a},
-    {0x12eff85, 0x12eff4b},
-    {0x12fffeb, 0x12fffd8},
-    {0x130ff51, 0x130ff0e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dffd8},
-    {0x12efff5, 0x12eff2c},
-    {0x12fff28, 0x12fff33},
-    {0x130ff5c, 0x130ff15},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff85},
-    {0x12eff66, 0x12eff0e},
-    {0x12fff66, 0x12fff8e},
-    {0x130ff66, 0x130ff1b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dff33},
-    {0x12effd7, 0x12efff0},
-    {0x12fffa3, 0x12fffe8},
-    {0x130ff70, 0x130ff21},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dffe0},
-    {0x12eff47, 0x12effd1},
-    {0x12fffe1, 0x12fff43},
-    {0x130ff7a, 0x130ff28},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dff8d},
-    {0x12effb8, 0x12effb3},
-    {0x12fff1e, 0x12fff9e},
-    {0x130ff85, 0x130ff2e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dff3b},
-    {0x12eff28, 0x12eff95},
-    {0x12fff5c, 0x12ffff9},
-    {0x130ff8f, 0x130ff34},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffe8},
-    {0x12eff99, 0x12eff76},
-    {0x12fff99, 0x12fff54},
-    {0x130ff99, 0x130ff3b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dff95},
-    {0x12eff0a, 0x12eff58},
-    {0x12fffd7, 0x12fffaf},
-    {0x130ffa3, 0x130ff41},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dff43},
-    {0x12eff7a, 0x12eff3a},
-    {0x12fff14, 0x12fff0a},
-    {0x130ffae, 0x130ff48},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dfff0},
-    {0x12effeb, 0x12eff1b},
-    {0x12fff51, 0x12fff65},
-    {0x130ffb8, 0x130ff4e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dff9d},
-    {0x12eff5c, 0x12efffd},
-    {0x12fff8f, 0x12fffbf},
-    {0x130ffc2, 0x130ff54},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff4b},
-    {0x12effcc, 0x12effdf},
-    {0x12fffcc, 0x12fff1a},
-    {0x130ffcc, 0x130ff5b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dfff8},
-    {0x12eff3d, 0x12effc0},
-    {0x12fff0a, 0x12fff75},
-    {0x130ffd7, 0x130ff61},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dffa5},
-    {0x12effae, 0x12effa2},
-    {0x12fff47, 0x12fffd0},
-    {0x130ffe1, 0x130ff67},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dff53},
-    {0x12eff1e, 0x12eff84},
-    {0x12fff85, 0x12fff2b},
-    {0x130ffeb, 0x130ff6e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dff00},
-    {0x12eff8f, 0x12eff66},
-    {0x12fffc2, 0x12fff86},
-    {0x130fff5, 0x130ff74},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dffae},
-    {0x12eff00, 0x12eff47},
-    {0x12fff00, 0x12fffe1},
-    {0x130ff00, 0x130ff7a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dff5b},
-    {0x12eff70, 0x12eff29},
-    {0x12fff3d, 0x12fff3c},
-    {0x130ff0a, 0x130ff81},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dff08},
-    {0x12effe1, 0x12eff0b},
-    {0x12fff7a, 0x12fff97},
-    {0x130ff14, 0x130ff87},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dffb6},
-    {0x12eff51, 0x12effec},
-    {0x12fffb8, 0x12ffff1},
-    {0x130ff1e, 0x130ff8d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dff63},
-    {0x12effc2, 0x12effce},
-    {0x12ffff5, 0x12fff4c},
-    {0x130ff28, 0x130ff94},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff10},
-    {0x12eff33, 0x12effb0},
-    {0x12fff33, 0x12fffa7},
-    {0x130ff33, 0x130ff9a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dffbe},
-    {0x12effa3, 0x12eff91},
-    {0x12fff70, 0x12fff02},
-    {0x130ff3d, 0x130ffa1},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dff6b},
-    {0x12eff14, 0x12eff73},
-    {0x12fffae, 0x12fff5d},
-    {0x130ff47, 0x130ffa7},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dff18},
-    {0x12eff85, 0x12eff55},
-    {0x12fffeb, 0x12fffb8},
-    {0x130ff51, 0x130ffad},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dffc6},
-    {0x12efff5, 0x12eff36},
-    {0x12fff28, 0x12fff13},
-    {0x130ff5c, 0x130ffb4},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff73},
-    {0x12eff66, 0x12eff18},
-    {0x12fff66, 0x12fff6e},
-    {0x130ff66, 0x130ffba},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dff21},
-    {0x12effd7, 0x12efffa},
-    {0x12fffa3, 0x12fffc8},
-    {0x130ff70, 0x130ffc0},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dffce},
-    {0x12eff47, 0x12effdb},
-    {0x12fffe1, 0x12fff23},
-    {0x130ff7a, 0x130ffc7},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dff7b},
-    {0x12effb8, 0x12effbd},
-    {0x12fff1e, 0x12fff7e},
-    {0x130ff85, 0x130ffcd},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dff29},
-    {0x12eff28, 0x12eff9f},
-    {0x12fff5c, 0x12fffd9},
-    {0x130ff8f, 0x130ffd3},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffd6},
-    {0x12eff99, 0x12eff80},
-    {0x12fff99, 0x12fff34},
-    {0x130ff99, 0x130ffda},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dff83},
-    {0x12eff0a, 0x12eff62},
-    {0x12fffd7, 0x12fff8f},
-    {0x130ffa3, 0x130ffe0},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dff31},
-    {0x12eff7a, 0x12eff44},
-    {0x12fff14, 0x12fffea},
-    {0x130ffae, 0x130ffe6},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dffde},
-    {0x12effeb, 0x12eff25},
-    {0x12fff51, 0x12fff45},
-    {0x130ffb8, 0x130ffed},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dff8b},
-    {0x12eff5c, 0x12eff07},
-    {0x12fff8f, 0x12fffa0},
-    {0x130ffc2, 0x130fff3},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff39},
-    {0x12effcc, 0x12effe9},
-    {0x12fffcc, 0x12ffffa},
-    {0x130ffcc, 0x130fff9},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dffe6},
-    {0x12eff3d, 0x12effca},
-    {0x12fff0a, 0x12fff55},
-    {0x130ffd7, 0x130ff00},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dff94},
-    {0x12effae, 0x12effac},
-    {0x12fff47, 0x12fffb0},
-    {0x130ffe1, 0x130ff06},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dff41},
-    {0x12eff1e, 0x12eff8e},
-    {0x12fff85, 0x12fff0b},
-    {0x130ffeb, 0x130ff0d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dffee},
-    {0x12eff8f, 0x12eff6f},
-    {0x12fffc2, 0x12fff66},
-    {0x130fff5, 0x130ff13},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dff9c},
-    {0x12eff00, 0x12eff51},
-    {0x12fff00, 0x12fffc1},
-    {0x130ff00, 0x130ff19},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dff49},
-    {0x12eff70, 0x12eff33},
-    {0x12fff3d, 0x12fff1c},
-    {0x130ff0a, 0x130ff20},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dfff6},
-    {0x12effe1, 0x12eff14},
-    {0x12fff7a, 0x12fff77},
-    {0x130ff14, 0x130ff26},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dffa4},
-    {0x12eff51, 0x12efff6},
-    {0x12fffb8, 0x12fffd1},
-    {0x130ff1e, 0x130ff2c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dff51},
-    {0x12effc2, 0x12effd8},
-    {0x12ffff5, 0x12fff2c},
-    {0x130ff28, 0x130ff33},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dfffe},
-    {0x12eff33, 0x12effb9},
-    {0x12fff33, 0x12fff87},
-    {0x130ff33, 0x130ff39},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dffac},
-    {0x12effa3, 0x12eff9b},
-    {0x12fff70, 0x12fffe2},
-    {0x130ff3d, 0x130ff3f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dff59},
-    {0x12eff14, 0x12eff7d},
-    {0x12fffae, 0x12fff3d},
-    {0x130ff47, 0x130ff46},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dff06},
-    {0x12eff85, 0x12eff5f},
-    {0x12fffeb, 0x12fff98},
-    {0x130ff51, 0x130ff4c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dffb4},
-    {0x12efff5, 0x12eff40},
-    {0x12fff28, 0x12ffff3},
-    {0x130ff5c, 0x130ff52},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff61},
-    {0x12eff66, 0x12eff22},
-    {0x12fff66, 0x12fff4e},
-    {0x130ff66, 0x130ff59},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dff0f},
-    {0x12effd7, 0x12eff04},
-    {0x12fffa3, 0x12fffa9},
-    {0x130ff70, 0x130ff5f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dffbc},
-    {0x12eff47, 0x12effe5},
-    {0x12fffe1, 0x12fff03},
-    {0x130ff7a, 0x130ff66},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dff69},
-    {0x12effb8, 0x12effc7},
-    {0x12fff1e, 0x12fff5e},
-    {0x130ff85, 0x130ff6c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dff17},
-    {0x12eff28, 0x12effa9},
-    {0x12fff5c, 0x12fffb9},
-    {0x130ff8f, 0x130ff72},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffc4},
-    {0x12eff99, 0x12eff8a},
-    {0x12fff99, 0x12fff14},
-    {0x130ff99, 0x130ff79},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dff71},
-    {0x12eff0a, 0x12eff6c},
-    {0x12fffd7, 0x12fff6f},
-    {0x130ffa3, 0x130ff7f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dff1f},
-    {0x12eff7a, 0x12eff4e},
-    {0x12fff14, 0x12fffca},
-    {0x130ffae, 0x130ff85},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dffcc},
-    {0x12effeb, 0x12eff2f},
-    {0x12fff51, 0x12fff25},
-    {0x130ffb8, 0x130ff8c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dff79},
-    {0x12eff5c, 0x12eff11},
-    {0x12fff8f, 0x12fff80},
-    {0x130ffc2, 0x130ff92},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff27},
-    {0x12effcc, 0x12efff3},
-    {0x12fffcc, 0x12fffda},
-    {0x130ffcc, 0x130ff98},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dffd4},
-    {0x12eff3d, 0x12effd4},
-    {0x12fff0a, 0x12fff35},
-    {0x130ffd7, 0x130ff9f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dff82},
-    {0x12effae, 0x12effb6},
-    {0x12fff47, 0x12fff90},
-    {0x130ffe1, 0x130ffa5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dff2f},
-    {0x12eff1e, 0x12eff98},
-    {0x12fff85, 0x12fffeb},
-    {0x130ffeb, 0x130ffab},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dffdc},
-    {0x12eff8f, 0x12eff79},
-    {0x12fffc2, 0x12fff46},
-    {0x130fff5, 0x130ffb2},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dff8a},
-    {0x12eff00, 0x12eff5b},
-    {0x12fff00, 0x12fffa1},
-    {0x130ff00, 0x130ffb8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dff37},
-    {0x12eff70, 0x12eff3d},
-    {0x12fff3d, 0x12ffffc},
-    {0x130ff0a, 0x130ffbe},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dffe4},
-    {0x12effe1, 0x12eff1e},
-    {0x12fff7a, 0x12fff57},
-    {0x130ff14, 0x130ffc5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dff92},
-    {0x12eff51, 0x12eff00},
-    {0x12fffb8, 0x12fffb2},
-    {0x130ff1e, 0x130ffcb},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dff3f},
-    {0x12effc2, 0x12effe2},
-    {0x12ffff5, 0x12fff0c},
-    {0x130ff28, 0x130ffd2},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dffec},
-    {0x12eff33, 0x12effc3},
-    {0x12fff33, 0x12fff67},
-    {0x130ff33, 0x130ffd8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dff9a},
-    {0x12effa3, 0x12effa5},
-    {0x12fff70, 0x12fffc2},
-    {0x130ff3d, 0x130ffde},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dff47},
-    {0x12eff14, 0x12eff87},
-    {0x12fffae, 0x12fff1d},
-    {0x130ff47, 0x130ffe5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dfff4},
-    {0x12eff85, 0x12eff68},
-    {0x12fffeb, 0x12fff78},
-    {0x130ff51, 0x130ffeb},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dffa2},
-    {0x12efff5, 0x12eff4a},
-    {0x12fff28, 0x12fffd3},
-    {0x130ff5c, 0x130fff1},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff4f},
-    {0x12eff66, 0x12eff2c},
-    {0x12fff66, 0x12fff2e},
-    {0x130ff66, 0x130fff8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dfffd},
-    {0x12effd7, 0x12eff0d},
-    {0x12fffa3, 0x12fff89},
-    {0x130ff70, 0x130fffe},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dffaa},
-    {0x12eff47, 0x12effef},
-    {0x12fffe1, 0x12fffe3},
-    {0x130ff7a, 0x130ff04},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dff57},
-    {0x12effb8, 0x12effd1},
-    {0x12fff1e, 0x12fff3e},
-    {0x130ff85, 0x130ff0b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dff05},
-    {0x12eff28, 0x12effb3},
-    {0x12fff5c, 0x12fff99},
-    {0x130ff8f, 0x130ff11},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffb2},
-    {0x12eff99, 0x12eff94},
-    {0x12fff99, 0x12ffff4},
-    {0x130ff99, 0x130ff17},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dff5f},
-    {0x12eff0a, 0x12eff76},
-    {0x12fffd7, 0x12fff4f},
-    {0x130ffa3, 0x130ff1e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dff0d},
-    {0x12eff7a, 0x12eff58},
-    {0x12fff14, 0x12fffaa},
-    {0x130ffae, 0x130ff24},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dffba},
-    {0x12effeb, 0x12eff39},
-    {0x12fff51, 0x12fff05},
-    {0x130ffb8, 0x130ff2b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dff67},
-    {0x12eff5c, 0x12eff1b},
-    {0x12fff8f, 0x12fff60},
-    {0x130ffc2, 0x130ff31},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff15},
-    {0x12effcc, 0x12efffd},
-    {0x12fffcc, 0x12fffba},
-    {0x130ffcc, 0x130ff37},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dffc2},
-    {0x12eff3d, 0x12effde},
-    {0x12fff0a, 0x12fff15},
-    {0x130ffd7, 0x130ff3e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dff70},
-    {0x12effae, 0x12effc0},
-    {0x12fff47, 0x12fff70},
-    {0x130ffe1, 0x130ff44},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dff1d},
-    {0x12eff1e, 0x12effa2},
-    {0x12fff85, 0x12fffcb},
-    {0x130ffeb, 0x130ff4a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dffca},
-    {0x12eff8f, 0x12eff83},
-    {0x12fffc2, 0x12fff26},
-    {0x130fff5, 0x130ff51},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dff78},
-    {0x12eff00, 0x12eff65},
-    {0x12fff00, 0x12fff81},
-    {0x130ff00, 0x130ff57},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dff25},
-    {0x12eff70, 0x12eff47},
-    {0x12fff3d, 0x12fffdc},
-    {0x130ff0a, 0x130ff5d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dffd2},
-    {0x12effe1, 0x12eff28},
-    {0x12fff7a, 0x12fff37},
-    {0x130ff14, 0x130ff64},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dff80},
-    {0x12eff51, 0x12eff0a},
-    {0x12fffb8, 0x12fff92},
-    {0x130ff1e, 0x130ff6a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dff2d},
-    {0x12effc2, 0x12effec},
-    {0x12ffff5, 0x12fffec},
-    {0x130ff28, 0x130ff70},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dffda},
-    {0x12eff33, 0x12effcd},
-    {0x12fff33, 0x12fff47},
-    {0x130ff33, 0x130ff77},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dff88},
-    {0x12effa3, 0x12effaf},
-    {0x12fff70, 0x12fffa2},
-    {0x130ff3d, 0x130ff7d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dff35},
-    {0x12eff14, 0x12eff91},
-    {0x12fffae, 0x12ffffd},
-    {0x130ff47, 0x130ff83},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dffe2},
-    {0x12eff85, 0x12eff72},
-    {0x12fffeb, 0x12fff58},
-    {0x130ff51, 0x130ff8a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dff90},
-    {0x12efff5, 0x12eff54},
-    {0x12fff28, 0x12fffb3},
-    {0x130ff5c, 0x130ff90},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff3d},
-    {0x12eff66, 0x12eff36},
-    {0x12fff66, 0x12fff0e},
-    {0x130ff66, 0x130ff97},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dffeb},
-    {0x12effd7, 0x12eff17},
-    {0x12fffa3, 0x12fff69},
-    {0x130ff70, 0x130ff9d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dff98},
-    {0x12eff47, 0x12efff9},
-    {0x12fffe1, 0x12fffc3},
-    {0x130ff7a, 0x130ffa3},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dff45},
-    {0x12effb8, 0x12effdb},
-    {0x12fff1e, 0x12fff1e},
-    {0x130ff85, 0x130ffaa},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dfff3},
-    {0x12eff28, 0x12effbc},
-    {0x12fff5c, 0x12fff79},
-    {0x130ff8f, 0x130ffb0},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffa0},
-    {0x12eff99, 0x12eff9e},
-    {0x12fff99, 0x12fffd4},
-    {0x130ff99, 0x130ffb6},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dff4d},
-    {0x12eff0a, 0x12eff80},
-    {0x12fffd7, 0x12fff2f},
-    {0x130ffa3, 0x130ffbd},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dfffb},
-    {0x12eff7a, 0x12eff61},
-    {0x12fff14, 0x12fff8a},
-    {0x130ffae, 0x130ffc3},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dffa8},
-    {0x12effeb, 0x12eff43},
-    {0x12fff51, 0x12fffe5},
-    {0x130ffb8, 0x130ffc9},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dff55},
-    {0x12eff5c, 0x12eff25},
-    {0x12fff8f, 0x12fff40},
-    {0x130ffc2, 0x130ffd0},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff03},
-    {0x12effcc, 0x12eff07},
-    {0x12fffcc, 0x12fff9b},
-    {0x130ffcc, 0x130ffd6},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dffb0},
-    {0x12eff3d, 0x12effe8},
-    {0x12fff0a, 0x12ffff5},
-    {0x130ffd7, 0x130ffdc},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dff5e},
-    {0x12effae, 0x12effca},
-    {0x12fff47, 0x12fff50},
-    {0x130ffe1, 0x130ffe3},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dff0b},
-    {0x12eff1e, 0x12effac},
-    {0x12fff85, 0x12fffab},
-    {0x130ffeb, 0x130ffe9},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dffb8},
-    {0x12eff8f, 0x12eff8d},
-    {0x12fffc2, 0x12fff06},
-    {0x130fff5, 0x130fff0},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dff66},
-    {0x12eff00, 0x12eff6f},
-    {0x12fff00, 0x12fff61},
-    {0x130ff00, 0x130fff6},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dff13},
-    {0x12eff70, 0x12eff51},
-    {0x12fff3d, 0x12fffbc},
-    {0x130ff0a, 0x130fffc},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dffc0},
-    {0x12effe1, 0x12eff32},
-    {0x12fff7a, 0x12fff17},
-    {0x130ff14, 0x130ff03},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dff6e},
-    {0x12eff51, 0x12eff14},
-    {0x12fffb8, 0x12fff72},
-    {0x130ff1e, 0x130ff09},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dff1b},
-    {0x12effc2, 0x12efff6},
-    {0x12ffff5, 0x12fffcc},
-    {0x130ff28, 0x130ff0f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dffc8},
-    {0x12eff33, 0x12effd7},
-    {0x12fff33, 0x12fff27},
-    {0x130ff33, 0x130ff16},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dff76},
-    {0x12effa3, 0x12effb9},
-    {0x12fff70, 0x12fff82},
-    {0x130ff3d, 0x130ff1c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dff23},
-    {0x12eff14, 0x12eff9b},
-    {0x12fffae, 0x12fffdd},
-    {0x130ff47, 0x130ff22},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dffd0},
-    {0x12eff85, 0x12eff7c},
-    {0x12fffeb, 0x12fff38},
-    {0x130ff51, 0x130ff29},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dff7e},
-    {0x12efff5, 0x12eff5e},
-    {0x12fff28, 0x12fff93},
-    {0x130ff5c, 0x130ff2f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff2b},
-    {0x12eff66, 0x12eff40},
-    {0x12fff66, 0x12fffee},
-    {0x130ff66, 0x130ff35},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dffd9},
-    {0x12effd7, 0x12eff21},
-    {0x12fffa3, 0x12fff49},
-    {0x130ff70, 0x130ff3c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dff86},
-    {0x12eff47, 0x12eff03},
-    {0x12fffe1, 0x12fffa4},
-    {0x130ff7a, 0x130ff42},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dff33},
-    {0x12effb8, 0x12effe5},
-    {0x12fff1e, 0x12ffffe},
-    {0x130ff85, 0x130ff48},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dffe1},
-    {0x12eff28, 0x12effc6},
-    {0x12fff5c, 0x12fff59},
-    {0x130ff8f, 0x130ff4f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff8e},
-    {0x12eff99, 0x12effa8},
-    {0x12fff99, 0x12fffb4},
-    {0x130ff99, 0x130ff55},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dff3b},
-    {0x12eff0a, 0x12eff8a},
-    {0x12fffd7, 0x12fff0f},
-    {0x130ffa3, 0x130ff5c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dffe9},
-    {0x12eff7a, 0x12eff6b},
-    {0x12fff14, 0x12fff6a},
-    {0x130ffae, 0x130ff62},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dff96},
-    {0x12effeb, 0x12eff4d},
-    {0x12fff51, 0x12fffc5},
-    {0x130ffb8, 0x130ff68},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dff43},
-    {0x12eff5c, 0x12eff2f},
-    {0x12fff8f, 0x12fff20},
-    {0x130ffc2, 0x130ff6f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dfff1},
-    {0x12effcc, 0x12eff10},
-    {0x12fffcc, 0x12fff7b},
-    {0x130ffcc, 0x130ff75},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dff9e},
-    {0x12eff3d, 0x12efff2},
-    {0x12fff0a, 0x12fffd5},
-    {0x130ffd7, 0x130ff7b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dff4c},
-    {0x12effae, 0x12effd4},
-    {0x12fff47, 0x12fff30},
-    {0x130ffe1, 0x130ff82},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dfff9},
-    {0x12eff1e, 0x12effb5},
-    {0x12fff85, 0x12fff8b},
-    {0x130ffeb, 0x130ff88},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff25, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dffa6},
-    {0x12eff8f, 0x12eff97},
-    {0x12fffc2, 0x12fffe6},
-    {0x130fff5, 0x130ff8e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dff54},
-    {0x12eff00, 0x12eff79},
-    {0x12fff00, 0x12fff41},
-    {0x130ff00, 0x130ff95},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dff01},
-    {0x12eff70, 0x12eff5b},
-    {0x12fff3d, 0x12fff9c},
-    {0x130ff0a, 0x130ff9b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dffae},
-    {0x12effe1, 0x12eff3c},
-    {0x12fff7a, 0x12ffff7},
-    {0x130ff14, 0x130ffa1},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dff5c},
-    {0x12eff51, 0x12eff1e},
-    {0x12fffb8, 0x12fff52},
-    {0x130ff1e, 0x130ffa8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dff09},
-    {0x12effc2, 0x12eff00},
-    {0x12ffff5, 0x12fffad},
-    {0x130ff28, 0x130ffae},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dffb6},
-    {0x12eff33, 0x12effe1},
-    {0x12fff33, 0x12fff07},
-    {0x130ff33, 0x130ffb5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dff64},
-    {0x12effa3, 0x12effc3},
-    {0x12fff70, 0x12fff62},
-    {0x130ff3d, 0x130ffbb},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dff11},
-    {0x12eff14, 0x12effa5},
-    {0x12fffae, 0x12fffbd},
-    {0x130ff47, 0x130ffc1},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dffbe},
-    {0x12eff85, 0x12eff86},
-    {0x12fffeb, 0x12fff18},
-    {0x130ff51, 0x130ffc8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dff6c},
-    {0x12efff5, 0x12eff68},
-    {0x12fff28, 0x12fff73},
-    {0x130ff5c, 0x130ffce},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff19},
-    {0x12eff66, 0x12eff4a},
-    {0x12fff66, 0x12fffce},
-    {0x130ff66, 0x130ffd4},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dffc7},
-    {0x12effd7, 0x12eff2b},
-    {0x12fffa3, 0x12fff29},
-    {0x130ff70, 0x130ffdb},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dff74},
-    {0x12eff47, 0x12eff0d},
-    {0x12fffe1, 0x12fff84},
-    {0x130ff7a, 0x130ffe1},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dff21},
-    {0x12effb8, 0x12effef},
-    {0x12fff1e, 0x12fffde},
-    {0x130ff85, 0x130ffe7},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dffcf},
-    {0x12eff28, 0x12effd0},
-    {0x12fff5c, 0x12fff39},
-    {0x130ff8f, 0x130ffee},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff7c},
-    {0x12eff99, 0x12effb2},
-    {0x12fff99, 0x12fff94},
-    {0x130ff99, 0x130fff4},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff17},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dff29},
-    {0x12eff0a, 0x12eff94},
-    {0x12fffd7, 0x12fffef},
-    {0x130ffa3, 0x130fffa},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dffd7},
-    {0x12eff7a, 0x12eff75},
-    {0x12fff14, 0x12fff4a},
-    {0x130ffae, 0x130ff01},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dff84},
-    {0x12effeb, 0x12eff57},
-    {0x12fff51, 0x12fffa5},
-    {0x130ffb8, 0x130ff07},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dff31},
-    {0x12eff5c, 0x12eff39},
-    {0x12fff8f, 0x12fff00},
-    {0x130ffc2, 0x130ff0e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dffdf},
-    {0x12effcc, 0x12eff1a},
-    {0x12fffcc, 0x12fff5b},
-    {0x130ffcc, 0x130ff14},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dff8c},
-    {0x12eff3d, 0x12efffc},
-    {0x12fff0a, 0x12fffb5},
-    {0x130ffd7, 0x130ff1a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dff3a},
-    {0x12effae, 0x12effde},
-    {0x12fff47, 0x12fff10},
-    {0x130ffe1, 0x130ff21},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dffe7},
-    {0x12eff1e, 0x12effbf},
-    {0x12fff85, 0x12fff6b},
-    {0x130ffeb, 0x130ff27},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff26, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dff94},
-    {0x12eff8f, 0x12effa1},
-    {0x12fffc2, 0x12fffc6},
-    {0x130fff5, 0x130ff2d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dff42},
-    {0x12eff00, 0x12eff83},
-    {0x12fff00, 0x12fff21},
-    {0x130ff00, 0x130ff34},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dffef},
-    {0x12eff70, 0x12eff64},
-    {0x12fff3d, 0x12fff7c},
-    {0x130ff0a, 0x130ff3a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dff9c},
-    {0x12effe1, 0x12eff46},
-    {0x12fff7a, 0x12fffd7},
-    {0x130ff14, 0x130ff40},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dff4a},
-    {0x12eff51, 0x12eff28},
-    {0x12fffb8, 0x12fff32},
-    {0x130ff1e, 0x130ff47},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dfff7},
-    {0x12effc2, 0x12eff09},
-    {0x12ffff5, 0x12fff8d},
-    {0x130ff28, 0x130ff4d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dffa4},
-    {0x12eff33, 0x12effeb},
-    {0x12fff33, 0x12fffe7},
-    {0x130ff33, 0x130ff53},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dff52},
-    {0x12effa3, 0x12effcd},
-    {0x12fff70, 0x12fff42},
-    {0x130ff3d, 0x130ff5a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dffff},
-    {0x12eff14, 0x12effae},
-    {0x12fffae, 0x12fff9d},
-    {0x130ff47, 0x130ff60},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dffac},
-    {0x12eff85, 0x12eff90},
-    {0x12fffeb, 0x12ffff8},
-    {0x130ff51, 0x130ff66},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dff5a},
-    {0x12efff5, 0x12eff72},
-    {0x12fff28, 0x12fff53},
-    {0x130ff5c, 0x130ff6d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff07},
-    {0x12eff66, 0x12eff54},
-    {0x12fff66, 0x12fffae},
-    {0x130ff66, 0x130ff73},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dffb5},
-    {0x12effd7, 0x12eff35},
-    {0x12fffa3, 0x12fff09},
-    {0x130ff70, 0x130ff7a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dff62},
-    {0x12eff47, 0x12eff17},
-    {0x12fffe1, 0x12fff64},
-    {0x130ff7a, 0x130ff80},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dff0f},
-    {0x12effb8, 0x12efff9},
-    {0x12fff1e, 0x12fffbe},
-    {0x130ff85, 0x130ff86},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dffbd},
-    {0x12eff28, 0x12effda},
-    {0x12fff5c, 0x12fff19},
-    {0x130ff8f, 0x130ff8d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff6a},
-    {0x12eff99, 0x12effbc},
-    {0x12fff99, 0x12fff74},
-    {0x130ff99, 0x130ff93},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dff17},
-    {0x12eff0a, 0x12eff9e},
-    {0x12fffd7, 0x12fffcf},
-    {0x130ffa3, 0x130ff99},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dffc5},
-    {0x12eff7a, 0x12eff7f},
-    {0x12fff14, 0x12fff2a},
-    {0x130ffae, 0x130ffa0},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dff72},
-    {0x12effeb, 0x12eff61},
-    {0x12fff51, 0x12fff85},
-    {0x130ffb8, 0x130ffa6},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dff1f},
-    {0x12eff5c, 0x12eff43},
-    {0x12fff8f, 0x12fffe0},
-    {0x130ffc2, 0x130ffac},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dffcd},
-    {0x12effcc, 0x12eff24},
-    {0x12fffcc, 0x12fff3b},
-    {0x130ffcc, 0x130ffb3},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dff7a},
-    {0x12eff3d, 0x12eff06},
-    {0x12fff0a, 0x12fff96},
-    {0x130ffd7, 0x130ffb9},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dff28},
-    {0x12effae, 0x12effe8},
-    {0x12fff47, 0x12ffff0},
-    {0x130ffe1, 0x130ffbf},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dffd5},
-    {0x12eff1e, 0x12effc9},
-    {0x12fff85, 0x12fff4b},
-    {0x130ffeb, 0x130ffc6},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff04, 0x110ff04},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff27, 0x12bff18},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dff82},
-    {0x12eff8f, 0x12effab},
-    {0x12fffc2, 0x12fffa6},
-    {0x130fff5, 0x130ffcc},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dffe4},
-    {0x12eff00, 0x12eff29},
-    {0x12fff00, 0x12fff41},
-    {0x130ff00, 0x130ff9e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dff26},
-    {0x12eff14, 0x12eff53},
-    {0x12fffae, 0x12fff05},
-    {0x130ff07, 0x130ffa3},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dff68},
-    {0x12eff28, 0x12eff7c},
-    {0x12fff5c, 0x12fffc9},
-    {0x130ff0f, 0x130ffa7},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dffaa},
-    {0x12eff3d, 0x12effa5},
-    {0x12fff0a, 0x12fff8d},
-    {0x130ff17, 0x130ffac},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dffec},
-    {0x12eff51, 0x12effce},
-    {0x12fffb8, 0x12fff51},
-    {0x130ff1e, 0x130ffb1},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff2e},
-    {0x12eff66, 0x12efff8},
-    {0x12fff66, 0x12fff15},
-    {0x130ff26, 0x130ffb6},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dff70},
-    {0x12eff7a, 0x12eff21},
-    {0x12fff14, 0x12fffda},
-    {0x130ff2e, 0x130ffba},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dffb2},
-    {0x12eff8f, 0x12eff4a},
-    {0x12fffc2, 0x12fff9e},
-    {0x130ff35, 0x130ffbf},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dfff4},
-    {0x12effa3, 0x12eff73},
-    {0x12fff70, 0x12fff62},
-    {0x130ff3d, 0x130ffc4},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dff36},
-    {0x12effb8, 0x12eff9d},
-    {0x12fff1e, 0x12fff26},
-    {0x130ff45, 0x130ffc9},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff78},
-    {0x12effcc, 0x12effc6},
-    {0x12fffcc, 0x12fffea},
-    {0x130ff4c, 0x130ffcd},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dffba},
-    {0x12effe1, 0x12effef},
-    {0x12fff7a, 0x12fffae},
-    {0x130ff54, 0x130ffd2},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dfffc},
-    {0x12efff5, 0x12eff18},
-    {0x12fff28, 0x12fff73},
-    {0x130ff5c, 0x130ffd7},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dff3e},
-    {0x12eff0a, 0x12eff42},
-    {0x12fffd7, 0x12fff37},
-    {0x130ff63, 0x130ffdc},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dff80},
-    {0x12eff1e, 0x12eff6b},
-    {0x12fff85, 0x12ffffb},
-    {0x130ff6b, 0x130ffe0},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dffc2},
-    {0x12eff33, 0x12eff94},
-    {0x12fff33, 0x12fffbf},
-    {0x130ff73, 0x130ffe5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dff04},
-    {0x12eff47, 0x12effbe},
-    {0x12fffe1, 0x12fff83},
-    {0x130ff7a, 0x130ffea},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dff46},
-    {0x12eff5c, 0x12effe7},
-    {0x12fff8f, 0x12fff47},
-    {0x130ff82, 0x130ffef},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dff88},
-    {0x12eff70, 0x12eff10},
-    {0x12fff3d, 0x12fff0c},
-    {0x130ff8a, 0x130fff4},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dffca},
-    {0x12eff85, 0x12eff39},
-    {0x12fffeb, 0x12fffd0},
-    {0x130ff91, 0x130fff8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff12},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff0c},
-    {0x12eff99, 0x12eff63},
-    {0x12fff99, 0x12fff94},
-    {0x130ff99, 0x130fffd},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dff4e},
-    {0x12effae, 0x12eff8c},
-    {0x12fff47, 0x12fff58},
-    {0x130ffa1, 0x130ff02},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dff90},
-    {0x12effc2, 0x12effb5},
-    {0x12ffff5, 0x12fff1c},
-    {0x130ffa8, 0x130ff07},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dffd2},
-    {0x12effd7, 0x12effde},
-    {0x12fffa3, 0x12fffe0},
-    {0x130ffb0, 0x130ff0b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dff14},
-    {0x12effeb, 0x12eff08},
-    {0x12fff51, 0x12fffa5},
-    {0x130ffb8, 0x130ff10},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dff56},
-    {0x12eff00, 0x12eff31},
-    {0x12fff00, 0x12fff69},
-    {0x130ffc0, 0x130ff15},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dff98},
-    {0x12eff14, 0x12eff5a},
-    {0x12fffae, 0x12fff2d},
-    {0x130ffc7, 0x130ff1a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dffda},
-    {0x12eff28, 0x12eff83},
-    {0x12fff5c, 0x12ffff1},
-    {0x130ffcf, 0x130ff1e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dff1c},
-    {0x12eff3d, 0x12effad},
-    {0x12fff0a, 0x12fffb5},
-    {0x130ffd7, 0x130ff23},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dff5e},
-    {0x12eff51, 0x12effd6},
-    {0x12fffb8, 0x12fff79},
-    {0x130ffde, 0x130ff28},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dffa0},
-    {0x12eff66, 0x12effff},
-    {0x12fff66, 0x12fff3d},
-    {0x130ffe6, 0x130ff2d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dffe2},
-    {0x12eff7a, 0x12eff28},
-    {0x12fff14, 0x12fff02},
-    {0x130ffee, 0x130ff32},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dff24},
-    {0x12eff8f, 0x12eff52},
-    {0x12fffc2, 0x12fffc6},
-    {0x130fff5, 0x130ff36},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1e, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dff66},
-    {0x12effa3, 0x12eff7b},
-    {0x12fff70, 0x12fff8a},
-    {0x130fffd, 0x130ff3b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dffa8},
-    {0x12effb8, 0x12effa4},
-    {0x12fff1e, 0x12fff4e},
-    {0x130ff05, 0x130ff40},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dffea},
-    {0x12effcc, 0x12effcd},
-    {0x12fffcc, 0x12fff12},
-    {0x130ff0c, 0x130ff45},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dff2c},
-    {0x12effe1, 0x12efff7},
-    {0x12fff7a, 0x12fffd6},
-    {0x130ff14, 0x130ff49},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dff6e},
-    {0x12efff5, 0x12eff20},
-    {0x12fff28, 0x12fff9b},
-    {0x130ff1c, 0x130ff4e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dffb0},
-    {0x12eff0a, 0x12eff49},
-    {0x12fffd7, 0x12fff5f},
-    {0x130ff23, 0x130ff53},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dfff2},
-    {0x12eff1e, 0x12eff72},
-    {0x12fff85, 0x12fff23},
-    {0x130ff2b, 0x130ff58},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff34},
-    {0x12eff33, 0x12eff9c},
-    {0x12fff33, 0x12fffe7},
-    {0x130ff33, 0x130ff5c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dff76},
-    {0x12eff47, 0x12effc5},
-    {0x12fffe1, 0x12fffab},
-    {0x130ff3a, 0x130ff61},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dffb8},
-    {0x12eff5c, 0x12effee},
-    {0x12fff8f, 0x12fff6f},
-    {0x130ff42, 0x130ff66},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dfffa},
-    {0x12eff70, 0x12eff17},
-    {0x12fff3d, 0x12fff34},
-    {0x130ff4a, 0x130ff6b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dff3c},
-    {0x12eff85, 0x12eff41},
-    {0x12fffeb, 0x12ffff8},
-    {0x130ff51, 0x130ff6f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff7e},
-    {0x12eff99, 0x12eff6a},
-    {0x12fff99, 0x12fffbc},
-    {0x130ff59, 0x130ff74},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dffc0},
-    {0x12effae, 0x12eff93},
-    {0x12fff47, 0x12fff80},
-    {0x130ff61, 0x130ff79},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dff03},
-    {0x12effc2, 0x12effbd},
-    {0x12ffff5, 0x12fff44},
-    {0x130ff68, 0x130ff7e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dff45},
-    {0x12effd7, 0x12effe6},
-    {0x12fffa3, 0x12fff08},
-    {0x130ff70, 0x130ff83},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dff87},
-    {0x12effeb, 0x12eff0f},
-    {0x12fff51, 0x12fffcd},
-    {0x130ff78, 0x130ff87},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dffc9},
-    {0x12eff00, 0x12eff38},
-    {0x12fff00, 0x12fff91},
-    {0x130ff80, 0x130ff8c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dff0b},
-    {0x12eff14, 0x12eff62},
-    {0x12fffae, 0x12fff55},
-    {0x130ff87, 0x130ff91},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dff4d},
-    {0x12eff28, 0x12eff8b},
-    {0x12fff5c, 0x12fff19},
-    {0x130ff8f, 0x130ff96},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dff8f},
-    {0x12eff3d, 0x12effb4},
-    {0x12fff0a, 0x12fffdd},
-    {0x130ff97, 0x130ff9a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dffd1},
-    {0x12eff51, 0x12effdd},
-    {0x12fffb8, 0x12fffa1},
-    {0x130ff9e, 0x130ff9f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff13},
-    {0x12eff66, 0x12eff07},
-    {0x12fff66, 0x12fff66},
-    {0x130ffa6, 0x130ffa4},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dff55},
-    {0x12eff7a, 0x12eff30},
-    {0x12fff14, 0x12fff2a},
-    {0x130ffae, 0x130ffa9},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dff97},
-    {0x12eff8f, 0x12eff59},
-    {0x12fffc2, 0x12fffee},
-    {0x130ffb5, 0x130ffad},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dffd9},
-    {0x12effa3, 0x12eff82},
-    {0x12fff70, 0x12fffb2},
-    {0x130ffbd, 0x130ffb2},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dff1b},
-    {0x12effb8, 0x12effac},
-    {0x12fff1e, 0x12fff76},
-    {0x130ffc5, 0x130ffb7},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff5d},
-    {0x12effcc, 0x12effd5},
-    {0x12fffcc, 0x12fff3a},
-    {0x130ffcc, 0x130ffbc},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dff9f},
-    {0x12effe1, 0x12efffe},
-    {0x12fff7a, 0x12ffffe},
-    {0x130ffd4, 0x130ffc0},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dffe1},
-    {0x12efff5, 0x12eff27},
-    {0x12fff28, 0x12fffc3},
-    {0x130ffdc, 0x130ffc5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dff23},
-    {0x12eff0a, 0x12eff51},
-    {0x12fffd7, 0x12fff87},
-    {0x130ffe3, 0x130ffca},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dff65},
-    {0x12eff1e, 0x12eff7a},
-    {0x12fff85, 0x12fff4b},
-    {0x130ffeb, 0x130ffcf},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dffa7},
-    {0x12eff33, 0x12effa3},
-    {0x12fff33, 0x12fff0f},
-    {0x130fff3, 0x130ffd4},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff1f, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dffe9},
-    {0x12eff47, 0x12effcc},
-    {0x12fffe1, 0x12fffd3},
-    {0x130fffa, 0x130ffd8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dff2b},
-    {0x12eff5c, 0x12efff6},
-    {0x12fff8f, 0x12fff97},
-    {0x130ff02, 0x130ffdd},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dff6d},
-    {0x12eff70, 0x12eff1f},
-    {0x12fff3d, 0x12fff5c},
-    {0x130ff0a, 0x130ffe2},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dffaf},
-    {0x12eff85, 0x12eff48},
-    {0x12fffeb, 0x12fff20},
-    {0x130ff11, 0x130ffe7},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dfff1},
-    {0x12eff99, 0x12eff71},
-    {0x12fff99, 0x12fffe4},
-    {0x130ff19, 0x130ffeb},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dff33},
-    {0x12effae, 0x12eff9b},
-    {0x12fff47, 0x12fffa8},
-    {0x130ff21, 0x130fff0},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dff75},
-    {0x12effc2, 0x12effc4},
-    {0x12ffff5, 0x12fff6c},
-    {0x130ff28, 0x130fff5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dffb7},
-    {0x12effd7, 0x12effed},
-    {0x12fffa3, 0x12fff30},
-    {0x130ff30, 0x130fffa},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff13},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dfff9},
-    {0x12effeb, 0x12eff16},
-    {0x12fff51, 0x12ffff5},
-    {0x130ff38, 0x130fffe},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dff3b},
-    {0x12eff00, 0x12eff40},
-    {0x12fff00, 0x12fffb9},
-    {0x130ff40, 0x130ff03},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dff7d},
-    {0x12eff14, 0x12eff69},
-    {0x12fffae, 0x12fff7d},
-    {0x130ff47, 0x130ff08},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dffbf},
-    {0x12eff28, 0x12eff92},
-    {0x12fff5c, 0x12fff41},
-    {0x130ff4f, 0x130ff0d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dff01},
-    {0x12eff3d, 0x12effbc},
-    {0x12fff0a, 0x12fff05},
-    {0x130ff57, 0x130ff12},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dff43},
-    {0x12eff51, 0x12effe5},
-    {0x12fffb8, 0x12fffc9},
-    {0x130ff5e, 0x130ff16},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff85},
-    {0x12eff66, 0x12eff0e},
-    {0x12fff66, 0x12fff8e},
-    {0x130ff66, 0x130ff1b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dffc7},
-    {0x12eff7a, 0x12eff37},
-    {0x12fff14, 0x12fff52},
-    {0x130ff6e, 0x130ff20},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dff09},
-    {0x12eff8f, 0x12eff61},
-    {0x12fffc2, 0x12fff16},
-    {0x130ff75, 0x130ff25},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dff4b},
-    {0x12effa3, 0x12eff8a},
-    {0x12fff70, 0x12fffda},
-    {0x130ff7d, 0x130ff29},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dff8d},
-    {0x12effb8, 0x12effb3},
-    {0x12fff1e, 0x12fff9e},
-    {0x130ff85, 0x130ff2e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dffcf},
-    {0x12effcc, 0x12effdc},
-    {0x12fffcc, 0x12fff62},
-    {0x130ff8c, 0x130ff33},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dff11},
-    {0x12effe1, 0x12eff06},
-    {0x12fff7a, 0x12fff27},
-    {0x130ff94, 0x130ff38},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dff53},
-    {0x12efff5, 0x12eff2f},
-    {0x12fff28, 0x12fffeb},
-    {0x130ff9c, 0x130ff3c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dff95},
-    {0x12eff0a, 0x12eff58},
-    {0x12fffd7, 0x12fffaf},
-    {0x130ffa3, 0x130ff41},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dffd7},
-    {0x12eff1e, 0x12eff81},
-    {0x12fff85, 0x12fff73},
-    {0x130ffab, 0x130ff46},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff19},
-    {0x12eff33, 0x12effab},
-    {0x12fff33, 0x12fff37},
-    {0x130ffb3, 0x130ff4b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dff5b},
-    {0x12eff47, 0x12effd4},
-    {0x12fffe1, 0x12ffffb},
-    {0x130ffba, 0x130ff4f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dff9d},
-    {0x12eff5c, 0x12efffd},
-    {0x12fff8f, 0x12fffbf},
-    {0x130ffc2, 0x130ff54},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dffdf},
-    {0x12eff70, 0x12eff26},
-    {0x12fff3d, 0x12fff84},
-    {0x130ffca, 0x130ff59},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dff21},
-    {0x12eff85, 0x12eff50},
-    {0x12fffeb, 0x12fff48},
-    {0x130ffd1, 0x130ff5e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff63},
-    {0x12eff99, 0x12eff79},
-    {0x12fff99, 0x12fff0c},
-    {0x130ffd9, 0x130ff63},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dffa5},
-    {0x12effae, 0x12effa2},
-    {0x12fff47, 0x12fffd0},
-    {0x130ffe1, 0x130ff67},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dffe8},
-    {0x12effc2, 0x12effcb},
-    {0x12ffff5, 0x12fff94},
-    {0x130ffe8, 0x130ff6c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dff2a},
-    {0x12effd7, 0x12efff5},
-    {0x12fffa3, 0x12fff58},
-    {0x130fff0, 0x130ff71},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff20, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dff6c},
-    {0x12effeb, 0x12eff1e},
-    {0x12fff51, 0x12fff1d},
-    {0x130fff8, 0x130ff76},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dffae},
-    {0x12eff00, 0x12eff47},
-    {0x12fff00, 0x12fffe1},
-    {0x130ff00, 0x130ff7a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dfff0},
-    {0x12eff14, 0x12eff70},
-    {0x12fffae, 0x12fffa5},
-    {0x130ff07, 0x130ff7f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dff32},
-    {0x12eff28, 0x12eff9a},
-    {0x12fff5c, 0x12fff69},
-    {0x130ff0f, 0x130ff84},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dff74},
-    {0x12eff3d, 0x12effc3},
-    {0x12fff0a, 0x12fff2d},
-    {0x130ff17, 0x130ff89},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dffb6},
-    {0x12eff51, 0x12effec},
-    {0x12fffb8, 0x12ffff1},
-    {0x130ff1e, 0x130ff8d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dfff8},
-    {0x12eff66, 0x12eff15},
-    {0x12fff66, 0x12fffb6},
-    {0x130ff26, 0x130ff92},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dff3a},
-    {0x12eff7a, 0x12eff3f},
-    {0x12fff14, 0x12fff7a},
-    {0x130ff2e, 0x130ff97},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dff7c},
-    {0x12eff8f, 0x12eff68},
-    {0x12fffc2, 0x12fff3e},
-    {0x130ff35, 0x130ff9c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dffbe},
-    {0x12effa3, 0x12eff91},
-    {0x12fff70, 0x12fff02},
-    {0x130ff3d, 0x130ffa1},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dff00},
-    {0x12effb8, 0x12effbb},
-    {0x12fff1e, 0x12fffc6},
-    {0x130ff45, 0x130ffa5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff42},
-    {0x12effcc, 0x12effe4},
-    {0x12fffcc, 0x12fff8a},
-    {0x130ff4c, 0x130ffaa},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dff84},
-    {0x12effe1, 0x12eff0d},
-    {0x12fff7a, 0x12fff4f},
-    {0x130ff54, 0x130ffaf},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dffc6},
-    {0x12efff5, 0x12eff36},
-    {0x12fff28, 0x12fff13},
-    {0x130ff5c, 0x130ffb4},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dff08},
-    {0x12eff0a, 0x12eff60},
-    {0x12fffd7, 0x12fffd7},
-    {0x130ff63, 0x130ffb8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dff4a},
-    {0x12eff1e, 0x12eff89},
-    {0x12fff85, 0x12fff9b},
-    {0x130ff6b, 0x130ffbd},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff8c},
-    {0x12eff33, 0x12effb2},
-    {0x12fff33, 0x12fff5f},
-    {0x130ff73, 0x130ffc2},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dffce},
-    {0x12eff47, 0x12effdb},
-    {0x12fffe1, 0x12fff23},
-    {0x130ff7a, 0x130ffc7},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dff10},
-    {0x12eff5c, 0x12eff05},
-    {0x12fff8f, 0x12fffe8},
-    {0x130ff82, 0x130ffcb},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dff52},
-    {0x12eff70, 0x12eff2e},
-    {0x12fff3d, 0x12fffac},
-    {0x130ff8a, 0x130ffd0},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dff94},
-    {0x12eff85, 0x12eff57},
-    {0x12fffeb, 0x12fff70},
-    {0x130ff91, 0x130ffd5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffd6},
-    {0x12eff99, 0x12eff80},
-    {0x12fff99, 0x12fff34},
-    {0x130ff99, 0x130ffda},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dff18},
-    {0x12effae, 0x12effaa},
-    {0x12fff47, 0x12ffff8},
-    {0x130ffa1, 0x130ffde},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dff5a},
-    {0x12effc2, 0x12effd3},
-    {0x12ffff5, 0x12fffbc},
-    {0x130ffa8, 0x130ffe3},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dff9c},
-    {0x12effd7, 0x12efffc},
-    {0x12fffa3, 0x12fff80},
-    {0x130ffb0, 0x130ffe8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dffde},
-    {0x12effeb, 0x12eff25},
-    {0x12fff51, 0x12fff45},
-    {0x130ffb8, 0x130ffed},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dff20},
-    {0x12eff00, 0x12eff4f},
-    {0x12fff00, 0x12fff09},
-    {0x130ffc0, 0x130fff2},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dff62},
-    {0x12eff14, 0x12eff78},
-    {0x12fffae, 0x12fffcd},
-    {0x130ffc7, 0x130fff6},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff14},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dffa4},
-    {0x12eff28, 0x12effa1},
-    {0x12fff5c, 0x12fff91},
-    {0x130ffcf, 0x130fffb},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dffe6},
-    {0x12eff3d, 0x12effca},
-    {0x12fff0a, 0x12fff55},
-    {0x130ffd7, 0x130ff00},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dff28},
-    {0x12eff51, 0x12efff4},
-    {0x12fffb8, 0x12fff19},
-    {0x130ffde, 0x130ff05},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff6a},
-    {0x12eff66, 0x12eff1d},
-    {0x12fff66, 0x12fffde},
-    {0x130ffe6, 0x130ff09},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dffac},
-    {0x12eff7a, 0x12eff46},
-    {0x12fff14, 0x12fffa2},
-    {0x130ffee, 0x130ff0e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dffee},
-    {0x12eff8f, 0x12eff6f},
-    {0x12fffc2, 0x12fff66},
-    {0x130fff5, 0x130ff13},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff21, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dff30},
-    {0x12effa3, 0x12eff99},
-    {0x12fff70, 0x12fff2a},
-    {0x130fffd, 0x130ff18},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dff72},
-    {0x12effb8, 0x12effc2},
-    {0x12fff1e, 0x12fffee},
-    {0x130ff05, 0x130ff1c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dffb4},
-    {0x12effcc, 0x12effeb},
-    {0x12fffcc, 0x12fffb2},
-    {0x130ff0c, 0x130ff21},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dfff6},
-    {0x12effe1, 0x12eff14},
-    {0x12fff7a, 0x12fff77},
-    {0x130ff14, 0x130ff26},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dff38},
-    {0x12efff5, 0x12eff3e},
-    {0x12fff28, 0x12fff3b},
-    {0x130ff1c, 0x130ff2b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dff7a},
-    {0x12eff0a, 0x12eff67},
-    {0x12fffd7, 0x12fffff},
-    {0x130ff23, 0x130ff2f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dffbc},
-    {0x12eff1e, 0x12eff90},
-    {0x12fff85, 0x12fffc3},
-    {0x130ff2b, 0x130ff34},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dfffe},
-    {0x12eff33, 0x12effb9},
-    {0x12fff33, 0x12fff87},
-    {0x130ff33, 0x130ff39},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dff40},
-    {0x12eff47, 0x12effe3},
-    {0x12fffe1, 0x12fff4b},
-    {0x130ff3a, 0x130ff3e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dff82},
-    {0x12eff5c, 0x12eff0c},
-    {0x12fff8f, 0x12fff10},
-    {0x130ff42, 0x130ff43},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dffc4},
-    {0x12eff70, 0x12eff35},
-    {0x12fff3d, 0x12fffd4},
-    {0x130ff4a, 0x130ff47},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dff06},
-    {0x12eff85, 0x12eff5f},
-    {0x12fffeb, 0x12fff98},
-    {0x130ff51, 0x130ff4c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff48},
-    {0x12eff99, 0x12eff88},
-    {0x12fff99, 0x12fff5c},
-    {0x130ff59, 0x130ff51},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dff8b},
-    {0x12effae, 0x12effb1},
-    {0x12fff47, 0x12fff20},
-    {0x130ff61, 0x130ff56},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dffcd},
-    {0x12effc2, 0x12effda},
-    {0x12ffff5, 0x12fffe4},
-    {0x130ff68, 0x130ff5a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dff0f},
-    {0x12effd7, 0x12eff04},
-    {0x12fffa3, 0x12fffa9},
-    {0x130ff70, 0x130ff5f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dff51},
-    {0x12effeb, 0x12eff2d},
-    {0x12fff51, 0x12fff6d},
-    {0x130ff78, 0x130ff64},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dff93},
-    {0x12eff00, 0x12eff56},
-    {0x12fff00, 0x12fff31},
-    {0x130ff80, 0x130ff69},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dffd5},
-    {0x12eff14, 0x12eff7f},
-    {0x12fffae, 0x12ffff5},
-    {0x130ff87, 0x130ff6d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dff17},
-    {0x12eff28, 0x12effa9},
-    {0x12fff5c, 0x12fffb9},
-    {0x130ff8f, 0x130ff72},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dff59},
-    {0x12eff3d, 0x12effd2},
-    {0x12fff0a, 0x12fff7d},
-    {0x130ff97, 0x130ff77},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dff9b},
-    {0x12eff51, 0x12efffb},
-    {0x12fffb8, 0x12fff41},
-    {0x130ff9e, 0x130ff7c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dffdd},
-    {0x12eff66, 0x12eff24},
-    {0x12fff66, 0x12fff06},
-    {0x130ffa6, 0x130ff81},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dff1f},
-    {0x12eff7a, 0x12eff4e},
-    {0x12fff14, 0x12fffca},
-    {0x130ffae, 0x130ff85},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dff61},
-    {0x12eff8f, 0x12eff77},
-    {0x12fffc2, 0x12fff8e},
-    {0x130ffb5, 0x130ff8a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dffa3},
-    {0x12effa3, 0x12effa0},
-    {0x12fff70, 0x12fff52},
-    {0x130ffbd, 0x130ff8f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dffe5},
-    {0x12effb8, 0x12effc9},
-    {0x12fff1e, 0x12fff16},
-    {0x130ffc5, 0x130ff94},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff27},
-    {0x12effcc, 0x12efff3},
-    {0x12fffcc, 0x12fffda},
-    {0x130ffcc, 0x130ff98},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dff69},
-    {0x12effe1, 0x12eff1c},
-    {0x12fff7a, 0x12fff9f},
-    {0x130ffd4, 0x130ff9d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dffab},
-    {0x12efff5, 0x12eff45},
-    {0x12fff28, 0x12fff63},
-    {0x130ffdc, 0x130ffa2},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dffed},
-    {0x12eff0a, 0x12eff6e},
-    {0x12fffd7, 0x12fff27},
-    {0x130ffe3, 0x130ffa7},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dff2f},
-    {0x12eff1e, 0x12eff98},
-    {0x12fff85, 0x12fffeb},
-    {0x130ffeb, 0x130ffab},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dff71},
-    {0x12eff33, 0x12effc1},
-    {0x12fff33, 0x12fffaf},
-    {0x130fff3, 0x130ffb0},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff22, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dffb3},
-    {0x12eff47, 0x12effea},
-    {0x12fffe1, 0x12fff73},
-    {0x130fffa, 0x130ffb5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dfff5},
-    {0x12eff5c, 0x12eff13},
-    {0x12fff8f, 0x12fff38},
-    {0x130ff02, 0x130ffba},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dff37},
-    {0x12eff70, 0x12eff3d},
-    {0x12fff3d, 0x12ffffc},
-    {0x130ff0a, 0x130ffbe},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dff79},
-    {0x12eff85, 0x12eff66},
-    {0x12fffeb, 0x12fffc0},
-    {0x130ff11, 0x130ffc3},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dffbb},
-    {0x12eff99, 0x12eff8f},
-    {0x12fff99, 0x12fff84},
-    {0x130ff19, 0x130ffc8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dfffd},
-    {0x12effae, 0x12effb8},
-    {0x12fff47, 0x12fff48},
-    {0x130ff21, 0x130ffcd},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dff3f},
-    {0x12effc2, 0x12effe2},
-    {0x12ffff5, 0x12fff0c},
-    {0x130ff28, 0x130ffd2},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dff81},
-    {0x12effd7, 0x12eff0b},
-    {0x12fffa3, 0x12fffd1},
-    {0x130ff30, 0x130ffd6},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dffc3},
-    {0x12effeb, 0x12eff34},
-    {0x12fff51, 0x12fff95},
-    {0x130ff38, 0x130ffdb},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff00, 0x12dff05},
-    {0x12eff00, 0x12eff5e},
-    {0x12fff00, 0x12fff59},
-    {0x130ff40, 0x130ffe0},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff7a, 0x12dff47},
-    {0x12eff14, 0x12eff87},
-    {0x12fffae, 0x12fff1d},
-    {0x130ff47, 0x130ffe5},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dfff5, 0x12dff89},
-    {0x12eff28, 0x12effb0},
-    {0x12fff5c, 0x12fffe1},
-    {0x130ff4f, 0x130ffe9},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff70, 0x12dffcb},
-    {0x12eff3d, 0x12effd9},
-    {0x12fff0a, 0x12fffa5},
-    {0x130ff57, 0x130ffee},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffeb, 0x12dff0d},
-    {0x12eff51, 0x12eff03},
-    {0x12fffb8, 0x12fff6a},
-    {0x130ff5e, 0x130fff3},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dff66, 0x12dff4f},
-    {0x12eff66, 0x12eff2c},
-    {0x12fff66, 0x12fff2e},
-    {0x130ff66, 0x130fff8},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff15},
-    {0x12cff08, 0x12cff10},
-    {0x12dffe1, 0x12dff91},
-    {0x12eff7a, 0x12eff55},
-    {0x12fff14, 0x12ffff2},
-    {0x130ff6e, 0x130fffc},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff5c, 0x12dffd3},
-    {0x12eff8f, 0x12eff7e},
-    {0x12fffc2, 0x12fffb6},
-    {0x130ff75, 0x130ff01},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffd7, 0x12dff15},
-    {0x12effa3, 0x12effa8},
-    {0x12fff70, 0x12fff7a},
-    {0x130ff7d, 0x130ff06},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff51, 0x12dff57},
-    {0x12effb8, 0x12effd1},
-    {0x12fff1e, 0x12fff3e},
-    {0x130ff85, 0x130ff0b},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffcc, 0x12dff99},
-    {0x12effcc, 0x12efffa},
-    {0x12fffcc, 0x12fff02},
-    {0x130ff8c, 0x130ff10},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff47, 0x12dffdb},
-    {0x12effe1, 0x12eff23},
-    {0x12fff7a, 0x12fffc7},
-    {0x130ff94, 0x130ff14},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffc2, 0x12dff1d},
-    {0x12efff5, 0x12eff4d},
-    {0x12fff28, 0x12fff8b},
-    {0x130ff9c, 0x130ff19},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff3d, 0x12dff5f},
-    {0x12eff0a, 0x12eff76},
-    {0x12fffd7, 0x12fff4f},
-    {0x130ffa3, 0x130ff1e},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffb8, 0x12dffa1},
-    {0x12eff1e, 0x12eff9f},
-    {0x12fff85, 0x12fff13},
-    {0x130ffab, 0x130ff23},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff33, 0x12dffe3},
-    {0x12eff33, 0x12effc8},
-    {0x12fff33, 0x12fffd7},
-    {0x130ffb3, 0x130ff27},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffae, 0x12dff25},
-    {0x12eff47, 0x12efff2},
-    {0x12fffe1, 0x12fff9b},
-    {0x130ffba, 0x130ff2c},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff28, 0x12dff67},
-    {0x12eff5c, 0x12eff1b},
-    {0x12fff8f, 0x12fff60},
-    {0x130ffc2, 0x130ff31},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dffa3, 0x12dffa9},
-    {0x12eff70, 0x12eff44},
-    {0x12fff3d, 0x12fff24},
-    {0x130ffca, 0x130ff36},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff1e, 0x12dffeb},
-    {0x12eff85, 0x12eff6d},
-    {0x12fffeb, 0x12fffe8},
-    {0x130ffd1, 0x130ff3a},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff99, 0x12dff2d},
-    {0x12eff99, 0x12eff97},
-    {0x12fff99, 0x12fffac},
-    {0x130ffd9, 0x130ff3f},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff14, 0x12dff70},
-    {0x12effae, 0x12effc0},
-    {0x12fff47, 0x12fff70},
-    {0x130ffe1, 0x130ff44},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff8f, 0x12dffb2},
-    {0x12effc2, 0x12effe9},
-    {0x12ffff5, 0x12fff34},
-    {0x130ffe8, 0x130ff49},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff0a, 0x12dfff4},
-    {0x12effd7, 0x12eff12},
-    {0x12fffa3, 0x12ffff9},
-    {0x130fff0, 0x130ff4d},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff23, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff85, 0x12dff36},
-    {0x12effeb, 0x12eff3c},
-    {0x12fff51, 0x12fffbd},
-    {0x130fff8, 0x130ff52},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} },
-
-  { {0x10fffff, 0x10fffff},
-    {0x110ff03, 0x110ff03},
-    {0x111ff10, 0x111ff10},
-    {0x12afce4, 0x12afce4},
-    {0x12bff24, 0x12bff16},
-    {0x12cff08, 0x12cff10},
-    {0x12dff01, 0x12dff78},
-    {0x12eff00, 0x12eff65},
-    {0x12fff00, 0x12fff81},
-    {0x130ff00, 0x130ff57},
-    {0x1337f0a, 0x1337f0a},
-    {0x1347c10, 0x1347c10},
-    {0x135ff03, 0x135ff03},
-    {0x1427f04, 0x1427f04} }
+const uint8_t scu8ia3d_DiffMifDat [QUCPU_INT_NUMFRQ] [QUCPU_INT_NUMREG] [QUCPU_INT_NUMRCK] = {
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0b}, {0x1e, 0x16}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x40}, {0x08, 0x18}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x46}, {0x30, 0x50}, {0x03, 0x03}, {0x00, 0x00} },
+  { {0x0f, 0x05}, {0x1e, 0x0a}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x0a}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x30}, {0x03, 0x03}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0a}, {0x1e, 0x14}, {0x30, 0x30}, {0x04, 0x04}, {0x1e, 0x10}, {0x08, 0x08}, {0x01, 0x01},
+    {0x00, 0x00}, {0x00, 0x00}, {0x00, 0x00}, {0x42, 0x4a}, {0x30, 0x40}, {0x03, 0x04}, {0x00, 0x00} },
+  { {0x0f, 0x0f}, {0x1e, 0x1e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x01, 0xe4},
+    {0x00, 0x29}, {0x00, 0x41}, {0x00, 0x9e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0f, 0x0f}, {0x1e, 0x1e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xcc, 0x78},
+    {0xcc, 0xc6}, {0xcc, 0xea}, {0x4c, 0xcd}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0f, 0x0f}, {0x1e, 0x1e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x99, 0x0c},
+    {0x99, 0x63}, {0x99, 0x94}, {0x99, 0xfd}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0f, 0x0f}, {0x1e, 0x1e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x66, 0xa0},
+    {0x66, 0xff}, {0x66, 0x3d}, {0xe6, 0x2d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0f, 0x0f}, {0x1e, 0x1e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x33, 0x34},
+    {0x33, 0x9c}, {0x33, 0xe7}, {0x33, 0x5c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0f, 0x0f}, {0x1e, 0x1e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x00, 0xc9},
+    {0x00, 0x38}, {0x00, 0x91}, {0x80, 0x8c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0f, 0x0f}, {0x1e, 0x1e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xcc, 0x5d},
+    {0xcc, 0xd5}, {0xcc, 0x3a}, {0xcc, 0xbc}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0f, 0x0f}, {0x1e, 0x1e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x99, 0xf1},
+    {0x99, 0x71}, {0x99, 0xe4}, {0x19, 0xeb}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0e, 0x0e}, {0x1c, 0x1c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xd7, 0xf4},
+    {0xa3, 0x73}, {0x70, 0x62}, {0x3d, 0xc4}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0e, 0x0e}, {0x1c, 0x1c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x51, 0xb1},
+    {0xb8, 0x9f}, {0x1e, 0xde}, {0x85, 0xf0}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0e, 0x0e}, {0x1c, 0x1c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0xcc, 0x6f},
+    {0xcc, 0xcb}, {0xcc, 0x5a}, {0xcc, 0x1d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0e, 0x0e}, {0x1c, 0x1c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x47, 0x2c},
+    {0xe1, 0xf7}, {0x7a, 0xd6}, {0x14, 0x49}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0e, 0x0e}, {0x1c, 0x1c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xc2, 0xea},
+    {0xf5, 0x22}, {0x28, 0x53}, {0x5c, 0x76}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0e, 0x0e}, {0x1c, 0x1c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x3d, 0xa7},
+    {0x0a, 0x4e}, {0xd7, 0xcf}, {0xa3, 0xa2}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0e, 0x0e}, {0x1c, 0x1c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xb8, 0x65},
+    {0x1e, 0x7a}, {0x85, 0x4b}, {0xeb, 0xcf}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0e, 0x0e}, {0x1c, 0x1c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x33, 0x22},
+    {0x33, 0xa6}, {0x33, 0xc7}, {0x33, 0xfb}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0d, 0x0d}, {0x1a, 0x1a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x8f, 0x99},
+    {0xc2, 0xb0}, {0xf5, 0xac}, {0x28, 0xb7}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0d, 0x0d}, {0x1a, 0x1a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xb8, 0x80},
+    {0x1e, 0x6b}, {0x85, 0xfb}, {0x6b, 0xe0}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0d, 0x0d}, {0x1a, 0x1a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0xe1, 0x67},
+    {0x7a, 0x26}, {0x14, 0x4a}, {0xae, 0x0a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0d, 0x0d}, {0x1a, 0x1a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x0a, 0x4e},
+    {0xd7, 0xe1}, {0xa3, 0x98}, {0xf0, 0x33}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0d, 0x0d}, {0x1a, 0x1a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x33, 0x34},
+    {0x33, 0x9c}, {0x33, 0xe7}, {0x33, 0x5c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0d, 0x0d}, {0x1a, 0x1a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x5c, 0x1b},
+    {0x8f, 0x57}, {0xc2, 0x36}, {0x75, 0x86}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0d, 0x0d}, {0x1a, 0x1a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x85, 0x02},
+    {0xeb, 0x12}, {0x51, 0x85}, {0xb8, 0xaf}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0d, 0x0d}, {0x1a, 0x1a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xae, 0xe9},
+    {0x47, 0xcc}, {0xe1, 0xd3}, {0xfa, 0xd8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0d, 0x0d}, {0x1a, 0x1a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xd7, 0xd0},
+    {0xa3, 0x87}, {0x70, 0x22}, {0x3d, 0x02}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0c, 0x0c}, {0x18, 0x18}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x01, 0xe4},
+    {0x00, 0x29}, {0x00, 0x41}, {0x00, 0x9e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0c, 0x0c}, {0x18, 0x18}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xd7, 0xf4},
+    {0xa3, 0x73}, {0x70, 0x62}, {0x3d, 0xc4}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0c, 0x0c}, {0x18, 0x18}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xae, 0x04},
+    {0x47, 0xbe}, {0xe1, 0x83}, {0x7a, 0xea}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0c, 0x0c}, {0x18, 0x18}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x85, 0x14},
+    {0xeb, 0x08}, {0x51, 0xa5}, {0xb8, 0x10}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0c, 0x0c}, {0x18, 0x18}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x5c, 0x24},
+    {0x8f, 0x52}, {0xc2, 0xc6}, {0xf5, 0x36}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0c, 0x0c}, {0x18, 0x18}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x33, 0x34},
+    {0x33, 0x9c}, {0x33, 0xe7}, {0x33, 0x5c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0c, 0x0c}, {0x18, 0x18}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x0a, 0x45},
+    {0xd7, 0xe6}, {0xa3, 0x08}, {0x70, 0x83}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0c, 0x0c}, {0x18, 0x18}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xe1, 0x55},
+    {0x7a, 0x30}, {0x14, 0x2a}, {0xae, 0xa9}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0c, 0x0c}, {0x18, 0x18}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xb8, 0x65},
+    {0x1e, 0x7a}, {0x85, 0x4b}, {0xeb, 0xcf}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0c, 0x0c}, {0x18, 0x18}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x8f, 0x75},
+    {0xc2, 0xc4}, {0xf5, 0x6c}, {0x28, 0xf5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0c, 0x0c}, {0x18, 0x18}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x66, 0x85},
+    {0x66, 0x0e}, {0x66, 0x8e}, {0x66, 0x1b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0c, 0x0c}, {0x18, 0x18}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x3d, 0x95},
+    {0x0a, 0x58}, {0xd7, 0xaf}, {0xa3, 0x41}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0b, 0x0b}, {0x16, 0x16}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x3d, 0xc2},
+    {0x0a, 0x3f}, {0xd7, 0x7f}, {0x23, 0xb4}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0b, 0x0b}, {0x16, 0x16}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xc2, 0xfc},
+    {0xf5, 0x18}, {0x28, 0x73}, {0x5c, 0xd7}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0b, 0x0b}, {0x16, 0x16}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x47, 0x35},
+    {0xe1, 0xf2}, {0x7a, 0x66}, {0x94, 0xfa}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0b, 0x0b}, {0x16, 0x16}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0xcc, 0x6f},
+    {0xcc, 0xcb}, {0xcc, 0x5a}, {0xcc, 0x1d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0b, 0x0b}, {0x16, 0x16}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x51, 0xa8},
+    {0xb8, 0xa4}, {0x1e, 0x4e}, {0x05, 0x40}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0b, 0x0b}, {0x16, 0x16}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xd7, 0xe2},
+    {0xa3, 0x7d}, {0x70, 0x42}, {0x3d, 0x63}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0b, 0x0b}, {0x16, 0x16}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x5c, 0x1b},
+    {0x8f, 0x57}, {0xc2, 0x36}, {0x75, 0x86}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0b, 0x0b}, {0x16, 0x16}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xe1, 0x55},
+    {0x7a, 0x30}, {0x14, 0x2a}, {0xae, 0xa9}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0b, 0x0b}, {0x16, 0x16}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x66, 0x8e},
+    {0x66, 0x09}, {0x66, 0x1e}, {0xe6, 0xcc}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0b, 0x0b}, {0x16, 0x16}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0xeb, 0xc8},
+    {0x51, 0xe2}, {0xb8, 0x11}, {0x1e, 0xef}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0b, 0x0b}, {0x16, 0x16}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x70, 0x01},
+    {0x3d, 0xbc}, {0x0a, 0x05}, {0x57, 0x12}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0b, 0x0b}, {0x16, 0x16}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xf5, 0x3b},
+    {0x28, 0x95}, {0x5c, 0xf9}, {0x8f, 0x34}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0b, 0x0b}, {0x16, 0x16}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x7a, 0x74},
+    {0x14, 0x6e}, {0xae, 0xed}, {0xc7, 0x57}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0a, 0x0a}, {0x14, 0x14}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x01, 0xe4},
+    {0x00, 0x29}, {0x00, 0x41}, {0x00, 0x9e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0a, 0x0a}, {0x14, 0x14}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x33, 0x46},
+    {0x33, 0x92}, {0x33, 0x07}, {0x33, 0xbe}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0a, 0x0a}, {0x14, 0x14}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x66, 0xa9},
+    {0x66, 0xfa}, {0x66, 0xcd}, {0x66, 0xdd}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0a, 0x0a}, {0x14, 0x14}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x99, 0x0c},
+    {0x99, 0x63}, {0x99, 0x94}, {0x99, 0xfd}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0a, 0x0a}, {0x14, 0x14}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0xcc, 0x6f},
+    {0xcc, 0xcb}, {0xcc, 0x5a}, {0xcc, 0x1d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0a, 0x0a}, {0x14, 0x14}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x01, 0xd2},
+    {0x00, 0x33}, {0x00, 0x21}, {0x00, 0x3d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0a, 0x0a}, {0x14, 0x14}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x33, 0x34},
+    {0x33, 0x9c}, {0x33, 0xe7}, {0x33, 0x5c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0a, 0x0a}, {0x14, 0x14}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x66, 0x97},
+    {0x66, 0x04}, {0x66, 0xae}, {0x66, 0x7c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0a, 0x0a}, {0x14, 0x14}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x99, 0xfa},
+    {0x99, 0x6c}, {0x99, 0x74}, {0x99, 0x9c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0a, 0x0a}, {0x14, 0x14}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xcc, 0x5d},
+    {0xcc, 0xd5}, {0xcc, 0x3a}, {0xcc, 0xbc}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0a, 0x0a}, {0x14, 0x14}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x01, 0xc0},
+    {0x00, 0x3d}, {0x00, 0x01}, {0x00, 0xdc}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0a, 0x0a}, {0x14, 0x14}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x33, 0x22},
+    {0x33, 0xa6}, {0x33, 0xc7}, {0x33, 0xfb}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0a, 0x0a}, {0x14, 0x14}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x66, 0x85},
+    {0x66, 0x0e}, {0x66, 0x8e}, {0x66, 0x1b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0a, 0x0a}, {0x14, 0x14}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x99, 0xe8},
+    {0x99, 0x76}, {0x99, 0x54}, {0x99, 0x3b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0a, 0x0a}, {0x14, 0x14}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xcc, 0x4b},
+    {0xcc, 0xdf}, {0xcc, 0x1a}, {0xcc, 0x5b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0a, 0x0a}, {0x14, 0x14}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x01, 0xae},
+    {0x00, 0x47}, {0x00, 0xe1}, {0x00, 0x7a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x0a, 0x0a}, {0x14, 0x14}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x33, 0x10},
+    {0x33, 0xb0}, {0x33, 0xa7}, {0x33, 0x9a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x09, 0x09}, {0x12, 0x12}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xf5, 0x68},
+    {0x28, 0x7c}, {0x5c, 0xc9}, {0x0f, 0xa7}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x09, 0x09}, {0x12, 0x12}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xd7, 0xf4},
+    {0xa3, 0x73}, {0x70, 0x62}, {0x3d, 0xc4}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x09, 0x09}, {0x12, 0x12}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xb8, 0x80},
+    {0x1e, 0x6b}, {0x85, 0xfb}, {0x6b, 0xe0}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x09, 0x09}, {0x12, 0x12}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x99, 0x0c},
+    {0x99, 0x63}, {0x99, 0x94}, {0x99, 0xfd}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x09, 0x09}, {0x12, 0x12}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x7a, 0x98},
+    {0x14, 0x5a}, {0xae, 0x2d}, {0xc7, 0x1a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x09, 0x09}, {0x12, 0x12}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x5c, 0x24},
+    {0x8f, 0x52}, {0xc2, 0xc6}, {0xf5, 0x36}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x09, 0x09}, {0x12, 0x12}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x3d, 0xb0},
+    {0x0a, 0x49}, {0xd7, 0x5f}, {0x23, 0x53}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x09, 0x09}, {0x12, 0x12}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x1e, 0x3c},
+    {0x85, 0x41}, {0xeb, 0xf8}, {0x51, 0x6f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x09, 0x09}, {0x12, 0x12}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x00, 0xc9},
+    {0x00, 0x38}, {0x00, 0x91}, {0x80, 0x8c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x09, 0x09}, {0x12, 0x12}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xe1, 0x55},
+    {0x7a, 0x30}, {0x14, 0x2a}, {0xae, 0xa9}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x09, 0x09}, {0x12, 0x12}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xc2, 0xe1},
+    {0xf5, 0x27}, {0x28, 0xc3}, {0xdc, 0xc5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x09, 0x09}, {0x12, 0x12}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0xa3, 0x6d},
+    {0x70, 0x1f}, {0x3d, 0x5c}, {0x0a, 0xe2}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x09, 0x09}, {0x12, 0x12}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x85, 0xf9},
+    {0xeb, 0x16}, {0x51, 0xf5}, {0x38, 0xfe}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x09, 0x09}, {0x12, 0x12}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x66, 0x85},
+    {0x66, 0x0e}, {0x66, 0x8e}, {0x66, 0x1b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x09, 0x09}, {0x12, 0x12}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x47, 0x11},
+    {0xe1, 0x06}, {0x7a, 0x27}, {0x94, 0x38}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x09, 0x09}, {0x12, 0x12}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x28, 0x9d},
+    {0x5c, 0xfd}, {0x8f, 0xbf}, {0xc2, 0x54}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x09, 0x09}, {0x12, 0x12}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x0a, 0x2a},
+    {0xd7, 0xf5}, {0xa3, 0x58}, {0xf0, 0x71}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x09, 0x09}, {0x12, 0x12}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xeb, 0xb6},
+    {0x51, 0xec}, {0xb8, 0xf1}, {0x1e, 0x8d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x09, 0x09}, {0x12, 0x12}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xcc, 0x42},
+    {0xcc, 0xe4}, {0xcc, 0x8a}, {0x4c, 0xaa}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x09, 0x09}, {0x12, 0x12}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xae, 0xce},
+    {0x47, 0xdb}, {0xe1, 0x23}, {0x7a, 0xc7}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x09, 0x09}, {0x12, 0x12}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x8f, 0x5a},
+    {0xc2, 0xd3}, {0xf5, 0xbc}, {0xa8, 0xe3}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x08, 0x08}, {0x10, 0x10}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x47, 0x3e},
+    {0xe1, 0xed}, {0x7a, 0xf6}, {0x14, 0xaa}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x08, 0x08}, {0x10, 0x10}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xd7, 0xf4},
+    {0xa3, 0x73}, {0x70, 0x62}, {0x3d, 0xc4}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x08, 0x08}, {0x10, 0x10}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x66, 0xa9},
+    {0x66, 0xfa}, {0x66, 0xcd}, {0x66, 0xdd}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x08, 0x08}, {0x10, 0x10}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xf5, 0x5f},
+    {0x28, 0x81}, {0x5c, 0x39}, {0x8f, 0xf7}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x08, 0x08}, {0x10, 0x10}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x85, 0x14},
+    {0xeb, 0x08}, {0x51, 0xa5}, {0xb8, 0x10}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x08, 0x08}, {0x10, 0x10}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x14, 0xc9},
+    {0xae, 0x8e}, {0x47, 0x10}, {0xe1, 0x2a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x08, 0x08}, {0x10, 0x10}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xa3, 0x7f},
+    {0x70, 0x15}, {0x3d, 0x7c}, {0x0a, 0x43}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x08, 0x08}, {0x10, 0x10}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x33, 0x34},
+    {0x33, 0x9c}, {0x33, 0xe7}, {0x33, 0x5c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x08, 0x08}, {0x10, 0x10}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xc2, 0xea},
+    {0xf5, 0x22}, {0x28, 0x53}, {0x5c, 0x76}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x08, 0x08}, {0x10, 0x10}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x51, 0x9f},
+    {0xb8, 0xa9}, {0x1e, 0xbe}, {0x85, 0x8f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x08, 0x08}, {0x10, 0x10}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xe1, 0x55},
+    {0x7a, 0x30}, {0x14, 0x2a}, {0xae, 0xa9}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x08, 0x08}, {0x10, 0x10}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x70, 0x0a},
+    {0x3d, 0xb7}, {0x0a, 0x95}, {0xd7, 0xc2}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x08, 0x08}, {0x10, 0x10}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x01, 0xc0},
+    {0x00, 0x3d}, {0x00, 0x01}, {0x00, 0xdc}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x08, 0x08}, {0x10, 0x10}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x8f, 0x75},
+    {0xc2, 0xc4}, {0xf5, 0x6c}, {0x28, 0xf5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x08, 0x08}, {0x10, 0x10}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x1e, 0x2a},
+    {0x85, 0x4b}, {0xeb, 0xd8}, {0x51, 0x0e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x08, 0x08}, {0x10, 0x10}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xae, 0xe0},
+    {0x47, 0xd1}, {0xe1, 0x43}, {0x7a, 0x28}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x08, 0x08}, {0x10, 0x10}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x3d, 0x95},
+    {0x0a, 0x58}, {0xd7, 0xaf}, {0xa3, 0x41}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x08, 0x08}, {0x10, 0x10}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xcc, 0x4b},
+    {0xcc, 0xdf}, {0xcc, 0x1a}, {0xcc, 0x5b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x08, 0x08}, {0x10, 0x10}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x5c, 0x00},
+    {0x8f, 0x66}, {0xc2, 0x86}, {0xf5, 0x74}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x08, 0x08}, {0x10, 0x10}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xeb, 0xb6},
+    {0x51, 0xec}, {0xb8, 0xf1}, {0x1e, 0x8d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x08, 0x08}, {0x10, 0x10}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x7a, 0x6b},
+    {0x14, 0x73}, {0xae, 0x5d}, {0x47, 0xa7}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x08, 0x08}, {0x10, 0x10}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x0a, 0x21},
+    {0xd7, 0xfa}, {0xa3, 0xc8}, {0x70, 0xc0}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x08, 0x08}, {0x10, 0x10}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x99, 0xd6},
+    {0x99, 0x80}, {0x99, 0x34}, {0x99, 0xda}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x08, 0x08}, {0x10, 0x10}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x28, 0x8b},
+    {0x5c, 0x07}, {0x8f, 0xa0}, {0xc2, 0xf3}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x08, 0x08}, {0x10, 0x10}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x15}, {0x08, 0x10}, {0xb8, 0x41},
+    {0x1e, 0x8e}, {0x85, 0x0b}, {0xeb, 0x0d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x08, 0x08}, {0x10, 0x10}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x47, 0xf6},
+    {0xe1, 0x14}, {0x7a, 0x77}, {0x14, 0x26}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x08, 0x08}, {0x10, 0x10}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xd7, 0xac},
+    {0xa3, 0x9b}, {0x70, 0xe2}, {0x3d, 0x3f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x99, 0x15},
+    {0x99, 0x5e}, {0x99, 0x24}, {0x19, 0xae}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xd7, 0xf4},
+    {0xa3, 0x73}, {0x70, 0x62}, {0x3d, 0xc4}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x14, 0xd2},
+    {0xae, 0x89}, {0x47, 0xa0}, {0x61, 0xda}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x51, 0xb1},
+    {0xb8, 0x9f}, {0x1e, 0xde}, {0x85, 0xf0}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x8f, 0x90},
+    {0xc2, 0xb5}, {0xf5, 0x1c}, {0xa8, 0x07}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0xcc, 0x6f},
+    {0xcc, 0xcb}, {0xcc, 0x5a}, {0xcc, 0x1d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x0a, 0x4e},
+    {0xd7, 0xe1}, {0xa3, 0x98}, {0xf0, 0x33}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x47, 0x2c},
+    {0xe1, 0xf7}, {0x7a, 0xd6}, {0x14, 0x49}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x85, 0x0b},
+    {0xeb, 0x0d}, {0x51, 0x15}, {0x38, 0x60}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xc2, 0xea},
+    {0xf5, 0x22}, {0x28, 0x53}, {0x5c, 0x76}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x00, 0xc9},
+    {0x00, 0x38}, {0x00, 0x91}, {0x80, 0x8c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x3d, 0xa7},
+    {0x0a, 0x4e}, {0xd7, 0xcf}, {0xa3, 0xa2}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x7a, 0x86},
+    {0x14, 0x64}, {0xae, 0x0d}, {0xc7, 0xb9}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xb8, 0x65},
+    {0x1e, 0x7a}, {0x85, 0x4b}, {0xeb, 0xcf}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0xf5, 0x44},
+    {0x28, 0x90}, {0x5c, 0x89}, {0x0f, 0xe5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x33, 0x22},
+    {0x33, 0xa6}, {0x33, 0xc7}, {0x33, 0xfb}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x70, 0x01},
+    {0x3d, 0xbc}, {0x0a, 0x05}, {0x57, 0x12}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xae, 0xe0},
+    {0x47, 0xd1}, {0xe1, 0x43}, {0x7a, 0x28}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xeb, 0xbf},
+    {0x51, 0xe7}, {0xb8, 0x81}, {0x9e, 0x3e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x28, 0x9d},
+    {0x5c, 0xfd}, {0x8f, 0xbf}, {0xc2, 0x54}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x66, 0x7c},
+    {0x66, 0x13}, {0x66, 0xfe}, {0xe6, 0x6a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xa3, 0x5b},
+    {0x70, 0x29}, {0x3d, 0x3c}, {0x0a, 0x81}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xe1, 0x3a},
+    {0x7a, 0x3f}, {0x14, 0x7a}, {0x2e, 0x97}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x1e, 0x18},
+    {0x85, 0x55}, {0xeb, 0xb8}, {0x51, 0xad}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x5c, 0xf7},
+    {0x8f, 0x6a}, {0xc2, 0xf6}, {0x75, 0xc3}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x99, 0xd6},
+    {0x99, 0x80}, {0x99, 0x34}, {0x99, 0xda}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xd7, 0xb5},
+    {0xa3, 0x96}, {0x70, 0x72}, {0xbd, 0xf0}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x15}, {0x08, 0x10}, {0x14, 0x94},
+    {0xae, 0xac}, {0x47, 0xb0}, {0xe1, 0x06}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x51, 0x72},
+    {0xb8, 0xc2}, {0x1e, 0xee}, {0x05, 0x1c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x8f, 0x51},
+    {0xc2, 0xd8}, {0xf5, 0x2c}, {0x28, 0x33}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xcc, 0x30},
+    {0xcc, 0xee}, {0xcc, 0x6a}, {0x4c, 0x49}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x0a, 0x0f},
+    {0xd7, 0x04}, {0xa3, 0xa9}, {0x70, 0x5f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x47, 0xed},
+    {0xe1, 0x19}, {0x7a, 0xe7}, {0x94, 0x75}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x85, 0xcc},
+    {0xeb, 0x2f}, {0x51, 0x25}, {0xb8, 0x8c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x07, 0x07}, {0x0e, 0x0e}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xc2, 0xab},
+    {0xf5, 0x45}, {0x28, 0x63}, {0xdc, 0xa2}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x01, 0xe4},
+    {0x00, 0x29}, {0x00, 0x41}, {0x00, 0x9e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xeb, 0xec},
+    {0x51, 0xce}, {0xb8, 0x51}, {0x1e, 0xb1}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xd7, 0xf4},
+    {0xa3, 0x73}, {0x70, 0x62}, {0x3d, 0xc4}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xc2, 0xfc},
+    {0xf5, 0x18}, {0x28, 0x73}, {0x5c, 0xd7}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xae, 0x04},
+    {0x47, 0xbe}, {0xe1, 0x83}, {0x7a, 0xea}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x99, 0x0c},
+    {0x99, 0x63}, {0x99, 0x94}, {0x99, 0xfd}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x85, 0x14},
+    {0xeb, 0x08}, {0x51, 0xa5}, {0xb8, 0x10}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x70, 0x1c},
+    {0x3d, 0xad}, {0x0a, 0xb5}, {0xd7, 0x23}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x5c, 0x24},
+    {0x8f, 0x52}, {0xc2, 0xc6}, {0xf5, 0x36}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x47, 0x2c},
+    {0xe1, 0xf7}, {0x7a, 0xd6}, {0x14, 0x49}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x33, 0x34},
+    {0x33, 0x9c}, {0x33, 0xe7}, {0x33, 0x5c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x1e, 0x3c},
+    {0x85, 0x41}, {0xeb, 0xf8}, {0x51, 0x6f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x0a, 0x45},
+    {0xd7, 0xe6}, {0xa3, 0x08}, {0x70, 0x83}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xf5, 0x4d},
+    {0x28, 0x8b}, {0x5c, 0x19}, {0x8f, 0x96}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xe1, 0x55},
+    {0x7a, 0x30}, {0x14, 0x2a}, {0xae, 0xa9}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xcc, 0x5d},
+    {0xcc, 0xd5}, {0xcc, 0x3a}, {0xcc, 0xbc}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xb8, 0x65},
+    {0x1e, 0x7a}, {0x85, 0x4b}, {0xeb, 0xcf}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0xa3, 0x6d},
+    {0x70, 0x1f}, {0x3d, 0x5c}, {0x0a, 0xe2}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x8f, 0x75},
+    {0xc2, 0xc4}, {0xf5, 0x6c}, {0x28, 0xf5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x7a, 0x7d},
+    {0x14, 0x69}, {0xae, 0x7d}, {0x47, 0x08}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x66, 0x85},
+    {0x66, 0x0e}, {0x66, 0x8e}, {0x66, 0x1b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x51, 0x8d},
+    {0xb8, 0xb3}, {0x1e, 0x9e}, {0x85, 0x2e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x3d, 0x95},
+    {0x0a, 0x58}, {0xd7, 0xaf}, {0xa3, 0x41}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x28, 0x9d},
+    {0x5c, 0xfd}, {0x8f, 0xbf}, {0xc2, 0x54}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x14, 0xa5},
+    {0xae, 0xa2}, {0x47, 0xd0}, {0xe1, 0x67}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x01, 0xae},
+    {0x00, 0x47}, {0x00, 0xe1}, {0x00, 0x7a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xeb, 0xb6},
+    {0x51, 0xec}, {0xb8, 0xf1}, {0x1e, 0x8d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xd7, 0xbe},
+    {0xa3, 0x91}, {0x70, 0x02}, {0x3d, 0xa1}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xc2, 0xc6},
+    {0xf5, 0x36}, {0x28, 0x13}, {0x5c, 0xb4}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xae, 0xce},
+    {0x47, 0xdb}, {0xe1, 0x23}, {0x7a, 0xc7}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x99, 0xd6},
+    {0x99, 0x80}, {0x99, 0x34}, {0x99, 0xda}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x85, 0xde},
+    {0xeb, 0x25}, {0x51, 0x45}, {0xb8, 0xed}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x15}, {0x08, 0x10}, {0x70, 0xe6},
+    {0x3d, 0xca}, {0x0a, 0x55}, {0xd7, 0x00}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x15}, {0x08, 0x10}, {0x5c, 0xee},
+    {0x8f, 0x6f}, {0xc2, 0x66}, {0xf5, 0x13}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x47, 0xf6},
+    {0xe1, 0x14}, {0x7a, 0x77}, {0x14, 0x26}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x33, 0xfe},
+    {0x33, 0xb9}, {0x33, 0x87}, {0x33, 0x39}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x1e, 0x06},
+    {0x85, 0x5f}, {0xeb, 0x98}, {0x51, 0x4c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x0a, 0x0f},
+    {0xd7, 0x04}, {0xa3, 0xa9}, {0x70, 0x5f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xf5, 0x17},
+    {0x28, 0xa9}, {0x5c, 0xb9}, {0x8f, 0x72}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xe1, 0x1f},
+    {0x7a, 0x4e}, {0x14, 0xca}, {0xae, 0x85}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xcc, 0x27},
+    {0xcc, 0xf3}, {0xcc, 0xda}, {0xcc, 0x98}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xb8, 0x2f},
+    {0x1e, 0x98}, {0x85, 0xeb}, {0xeb, 0xab}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0xa3, 0x37},
+    {0x70, 0x3d}, {0x3d, 0xfc}, {0x0a, 0xbe}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x8f, 0x3f},
+    {0xc2, 0xe2}, {0xf5, 0x0c}, {0x28, 0xd2}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x7a, 0x47},
+    {0x14, 0x87}, {0xae, 0x1d}, {0x47, 0xe5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x66, 0x4f},
+    {0x66, 0x2c}, {0x66, 0x2e}, {0x66, 0xf8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x51, 0x57},
+    {0xb8, 0xd1}, {0x1e, 0x3e}, {0x85, 0x0b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x3d, 0x5f},
+    {0x0a, 0x76}, {0xd7, 0x4f}, {0xa3, 0x1e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x28, 0x67},
+    {0x5c, 0x1b}, {0x8f, 0x60}, {0xc2, 0x31}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x06, 0x06}, {0x0c, 0x0c}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x14, 0x70},
+    {0xae, 0xc0}, {0x47, 0x70}, {0xe1, 0x44}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x01, 0xe4},
+    {0x00, 0x29}, {0x00, 0x41}, {0x00, 0x9e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x99, 0x15},
+    {0x99, 0x5e}, {0x99, 0x24}, {0x19, 0xae}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x33, 0x46},
+    {0x33, 0x92}, {0x33, 0x07}, {0x33, 0xbe}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xcc, 0x78},
+    {0xcc, 0xc6}, {0xcc, 0xea}, {0x4c, 0xcd}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x66, 0xa9},
+    {0x66, 0xfa}, {0x66, 0xcd}, {0x66, 0xdd}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x00, 0xdb},
+    {0x00, 0x2e}, {0x00, 0xb1}, {0x80, 0xed}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x99, 0x0c},
+    {0x99, 0x63}, {0x99, 0x94}, {0x99, 0xfd}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x33, 0x3d},
+    {0x33, 0x97}, {0x33, 0x77}, {0xb3, 0x0d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0xcc, 0x6f},
+    {0xcc, 0xcb}, {0xcc, 0x5a}, {0xcc, 0x1d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x66, 0xa0},
+    {0x66, 0xff}, {0x66, 0x3d}, {0xe6, 0x2d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x01, 0xd2},
+    {0x00, 0x33}, {0x00, 0x21}, {0x00, 0x3d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x99, 0x03},
+    {0x99, 0x68}, {0x99, 0x04}, {0x19, 0x4d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x33, 0x34},
+    {0x33, 0x9c}, {0x33, 0xe7}, {0x33, 0x5c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xcc, 0x66},
+    {0xcc, 0xd0}, {0xcc, 0xca}, {0x4c, 0x6c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x66, 0x97},
+    {0x66, 0x04}, {0x66, 0xae}, {0x66, 0x7c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x00, 0xc9},
+    {0x00, 0x38}, {0x00, 0x91}, {0x80, 0x8c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x99, 0xfa},
+    {0x99, 0x6c}, {0x99, 0x74}, {0x99, 0x9c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x33, 0x2b},
+    {0x33, 0xa1}, {0x33, 0x57}, {0xb3, 0xac}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xcc, 0x5d},
+    {0xcc, 0xd5}, {0xcc, 0x3a}, {0xcc, 0xbc}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x66, 0x8e},
+    {0x66, 0x09}, {0x66, 0x1e}, {0xe6, 0xcc}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x01, 0xc0},
+    {0x00, 0x3d}, {0x00, 0x01}, {0x00, 0xdc}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x99, 0xf1},
+    {0x99, 0x71}, {0x99, 0xe4}, {0x19, 0xeb}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x33, 0x22},
+    {0x33, 0xa6}, {0x33, 0xc7}, {0x33, 0xfb}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xcc, 0x54},
+    {0xcc, 0xda}, {0xcc, 0xaa}, {0x4c, 0x0b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x66, 0x85},
+    {0x66, 0x0e}, {0x66, 0x8e}, {0x66, 0x1b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x00, 0xb7},
+    {0x00, 0x42}, {0x00, 0x71}, {0x80, 0x2b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x99, 0xe8},
+    {0x99, 0x76}, {0x99, 0x54}, {0x99, 0x3b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x33, 0x19},
+    {0x33, 0xab}, {0x33, 0x37}, {0xb3, 0x4b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xcc, 0x4b},
+    {0xcc, 0xdf}, {0xcc, 0x1a}, {0xcc, 0x5b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x66, 0x7c},
+    {0x66, 0x13}, {0x66, 0xfe}, {0xe6, 0x6a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x01, 0xae},
+    {0x00, 0x47}, {0x00, 0xe1}, {0x00, 0x7a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x99, 0xdf},
+    {0x99, 0x7b}, {0x99, 0xc4}, {0x19, 0x8a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x33, 0x10},
+    {0x33, 0xb0}, {0x33, 0xa7}, {0x33, 0x9a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xcc, 0x42},
+    {0xcc, 0xe4}, {0xcc, 0x8a}, {0x4c, 0xaa}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x66, 0x73},
+    {0x66, 0x18}, {0x66, 0x6e}, {0x66, 0xba}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x00, 0xa5},
+    {0x00, 0x4c}, {0x00, 0x51}, {0x80, 0xca}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x99, 0xd6},
+    {0x99, 0x80}, {0x99, 0x34}, {0x99, 0xda}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x33, 0x07},
+    {0x33, 0xb5}, {0x33, 0x17}, {0xb3, 0xea}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xcc, 0x39},
+    {0xcc, 0xe9}, {0xcc, 0xfa}, {0xcc, 0xf9}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x15}, {0x08, 0x10}, {0x66, 0x6a},
+    {0x66, 0x1d}, {0x66, 0xde}, {0xe6, 0x09}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x01, 0x9c},
+    {0x00, 0x51}, {0x00, 0xc1}, {0x00, 0x19}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x99, 0xcd},
+    {0x99, 0x85}, {0x99, 0xa4}, {0x19, 0x29}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x33, 0xfe},
+    {0x33, 0xb9}, {0x33, 0x87}, {0x33, 0x39}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xcc, 0x30},
+    {0xcc, 0xee}, {0xcc, 0x6a}, {0x4c, 0x49}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x66, 0x61},
+    {0x66, 0x22}, {0x66, 0x4e}, {0x66, 0x59}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x00, 0x93},
+    {0x00, 0x56}, {0x00, 0x31}, {0x80, 0x69}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x99, 0xc4},
+    {0x99, 0x8a}, {0x99, 0x14}, {0x99, 0x79}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x33, 0xf5},
+    {0x33, 0xbe}, {0x33, 0xf7}, {0xb3, 0x88}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xcc, 0x27},
+    {0xcc, 0xf3}, {0xcc, 0xda}, {0xcc, 0x98}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x66, 0x58},
+    {0x66, 0x27}, {0x66, 0xbe}, {0xe6, 0xa8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x01, 0x8a},
+    {0x00, 0x5b}, {0x00, 0xa1}, {0x00, 0xb8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x99, 0xbb},
+    {0x99, 0x8f}, {0x99, 0x84}, {0x19, 0xc8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x33, 0xec},
+    {0x33, 0xc3}, {0x33, 0x67}, {0x33, 0xd8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0xcc, 0x1e},
+    {0xcc, 0xf8}, {0xcc, 0x4a}, {0x4c, 0xe8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x66, 0x4f},
+    {0x66, 0x2c}, {0x66, 0x2e}, {0x66, 0xf8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x00, 0x81},
+    {0x00, 0x60}, {0x00, 0x11}, {0x80, 0x08}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x99, 0xb2},
+    {0x99, 0x94}, {0x99, 0xf4}, {0x99, 0x17}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x33, 0xe3},
+    {0x33, 0xc8}, {0x33, 0xd7}, {0xb3, 0x27}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0xcc, 0x15},
+    {0xcc, 0xfd}, {0xcc, 0xba}, {0xcc, 0x37}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x66, 0x46},
+    {0x66, 0x31}, {0x66, 0x9e}, {0xe6, 0x47}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x01, 0x78},
+    {0x00, 0x65}, {0x00, 0x81}, {0x00, 0x57}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x99, 0xa9},
+    {0x99, 0x99}, {0x99, 0x64}, {0x19, 0x67}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x33, 0xda},
+    {0x33, 0xcd}, {0x33, 0x47}, {0x33, 0x77}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0xcc, 0x0c},
+    {0xcc, 0x02}, {0xcc, 0x2b}, {0x4c, 0x87}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x66, 0x3d},
+    {0x66, 0x36}, {0x66, 0x0e}, {0x66, 0x97}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x00, 0x6f},
+    {0x00, 0x6a}, {0x00, 0xf1}, {0x80, 0xa6}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x99, 0xa0},
+    {0x99, 0x9e}, {0x99, 0xd4}, {0x99, 0xb6}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x33, 0xd1},
+    {0x33, 0xd2}, {0x33, 0xb7}, {0xb3, 0xc6}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0xcc, 0x03},
+    {0xcc, 0x07}, {0xcc, 0x9b}, {0xcc, 0xd6}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x66, 0x34},
+    {0x66, 0x3b}, {0x66, 0x7e}, {0xe6, 0xe6}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x25, 0x16}, {0x08, 0x10}, {0x01, 0x66},
+    {0x00, 0x6f}, {0x00, 0x61}, {0x00, 0xf6}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x99, 0x97},
+    {0x99, 0xa3}, {0x99, 0x44}, {0x19, 0x06}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x33, 0xc8},
+    {0x33, 0xd7}, {0x33, 0x27}, {0x33, 0x16}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0xcc, 0xfa},
+    {0xcc, 0x0b}, {0xcc, 0x0b}, {0x4c, 0x26}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x05, 0x05}, {0x0a, 0x0a}, {0x30, 0x30}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x66, 0x2b},
+    {0x66, 0x40}, {0x66, 0xee}, {0x66, 0x35}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x01, 0xe4},
+    {0x00, 0x29}, {0x00, 0x41}, {0x00, 0x9e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x47, 0x3e},
+    {0xe1, 0xed}, {0x7a, 0xf6}, {0x14, 0xaa}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x8f, 0x99},
+    {0xc2, 0xb0}, {0xf5, 0xac}, {0x28, 0xb7}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xd7, 0xf4},
+    {0xa3, 0x73}, {0x70, 0x62}, {0x3d, 0xc4}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x1e, 0x4e},
+    {0x85, 0x37}, {0xeb, 0x18}, {0x51, 0xd1}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x66, 0xa9},
+    {0x66, 0xfa}, {0x66, 0xcd}, {0x66, 0xdd}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xae, 0x04},
+    {0x47, 0xbe}, {0xe1, 0x83}, {0x7a, 0xea}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xf5, 0x5f},
+    {0x28, 0x81}, {0x5c, 0x39}, {0x8f, 0xf7}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x3d, 0xb9},
+    {0x0a, 0x44}, {0xd7, 0xef}, {0xa3, 0x03}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x85, 0x14},
+    {0xeb, 0x08}, {0x51, 0xa5}, {0xb8, 0x10}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0xcc, 0x6f},
+    {0xcc, 0xcb}, {0xcc, 0x5a}, {0xcc, 0x1d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x14, 0xc9},
+    {0xae, 0x8e}, {0x47, 0x10}, {0xe1, 0x2a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x5c, 0x24},
+    {0x8f, 0x52}, {0xc2, 0xc6}, {0xf5, 0x36}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xa3, 0x7f},
+    {0x70, 0x15}, {0x3d, 0x7c}, {0x0a, 0x43}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xeb, 0xda},
+    {0x51, 0xd8}, {0xb8, 0x31}, {0x1e, 0x50}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x33, 0x34},
+    {0x33, 0x9c}, {0x33, 0xe7}, {0x33, 0x5c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x7a, 0x8f},
+    {0x14, 0x5f}, {0xae, 0x9d}, {0x47, 0x69}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xc2, 0xea},
+    {0xf5, 0x22}, {0x28, 0x53}, {0x5c, 0x76}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x0a, 0x45},
+    {0xd7, 0xe6}, {0xa3, 0x08}, {0x70, 0x83}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x51, 0x9f},
+    {0xb8, 0xa9}, {0x1e, 0xbe}, {0x85, 0x8f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x99, 0xfa},
+    {0x99, 0x6c}, {0x99, 0x74}, {0x99, 0x9c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xe1, 0x55},
+    {0x7a, 0x30}, {0x14, 0x2a}, {0xae, 0xa9}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x28, 0xaf},
+    {0x5c, 0xf3}, {0x8f, 0xdf}, {0xc2, 0xb5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x70, 0x0a},
+    {0x3d, 0xb7}, {0x0a, 0x95}, {0xd7, 0xc2}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xb8, 0x65},
+    {0x1e, 0x7a}, {0x85, 0x4b}, {0xeb, 0xcf}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x01, 0xc0},
+    {0x00, 0x3d}, {0x00, 0x01}, {0x00, 0xdc}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x47, 0x1a},
+    {0xe1, 0x01}, {0x7a, 0xb7}, {0x14, 0xe8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x8f, 0x75},
+    {0xc2, 0xc4}, {0xf5, 0x6c}, {0x28, 0xf5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xd7, 0xd0},
+    {0xa3, 0x87}, {0x70, 0x22}, {0x3d, 0x02}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x1e, 0x2a},
+    {0x85, 0x4b}, {0xeb, 0xd8}, {0x51, 0x0e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x66, 0x85},
+    {0x66, 0x0e}, {0x66, 0x8e}, {0x66, 0x1b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xae, 0xe0},
+    {0x47, 0xd1}, {0xe1, 0x43}, {0x7a, 0x28}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xf5, 0x3b},
+    {0x28, 0x95}, {0x5c, 0xf9}, {0x8f, 0x34}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x3d, 0x95},
+    {0x0a, 0x58}, {0xd7, 0xaf}, {0xa3, 0x41}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x85, 0xf0},
+    {0xeb, 0x1b}, {0x51, 0x65}, {0xb8, 0x4e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xcc, 0x4b},
+    {0xcc, 0xdf}, {0xcc, 0x1a}, {0xcc, 0x5b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x14, 0xa5},
+    {0xae, 0xa2}, {0x47, 0xd0}, {0xe1, 0x67}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x5c, 0x00},
+    {0x8f, 0x66}, {0xc2, 0x86}, {0xf5, 0x74}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xa3, 0x5b},
+    {0x70, 0x29}, {0x3d, 0x3c}, {0x0a, 0x81}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xeb, 0xb6},
+    {0x51, 0xec}, {0xb8, 0xf1}, {0x1e, 0x8d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x33, 0x10},
+    {0x33, 0xb0}, {0x33, 0xa7}, {0x33, 0x9a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x7a, 0x6b},
+    {0x14, 0x73}, {0xae, 0x5d}, {0x47, 0xa7}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xc2, 0xc6},
+    {0xf5, 0x36}, {0x28, 0x13}, {0x5c, 0xb4}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x0a, 0x21},
+    {0xd7, 0xfa}, {0xa3, 0xc8}, {0x70, 0xc0}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x51, 0x7b},
+    {0xb8, 0xbd}, {0x1e, 0x7e}, {0x85, 0xcd}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x99, 0xd6},
+    {0x99, 0x80}, {0x99, 0x34}, {0x99, 0xda}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xe1, 0x31},
+    {0x7a, 0x44}, {0x14, 0xea}, {0xae, 0xe6}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x28, 0x8b},
+    {0x5c, 0x07}, {0x8f, 0xa0}, {0xc2, 0xf3}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x15}, {0x08, 0x10}, {0x70, 0xe6},
+    {0x3d, 0xca}, {0x0a, 0x55}, {0xd7, 0x00}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x15}, {0x08, 0x10}, {0xb8, 0x41},
+    {0x1e, 0x8e}, {0x85, 0x0b}, {0xeb, 0x0d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x01, 0x9c},
+    {0x00, 0x51}, {0x00, 0xc1}, {0x00, 0x19}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x47, 0xf6},
+    {0xe1, 0x14}, {0x7a, 0x77}, {0x14, 0x26}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x8f, 0x51},
+    {0xc2, 0xd8}, {0xf5, 0x2c}, {0x28, 0x33}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xd7, 0xac},
+    {0xa3, 0x9b}, {0x70, 0xe2}, {0x3d, 0x3f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x1e, 0x06},
+    {0x85, 0x5f}, {0xeb, 0x98}, {0x51, 0x4c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x66, 0x61},
+    {0x66, 0x22}, {0x66, 0x4e}, {0x66, 0x59}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xae, 0xbc},
+    {0x47, 0xe5}, {0xe1, 0x03}, {0x7a, 0x66}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xf5, 0x17},
+    {0x28, 0xa9}, {0x5c, 0xb9}, {0x8f, 0x72}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x3d, 0x71},
+    {0x0a, 0x6c}, {0xd7, 0x6f}, {0xa3, 0x7f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x85, 0xcc},
+    {0xeb, 0x2f}, {0x51, 0x25}, {0xb8, 0x8c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xcc, 0x27},
+    {0xcc, 0xf3}, {0xcc, 0xda}, {0xcc, 0x98}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x14, 0x82},
+    {0xae, 0xb6}, {0x47, 0x90}, {0xe1, 0xa5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x5c, 0xdc},
+    {0x8f, 0x79}, {0xc2, 0x46}, {0xf5, 0xb2}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0xa3, 0x37},
+    {0x70, 0x3d}, {0x3d, 0xfc}, {0x0a, 0xbe}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0xeb, 0x92},
+    {0x51, 0x00}, {0xb8, 0xb2}, {0x1e, 0xcb}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x33, 0xec},
+    {0x33, 0xc3}, {0x33, 0x67}, {0x33, 0xd8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x7a, 0x47},
+    {0x14, 0x87}, {0xae, 0x1d}, {0x47, 0xe5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0xc2, 0xa2},
+    {0xf5, 0x4a}, {0x28, 0xd3}, {0x5c, 0xf1}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x0a, 0xfd},
+    {0xd7, 0x0d}, {0xa3, 0x89}, {0x70, 0xfe}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x51, 0x57},
+    {0xb8, 0xd1}, {0x1e, 0x3e}, {0x85, 0x0b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x99, 0xb2},
+    {0x99, 0x94}, {0x99, 0xf4}, {0x99, 0x17}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0xe1, 0x0d},
+    {0x7a, 0x58}, {0x14, 0xaa}, {0xae, 0x24}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x28, 0x67},
+    {0x5c, 0x1b}, {0x8f, 0x60}, {0xc2, 0x31}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x70, 0xc2},
+    {0x3d, 0xde}, {0x0a, 0x15}, {0xd7, 0x3e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0xb8, 0x1d},
+    {0x1e, 0xa2}, {0x85, 0xcb}, {0xeb, 0x4a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x01, 0x78},
+    {0x00, 0x65}, {0x00, 0x81}, {0x00, 0x57}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x47, 0xd2},
+    {0xe1, 0x28}, {0x7a, 0x37}, {0x14, 0x64}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x8f, 0x2d},
+    {0xc2, 0xec}, {0xf5, 0xec}, {0x28, 0x70}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0xd7, 0x88},
+    {0xa3, 0xaf}, {0x70, 0xa2}, {0x3d, 0x7d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x1e, 0xe2},
+    {0x85, 0x72}, {0xeb, 0x58}, {0x51, 0x8a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x66, 0x3d},
+    {0x66, 0x36}, {0x66, 0x0e}, {0x66, 0x97}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0xae, 0x98},
+    {0x47, 0xf9}, {0xe1, 0xc3}, {0x7a, 0xa3}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0xf5, 0xf3},
+    {0x28, 0xbc}, {0x5c, 0x79}, {0x8f, 0xb0}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x3d, 0x4d},
+    {0x0a, 0x80}, {0xd7, 0x2f}, {0xa3, 0xbd}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x85, 0xa8},
+    {0xeb, 0x43}, {0x51, 0xe5}, {0xb8, 0xc9}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0xcc, 0x03},
+    {0xcc, 0x07}, {0xcc, 0x9b}, {0xcc, 0xd6}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x14, 0x5e},
+    {0xae, 0xca}, {0x47, 0x50}, {0xe1, 0xe3}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x5c, 0xb8},
+    {0x8f, 0x8d}, {0xc2, 0x06}, {0xf5, 0xf0}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x25, 0x16}, {0x08, 0x10}, {0xa3, 0x13},
+    {0x70, 0x51}, {0x3d, 0xbc}, {0x0a, 0xfc}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0xeb, 0x6e},
+    {0x51, 0x14}, {0xb8, 0x72}, {0x1e, 0x09}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x33, 0xc8},
+    {0x33, 0xd7}, {0x33, 0x27}, {0x33, 0x16}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x7a, 0x23},
+    {0x14, 0x9b}, {0xae, 0xdd}, {0x47, 0x22}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0xc2, 0x7e},
+    {0xf5, 0x5e}, {0x28, 0x93}, {0x5c, 0x2f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x0a, 0xd9},
+    {0xd7, 0x21}, {0xa3, 0x49}, {0x70, 0x3c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x51, 0x33},
+    {0xb8, 0xe5}, {0x1e, 0xfe}, {0x85, 0x48}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x99, 0x8e},
+    {0x99, 0xa8}, {0x99, 0xb4}, {0x99, 0x55}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0xe1, 0xe9},
+    {0x7a, 0x6b}, {0x14, 0x6a}, {0xae, 0x62}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x28, 0x43},
+    {0x5c, 0x2f}, {0x8f, 0x20}, {0xc2, 0x6f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x70, 0x9e},
+    {0x3d, 0xf2}, {0x0a, 0xd5}, {0xd7, 0x7b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0xb8, 0xf9},
+    {0x1e, 0xb5}, {0x85, 0x8b}, {0xeb, 0x88}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x26, 0x17}, {0x08, 0x10}, {0x01, 0x54},
+    {0x00, 0x79}, {0x00, 0x41}, {0x00, 0x95}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x26, 0x17}, {0x08, 0x10}, {0x47, 0xae},
+    {0xe1, 0x3c}, {0x7a, 0xf7}, {0x14, 0xa1}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x26, 0x17}, {0x08, 0x10}, {0x8f, 0x09},
+    {0xc2, 0x00}, {0xf5, 0xad}, {0x28, 0xae}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x26, 0x17}, {0x08, 0x10}, {0xd7, 0x64},
+    {0xa3, 0xc3}, {0x70, 0x62}, {0x3d, 0xbb}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x26, 0x17}, {0x08, 0x10}, {0x1e, 0xbe},
+    {0x85, 0x86}, {0xeb, 0x18}, {0x51, 0xc8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x26, 0x17}, {0x08, 0x10}, {0x66, 0x19},
+    {0x66, 0x4a}, {0x66, 0xce}, {0x66, 0xd4}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x26, 0x17}, {0x08, 0x10}, {0xae, 0x74},
+    {0x47, 0x0d}, {0xe1, 0x84}, {0x7a, 0xe1}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x26, 0x17}, {0x08, 0x10}, {0xf5, 0xcf},
+    {0x28, 0xd0}, {0x5c, 0x39}, {0x8f, 0xee}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x26, 0x17}, {0x08, 0x10}, {0x3d, 0x29},
+    {0x0a, 0x94}, {0xd7, 0xef}, {0xa3, 0xfa}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x26, 0x18}, {0x08, 0x10}, {0x85, 0x84},
+    {0xeb, 0x57}, {0x51, 0xa5}, {0xb8, 0x07}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x26, 0x18}, {0x08, 0x10}, {0xcc, 0xdf},
+    {0xcc, 0x1a}, {0xcc, 0x5b}, {0xcc, 0x14}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x26, 0x18}, {0x08, 0x10}, {0x14, 0x3a},
+    {0xae, 0xde}, {0x47, 0x10}, {0xe1, 0x21}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x26, 0x18}, {0x08, 0x10}, {0x5c, 0x94},
+    {0x8f, 0xa1}, {0xc2, 0xc6}, {0xf5, 0x2d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0xa3, 0xef},
+    {0x70, 0x64}, {0x3d, 0x7c}, {0x0a, 0x3a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0xeb, 0x4a},
+    {0x51, 0x28}, {0xb8, 0x32}, {0x1e, 0x47}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0x33, 0xa4},
+    {0x33, 0xeb}, {0x33, 0xe7}, {0x33, 0x53}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0x7a, 0xff},
+    {0x14, 0xae}, {0xae, 0x9d}, {0x47, 0x60}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0xc2, 0x5a},
+    {0xf5, 0x72}, {0x28, 0x53}, {0x5c, 0x6d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0x0a, 0xb5},
+    {0xd7, 0x35}, {0xa3, 0x09}, {0x70, 0x7a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0x51, 0x0f},
+    {0xb8, 0xf9}, {0x1e, 0xbe}, {0x85, 0x86}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0x99, 0x6a},
+    {0x99, 0xbc}, {0x99, 0x74}, {0x99, 0x93}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0xe1, 0xc5},
+    {0x7a, 0x7f}, {0x14, 0x2a}, {0xae, 0xa0}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0x28, 0x1f},
+    {0x5c, 0x43}, {0x8f, 0xe0}, {0xc2, 0xac}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0x70, 0x7a},
+    {0x3d, 0x06}, {0x0a, 0x96}, {0xd7, 0xb9}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x04, 0x04}, {0x08, 0x08}, {0x30, 0x30}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0xb8, 0xd5},
+    {0x1e, 0xc9}, {0x85, 0x4b}, {0xeb, 0xc6}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x01, 0xe4},
+    {0x00, 0x29}, {0x00, 0x41}, {0x00, 0x9e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xf5, 0x68},
+    {0x28, 0x7c}, {0x5c, 0xc9}, {0x0f, 0xa7}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xeb, 0xec},
+    {0x51, 0xce}, {0xb8, 0x51}, {0x1e, 0xb1}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xe1, 0x70},
+    {0x7a, 0x21}, {0x14, 0xda}, {0x2e, 0xba}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xd7, 0xf4},
+    {0xa3, 0x73}, {0x70, 0x62}, {0x3d, 0xc4}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xcc, 0x78},
+    {0xcc, 0xc6}, {0xcc, 0xea}, {0x4c, 0xcd}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xc2, 0xfc},
+    {0xf5, 0x18}, {0x28, 0x73}, {0x5c, 0xd7}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xb8, 0x80},
+    {0x1e, 0x6b}, {0x85, 0xfb}, {0x6b, 0xe0}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xae, 0x04},
+    {0x47, 0xbe}, {0xe1, 0x83}, {0x7a, 0xea}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xa3, 0x88},
+    {0x70, 0x10}, {0x3d, 0x0c}, {0x8a, 0xf4}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x99, 0x0c},
+    {0x99, 0x63}, {0x99, 0x94}, {0x99, 0xfd}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x8f, 0x90},
+    {0xc2, 0xb5}, {0xf5, 0x1c}, {0xa8, 0x07}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x85, 0x14},
+    {0xeb, 0x08}, {0x51, 0xa5}, {0xb8, 0x10}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x7a, 0x98},
+    {0x14, 0x5a}, {0xae, 0x2d}, {0xc7, 0x1a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x70, 0x1c},
+    {0x3d, 0xad}, {0x0a, 0xb5}, {0xd7, 0x23}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x66, 0xa0},
+    {0x66, 0xff}, {0x66, 0x3d}, {0xe6, 0x2d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x5c, 0x24},
+    {0x8f, 0x52}, {0xc2, 0xc6}, {0xf5, 0x36}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x51, 0xa8},
+    {0xb8, 0xa4}, {0x1e, 0x4e}, {0x05, 0x40}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x47, 0x2c},
+    {0xe1, 0xf7}, {0x7a, 0xd6}, {0x14, 0x49}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x3d, 0xb0},
+    {0x0a, 0x49}, {0xd7, 0x5f}, {0x23, 0x53}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x33, 0x34},
+    {0x33, 0x9c}, {0x33, 0xe7}, {0x33, 0x5c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x28, 0xb8},
+    {0x5c, 0xee}, {0x8f, 0x6f}, {0x42, 0x66}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x1e, 0x3c},
+    {0x85, 0x41}, {0xeb, 0xf8}, {0x51, 0x6f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x14, 0xc0},
+    {0xae, 0x93}, {0x47, 0x80}, {0x61, 0x79}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x0a, 0x45},
+    {0xd7, 0xe6}, {0xa3, 0x08}, {0x70, 0x83}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x00, 0xc9},
+    {0x00, 0x38}, {0x00, 0x91}, {0x80, 0x8c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xf5, 0x4d},
+    {0x28, 0x8b}, {0x5c, 0x19}, {0x8f, 0x96}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xeb, 0xd1},
+    {0x51, 0xdd}, {0xb8, 0xa1}, {0x9e, 0x9f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xe1, 0x55},
+    {0x7a, 0x30}, {0x14, 0x2a}, {0xae, 0xa9}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xd7, 0xd9},
+    {0xa3, 0x82}, {0x70, 0xb2}, {0xbd, 0xb2}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xcc, 0x5d},
+    {0xcc, 0xd5}, {0xcc, 0x3a}, {0xcc, 0xbc}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xc2, 0xe1},
+    {0xf5, 0x27}, {0x28, 0xc3}, {0xdc, 0xc5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xb8, 0x65},
+    {0x1e, 0x7a}, {0x85, 0x4b}, {0xeb, 0xcf}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xae, 0xe9},
+    {0x47, 0xcc}, {0xe1, 0xd3}, {0xfa, 0xd8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0xa3, 0x6d},
+    {0x70, 0x1f}, {0x3d, 0x5c}, {0x0a, 0xe2}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x99, 0xf1},
+    {0x99, 0x71}, {0x99, 0xe4}, {0x19, 0xeb}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x8f, 0x75},
+    {0xc2, 0xc4}, {0xf5, 0x6c}, {0x28, 0xf5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x85, 0xf9},
+    {0xeb, 0x16}, {0x51, 0xf5}, {0x38, 0xfe}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x7a, 0x7d},
+    {0x14, 0x69}, {0xae, 0x7d}, {0x47, 0x08}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x70, 0x01},
+    {0x3d, 0xbc}, {0x0a, 0x05}, {0x57, 0x12}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x66, 0x85},
+    {0x66, 0x0e}, {0x66, 0x8e}, {0x66, 0x1b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x5c, 0x09},
+    {0x8f, 0x61}, {0xc2, 0x16}, {0x75, 0x25}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x51, 0x8d},
+    {0xb8, 0xb3}, {0x1e, 0x9e}, {0x85, 0x2e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x47, 0x11},
+    {0xe1, 0x06}, {0x7a, 0x27}, {0x94, 0x38}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x3d, 0x95},
+    {0x0a, 0x58}, {0xd7, 0xaf}, {0xa3, 0x41}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x33, 0x19},
+    {0x33, 0xab}, {0x33, 0x37}, {0xb3, 0x4b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x28, 0x9d},
+    {0x5c, 0xfd}, {0x8f, 0xbf}, {0xc2, 0x54}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x1e, 0x21},
+    {0x85, 0x50}, {0xeb, 0x48}, {0xd1, 0x5e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x14, 0xa5},
+    {0xae, 0xa2}, {0x47, 0xd0}, {0xe1, 0x67}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x0a, 0x2a},
+    {0xd7, 0xf5}, {0xa3, 0x58}, {0xf0, 0x71}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x01, 0xae},
+    {0x00, 0x47}, {0x00, 0xe1}, {0x00, 0x7a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xf5, 0x32},
+    {0x28, 0x9a}, {0x5c, 0x69}, {0x0f, 0x84}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xeb, 0xb6},
+    {0x51, 0xec}, {0xb8, 0xf1}, {0x1e, 0x8d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xe1, 0x3a},
+    {0x7a, 0x3f}, {0x14, 0x7a}, {0x2e, 0x97}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xd7, 0xbe},
+    {0xa3, 0x91}, {0x70, 0x02}, {0x3d, 0xa1}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xcc, 0x42},
+    {0xcc, 0xe4}, {0xcc, 0x8a}, {0x4c, 0xaa}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xc2, 0xc6},
+    {0xf5, 0x36}, {0x28, 0x13}, {0x5c, 0xb4}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xb8, 0x4a},
+    {0x1e, 0x89}, {0x85, 0x9b}, {0x6b, 0xbd}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xae, 0xce},
+    {0x47, 0xdb}, {0xe1, 0x23}, {0x7a, 0xc7}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xa3, 0x52},
+    {0x70, 0x2e}, {0x3d, 0xac}, {0x8a, 0xd0}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x99, 0xd6},
+    {0x99, 0x80}, {0x99, 0x34}, {0x99, 0xda}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x8f, 0x5a},
+    {0xc2, 0xd3}, {0xf5, 0xbc}, {0xa8, 0xe3}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x85, 0xde},
+    {0xeb, 0x25}, {0x51, 0x45}, {0xb8, 0xed}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x7a, 0x62},
+    {0x14, 0x78}, {0xae, 0xcd}, {0xc7, 0xf6}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x15}, {0x08, 0x10}, {0x70, 0xe6},
+    {0x3d, 0xca}, {0x0a, 0x55}, {0xd7, 0x00}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x15}, {0x08, 0x10}, {0x66, 0x6a},
+    {0x66, 0x1d}, {0x66, 0xde}, {0xe6, 0x09}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x21, 0x15}, {0x08, 0x10}, {0x5c, 0xee},
+    {0x8f, 0x6f}, {0xc2, 0x66}, {0xf5, 0x13}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x51, 0x72},
+    {0xb8, 0xc2}, {0x1e, 0xee}, {0x05, 0x1c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x47, 0xf6},
+    {0xe1, 0x14}, {0x7a, 0x77}, {0x14, 0x26}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x3d, 0x7a},
+    {0x0a, 0x67}, {0xd7, 0xff}, {0x23, 0x2f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x33, 0xfe},
+    {0x33, 0xb9}, {0x33, 0x87}, {0x33, 0x39}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x28, 0x82},
+    {0x5c, 0x0c}, {0x8f, 0x10}, {0x42, 0x43}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x1e, 0x06},
+    {0x85, 0x5f}, {0xeb, 0x98}, {0x51, 0x4c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x14, 0x8b},
+    {0xae, 0xb1}, {0x47, 0x20}, {0x61, 0x56}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x0a, 0x0f},
+    {0xd7, 0x04}, {0xa3, 0xa9}, {0x70, 0x5f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x00, 0x93},
+    {0x00, 0x56}, {0x00, 0x31}, {0x80, 0x69}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xf5, 0x17},
+    {0x28, 0xa9}, {0x5c, 0xb9}, {0x8f, 0x72}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xeb, 0x9b},
+    {0x51, 0xfb}, {0xb8, 0x41}, {0x9e, 0x7c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xe1, 0x1f},
+    {0x7a, 0x4e}, {0x14, 0xca}, {0xae, 0x85}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xd7, 0xa3},
+    {0xa3, 0xa0}, {0x70, 0x52}, {0xbd, 0x8f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xcc, 0x27},
+    {0xcc, 0xf3}, {0xcc, 0xda}, {0xcc, 0x98}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xc2, 0xab},
+    {0xf5, 0x45}, {0x28, 0x63}, {0xdc, 0xa2}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xb8, 0x2f},
+    {0x1e, 0x98}, {0x85, 0xeb}, {0xeb, 0xab}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xae, 0xb3},
+    {0x47, 0xea}, {0xe1, 0x73}, {0xfa, 0xb5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0xa3, 0x37},
+    {0x70, 0x3d}, {0x3d, 0xfc}, {0x0a, 0xbe}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x99, 0xbb},
+    {0x99, 0x8f}, {0x99, 0x84}, {0x19, 0xc8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x8f, 0x3f},
+    {0xc2, 0xe2}, {0xf5, 0x0c}, {0x28, 0xd2}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x85, 0xc3},
+    {0xeb, 0x34}, {0x51, 0x95}, {0x38, 0xdb}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x7a, 0x47},
+    {0x14, 0x87}, {0xae, 0x1d}, {0x47, 0xe5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x70, 0xcb},
+    {0x3d, 0xd9}, {0x0a, 0xa5}, {0x57, 0xee}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x66, 0x4f},
+    {0x66, 0x2c}, {0x66, 0x2e}, {0x66, 0xf8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x5c, 0xd3},
+    {0x8f, 0x7e}, {0xc2, 0xb6}, {0x75, 0x01}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x51, 0x57},
+    {0xb8, 0xd1}, {0x1e, 0x3e}, {0x85, 0x0b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x47, 0xdb},
+    {0xe1, 0x23}, {0x7a, 0xc7}, {0x94, 0x14}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x3d, 0x5f},
+    {0x0a, 0x76}, {0xd7, 0x4f}, {0xa3, 0x1e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x33, 0xe3},
+    {0x33, 0xc8}, {0x33, 0xd7}, {0xb3, 0x27}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x28, 0x67},
+    {0x5c, 0x1b}, {0x8f, 0x60}, {0xc2, 0x31}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x1e, 0xeb},
+    {0x85, 0x6d}, {0xeb, 0xe8}, {0xd1, 0x3a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x14, 0x70},
+    {0xae, 0xc0}, {0x47, 0x70}, {0xe1, 0x44}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x0a, 0xf4},
+    {0xd7, 0x12}, {0xa3, 0xf9}, {0xf0, 0x4d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0x03, 0x03}, {0x06, 0x06}, {0x30, 0x30}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x01, 0x78},
+    {0x00, 0x65}, {0x00, 0x81}, {0x00, 0x57}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xcc, 0xfc},
+    {0xcc, 0xc3}, {0xcc, 0x32}, {0x0c, 0xa6}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x99, 0x15},
+    {0x99, 0x5e}, {0x99, 0x24}, {0x19, 0xae}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x66, 0x2e},
+    {0x66, 0xf8}, {0x66, 0x15}, {0x26, 0xb6}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x33, 0x46},
+    {0x33, 0x92}, {0x33, 0x07}, {0x33, 0xbe}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x00, 0x5f},
+    {0x00, 0x2c}, {0x00, 0xf9}, {0x40, 0xc5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xcc, 0x78},
+    {0xcc, 0xc6}, {0xcc, 0xea}, {0x4c, 0xcd}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x99, 0x90},
+    {0x99, 0x60}, {0x99, 0xdc}, {0x59, 0xd5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x66, 0xa9},
+    {0x66, 0xfa}, {0x66, 0xcd}, {0x66, 0xdd}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x33, 0xc2},
+    {0x33, 0x94}, {0x33, 0xbf}, {0x73, 0xe5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x00, 0xdb},
+    {0x00, 0x2e}, {0x00, 0xb1}, {0x80, 0xed}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xcc, 0xf3},
+    {0xcc, 0xc8}, {0xcc, 0xa2}, {0x8c, 0xf5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x99, 0x0c},
+    {0x99, 0x63}, {0x99, 0x94}, {0x99, 0xfd}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x66, 0x25},
+    {0x66, 0xfd}, {0x66, 0x85}, {0xa6, 0x05}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x33, 0x3d},
+    {0x33, 0x97}, {0x33, 0x77}, {0xb3, 0x0d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x00, 0x56},
+    {0x00, 0x31}, {0x00, 0x69}, {0xc0, 0x15}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0xcc, 0x6f},
+    {0xcc, 0xcb}, {0xcc, 0x5a}, {0xcc, 0x1d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x99, 0x87},
+    {0x99, 0x65}, {0x99, 0x4c}, {0xd9, 0x25}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x66, 0xa0},
+    {0x66, 0xff}, {0x66, 0x3d}, {0xe6, 0x2d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x33, 0xb9},
+    {0x33, 0x99}, {0x33, 0x2f}, {0xf3, 0x35}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x01, 0xd2},
+    {0x00, 0x33}, {0x00, 0x21}, {0x00, 0x3d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xcc, 0xea},
+    {0xcc, 0xcd}, {0xcc, 0x12}, {0x0c, 0x45}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x99, 0x03},
+    {0x99, 0x68}, {0x99, 0x04}, {0x19, 0x4d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x66, 0x1c},
+    {0x66, 0x02}, {0x66, 0xf6}, {0x26, 0x54}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x33, 0x34},
+    {0x33, 0x9c}, {0x33, 0xe7}, {0x33, 0x5c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x00, 0x4d},
+    {0x00, 0x36}, {0x00, 0xd9}, {0x40, 0x64}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xcc, 0x66},
+    {0xcc, 0xd0}, {0xcc, 0xca}, {0x4c, 0x6c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x99, 0x7e},
+    {0x99, 0x6a}, {0x99, 0xbc}, {0x59, 0x74}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x66, 0x97},
+    {0x66, 0x04}, {0x66, 0xae}, {0x66, 0x7c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x33, 0xb0},
+    {0x33, 0x9e}, {0x33, 0x9f}, {0x73, 0x84}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x00, 0xc9},
+    {0x00, 0x38}, {0x00, 0x91}, {0x80, 0x8c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xcc, 0xe1},
+    {0xcc, 0xd2}, {0xcc, 0x82}, {0x8c, 0x94}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x99, 0xfa},
+    {0x99, 0x6c}, {0x99, 0x74}, {0x99, 0x9c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x66, 0x13},
+    {0x66, 0x07}, {0x66, 0x66}, {0xa6, 0xa4}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x33, 0x2b},
+    {0x33, 0xa1}, {0x33, 0x57}, {0xb3, 0xac}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x00, 0x44},
+    {0x00, 0x3b}, {0x00, 0x49}, {0xc0, 0xb4}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xcc, 0x5d},
+    {0xcc, 0xd5}, {0xcc, 0x3a}, {0xcc, 0xbc}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x99, 0x75},
+    {0x99, 0x6f}, {0x99, 0x2c}, {0xd9, 0xc4}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x66, 0x8e},
+    {0x66, 0x09}, {0x66, 0x1e}, {0xe6, 0xcc}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x33, 0xa7},
+    {0x33, 0xa3}, {0x33, 0x0f}, {0xf3, 0xd4}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x01, 0xc0},
+    {0x00, 0x3d}, {0x00, 0x01}, {0x00, 0xdc}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0xcc, 0xd8},
+    {0xcc, 0xd7}, {0xcc, 0xf2}, {0x0c, 0xe3}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x99, 0xf1},
+    {0x99, 0x71}, {0x99, 0xe4}, {0x19, 0xeb}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x66, 0x0a},
+    {0x66, 0x0c}, {0x66, 0xd6}, {0x26, 0xf3}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x33, 0x22},
+    {0x33, 0xa6}, {0x33, 0xc7}, {0x33, 0xfb}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x00, 0x3b},
+    {0x00, 0x40}, {0x00, 0xb9}, {0x40, 0x03}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xcc, 0x54},
+    {0xcc, 0xda}, {0xcc, 0xaa}, {0x4c, 0x0b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x99, 0x6c},
+    {0x99, 0x74}, {0x99, 0x9c}, {0x59, 0x13}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x66, 0x85},
+    {0x66, 0x0e}, {0x66, 0x8e}, {0x66, 0x1b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x33, 0x9e},
+    {0x33, 0xa8}, {0x33, 0x7f}, {0x73, 0x23}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x00, 0xb7},
+    {0x00, 0x42}, {0x00, 0x71}, {0x80, 0x2b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xcc, 0xcf},
+    {0xcc, 0xdc}, {0xcc, 0x62}, {0x8c, 0x33}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x99, 0xe8},
+    {0x99, 0x76}, {0x99, 0x54}, {0x99, 0x3b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x66, 0x01},
+    {0x66, 0x11}, {0x66, 0x46}, {0xa6, 0x43}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x33, 0x19},
+    {0x33, 0xab}, {0x33, 0x37}, {0xb3, 0x4b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x00, 0x32},
+    {0x00, 0x45}, {0x00, 0x29}, {0xc0, 0x53}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xcc, 0x4b},
+    {0xcc, 0xdf}, {0xcc, 0x1a}, {0xcc, 0x5b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x99, 0x63},
+    {0x99, 0x79}, {0x99, 0x0c}, {0xd9, 0x63}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x66, 0x7c},
+    {0x66, 0x13}, {0x66, 0xfe}, {0xe6, 0x6a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x33, 0x95},
+    {0x33, 0xad}, {0x33, 0xef}, {0xf3, 0x72}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x01, 0xae},
+    {0x00, 0x47}, {0x00, 0xe1}, {0x00, 0x7a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xcc, 0xc6},
+    {0xcc, 0xe1}, {0xcc, 0xd2}, {0x0c, 0x82}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x99, 0xdf},
+    {0x99, 0x7b}, {0x99, 0xc4}, {0x19, 0x8a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x66, 0xf8},
+    {0x66, 0x15}, {0x66, 0xb6}, {0x26, 0x92}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x33, 0x10},
+    {0x33, 0xb0}, {0x33, 0xa7}, {0x33, 0x9a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x00, 0x29},
+    {0x00, 0x4a}, {0x00, 0x99}, {0x40, 0xa2}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xcc, 0x42},
+    {0xcc, 0xe4}, {0xcc, 0x8a}, {0x4c, 0xaa}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x99, 0x5a},
+    {0x99, 0x7e}, {0x99, 0x7c}, {0x59, 0xb2}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x66, 0x73},
+    {0x66, 0x18}, {0x66, 0x6e}, {0x66, 0xba}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x33, 0x8c},
+    {0x33, 0xb2}, {0x33, 0x5f}, {0x73, 0xc2}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x00, 0xa5},
+    {0x00, 0x4c}, {0x00, 0x51}, {0x80, 0xca}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xcc, 0xbd},
+    {0xcc, 0xe6}, {0xcc, 0x42}, {0x8c, 0xd2}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x99, 0xd6},
+    {0x99, 0x80}, {0x99, 0x34}, {0x99, 0xda}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x66, 0xef},
+    {0x66, 0x1a}, {0x66, 0x26}, {0xa6, 0xe2}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x33, 0x07},
+    {0x33, 0xb5}, {0x33, 0x17}, {0xb3, 0xea}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x00, 0x20},
+    {0x00, 0x4f}, {0x00, 0x09}, {0xc0, 0xf2}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xcc, 0x39},
+    {0xcc, 0xe9}, {0xcc, 0xfa}, {0xcc, 0xf9}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x15}, {0x08, 0x10}, {0x99, 0x51},
+    {0x99, 0x83}, {0x99, 0xec}, {0xd9, 0x01}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x15}, {0x08, 0x10}, {0x66, 0x6a},
+    {0x66, 0x1d}, {0x66, 0xde}, {0xe6, 0x09}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x15}, {0x08, 0x10}, {0x33, 0x83},
+    {0x33, 0xb7}, {0x33, 0xcf}, {0xf3, 0x11}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x01, 0x9c},
+    {0x00, 0x51}, {0x00, 0xc1}, {0x00, 0x19}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xcc, 0xb4},
+    {0xcc, 0xeb}, {0xcc, 0xb2}, {0x0c, 0x21}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x99, 0xcd},
+    {0x99, 0x85}, {0x99, 0xa4}, {0x19, 0x29}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x66, 0xe6},
+    {0x66, 0x1f}, {0x66, 0x96}, {0x26, 0x31}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x33, 0xfe},
+    {0x33, 0xb9}, {0x33, 0x87}, {0x33, 0x39}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x00, 0x17},
+    {0x00, 0x54}, {0x00, 0x79}, {0x40, 0x41}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xcc, 0x30},
+    {0xcc, 0xee}, {0xcc, 0x6a}, {0x4c, 0x49}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x99, 0x48},
+    {0x99, 0x88}, {0x99, 0x5c}, {0x59, 0x51}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x66, 0x61},
+    {0x66, 0x22}, {0x66, 0x4e}, {0x66, 0x59}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x33, 0x7a},
+    {0x33, 0xbc}, {0x33, 0x3f}, {0x73, 0x61}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x00, 0x93},
+    {0x00, 0x56}, {0x00, 0x31}, {0x80, 0x69}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xcc, 0xab},
+    {0xcc, 0xf0}, {0xcc, 0x22}, {0x8c, 0x71}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x99, 0xc4},
+    {0x99, 0x8a}, {0x99, 0x14}, {0x99, 0x79}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x66, 0xdd},
+    {0x66, 0x24}, {0x66, 0x06}, {0xa6, 0x81}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x33, 0xf5},
+    {0x33, 0xbe}, {0x33, 0xf7}, {0xb3, 0x88}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x00, 0x0e},
+    {0x00, 0x59}, {0x00, 0xe9}, {0xc0, 0x90}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xcc, 0x27},
+    {0xcc, 0xf3}, {0xcc, 0xda}, {0xcc, 0x98}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x99, 0x3f},
+    {0x99, 0x8d}, {0x99, 0xcc}, {0xd9, 0xa0}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x66, 0x58},
+    {0x66, 0x27}, {0x66, 0xbe}, {0xe6, 0xa8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x33, 0x71},
+    {0x33, 0xc1}, {0x33, 0xaf}, {0xf3, 0xb0}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x01, 0x8a},
+    {0x00, 0x5b}, {0x00, 0xa1}, {0x00, 0xb8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0xcc, 0xa2},
+    {0xcc, 0xf5}, {0xcc, 0x92}, {0x0c, 0xc0}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x99, 0xbb},
+    {0x99, 0x8f}, {0x99, 0x84}, {0x19, 0xc8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x66, 0xd4},
+    {0x66, 0x29}, {0x66, 0x76}, {0x26, 0xd0}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x33, 0xec},
+    {0x33, 0xc3}, {0x33, 0x67}, {0x33, 0xd8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x00, 0x05},
+    {0x00, 0x5e}, {0x00, 0x59}, {0x40, 0xe0}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0xcc, 0x1e},
+    {0xcc, 0xf8}, {0xcc, 0x4a}, {0x4c, 0xe8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x99, 0x36},
+    {0x99, 0x92}, {0x99, 0x3c}, {0x59, 0xf0}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x66, 0x4f},
+    {0x66, 0x2c}, {0x66, 0x2e}, {0x66, 0xf8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x33, 0x68},
+    {0x33, 0xc6}, {0x33, 0x1f}, {0x73, 0x00}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x00, 0x81},
+    {0x00, 0x60}, {0x00, 0x11}, {0x80, 0x08}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0xcc, 0x99},
+    {0xcc, 0xfa}, {0xcc, 0x02}, {0x8c, 0x10}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x99, 0xb2},
+    {0x99, 0x94}, {0x99, 0xf4}, {0x99, 0x17}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x66, 0xcb},
+    {0x66, 0x2e}, {0x66, 0xe6}, {0xa6, 0x1f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x33, 0xe3},
+    {0x33, 0xc8}, {0x33, 0xd7}, {0xb3, 0x27}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x00, 0xfc},
+    {0x00, 0x62}, {0x00, 0xc9}, {0xc0, 0x2f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0xcc, 0x15},
+    {0xcc, 0xfd}, {0xcc, 0xba}, {0xcc, 0x37}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x99, 0x2d},
+    {0x99, 0x97}, {0x99, 0xac}, {0xd9, 0x3f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x66, 0x46},
+    {0x66, 0x31}, {0x66, 0x9e}, {0xe6, 0x47}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x33, 0x5f},
+    {0x33, 0xcb}, {0x33, 0x8f}, {0xf3, 0x4f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x01, 0x78},
+    {0x00, 0x65}, {0x00, 0x81}, {0x00, 0x57}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0xcc, 0x90},
+    {0xcc, 0xff}, {0xcc, 0x72}, {0x0c, 0x5f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x99, 0xa9},
+    {0x99, 0x99}, {0x99, 0x64}, {0x19, 0x67}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x66, 0xc2},
+    {0x66, 0x33}, {0x66, 0x56}, {0x26, 0x6f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x33, 0xda},
+    {0x33, 0xcd}, {0x33, 0x47}, {0x33, 0x77}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x00, 0xf3},
+    {0x00, 0x67}, {0x00, 0x39}, {0x40, 0x7f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0xcc, 0x0c},
+    {0xcc, 0x02}, {0xcc, 0x2b}, {0x4c, 0x87}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x99, 0x24},
+    {0x99, 0x9c}, {0x99, 0x1c}, {0x59, 0x8f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x66, 0x3d},
+    {0x66, 0x36}, {0x66, 0x0e}, {0x66, 0x97}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x33, 0x56},
+    {0x33, 0xd0}, {0x33, 0xff}, {0x73, 0x9e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x00, 0x6f},
+    {0x00, 0x6a}, {0x00, 0xf1}, {0x80, 0xa6}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0xcc, 0x87},
+    {0xcc, 0x04}, {0xcc, 0xe3}, {0x8c, 0xae}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x99, 0xa0},
+    {0x99, 0x9e}, {0x99, 0xd4}, {0x99, 0xb6}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x66, 0xb9},
+    {0x66, 0x38}, {0x66, 0xc6}, {0xa6, 0xbe}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x33, 0xd1},
+    {0x33, 0xd2}, {0x33, 0xb7}, {0xb3, 0xc6}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x00, 0xea},
+    {0x00, 0x6c}, {0x00, 0xa9}, {0xc0, 0xce}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0xcc, 0x03},
+    {0xcc, 0x07}, {0xcc, 0x9b}, {0xcc, 0xd6}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x99, 0x1b},
+    {0x99, 0xa1}, {0x99, 0x8c}, {0xd9, 0xde}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x66, 0x34},
+    {0x66, 0x3b}, {0x66, 0x7e}, {0xe6, 0xe6}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x33, 0x4d},
+    {0x33, 0xd5}, {0x33, 0x6f}, {0xf3, 0xee}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x16}, {0x08, 0x10}, {0x01, 0x66},
+    {0x00, 0x6f}, {0x00, 0x61}, {0x00, 0xf6}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x16}, {0x08, 0x10}, {0xcc, 0x7e},
+    {0xcc, 0x09}, {0xcc, 0x53}, {0x0c, 0xfe}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x99, 0x97},
+    {0x99, 0xa3}, {0x99, 0x44}, {0x19, 0x06}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x66, 0xb0},
+    {0x66, 0x3d}, {0x66, 0x36}, {0x26, 0x0e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x33, 0xc8},
+    {0x33, 0xd7}, {0x33, 0x27}, {0x33, 0x16}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x00, 0xe1},
+    {0x00, 0x71}, {0x00, 0x19}, {0x40, 0x1e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0xcc, 0xfa},
+    {0xcc, 0x0b}, {0xcc, 0x0b}, {0x4c, 0x26}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x99, 0x12},
+    {0x99, 0xa6}, {0x99, 0xfc}, {0x59, 0x2d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x66, 0x2b},
+    {0x66, 0x40}, {0x66, 0xee}, {0x66, 0x35}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x05, 0x05}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x33, 0x44},
+    {0x33, 0xda}, {0x33, 0xdf}, {0x73, 0x3d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x01, 0xe4},
+    {0x00, 0x29}, {0x00, 0x41}, {0x00, 0x9e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xa3, 0x91},
+    {0x70, 0x0b}, {0x3d, 0x9c}, {0x0a, 0xa4}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x47, 0x3e},
+    {0xe1, 0xed}, {0x7a, 0xf6}, {0x14, 0xaa}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xeb, 0xec},
+    {0x51, 0xce}, {0xb8, 0x51}, {0x1e, 0xb1}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x8f, 0x99},
+    {0xc2, 0xb0}, {0xf5, 0xac}, {0x28, 0xb7}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x33, 0x46},
+    {0x33, 0x92}, {0x33, 0x07}, {0x33, 0xbe}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xd7, 0xf4},
+    {0xa3, 0x73}, {0x70, 0x62}, {0x3d, 0xc4}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x7a, 0xa1},
+    {0x14, 0x55}, {0xae, 0xbd}, {0x47, 0xca}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x1e, 0x4e},
+    {0x85, 0x37}, {0xeb, 0x18}, {0x51, 0xd1}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xc2, 0xfc},
+    {0xf5, 0x18}, {0x28, 0x73}, {0x5c, 0xd7}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x66, 0xa9},
+    {0x66, 0xfa}, {0x66, 0xcd}, {0x66, 0xdd}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x0a, 0x57},
+    {0xd7, 0xdc}, {0xa3, 0x28}, {0x70, 0xe4}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xae, 0x04},
+    {0x47, 0xbe}, {0xe1, 0x83}, {0x7a, 0xea}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x51, 0xb1},
+    {0xb8, 0x9f}, {0x1e, 0xde}, {0x85, 0xf0}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xf5, 0x5f},
+    {0x28, 0x81}, {0x5c, 0x39}, {0x8f, 0xf7}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x99, 0x0c},
+    {0x99, 0x63}, {0x99, 0x94}, {0x99, 0xfd}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x3d, 0xb9},
+    {0x0a, 0x44}, {0xd7, 0xef}, {0xa3, 0x03}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0xe1, 0x67},
+    {0x7a, 0x26}, {0x14, 0x4a}, {0xae, 0x0a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x85, 0x14},
+    {0xeb, 0x08}, {0x51, 0xa5}, {0xb8, 0x10}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x28, 0xc1},
+    {0x5c, 0xe9}, {0x8f, 0xff}, {0xc2, 0x16}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0xcc, 0x6f},
+    {0xcc, 0xcb}, {0xcc, 0x5a}, {0xcc, 0x1d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x70, 0x1c},
+    {0x3d, 0xad}, {0x0a, 0xb5}, {0xd7, 0x23}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x14, 0xc9},
+    {0xae, 0x8e}, {0x47, 0x10}, {0xe1, 0x2a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0xb8, 0x77},
+    {0x1e, 0x70}, {0x85, 0x6b}, {0xeb, 0x30}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x5c, 0x24},
+    {0x8f, 0x52}, {0xc2, 0xc6}, {0xf5, 0x36}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x01, 0xd2},
+    {0x00, 0x33}, {0x00, 0x21}, {0x00, 0x3d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xa3, 0x7f},
+    {0x70, 0x15}, {0x3d, 0x7c}, {0x0a, 0x43}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x47, 0x2c},
+    {0xe1, 0xf7}, {0x7a, 0xd6}, {0x14, 0x49}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xeb, 0xda},
+    {0x51, 0xd8}, {0xb8, 0x31}, {0x1e, 0x50}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x8f, 0x87},
+    {0xc2, 0xba}, {0xf5, 0x8c}, {0x28, 0x56}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x33, 0x34},
+    {0x33, 0x9c}, {0x33, 0xe7}, {0x33, 0x5c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xd7, 0xe2},
+    {0xa3, 0x7d}, {0x70, 0x42}, {0x3d, 0x63}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x7a, 0x8f},
+    {0x14, 0x5f}, {0xae, 0x9d}, {0x47, 0x69}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x1e, 0x3c},
+    {0x85, 0x41}, {0xeb, 0xf8}, {0x51, 0x6f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xc2, 0xea},
+    {0xf5, 0x22}, {0x28, 0x53}, {0x5c, 0x76}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x66, 0x97},
+    {0x66, 0x04}, {0x66, 0xae}, {0x66, 0x7c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x0a, 0x45},
+    {0xd7, 0xe6}, {0xa3, 0x08}, {0x70, 0x83}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xae, 0xf2},
+    {0x47, 0xc7}, {0xe1, 0x63}, {0x7a, 0x89}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x51, 0x9f},
+    {0xb8, 0xa9}, {0x1e, 0xbe}, {0x85, 0x8f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xf5, 0x4d},
+    {0x28, 0x8b}, {0x5c, 0x19}, {0x8f, 0x96}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x99, 0xfa},
+    {0x99, 0x6c}, {0x99, 0x74}, {0x99, 0x9c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x3d, 0xa7},
+    {0x0a, 0x4e}, {0xd7, 0xcf}, {0xa3, 0xa2}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xe1, 0x55},
+    {0x7a, 0x30}, {0x14, 0x2a}, {0xae, 0xa9}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x85, 0x02},
+    {0xeb, 0x12}, {0x51, 0x85}, {0xb8, 0xaf}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x28, 0xaf},
+    {0x5c, 0xf3}, {0x8f, 0xdf}, {0xc2, 0xb5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xcc, 0x5d},
+    {0xcc, 0xd5}, {0xcc, 0x3a}, {0xcc, 0xbc}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x70, 0x0a},
+    {0x3d, 0xb7}, {0x0a, 0x95}, {0xd7, 0xc2}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x14, 0xb7},
+    {0xae, 0x98}, {0x47, 0xf0}, {0xe1, 0xc8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xb8, 0x65},
+    {0x1e, 0x7a}, {0x85, 0x4b}, {0xeb, 0xcf}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x5c, 0x12},
+    {0x8f, 0x5c}, {0xc2, 0xa6}, {0xf5, 0xd5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x01, 0xc0},
+    {0x00, 0x3d}, {0x00, 0x01}, {0x00, 0xdc}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0xa3, 0x6d},
+    {0x70, 0x1f}, {0x3d, 0x5c}, {0x0a, 0xe2}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x47, 0x1a},
+    {0xe1, 0x01}, {0x7a, 0xb7}, {0x14, 0xe8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0xeb, 0xc8},
+    {0x51, 0xe2}, {0xb8, 0x11}, {0x1e, 0xef}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x8f, 0x75},
+    {0xc2, 0xc4}, {0xf5, 0x6c}, {0x28, 0xf5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x33, 0x22},
+    {0x33, 0xa6}, {0x33, 0xc7}, {0x33, 0xfb}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xd7, 0xd0},
+    {0xa3, 0x87}, {0x70, 0x22}, {0x3d, 0x02}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x7a, 0x7d},
+    {0x14, 0x69}, {0xae, 0x7d}, {0x47, 0x08}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x1e, 0x2a},
+    {0x85, 0x4b}, {0xeb, 0xd8}, {0x51, 0x0e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xc2, 0xd8},
+    {0xf5, 0x2c}, {0x28, 0x33}, {0x5c, 0x15}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x66, 0x85},
+    {0x66, 0x0e}, {0x66, 0x8e}, {0x66, 0x1b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x0a, 0x33},
+    {0xd7, 0xf0}, {0xa3, 0xe8}, {0x70, 0x21}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xae, 0xe0},
+    {0x47, 0xd1}, {0xe1, 0x43}, {0x7a, 0x28}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x51, 0x8d},
+    {0xb8, 0xb3}, {0x1e, 0x9e}, {0x85, 0x2e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xf5, 0x3b},
+    {0x28, 0x95}, {0x5c, 0xf9}, {0x8f, 0x34}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x99, 0xe8},
+    {0x99, 0x76}, {0x99, 0x54}, {0x99, 0x3b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x3d, 0x95},
+    {0x0a, 0x58}, {0xd7, 0xaf}, {0xa3, 0x41}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xe1, 0x43},
+    {0x7a, 0x3a}, {0x14, 0x0a}, {0xae, 0x48}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x85, 0xf0},
+    {0xeb, 0x1b}, {0x51, 0x65}, {0xb8, 0x4e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x28, 0x9d},
+    {0x5c, 0xfd}, {0x8f, 0xbf}, {0xc2, 0x54}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xcc, 0x4b},
+    {0xcc, 0xdf}, {0xcc, 0x1a}, {0xcc, 0x5b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x70, 0xf8},
+    {0x3d, 0xc0}, {0x0a, 0x75}, {0xd7, 0x61}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x14, 0xa5},
+    {0xae, 0xa2}, {0x47, 0xd0}, {0xe1, 0x67}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xb8, 0x53},
+    {0x1e, 0x84}, {0x85, 0x2b}, {0xeb, 0x6e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x5c, 0x00},
+    {0x8f, 0x66}, {0xc2, 0x86}, {0xf5, 0x74}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x01, 0xae},
+    {0x00, 0x47}, {0x00, 0xe1}, {0x00, 0x7a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xa3, 0x5b},
+    {0x70, 0x29}, {0x3d, 0x3c}, {0x0a, 0x81}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x47, 0x08},
+    {0xe1, 0x0b}, {0x7a, 0x97}, {0x14, 0x87}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xeb, 0xb6},
+    {0x51, 0xec}, {0xb8, 0xf1}, {0x1e, 0x8d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x8f, 0x63},
+    {0xc2, 0xce}, {0xf5, 0x4c}, {0x28, 0x94}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x33, 0x10},
+    {0x33, 0xb0}, {0x33, 0xa7}, {0x33, 0x9a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xd7, 0xbe},
+    {0xa3, 0x91}, {0x70, 0x02}, {0x3d, 0xa1}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x7a, 0x6b},
+    {0x14, 0x73}, {0xae, 0x5d}, {0x47, 0xa7}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x1e, 0x18},
+    {0x85, 0x55}, {0xeb, 0xb8}, {0x51, 0xad}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xc2, 0xc6},
+    {0xf5, 0x36}, {0x28, 0x13}, {0x5c, 0xb4}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x66, 0x73},
+    {0x66, 0x18}, {0x66, 0x6e}, {0x66, 0xba}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x0a, 0x21},
+    {0xd7, 0xfa}, {0xa3, 0xc8}, {0x70, 0xc0}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xae, 0xce},
+    {0x47, 0xdb}, {0xe1, 0x23}, {0x7a, 0xc7}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x51, 0x7b},
+    {0xb8, 0xbd}, {0x1e, 0x7e}, {0x85, 0xcd}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xf5, 0x29},
+    {0x28, 0x9f}, {0x5c, 0xd9}, {0x8f, 0xd3}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x99, 0xd6},
+    {0x99, 0x80}, {0x99, 0x34}, {0x99, 0xda}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x3d, 0x83},
+    {0x0a, 0x62}, {0xd7, 0x8f}, {0xa3, 0xe0}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xe1, 0x31},
+    {0x7a, 0x44}, {0x14, 0xea}, {0xae, 0xe6}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x85, 0xde},
+    {0xeb, 0x25}, {0x51, 0x45}, {0xb8, 0xed}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x28, 0x8b},
+    {0x5c, 0x07}, {0x8f, 0xa0}, {0xc2, 0xf3}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xcc, 0x39},
+    {0xcc, 0xe9}, {0xcc, 0xfa}, {0xcc, 0xf9}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x15}, {0x08, 0x10}, {0x70, 0xe6},
+    {0x3d, 0xca}, {0x0a, 0x55}, {0xd7, 0x00}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x15}, {0x08, 0x10}, {0x14, 0x94},
+    {0xae, 0xac}, {0x47, 0xb0}, {0xe1, 0x06}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x15}, {0x08, 0x10}, {0xb8, 0x41},
+    {0x1e, 0x8e}, {0x85, 0x0b}, {0xeb, 0x0d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x15}, {0x08, 0x10}, {0x5c, 0xee},
+    {0x8f, 0x6f}, {0xc2, 0x66}, {0xf5, 0x13}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x01, 0x9c},
+    {0x00, 0x51}, {0x00, 0xc1}, {0x00, 0x19}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xa3, 0x49},
+    {0x70, 0x33}, {0x3d, 0x1c}, {0x0a, 0x20}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x47, 0xf6},
+    {0xe1, 0x14}, {0x7a, 0x77}, {0x14, 0x26}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xeb, 0xa4},
+    {0x51, 0xf6}, {0xb8, 0xd1}, {0x1e, 0x2c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x8f, 0x51},
+    {0xc2, 0xd8}, {0xf5, 0x2c}, {0x28, 0x33}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x33, 0xfe},
+    {0x33, 0xb9}, {0x33, 0x87}, {0x33, 0x39}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xd7, 0xac},
+    {0xa3, 0x9b}, {0x70, 0xe2}, {0x3d, 0x3f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x7a, 0x59},
+    {0x14, 0x7d}, {0xae, 0x3d}, {0x47, 0x46}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x1e, 0x06},
+    {0x85, 0x5f}, {0xeb, 0x98}, {0x51, 0x4c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xc2, 0xb4},
+    {0xf5, 0x40}, {0x28, 0xf3}, {0x5c, 0x52}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x66, 0x61},
+    {0x66, 0x22}, {0x66, 0x4e}, {0x66, 0x59}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x0a, 0x0f},
+    {0xd7, 0x04}, {0xa3, 0xa9}, {0x70, 0x5f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xae, 0xbc},
+    {0x47, 0xe5}, {0xe1, 0x03}, {0x7a, 0x66}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x51, 0x69},
+    {0xb8, 0xc7}, {0x1e, 0x5e}, {0x85, 0x6c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xf5, 0x17},
+    {0x28, 0xa9}, {0x5c, 0xb9}, {0x8f, 0x72}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x99, 0xc4},
+    {0x99, 0x8a}, {0x99, 0x14}, {0x99, 0x79}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x3d, 0x71},
+    {0x0a, 0x6c}, {0xd7, 0x6f}, {0xa3, 0x7f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xe1, 0x1f},
+    {0x7a, 0x4e}, {0x14, 0xca}, {0xae, 0x85}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x85, 0xcc},
+    {0xeb, 0x2f}, {0x51, 0x25}, {0xb8, 0x8c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x28, 0x79},
+    {0x5c, 0x11}, {0x8f, 0x80}, {0xc2, 0x92}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xcc, 0x27},
+    {0xcc, 0xf3}, {0xcc, 0xda}, {0xcc, 0x98}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x70, 0xd4},
+    {0x3d, 0xd4}, {0x0a, 0x35}, {0xd7, 0x9f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x14, 0x82},
+    {0xae, 0xb6}, {0x47, 0x90}, {0xe1, 0xa5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xb8, 0x2f},
+    {0x1e, 0x98}, {0x85, 0xeb}, {0xeb, 0xab}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x5c, 0xdc},
+    {0x8f, 0x79}, {0xc2, 0x46}, {0xf5, 0xb2}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x01, 0x8a},
+    {0x00, 0x5b}, {0x00, 0xa1}, {0x00, 0xb8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0xa3, 0x37},
+    {0x70, 0x3d}, {0x3d, 0xfc}, {0x0a, 0xbe}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x47, 0xe4},
+    {0xe1, 0x1e}, {0x7a, 0x57}, {0x14, 0xc5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0xeb, 0x92},
+    {0x51, 0x00}, {0xb8, 0xb2}, {0x1e, 0xcb}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x8f, 0x3f},
+    {0xc2, 0xe2}, {0xf5, 0x0c}, {0x28, 0xd2}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x33, 0xec},
+    {0x33, 0xc3}, {0x33, 0x67}, {0x33, 0xd8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0xd7, 0x9a},
+    {0xa3, 0xa5}, {0x70, 0xc2}, {0x3d, 0xde}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x7a, 0x47},
+    {0x14, 0x87}, {0xae, 0x1d}, {0x47, 0xe5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x1e, 0xf4},
+    {0x85, 0x68}, {0xeb, 0x78}, {0x51, 0xeb}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0xc2, 0xa2},
+    {0xf5, 0x4a}, {0x28, 0xd3}, {0x5c, 0xf1}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x66, 0x4f},
+    {0x66, 0x2c}, {0x66, 0x2e}, {0x66, 0xf8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x0a, 0xfd},
+    {0xd7, 0x0d}, {0xa3, 0x89}, {0x70, 0xfe}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0xae, 0xaa},
+    {0x47, 0xef}, {0xe1, 0xe3}, {0x7a, 0x04}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x51, 0x57},
+    {0xb8, 0xd1}, {0x1e, 0x3e}, {0x85, 0x0b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0xf5, 0x05},
+    {0x28, 0xb3}, {0x5c, 0x99}, {0x8f, 0x11}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x99, 0xb2},
+    {0x99, 0x94}, {0x99, 0xf4}, {0x99, 0x17}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x3d, 0x5f},
+    {0x0a, 0x76}, {0xd7, 0x4f}, {0xa3, 0x1e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0xe1, 0x0d},
+    {0x7a, 0x58}, {0x14, 0xaa}, {0xae, 0x24}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x85, 0xba},
+    {0xeb, 0x39}, {0x51, 0x05}, {0xb8, 0x2b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x28, 0x67},
+    {0x5c, 0x1b}, {0x8f, 0x60}, {0xc2, 0x31}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0xcc, 0x15},
+    {0xcc, 0xfd}, {0xcc, 0xba}, {0xcc, 0x37}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x70, 0xc2},
+    {0x3d, 0xde}, {0x0a, 0x15}, {0xd7, 0x3e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x14, 0x70},
+    {0xae, 0xc0}, {0x47, 0x70}, {0xe1, 0x44}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0xb8, 0x1d},
+    {0x1e, 0xa2}, {0x85, 0xcb}, {0xeb, 0x4a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x5c, 0xca},
+    {0x8f, 0x83}, {0xc2, 0x26}, {0xf5, 0x51}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x01, 0x78},
+    {0x00, 0x65}, {0x00, 0x81}, {0x00, 0x57}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0xa3, 0x25},
+    {0x70, 0x47}, {0x3d, 0xdc}, {0x0a, 0x5d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x47, 0xd2},
+    {0xe1, 0x28}, {0x7a, 0x37}, {0x14, 0x64}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0xeb, 0x80},
+    {0x51, 0x0a}, {0xb8, 0x92}, {0x1e, 0x6a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x8f, 0x2d},
+    {0xc2, 0xec}, {0xf5, 0xec}, {0x28, 0x70}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x33, 0xda},
+    {0x33, 0xcd}, {0x33, 0x47}, {0x33, 0x77}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0xd7, 0x88},
+    {0xa3, 0xaf}, {0x70, 0xa2}, {0x3d, 0x7d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x7a, 0x35},
+    {0x14, 0x91}, {0xae, 0xfd}, {0x47, 0x83}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x1e, 0xe2},
+    {0x85, 0x72}, {0xeb, 0x58}, {0x51, 0x8a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0xc2, 0x90},
+    {0xf5, 0x54}, {0x28, 0xb3}, {0x5c, 0x90}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x66, 0x3d},
+    {0x66, 0x36}, {0x66, 0x0e}, {0x66, 0x97}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x0a, 0xeb},
+    {0xd7, 0x17}, {0xa3, 0x69}, {0x70, 0x9d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0xae, 0x98},
+    {0x47, 0xf9}, {0xe1, 0xc3}, {0x7a, 0xa3}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x51, 0x45},
+    {0xb8, 0xdb}, {0x1e, 0x1e}, {0x85, 0xaa}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0xf5, 0xf3},
+    {0x28, 0xbc}, {0x5c, 0x79}, {0x8f, 0xb0}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x99, 0xa0},
+    {0x99, 0x9e}, {0x99, 0xd4}, {0x99, 0xb6}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x3d, 0x4d},
+    {0x0a, 0x80}, {0xd7, 0x2f}, {0xa3, 0xbd}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0xe1, 0xfb},
+    {0x7a, 0x61}, {0x14, 0x8a}, {0xae, 0xc3}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x85, 0xa8},
+    {0xeb, 0x43}, {0x51, 0xe5}, {0xb8, 0xc9}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x28, 0x55},
+    {0x5c, 0x25}, {0x8f, 0x40}, {0xc2, 0xd0}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0xcc, 0x03},
+    {0xcc, 0x07}, {0xcc, 0x9b}, {0xcc, 0xd6}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x70, 0xb0},
+    {0x3d, 0xe8}, {0x0a, 0xf5}, {0xd7, 0xdc}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x14, 0x5e},
+    {0xae, 0xca}, {0x47, 0x50}, {0xe1, 0xe3}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0xb8, 0x0b},
+    {0x1e, 0xac}, {0x85, 0xab}, {0xeb, 0xe9}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x5c, 0xb8},
+    {0x8f, 0x8d}, {0xc2, 0x06}, {0xf5, 0xf0}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x16}, {0x08, 0x10}, {0x01, 0x66},
+    {0x00, 0x6f}, {0x00, 0x61}, {0x00, 0xf6}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x16}, {0x08, 0x10}, {0xa3, 0x13},
+    {0x70, 0x51}, {0x3d, 0xbc}, {0x0a, 0xfc}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x47, 0xc0},
+    {0xe1, 0x32}, {0x7a, 0x17}, {0x14, 0x03}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0xeb, 0x6e},
+    {0x51, 0x14}, {0xb8, 0x72}, {0x1e, 0x09}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x8f, 0x1b},
+    {0xc2, 0xf6}, {0xf5, 0xcc}, {0x28, 0x0f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x33, 0xc8},
+    {0x33, 0xd7}, {0x33, 0x27}, {0x33, 0x16}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0xd7, 0x76},
+    {0xa3, 0xb9}, {0x70, 0x82}, {0x3d, 0x1c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x7a, 0x23},
+    {0x14, 0x9b}, {0xae, 0xdd}, {0x47, 0x22}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x1e, 0xd0},
+    {0x85, 0x7c}, {0xeb, 0x38}, {0x51, 0x29}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0xc2, 0x7e},
+    {0xf5, 0x5e}, {0x28, 0x93}, {0x5c, 0x2f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x66, 0x2b},
+    {0x66, 0x40}, {0x66, 0xee}, {0x66, 0x35}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x0a, 0xd9},
+    {0xd7, 0x21}, {0xa3, 0x49}, {0x70, 0x3c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0xae, 0x86},
+    {0x47, 0x03}, {0xe1, 0xa4}, {0x7a, 0x42}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x51, 0x33},
+    {0xb8, 0xe5}, {0x1e, 0xfe}, {0x85, 0x48}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0xf5, 0xe1},
+    {0x28, 0xc6}, {0x5c, 0x59}, {0x8f, 0x4f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x99, 0x8e},
+    {0x99, 0xa8}, {0x99, 0xb4}, {0x99, 0x55}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x3d, 0x3b},
+    {0x0a, 0x8a}, {0xd7, 0x0f}, {0xa3, 0x5c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0xe1, 0xe9},
+    {0x7a, 0x6b}, {0x14, 0x6a}, {0xae, 0x62}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x85, 0x96},
+    {0xeb, 0x4d}, {0x51, 0xc5}, {0xb8, 0x68}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x28, 0x43},
+    {0x5c, 0x2f}, {0x8f, 0x20}, {0xc2, 0x6f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0xcc, 0xf1},
+    {0xcc, 0x10}, {0xcc, 0x7b}, {0xcc, 0x75}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x70, 0x9e},
+    {0x3d, 0xf2}, {0x0a, 0xd5}, {0xd7, 0x7b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x14, 0x4c},
+    {0xae, 0xd4}, {0x47, 0x30}, {0xe1, 0x82}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0xb8, 0xf9},
+    {0x1e, 0xb5}, {0x85, 0x8b}, {0xeb, 0x88}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x25, 0x17}, {0x08, 0x10}, {0x5c, 0xa6},
+    {0x8f, 0x97}, {0xc2, 0xe6}, {0xf5, 0x8e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x26, 0x17}, {0x08, 0x10}, {0x01, 0x54},
+    {0x00, 0x79}, {0x00, 0x41}, {0x00, 0x95}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x26, 0x17}, {0x08, 0x10}, {0xa3, 0x01},
+    {0x70, 0x5b}, {0x3d, 0x9c}, {0x0a, 0x9b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x26, 0x17}, {0x08, 0x10}, {0x47, 0xae},
+    {0xe1, 0x3c}, {0x7a, 0xf7}, {0x14, 0xa1}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x26, 0x17}, {0x08, 0x10}, {0xeb, 0x5c},
+    {0x51, 0x1e}, {0xb8, 0x52}, {0x1e, 0xa8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x26, 0x17}, {0x08, 0x10}, {0x8f, 0x09},
+    {0xc2, 0x00}, {0xf5, 0xad}, {0x28, 0xae}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x26, 0x17}, {0x08, 0x10}, {0x33, 0xb6},
+    {0x33, 0xe1}, {0x33, 0x07}, {0x33, 0xb5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x26, 0x17}, {0x08, 0x10}, {0xd7, 0x64},
+    {0xa3, 0xc3}, {0x70, 0x62}, {0x3d, 0xbb}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x26, 0x17}, {0x08, 0x10}, {0x7a, 0x11},
+    {0x14, 0xa5}, {0xae, 0xbd}, {0x47, 0xc1}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x26, 0x17}, {0x08, 0x10}, {0x1e, 0xbe},
+    {0x85, 0x86}, {0xeb, 0x18}, {0x51, 0xc8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x26, 0x17}, {0x08, 0x10}, {0xc2, 0x6c},
+    {0xf5, 0x68}, {0x28, 0x73}, {0x5c, 0xce}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x26, 0x17}, {0x08, 0x10}, {0x66, 0x19},
+    {0x66, 0x4a}, {0x66, 0xce}, {0x66, 0xd4}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x26, 0x17}, {0x08, 0x10}, {0x0a, 0xc7},
+    {0xd7, 0x2b}, {0xa3, 0x29}, {0x70, 0xdb}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x26, 0x17}, {0x08, 0x10}, {0xae, 0x74},
+    {0x47, 0x0d}, {0xe1, 0x84}, {0x7a, 0xe1}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x26, 0x17}, {0x08, 0x10}, {0x51, 0x21},
+    {0xb8, 0xef}, {0x1e, 0xde}, {0x85, 0xe7}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x26, 0x17}, {0x08, 0x10}, {0xf5, 0xcf},
+    {0x28, 0xd0}, {0x5c, 0x39}, {0x8f, 0xee}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x26, 0x17}, {0x08, 0x10}, {0x99, 0x7c},
+    {0x99, 0xb2}, {0x99, 0x94}, {0x99, 0xf4}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x26, 0x17}, {0x08, 0x10}, {0x3d, 0x29},
+    {0x0a, 0x94}, {0xd7, 0xef}, {0xa3, 0xfa}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x26, 0x18}, {0x08, 0x10}, {0xe1, 0xd7},
+    {0x7a, 0x75}, {0x14, 0x4a}, {0xae, 0x01}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x26, 0x18}, {0x08, 0x10}, {0x85, 0x84},
+    {0xeb, 0x57}, {0x51, 0xa5}, {0xb8, 0x07}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x26, 0x18}, {0x08, 0x10}, {0x28, 0x31},
+    {0x5c, 0x39}, {0x8f, 0x00}, {0xc2, 0x0e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x26, 0x18}, {0x08, 0x10}, {0xcc, 0xdf},
+    {0xcc, 0x1a}, {0xcc, 0x5b}, {0xcc, 0x14}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x26, 0x18}, {0x08, 0x10}, {0x70, 0x8c},
+    {0x3d, 0xfc}, {0x0a, 0xb5}, {0xd7, 0x1a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x26, 0x18}, {0x08, 0x10}, {0x14, 0x3a},
+    {0xae, 0xde}, {0x47, 0x10}, {0xe1, 0x21}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x26, 0x18}, {0x08, 0x10}, {0xb8, 0xe7},
+    {0x1e, 0xbf}, {0x85, 0x6b}, {0xeb, 0x27}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x26, 0x18}, {0x08, 0x10}, {0x5c, 0x94},
+    {0x8f, 0xa1}, {0xc2, 0xc6}, {0xf5, 0x2d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0x01, 0x42},
+    {0x00, 0x83}, {0x00, 0x21}, {0x00, 0x34}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0xa3, 0xef},
+    {0x70, 0x64}, {0x3d, 0x7c}, {0x0a, 0x3a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0x47, 0x9c},
+    {0xe1, 0x46}, {0x7a, 0xd7}, {0x14, 0x40}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0xeb, 0x4a},
+    {0x51, 0x28}, {0xb8, 0x32}, {0x1e, 0x47}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0x8f, 0xf7},
+    {0xc2, 0x09}, {0xf5, 0x8d}, {0x28, 0x4d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0x33, 0xa4},
+    {0x33, 0xeb}, {0x33, 0xe7}, {0x33, 0x53}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0xd7, 0x52},
+    {0xa3, 0xcd}, {0x70, 0x42}, {0x3d, 0x5a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0x7a, 0xff},
+    {0x14, 0xae}, {0xae, 0x9d}, {0x47, 0x60}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0x1e, 0xac},
+    {0x85, 0x90}, {0xeb, 0xf8}, {0x51, 0x66}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0xc2, 0x5a},
+    {0xf5, 0x72}, {0x28, 0x53}, {0x5c, 0x6d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0x66, 0x07},
+    {0x66, 0x54}, {0x66, 0xae}, {0x66, 0x73}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0x0a, 0xb5},
+    {0xd7, 0x35}, {0xa3, 0x09}, {0x70, 0x7a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0xae, 0x62},
+    {0x47, 0x17}, {0xe1, 0x64}, {0x7a, 0x80}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0x51, 0x0f},
+    {0xb8, 0xf9}, {0x1e, 0xbe}, {0x85, 0x86}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0xf5, 0xbd},
+    {0x28, 0xda}, {0x5c, 0x19}, {0x8f, 0x8d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0x99, 0x6a},
+    {0x99, 0xbc}, {0x99, 0x74}, {0x99, 0x93}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0x3d, 0x17},
+    {0x0a, 0x9e}, {0xd7, 0xcf}, {0xa3, 0x99}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0xe1, 0xc5},
+    {0x7a, 0x7f}, {0x14, 0x2a}, {0xae, 0xa0}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0x85, 0x72},
+    {0xeb, 0x61}, {0x51, 0x85}, {0xb8, 0xa6}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0x28, 0x1f},
+    {0x5c, 0x43}, {0x8f, 0xe0}, {0xc2, 0xac}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0xcc, 0xcd},
+    {0xcc, 0x24}, {0xcc, 0x3b}, {0xcc, 0xb3}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0x70, 0x7a},
+    {0x3d, 0x06}, {0x0a, 0x96}, {0xd7, 0xb9}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0x14, 0x28},
+    {0xae, 0xe8}, {0x47, 0xf0}, {0xe1, 0xbf}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0xb8, 0xd5},
+    {0x1e, 0xc9}, {0x85, 0x4b}, {0xeb, 0xc6}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x04, 0x04}, {0x10, 0x10}, {0xe4, 0xe4}, {0x27, 0x18}, {0x08, 0x10}, {0x5c, 0x82},
+    {0x8f, 0xab}, {0xc2, 0xa6}, {0xf5, 0xcc}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x01, 0xe4},
+    {0x00, 0x29}, {0x00, 0x41}, {0x00, 0x9e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x7a, 0x26},
+    {0x14, 0x53}, {0xae, 0x05}, {0x07, 0xa3}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xf5, 0x68},
+    {0x28, 0x7c}, {0x5c, 0xc9}, {0x0f, 0xa7}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x70, 0xaa},
+    {0x3d, 0xa5}, {0x0a, 0x8d}, {0x17, 0xac}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xeb, 0xec},
+    {0x51, 0xce}, {0xb8, 0x51}, {0x1e, 0xb1}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x66, 0x2e},
+    {0x66, 0xf8}, {0x66, 0x15}, {0x26, 0xb6}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xe1, 0x70},
+    {0x7a, 0x21}, {0x14, 0xda}, {0x2e, 0xba}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x5c, 0xb2},
+    {0x8f, 0x4a}, {0xc2, 0x9e}, {0x35, 0xbf}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xd7, 0xf4},
+    {0xa3, 0x73}, {0x70, 0x62}, {0x3d, 0xc4}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x51, 0x36},
+    {0xb8, 0x9d}, {0x1e, 0x26}, {0x45, 0xc9}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xcc, 0x78},
+    {0xcc, 0xc6}, {0xcc, 0xea}, {0x4c, 0xcd}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x47, 0xba},
+    {0xe1, 0xef}, {0x7a, 0xae}, {0x54, 0xd2}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xc2, 0xfc},
+    {0xf5, 0x18}, {0x28, 0x73}, {0x5c, 0xd7}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x3d, 0x3e},
+    {0x0a, 0x42}, {0xd7, 0x37}, {0x63, 0xdc}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xb8, 0x80},
+    {0x1e, 0x6b}, {0x85, 0xfb}, {0x6b, 0xe0}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x33, 0xc2},
+    {0x33, 0x94}, {0x33, 0xbf}, {0x73, 0xe5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xae, 0x04},
+    {0x47, 0xbe}, {0xe1, 0x83}, {0x7a, 0xea}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x28, 0x46},
+    {0x5c, 0xe7}, {0x8f, 0x47}, {0x82, 0xef}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0xa3, 0x88},
+    {0x70, 0x10}, {0x3d, 0x0c}, {0x8a, 0xf4}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x1e, 0xca},
+    {0x85, 0x39}, {0xeb, 0xd0}, {0x91, 0xf8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x12}, {0x08, 0x10}, {0x99, 0x0c},
+    {0x99, 0x63}, {0x99, 0x94}, {0x99, 0xfd}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x14, 0x4e},
+    {0xae, 0x8c}, {0x47, 0x58}, {0xa1, 0x02}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x8f, 0x90},
+    {0xc2, 0xb5}, {0xf5, 0x1c}, {0xa8, 0x07}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x0a, 0xd2},
+    {0xd7, 0xde}, {0xa3, 0xe0}, {0xb0, 0x0b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x85, 0x14},
+    {0xeb, 0x08}, {0x51, 0xa5}, {0xb8, 0x10}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x00, 0x56},
+    {0x00, 0x31}, {0x00, 0x69}, {0xc0, 0x15}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x7a, 0x98},
+    {0x14, 0x5a}, {0xae, 0x2d}, {0xc7, 0x1a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0xf5, 0xda},
+    {0x28, 0x83}, {0x5c, 0xf1}, {0xcf, 0x1e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x70, 0x1c},
+    {0x3d, 0xad}, {0x0a, 0xb5}, {0xd7, 0x23}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0xeb, 0x5e},
+    {0x51, 0xd6}, {0xb8, 0x79}, {0xde, 0x28}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x66, 0xa0},
+    {0x66, 0xff}, {0x66, 0x3d}, {0xe6, 0x2d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0xe1, 0xe2},
+    {0x7a, 0x28}, {0x14, 0x02}, {0xee, 0x32}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0x5c, 0x24},
+    {0x8f, 0x52}, {0xc2, 0xc6}, {0xf5, 0x36}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1e, 0x13}, {0x08, 0x10}, {0xd7, 0x66},
+    {0xa3, 0x7b}, {0x70, 0x8a}, {0xfd, 0x3b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x51, 0xa8},
+    {0xb8, 0xa4}, {0x1e, 0x4e}, {0x05, 0x40}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xcc, 0xea},
+    {0xcc, 0xcd}, {0xcc, 0x12}, {0x0c, 0x45}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x47, 0x2c},
+    {0xe1, 0xf7}, {0x7a, 0xd6}, {0x14, 0x49}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xc2, 0x6e},
+    {0xf5, 0x20}, {0x28, 0x9b}, {0x1c, 0x4e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x3d, 0xb0},
+    {0x0a, 0x49}, {0xd7, 0x5f}, {0x23, 0x53}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xb8, 0xf2},
+    {0x1e, 0x72}, {0x85, 0x23}, {0x2b, 0x58}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x33, 0x34},
+    {0x33, 0x9c}, {0x33, 0xe7}, {0x33, 0x5c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xae, 0x76},
+    {0x47, 0xc5}, {0xe1, 0xab}, {0x3a, 0x61}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x28, 0xb8},
+    {0x5c, 0xee}, {0x8f, 0x6f}, {0x42, 0x66}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xa3, 0xfa},
+    {0x70, 0x17}, {0x3d, 0x34}, {0x4a, 0x6b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x1e, 0x3c},
+    {0x85, 0x41}, {0xeb, 0xf8}, {0x51, 0x6f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x99, 0x7e},
+    {0x99, 0x6a}, {0x99, 0xbc}, {0x59, 0x74}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x14, 0xc0},
+    {0xae, 0x93}, {0x47, 0x80}, {0x61, 0x79}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x8f, 0x03},
+    {0xc2, 0xbd}, {0xf5, 0x44}, {0x68, 0x7e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x0a, 0x45},
+    {0xd7, 0xe6}, {0xa3, 0x08}, {0x70, 0x83}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x85, 0x87},
+    {0xeb, 0x0f}, {0x51, 0xcd}, {0x78, 0x87}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x00, 0xc9},
+    {0x00, 0x38}, {0x00, 0x91}, {0x80, 0x8c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x7a, 0x0b},
+    {0x14, 0x62}, {0xae, 0x55}, {0x87, 0x91}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xf5, 0x4d},
+    {0x28, 0x8b}, {0x5c, 0x19}, {0x8f, 0x96}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x70, 0x8f},
+    {0x3d, 0xb4}, {0x0a, 0xdd}, {0x97, 0x9a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xeb, 0xd1},
+    {0x51, 0xdd}, {0xb8, 0xa1}, {0x9e, 0x9f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x66, 0x13},
+    {0x66, 0x07}, {0x66, 0x66}, {0xa6, 0xa4}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xe1, 0x55},
+    {0x7a, 0x30}, {0x14, 0x2a}, {0xae, 0xa9}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x5c, 0x97},
+    {0x8f, 0x59}, {0xc2, 0xee}, {0xb5, 0xad}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xd7, 0xd9},
+    {0xa3, 0x82}, {0x70, 0xb2}, {0xbd, 0xb2}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x51, 0x1b},
+    {0xb8, 0xac}, {0x1e, 0x76}, {0xc5, 0xb7}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xcc, 0x5d},
+    {0xcc, 0xd5}, {0xcc, 0x3a}, {0xcc, 0xbc}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x47, 0x9f},
+    {0xe1, 0xfe}, {0x7a, 0xfe}, {0xd4, 0xc0}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xc2, 0xe1},
+    {0xf5, 0x27}, {0x28, 0xc3}, {0xdc, 0xc5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x3d, 0x23},
+    {0x0a, 0x51}, {0xd7, 0x87}, {0xe3, 0xca}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xb8, 0x65},
+    {0x1e, 0x7a}, {0x85, 0x4b}, {0xeb, 0xcf}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0x33, 0xa7},
+    {0x33, 0xa3}, {0x33, 0x0f}, {0xf3, 0xd4}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x1f, 0x13}, {0x08, 0x10}, {0xae, 0xe9},
+    {0x47, 0xcc}, {0xe1, 0xd3}, {0xfa, 0xd8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x28, 0x2b},
+    {0x5c, 0xf6}, {0x8f, 0x97}, {0x02, 0xdd}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0xa3, 0x6d},
+    {0x70, 0x1f}, {0x3d, 0x5c}, {0x0a, 0xe2}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x1e, 0xaf},
+    {0x85, 0x48}, {0xeb, 0x20}, {0x11, 0xe7}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x99, 0xf1},
+    {0x99, 0x71}, {0x99, 0xe4}, {0x19, 0xeb}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x14, 0x33},
+    {0xae, 0x9b}, {0x47, 0xa8}, {0x21, 0xf0}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x8f, 0x75},
+    {0xc2, 0xc4}, {0xf5, 0x6c}, {0x28, 0xf5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x0a, 0xb7},
+    {0xd7, 0xed}, {0xa3, 0x30}, {0x30, 0xfa}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x13}, {0x08, 0x10}, {0x85, 0xf9},
+    {0xeb, 0x16}, {0x51, 0xf5}, {0x38, 0xfe}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x00, 0x3b},
+    {0x00, 0x40}, {0x00, 0xb9}, {0x40, 0x03}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x7a, 0x7d},
+    {0x14, 0x69}, {0xae, 0x7d}, {0x47, 0x08}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xf5, 0xbf},
+    {0x28, 0x92}, {0x5c, 0x41}, {0x4f, 0x0d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x70, 0x01},
+    {0x3d, 0xbc}, {0x0a, 0x05}, {0x57, 0x12}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xeb, 0x43},
+    {0x51, 0xe5}, {0xb8, 0xc9}, {0x5e, 0x16}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x66, 0x85},
+    {0x66, 0x0e}, {0x66, 0x8e}, {0x66, 0x1b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xe1, 0xc7},
+    {0x7a, 0x37}, {0x14, 0x52}, {0x6e, 0x20}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x5c, 0x09},
+    {0x8f, 0x61}, {0xc2, 0x16}, {0x75, 0x25}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xd7, 0x4b},
+    {0xa3, 0x8a}, {0x70, 0xda}, {0x7d, 0x29}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x51, 0x8d},
+    {0xb8, 0xb3}, {0x1e, 0x9e}, {0x85, 0x2e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xcc, 0xcf},
+    {0xcc, 0xdc}, {0xcc, 0x62}, {0x8c, 0x33}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x47, 0x11},
+    {0xe1, 0x06}, {0x7a, 0x27}, {0x94, 0x38}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xc2, 0x53},
+    {0xf5, 0x2f}, {0x28, 0xeb}, {0x9c, 0x3c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x3d, 0x95},
+    {0x0a, 0x58}, {0xd7, 0xaf}, {0xa3, 0x41}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xb8, 0xd7},
+    {0x1e, 0x81}, {0x85, 0x73}, {0xab, 0x46}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x33, 0x19},
+    {0x33, 0xab}, {0x33, 0x37}, {0xb3, 0x4b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xae, 0x5b},
+    {0x47, 0xd4}, {0xe1, 0xfb}, {0xba, 0x4f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x28, 0x9d},
+    {0x5c, 0xfd}, {0x8f, 0xbf}, {0xc2, 0x54}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0xa3, 0xdf},
+    {0x70, 0x26}, {0x3d, 0x84}, {0xca, 0x59}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x1e, 0x21},
+    {0x85, 0x50}, {0xeb, 0x48}, {0xd1, 0x5e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x99, 0x63},
+    {0x99, 0x79}, {0x99, 0x0c}, {0xd9, 0x63}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x14, 0xa5},
+    {0xae, 0xa2}, {0x47, 0xd0}, {0xe1, 0x67}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x8f, 0xe8},
+    {0xc2, 0xcb}, {0xf5, 0x94}, {0xe8, 0x6c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x0a, 0x2a},
+    {0xd7, 0xf5}, {0xa3, 0x58}, {0xf0, 0x71}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x20, 0x14}, {0x08, 0x10}, {0x85, 0x6c},
+    {0xeb, 0x1e}, {0x51, 0x1d}, {0xf8, 0x76}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x01, 0xae},
+    {0x00, 0x47}, {0x00, 0xe1}, {0x00, 0x7a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x7a, 0xf0},
+    {0x14, 0x70}, {0xae, 0xa5}, {0x07, 0x7f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xf5, 0x32},
+    {0x28, 0x9a}, {0x5c, 0x69}, {0x0f, 0x84}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x70, 0x74},
+    {0x3d, 0xc3}, {0x0a, 0x2d}, {0x17, 0x89}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xeb, 0xb6},
+    {0x51, 0xec}, {0xb8, 0xf1}, {0x1e, 0x8d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x66, 0xf8},
+    {0x66, 0x15}, {0x66, 0xb6}, {0x26, 0x92}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xe1, 0x3a},
+    {0x7a, 0x3f}, {0x14, 0x7a}, {0x2e, 0x97}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x5c, 0x7c},
+    {0x8f, 0x68}, {0xc2, 0x3e}, {0x35, 0x9c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xd7, 0xbe},
+    {0xa3, 0x91}, {0x70, 0x02}, {0x3d, 0xa1}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x51, 0x00},
+    {0xb8, 0xbb}, {0x1e, 0xc6}, {0x45, 0xa5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xcc, 0x42},
+    {0xcc, 0xe4}, {0xcc, 0x8a}, {0x4c, 0xaa}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x47, 0x84},
+    {0xe1, 0x0d}, {0x7a, 0x4f}, {0x54, 0xaf}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xc2, 0xc6},
+    {0xf5, 0x36}, {0x28, 0x13}, {0x5c, 0xb4}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x3d, 0x08},
+    {0x0a, 0x60}, {0xd7, 0xd7}, {0x63, 0xb8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xb8, 0x4a},
+    {0x1e, 0x89}, {0x85, 0x9b}, {0x6b, 0xbd}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x33, 0x8c},
+    {0x33, 0xb2}, {0x33, 0x5f}, {0x73, 0xc2}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xae, 0xce},
+    {0x47, 0xdb}, {0xe1, 0x23}, {0x7a, 0xc7}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x28, 0x10},
+    {0x5c, 0x05}, {0x8f, 0xe8}, {0x82, 0xcb}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xa3, 0x52},
+    {0x70, 0x2e}, {0x3d, 0xac}, {0x8a, 0xd0}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x1e, 0x94},
+    {0x85, 0x57}, {0xeb, 0x70}, {0x91, 0xd5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x99, 0xd6},
+    {0x99, 0x80}, {0x99, 0x34}, {0x99, 0xda}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x14, 0x18},
+    {0xae, 0xaa}, {0x47, 0xf8}, {0xa1, 0xde}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x8f, 0x5a},
+    {0xc2, 0xd3}, {0xf5, 0xbc}, {0xa8, 0xe3}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x0a, 0x9c},
+    {0xd7, 0xfc}, {0xa3, 0x80}, {0xb0, 0xe8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x85, 0xde},
+    {0xeb, 0x25}, {0x51, 0x45}, {0xb8, 0xed}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x00, 0x20},
+    {0x00, 0x4f}, {0x00, 0x09}, {0xc0, 0xf2}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0x7a, 0x62},
+    {0x14, 0x78}, {0xae, 0xcd}, {0xc7, 0xf6}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x14}, {0x08, 0x10}, {0xf5, 0xa4},
+    {0x28, 0xa1}, {0x5c, 0x91}, {0xcf, 0xfb}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x15}, {0x08, 0x10}, {0x70, 0xe6},
+    {0x3d, 0xca}, {0x0a, 0x55}, {0xd7, 0x00}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x15}, {0x08, 0x10}, {0xeb, 0x28},
+    {0x51, 0xf4}, {0xb8, 0x19}, {0xde, 0x05}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x15}, {0x08, 0x10}, {0x66, 0x6a},
+    {0x66, 0x1d}, {0x66, 0xde}, {0xe6, 0x09}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x15}, {0x08, 0x10}, {0xe1, 0xac},
+    {0x7a, 0x46}, {0x14, 0xa2}, {0xee, 0x0e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x15}, {0x08, 0x10}, {0x5c, 0xee},
+    {0x8f, 0x6f}, {0xc2, 0x66}, {0xf5, 0x13}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x21, 0x15}, {0x08, 0x10}, {0xd7, 0x30},
+    {0xa3, 0x99}, {0x70, 0x2a}, {0xfd, 0x18}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x51, 0x72},
+    {0xb8, 0xc2}, {0x1e, 0xee}, {0x05, 0x1c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xcc, 0xb4},
+    {0xcc, 0xeb}, {0xcc, 0xb2}, {0x0c, 0x21}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x47, 0xf6},
+    {0xe1, 0x14}, {0x7a, 0x77}, {0x14, 0x26}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xc2, 0x38},
+    {0xf5, 0x3e}, {0x28, 0x3b}, {0x1c, 0x2b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x3d, 0x7a},
+    {0x0a, 0x67}, {0xd7, 0xff}, {0x23, 0x2f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xb8, 0xbc},
+    {0x1e, 0x90}, {0x85, 0xc3}, {0x2b, 0x34}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x33, 0xfe},
+    {0x33, 0xb9}, {0x33, 0x87}, {0x33, 0x39}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xae, 0x40},
+    {0x47, 0xe3}, {0xe1, 0x4b}, {0x3a, 0x3e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x28, 0x82},
+    {0x5c, 0x0c}, {0x8f, 0x10}, {0x42, 0x43}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xa3, 0xc4},
+    {0x70, 0x35}, {0x3d, 0xd4}, {0x4a, 0x47}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x1e, 0x06},
+    {0x85, 0x5f}, {0xeb, 0x98}, {0x51, 0x4c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x99, 0x48},
+    {0x99, 0x88}, {0x99, 0x5c}, {0x59, 0x51}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x14, 0x8b},
+    {0xae, 0xb1}, {0x47, 0x20}, {0x61, 0x56}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x8f, 0xcd},
+    {0xc2, 0xda}, {0xf5, 0xe4}, {0x68, 0x5a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x0a, 0x0f},
+    {0xd7, 0x04}, {0xa3, 0xa9}, {0x70, 0x5f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x85, 0x51},
+    {0xeb, 0x2d}, {0x51, 0x6d}, {0x78, 0x64}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x00, 0x93},
+    {0x00, 0x56}, {0x00, 0x31}, {0x80, 0x69}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x7a, 0xd5},
+    {0x14, 0x7f}, {0xae, 0xf5}, {0x87, 0x6d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xf5, 0x17},
+    {0x28, 0xa9}, {0x5c, 0xb9}, {0x8f, 0x72}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x70, 0x59},
+    {0x3d, 0xd2}, {0x0a, 0x7d}, {0x97, 0x77}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xeb, 0x9b},
+    {0x51, 0xfb}, {0xb8, 0x41}, {0x9e, 0x7c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x66, 0xdd},
+    {0x66, 0x24}, {0x66, 0x06}, {0xa6, 0x81}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xe1, 0x1f},
+    {0x7a, 0x4e}, {0x14, 0xca}, {0xae, 0x85}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x5c, 0x61},
+    {0x8f, 0x77}, {0xc2, 0x8e}, {0xb5, 0x8a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xd7, 0xa3},
+    {0xa3, 0xa0}, {0x70, 0x52}, {0xbd, 0x8f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x51, 0xe5},
+    {0xb8, 0xc9}, {0x1e, 0x16}, {0xc5, 0x94}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xcc, 0x27},
+    {0xcc, 0xf3}, {0xcc, 0xda}, {0xcc, 0x98}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x47, 0x69},
+    {0xe1, 0x1c}, {0x7a, 0x9f}, {0xd4, 0x9d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xc2, 0xab},
+    {0xf5, 0x45}, {0x28, 0x63}, {0xdc, 0xa2}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x3d, 0xed},
+    {0x0a, 0x6e}, {0xd7, 0x27}, {0xe3, 0xa7}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xb8, 0x2f},
+    {0x1e, 0x98}, {0x85, 0xeb}, {0xeb, 0xab}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0x33, 0x71},
+    {0x33, 0xc1}, {0x33, 0xaf}, {0xf3, 0xb0}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x22, 0x15}, {0x08, 0x10}, {0xae, 0xb3},
+    {0x47, 0xea}, {0xe1, 0x73}, {0xfa, 0xb5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x28, 0xf5},
+    {0x5c, 0x13}, {0x8f, 0x38}, {0x02, 0xba}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0xa3, 0x37},
+    {0x70, 0x3d}, {0x3d, 0xfc}, {0x0a, 0xbe}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x1e, 0x79},
+    {0x85, 0x66}, {0xeb, 0xc0}, {0x11, 0xc3}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x99, 0xbb},
+    {0x99, 0x8f}, {0x99, 0x84}, {0x19, 0xc8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x14, 0xfd},
+    {0xae, 0xb8}, {0x47, 0x48}, {0x21, 0xcd}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x8f, 0x3f},
+    {0xc2, 0xe2}, {0xf5, 0x0c}, {0x28, 0xd2}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x0a, 0x81},
+    {0xd7, 0x0b}, {0xa3, 0xd1}, {0x30, 0xd6}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x85, 0xc3},
+    {0xeb, 0x34}, {0x51, 0x95}, {0x38, 0xdb}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x00, 0x05},
+    {0x00, 0x5e}, {0x00, 0x59}, {0x40, 0xe0}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x7a, 0x47},
+    {0x14, 0x87}, {0xae, 0x1d}, {0x47, 0xe5}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0xf5, 0x89},
+    {0x28, 0xb0}, {0x5c, 0xe1}, {0x4f, 0xe9}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x70, 0xcb},
+    {0x3d, 0xd9}, {0x0a, 0xa5}, {0x57, 0xee}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0xeb, 0x0d},
+    {0x51, 0x03}, {0xb8, 0x6a}, {0x5e, 0xf3}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0x66, 0x4f},
+    {0x66, 0x2c}, {0x66, 0x2e}, {0x66, 0xf8}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x15}, {0x08, 0x10}, {0xe1, 0x91},
+    {0x7a, 0x55}, {0x14, 0xf2}, {0x6e, 0xfc}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x5c, 0xd3},
+    {0x8f, 0x7e}, {0xc2, 0xb6}, {0x75, 0x01}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0xd7, 0x15},
+    {0xa3, 0xa8}, {0x70, 0x7a}, {0x7d, 0x06}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x51, 0x57},
+    {0xb8, 0xd1}, {0x1e, 0x3e}, {0x85, 0x0b}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0xcc, 0x99},
+    {0xcc, 0xfa}, {0xcc, 0x02}, {0x8c, 0x10}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x47, 0xdb},
+    {0xe1, 0x23}, {0x7a, 0xc7}, {0x94, 0x14}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0xc2, 0x1d},
+    {0xf5, 0x4d}, {0x28, 0x8b}, {0x9c, 0x19}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x3d, 0x5f},
+    {0x0a, 0x76}, {0xd7, 0x4f}, {0xa3, 0x1e}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0xb8, 0xa1},
+    {0x1e, 0x9f}, {0x85, 0x13}, {0xab, 0x23}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x33, 0xe3},
+    {0x33, 0xc8}, {0x33, 0xd7}, {0xb3, 0x27}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0xae, 0x25},
+    {0x47, 0xf2}, {0xe1, 0x9b}, {0xba, 0x2c}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x28, 0x67},
+    {0x5c, 0x1b}, {0x8f, 0x60}, {0xc2, 0x31}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0xa3, 0xa9},
+    {0x70, 0x44}, {0x3d, 0x24}, {0xca, 0x36}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x1e, 0xeb},
+    {0x85, 0x6d}, {0xeb, 0xe8}, {0xd1, 0x3a}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x99, 0x2d},
+    {0x99, 0x97}, {0x99, 0xac}, {0xd9, 0x3f}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x14, 0x70},
+    {0xae, 0xc0}, {0x47, 0x70}, {0xe1, 0x44}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x8f, 0xb2},
+    {0xc2, 0xe9}, {0xf5, 0x34}, {0xe8, 0x49}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x0a, 0xf4},
+    {0xd7, 0x12}, {0xa3, 0xf9}, {0xf0, 0x4d}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x23, 0x16}, {0x08, 0x10}, {0x85, 0x36},
+    {0xeb, 0x3c}, {0x51, 0xbd}, {0xf8, 0x52}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} },
+  { {0xff, 0xff}, {0x03, 0x03}, {0x10, 0x10}, {0xe4, 0xe4}, {0x24, 0x16}, {0x08, 0x10}, {0x01, 0x78},
+    {0x00, 0x65}, {0x00, 0x81}, {0x00, 0x57}, {0x0a, 0x0a}, {0x10, 0x10}, {0x03, 0x03}, {0x04, 0x04} }
 };
@@ -24,4 +24,12 @@
 // ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
-extern const uint32_t scu32ia3d_DiffMifTbl [QUCPU_INT_NUMFRQ] [QUCPU_INT_NUMREG] [QUCPU_INT_NUMRCK];
+extern const uint32_t scu32ia1d_DiffMifAdrMsk [QUCPU_INT_NUMREG];
+extern const uint8_t  scu8ia3d_DiffMifDat [QUCPU_INT_NUMFRQ] [QUCPU_INT_NUMREG] [QUCPU_INT_NUMRCK];
+
+// Diff mif table entry: (AVMM address << 16) | (mask << 8) | data
+static inline uint32_t fu32i_GetDiffMif(uint64_t u64i_FrqInx, uint64_t u64i_MifReg, uint64_t u64i_Refclk)
+{
+	return (scu32ia1d_DiffMifAdrMsk[u64i_MifReg] |
+		scu8ia3d_DiffMifDat[u64i_FrqInx][u64i_MifReg][u64i_Refclk]);
+}
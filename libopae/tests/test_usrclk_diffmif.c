@@ -0,0 +1,82 @@
+// Copyright(c) 2017, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/*
+ * Exhaustive check of the split user clock diff mif table.
+ *
+ * Every (frequency, register, refclk) entry returned by fu32i_GetDiffMif()
+ * is folded into an FNV-1a hash and a plain sum, in the order of the
+ * original scu32ia3d_DiffMifTbl[frq][reg][rck]. The expected values were
+ * taken from that table before it was split, so any entry that does not
+ * reassemble to its original value fails the test.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "user_clk_pgm_uclock_freq_template_D.h"
+#include "user_clk_pgm_uclock_freq_template.h"
+#include "user_clk_pgm_uclock_freq_template_A.h"
+
+#define DIFFMIF_ENTRIES    33628
+#define DIFFMIF_FNV1A      0xdf71c106f9b390efULL
+#define DIFFMIF_SUM        0x0000009941a0ccf8ULL
+
+int main(void)
+{
+	uint64_t u64i_FrqInx, u64i_MifReg, u64i_Refclk;
+	uint64_t hash = 0xcbf29ce484222325ULL;
+	uint64_t sum = 0;
+	uint64_t entries = 0;
+	uint32_t entry;
+	int i;
+
+	for (u64i_FrqInx = 0; u64i_FrqInx < QUCPU_INT_NUMFRQ; u64i_FrqInx++) {
+		for (u64i_MifReg = 0; u64i_MifReg < QUCPU_INT_NUMREG; u64i_MifReg++) {
+			for (u64i_Refclk = 0; u64i_Refclk < QUCPU_INT_NUMRCK; u64i_Refclk++) {
+				entry = fu32i_GetDiffMif(u64i_FrqInx, u64i_MifReg, u64i_Refclk);
+				for (i = 0; i < 4; i++) {
+					hash ^= (entry >> (8 * i)) & 0xff;
+					hash *= 0x100000001b3ULL;
+				}
+				sum += entry;
+				entries++;
+			}
+		}
+	}
+
+	if (entries != DIFFMIF_ENTRIES || hash != DIFFMIF_FNV1A || sum != DIFFMIF_SUM) {
+		printf("diff mif table mismatch: %llu entries, hash 0x%016llx, sum 0x%016llx\n",
+		       (unsigned long long) entries, (unsigned long long) hash,
+		       (unsigned long long) sum);
+		printf("expected:                %d entries, hash 0x%016llx, sum 0x%016llx\n",
+		       DIFFMIF_ENTRIES, DIFFMIF_FNV1A, DIFFMIF_SUM);
+		return 1;
+	}
+
+	printf("diff mif table: %llu entries match\n", (unsigned long long) entries);
+	return 0;
+}
@@ -30,8 +30,10 @@
 #endif
 
 #include <algorithm>
+#include <cstdlib>
 #include <cwctype>
 #include <fstream>
+#include <sched.h>
 
 namespace intel
 {
@@ -88,6 +90,63 @@ namespace utils
         return str;
     }
 
+bool parse_cpu_list(const std::string & list, std::vector<int> & cpus)
+{
+    cpus.clear();
+    for (const auto & range : split(list, ','))
+    {
+        const char *p = range.c_str();
+        char *end = nullptr;
+        long first = strtol(p, &end, 10);
+        long last;
+
+        if (end == p)
+        {
+            return false;
+        }
+
+        last = first;
+        if (*end == '-')
+        {
+            p = end + 1;
+            last = strtol(p, &end, 10);
+            if (end == p)
+            {
+                return false;
+            }
+        }
+
+        if (*end != '\0' || first < 0 || last < first || last >= CPU_SETSIZE)
+        {
+            return false;
+        }
+
+        for (long cpu = first; cpu <= last; ++cpu)
+        {
+            cpus.push_back(static_cast<int>(cpu));
+        }
+    }
+    return !cpus.empty();
+}
+
+bool numa_node_cpus(int node, std::vector<int> & cpus)
+{
+    std::ifstream f("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+    std::string list;
+    return node >= 0 && std::getline(f, list) && parse_cpu_list(list, cpus);
+}
+
+bool set_thread_affinity(pthread_t thread, const std::vector<int> & cpus)
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus)
+    {
+        CPU_SET(cpu, &set);
+    }
+    return 0 == pthread_setaffinity_np(thread, sizeof(set), &set);
+}
+
 void csv_parse(const std::string & filename,
                std::map<std::string, std::vector<std::string>> & data)
 {
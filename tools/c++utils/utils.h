@@ -34,6 +34,7 @@
 #include <map>
 #include <iostream>
 #include <iomanip>
+#include <pthread.h>
 
 /// @brief utility functions grouped under the utils namespace
 namespace intel
@@ -132,6 +133,30 @@ namespace utils
     }
 
 
+    /// @brief Parses a Linux cpu list such as "0-3,8,10-11"
+    ///
+    /// @param[in] list cpu list
+    /// @param[out] cpus the cpus in the list, in order
+    ///
+    /// @return true if the list is well formed and not empty
+    bool parse_cpu_list(const std::string & list, std::vector<int> & cpus);
+
+    /// @brief Reads the cpus of a NUMA node from sysfs
+    ///
+    /// @param[in] node NUMA node
+    /// @param[out] cpus the cpus of the node
+    ///
+    /// @return true if the node exists and has cpus
+    bool numa_node_cpus(int node, std::vector<int> & cpus);
+
+    /// @brief Restricts a thread to a set of cpus
+    ///
+    /// @param[in] thread pthread handle (std::thread::native_handle())
+    /// @param[in] cpus cpus the thread may run on
+    ///
+    /// @return true on success
+    bool set_thread_affinity(pthread_t thread, const std::vector<int> & cpus);
+
     /// @brief random integer generator
     /// @details
     /// Used to generate random integers between
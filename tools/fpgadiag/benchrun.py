@@ -0,0 +1,359 @@
+#!/usr/bin/env python
+# Copyright(c) 2017, Intel Corporation
+#
+# Redistribution  and  use  in source  and  binary  forms,  with  or  without
+# modification, are permitted provided that the following conditions are met:
+#
+# * Redistributions of  source code  must retain the  above copyright notice,
+#  this list of conditions and the following disclaimer.
+# * Redistributions in binary form must reproduce the above copyright notice,
+#  this list of conditions and the following disclaimer in the documentation
+#   and/or other materials provided with the distribution.
+# * Neither the name  of Intel Corporation  nor the names of its contributors
+#   may be used to  endorse or promote  products derived  from this  software
+#   without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+# IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+# LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+# CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+# SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+# INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+# CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+
+"""Statistical benchmark runner for the fpgadiag apps.
+
+Expands a declarative test matrix, runs every point with warmup and
+repetitions, summarizes each metric the app prints in --csv mode and
+optionally compares the summary against a stored baseline.
+
+Matrix file:
+
+    {
+        "warmup" : 1,
+        "repetitions" : 5,
+        "thresholds" : { "default" : 5.0, "Lat_P99_ns" : 20.0 },
+        "tests" : [
+            {
+                "app" : "nlb3",
+                "args" : { "mode" : "read", "multi-cl" : 1 },
+                "matrix" : { "cachelines" : [1, 64, 1024],
+                             "read-vc" : ["vh0", "vh1"] }
+            }
+        ]
+    }
+
+"args" are passed to every point, "matrix" values are combined as a
+cartesian product. "cachelines" sets both --begin and --end for the nlb
+apps. Thresholds are the allowed change of the mean, in percent, before a
+metric counts as a regression.
+"""
+
+from __future__ import print_function
+
+import argparse
+import datetime
+import itertools
+import json
+import math
+import os
+import subprocess
+import sys
+
+cwd = os.path.dirname(os.path.realpath(__file__))
+
+# apps that take a cache line range rather than a single count
+range_apps = ('nlb0', 'nlb3', 'nlb7')
+
+# metric name prefixes/suffixes and whether a larger value is better
+higher_is_better = ('Bandwidth', '_Per_Sec')
+lower_is_better = ('Lat_', 'Clocks')
+
+
+def metric_direction(name):
+    if any(name.endswith(s) for s in higher_is_better):
+        return 1
+    if any(name.startswith(p) for p in lower_is_better):
+        return -1
+    return 0
+
+
+def expand(test):
+    """Yield (id, app, args) for every point of a test's matrix."""
+    app = test['app']
+    matrix = test.get('matrix', {})
+    keys = sorted(matrix.keys())
+    for values in itertools.product(*[matrix[k] for k in keys]):
+        args = dict(test.get('args', {}))
+        args.update(zip(keys, values))
+        point_id = ' '.join([app] + ['{}={}'.format(k, args[k])
+                                     for k in sorted(args.keys())])
+        yield point_id, app, args
+
+
+def command_line(bin_dir, app, args, target):
+    cmd = [os.path.join(bin_dir, app), '--target={}'.format(target), '--csv']
+    for key in sorted(args.keys()):
+        value = args[key]
+        if key == 'cachelines' and app in range_apps:
+            cmd += ['--begin={}'.format(value), '--end={}'.format(value)]
+        elif value is True:
+            cmd.append('--{}'.format(key))
+        elif value is False:
+            continue
+        else:
+            cmd.append('--{}={}'.format(key, value))
+    return cmd
+
+
+def parse_csv(output):
+    """Return {metric: (value, unit)} from every csv table in output.
+
+    A table is a header line followed by rows with the same number of
+    fields. Of a per-thread table only the "all" row is kept.
+    """
+    metrics = {}
+    header = None
+    for line in output.splitlines():
+        fields = [f.strip() for f in line.split(',')]
+        if len(fields) < 2:
+            header = None
+            continue
+        if not is_number(fields[0]) and fields[0] != 'all':
+            header = [normalize(f) for f in fields]
+            continue
+        if header is None or len(fields) != len(header):
+            continue
+        for name, field in zip(header, fields):
+            if metric_direction(name) == 0:
+                continue
+            value, unit = split_unit(field)
+            if value is not None:
+                metrics[name] = (value, unit)
+    return metrics
+
+
+def normalize(name):
+    name = name.strip("'")
+    if name.startswith('Clocks'):
+        return 'Clocks'
+    return name
+
+
+def is_number(text):
+    return split_unit(text)[0] is not None
+
+
+def split_unit(text):
+    parts = text.split(None, 1)
+    try:
+        value = float(parts[0])
+    except (ValueError, IndexError):
+        return None, None
+    if math.isinf(value) or math.isnan(value):
+        return None, None
+    return value, parts[1] if len(parts) > 1 else ''
+
+
+def percentile(sorted_values, p):
+    """Nearest-rank percentile."""
+    rank = int(math.ceil(p / 100.0 * len(sorted_values)))
+    return sorted_values[max(rank, 1) - 1]
+
+
+def summarize(samples):
+    n = len(samples)
+    mean = sum(samples) / n
+    var = sum((s - mean) ** 2 for s in samples) / (n - 1) if n > 1 else 0.0
+    ordered = sorted(samples)
+    return {'samples': samples,
+            'count': n,
+            'mean': mean,
+            'stddev': math.sqrt(var),
+            'min': ordered[0],
+            'max': ordered[-1],
+            'p50': percentile(ordered, 50),
+            'p90': percentile(ordered, 90),
+            'p99': percentile(ordered, 99)}
+
+
+def run_point(cmd, warmup, repetitions, timeout):
+    samples = {}
+    units = {}
+    failures = []
+    for rep in range(warmup + repetitions):
+        try:
+            p = subprocess.Popen(cmd, stdout=subprocess.PIPE,
+                                 stderr=subprocess.PIPE)
+            stdout, stderr = communicate(p, timeout)
+        except OSError as e:
+            failures.append({'repetition': rep, 'error': str(e)})
+            break
+        if stdout is None:
+            failures.append({'repetition': rep, 'error': 'timeout'})
+            continue
+        if p.returncode != 0:
+            failures.append({'repetition': rep, 'returncode': p.returncode,
+                             'stderr': stderr.decode('utf-8', 'replace')[-2000:]})
+            continue
+        if rep < warmup:
+            continue
+        for name, (value, unit) in parse_csv(stdout.decode('utf-8', 'replace')).items():
+            samples.setdefault(name, []).append(value)
+            units[name] = unit
+    metrics = {}
+    for name, values in samples.items():
+        metrics[name] = summarize(values)
+        metrics[name]['unit'] = units[name]
+    return metrics, failures
+
+
+def communicate(p, timeout):
+    if timeout is None:
+        return p.communicate()
+    try:
+        return p.communicate(timeout=timeout)
+    except TypeError:
+        # python 2: no timeout support
+        return p.communicate()
+    except subprocess.TimeoutExpired:
+        p.kill()
+        p.communicate()
+        return None, None
+
+
+def compare(results, baseline, thresholds, sigma):
+    """Compare means against the baseline.
+
+    A metric regresses when its mean moved in the bad direction by more
+    than its threshold (percent) and by more than sigma standard errors
+    of the difference, so noisy metrics need a larger change to trip.
+    """
+    base = dict((r['id'], r) for r in baseline.get('results', []))
+    rows = []
+    for result in results:
+        old = base.get(result['id'])
+        if old is None:
+            continue
+        for name, cur in sorted(result['metrics'].items()):
+            ref = old['metrics'].get(name)
+            if ref is None or ref['mean'] == 0:
+                continue
+            direction = metric_direction(name)
+            change = (cur['mean'] - ref['mean']) / abs(ref['mean']) * 100.0
+            limit = thresholds.get(name, thresholds.get('default', 5.0))
+            stderr = math.sqrt(cur['stddev'] ** 2 / cur['count'] +
+                               ref['stddev'] ** 2 / ref['count'])
+            significant = abs(cur['mean'] - ref['mean']) > sigma * stderr
+            status = 'ok'
+            if significant and abs(change) > limit:
+                status = 'regression' if change * direction < 0 else 'improvement'
+            rows.append({'id': result['id'],
+                         'metric': name,
+                         'baseline': ref['mean'],
+                         'current': cur['mean'],
+                         'change_pct': change,
+                         'threshold_pct': limit,
+                         'status': status})
+    return rows
+
+
+def report(results, comparison, out):
+    for result in results:
+        print(result['id'], file=out)
+        if result['failures']:
+            print('  {} failed runs'.format(len(result['failures'])), file=out)
+        for name, m in sorted(result['metrics'].items()):
+            print('  {:<20} mean {:>14.3f} stddev {:>12.3f} p50 {:>14.3f} p99 {:>14.3f} {}'.format(
+                name, m['mean'], m['stddev'], m['p50'], m['p99'], m['unit']), file=out)
+    changed = [c for c in comparison if c['status'] != 'ok']
+    if comparison:
+        print('', file=out)
+        print('Compared {} metrics against the baseline, {} changed'.format(
+            len(comparison), len(changed)), file=out)
+    for c in changed:
+        print('  {:<11} {} {}: {:.3f} -> {:.3f} ({:+.1f}%, limit {:.1f}%)'.format(
+            c['status'], c['id'], c['metric'], c['baseline'], c['current'],
+            c['change_pct'], c['threshold_pct']), file=out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Run an fpgadiag benchmark matrix')
+    parser.add_argument('matrix', help='test matrix (JSON)')
+    parser.add_argument('-t', '--target', default='fpga', choices=['fpga', 'ase', 'emu'],
+                        help='choose target')
+    parser.add_argument('-w', '--warmup', type=int,
+                        help='warmup runs per point (overrides the matrix)')
+    parser.add_argument('-r', '--repetitions', type=int,
+                        help='measured runs per point (overrides the matrix)')
+    parser.add_argument('-o', '--output',
+                        help='write results to this JSON file')
+    parser.add_argument('-b', '--baseline',
+                        help='results file to compare against')
+    parser.add_argument('--threshold', type=float,
+                        help='default regression threshold in percent')
+    parser.add_argument('--sigma', type=float, default=2.0,
+                        help='standard errors a change must exceed to count')
+    parser.add_argument('--timeout', type=float, default=60.0,
+                        help='seconds before a single run is killed')
+    parser.add_argument('--bin-dir', default=cwd,
+                        help='directory holding the fpgadiag apps')
+    args = parser.parse_args()
+
+    with open(args.matrix, 'r') as fd:
+        matrix = json.load(fd)
+
+    warmup = args.warmup if args.warmup is not None else matrix.get('warmup', 1)
+    repetitions = args.repetitions if args.repetitions is not None else matrix.get('repetitions', 5)
+    thresholds = dict(matrix.get('thresholds', {}))
+    if args.threshold is not None:
+        thresholds['default'] = args.threshold
+
+    if repetitions < 1:
+        parser.error('need at least one repetition')
+
+    started = datetime.datetime.now().isoformat()
+    results = []
+    for test in matrix.get('tests', []):
+        for point_id, app, point_args in expand(test):
+            cmd = command_line(args.bin_dir, app, point_args, args.target)
+            print('running', ' '.join(cmd), file=sys.stderr)
+            metrics, failures = run_point(cmd, warmup, repetitions, args.timeout)
+            results.append({'id': point_id,
+                            'app': app,
+                            'args': point_args,
+                            'metrics': metrics,
+                            'failures': failures})
+
+    comparison = []
+    if args.baseline:
+        with open(args.baseline, 'r') as fd:
+            comparison = compare(results, json.load(fd), thresholds, args.sigma)
+
+    summary = {'target': args.target,
+               'started': started,
+               'warmup': warmup,
+               'repetitions': repetitions,
+               'thresholds': thresholds,
+               'results': results,
+               'comparison': comparison}
+
+    if args.output:
+        with open(args.output, 'w') as fd:
+            json.dump(summary, fd, indent=4, sort_keys=True)
+
+    report(results, comparison, sys.stdout)
+
+    if any(r['failures'] for r in results):
+        return 2
+    if any(c['status'] == 'regression' for c in comparison):
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
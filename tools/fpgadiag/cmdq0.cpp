@@ -41,6 +41,10 @@
 using namespace std::chrono;
 using namespace intel::fpga::nlb;
 
+// The hwvalid threads have no deadline of their own: a stuck device times
+// out in swvalid, which sets cancel_.
+static const std::chrono::hours no_deadline(24);
+
 namespace intel
 {
 namespace fpga
@@ -69,13 +73,14 @@ cmdq0::cmdq0()
 , guid_("D8424DC4-A4A3-C413-F89E-433683F9040B")
 , dsm_size_(MB(4))
 , timeout_(0)
+, wait_mode_(wait_policy::spin_yield)
 , errors_(0)
 , suppress_header_(false)
 , csv_format_(false)
 {
     options_.add_option<bool>("help",                 'h', intel::utils::option::no_argument,   "Show help", false);
     options_.add_option<std::string>("config",        'c', intel::utils::option::with_argument, "Path to test config file", config_);
-    options_.add_option<std::string>("target",        't', intel::utils::option::with_argument, "one of { fpga, ase }", target_);
+    options_.add_option<std::string>("target",        't', intel::utils::option::with_argument, "one of { fpga, ase, emu }", target_);
     options_.add_option<std::uint32_t>("allocations", 'a', intel::utils::option::with_argument, "Number of FIFO entries",  allocations_);
     options_.add_option<std::uint32_t>("cachelines",  'l', intel::utils::option::with_argument, "Size of each FIFO entry", cachelines_);
     options_.add_option<bool>("cont",                 'L', intel::utils::option::no_argument,   "Enable continuous mode", cont_);
@@ -97,6 +102,7 @@ cmdq0::cmdq0()
     options_.add_option<uint8_t>("function",          'F', intel::utils::option::with_argument, "Function number of PCIe device");
     options_.add_option<uint8_t>("socket-id",         's', intel::utils::option::with_argument, "Socket id encoded in BBS");
     options_.add_option<std::string>("guid",          'g', intel::utils::option::with_argument, "accelerator id to enumerate", guid_);
+    options_.add_option<std::string>("wait-policy",   intel::utils::option::with_argument, "one of { spin, yield, sleep, monitor }", "yield");
     options_.add_option<bool>("suppress-hdr",         'S', intel::utils::option::no_argument,   "Suppress column headers", suppress_header_);
     options_.add_option<bool>("csv",                  'V', intel::utils::option::no_argument,   "Comma separated value format", csv_format_);
 }
@@ -119,7 +125,7 @@ void cmdq0::show_help(std::ostream &os)
 bool cmdq0::setup()
 {
     options_.get_value<std::string>("target", target_);
-    if ((target_ != "fpga") && (target_ != "ase"))
+    if ((target_ != "fpga") && (target_ != "ase") && (target_ != "emu"))
     {
         std::cerr << "Invalid --target: " << target_ << std::endl;
         return false;
@@ -238,8 +244,17 @@ bool cmdq0::setup()
         std::cerr << "Invalid --wrfence-vc: " << wrfence_vc_ << std::endl;
         return false;
     }
+    std::string wait_mode;
+    if (options_.get_value<std::string>("wait-policy", wait_mode) &&
+        !wait_policy::parse(wait_mode, wait_mode_))
+    {
+        std::cerr << "Invalid --wait-policy: " << wait_mode << std::endl;
+        return false;
+    }
+
     options_.get_value<bool>("suppress-hdr", suppress_header_);
     options_.get_value<bool>("csv", csv_format_);
+    cmdq_stats_.set_format(suppress_header_, csv_format_);
 
     return true;
 }
@@ -272,6 +287,11 @@ bool cmdq0::run()
     dma_buffer::ptr_t avail = bufs[2];
     uint32_t avail_size = avail->size();
 
+    fifo1_.reset(allocations_);
+    fifo2_.reset(allocations_);
+    issued_.assign(allocations_, steady_clock::time_point());
+    cmdq_stats_.reset();
+
     for (uint32_t i = 0 ; i < allocations_ ; ++i)
     {
         avail_size -= 2 * buffer_size;
@@ -280,7 +300,7 @@ bool cmdq0::run()
         bufs[0]->fill(0xaf);
         bufs[1]->fill(0xbe);
 
-        fifo1_.push_back(std::make_pair(bufs[0], bufs[1]));
+        fifo1_.push(std::make_pair(bufs[0], bufs[1]));
 
         avail = bufs[2];
     }
@@ -321,6 +341,8 @@ bool cmdq0::run()
     std::future<uint32_t> swvalid;
     std::future<uint32_t> hwvalid;
 
+    cmdq_stats_.start();
+
     if (cont_)
     {
         swvalid = std::async(std::launch::async,
@@ -358,6 +380,8 @@ bool cmdq0::run()
         hwvalid.wait();
     }
 
+    cmdq_stats_.stop();
+
     uint32_t allocations = swvalid.get();
     uint32_t iterations = hwvalid.get();
 
@@ -393,6 +417,7 @@ bool cmdq0::run()
                                                  cont_,
                                                  suppress_header_,
                                                  csv_format_);
+        std::cout << cmdq_stats_;
     }
 
     if (errors_ > 0)
@@ -424,7 +449,7 @@ bool cmdq0::verify(const cmdq_entry_t &entry)
 {
     dma_buffer::ptr_t inp = entry.first;
     dma_buffer::ptr_t out = entry.second;
-    return 0 == ::memcmp((void *)inp->address(), (void *)out->address(), inp->size());
+    return inp->equal(out, inp->size());
 }
 
 void cmdq0::show_mismatch(const cmdq_entry_t &entry)
@@ -441,25 +466,18 @@ void cmdq0::show_mismatch(const cmdq_entry_t &entry)
     volatile uint32_t *pout = (volatile uint32_t *) out->address();
     volatile uint32_t *pEndout = pout + (out->size() / sizeof(uint32_t));
 
-    while (pin < pEndin)
+    offset = inp->mismatch(out, inp->size()) & ~(sizeof(uint32_t) - 1);
+    if (offset >= inp->size())
     {
-        if (*pin != *pout)
-        {
-            goto print;
-        }
-
-        ++pin;
-        ++pout;
+        return;
     }
 
-    return;
-
-print:
-
-    offset = ((uint8_t *)pin - inp->address());
+    pin  += offset / sizeof(uint32_t);
+    pout += offset / sizeof(uint32_t);
 
     std::cerr << std::endl;
-    std::cerr << "offset: " << offset << " bytes into buffer" << std::endl;
+    std::cerr << "offset: " << offset << " bytes into buffer"
+              << " (cache line " << offset / CL(1) << ")" << std::endl;
     std::cerr << " src:" << (void *)(pin + (offset / sizeof(uint32_t))) << ' ';
     std::cerr << " src phys:0x" << std::hex << std::setfill('0') <<
                 (inp->iova() + offset) << std::endl;
@@ -505,8 +523,14 @@ print_done:
 uint32_t cmdq0::swvalid_thr(cmdq_t &fifo1, cmdq_t &fifo2)
 {
     uint32_t i;
-    uint32_t loops;
-    const uint32_t max_loops = 100000;
+    wait_policy wait(wait_mode_);
+
+    auto cmdq_sw_clear = [this]()
+    {
+        uint32_t sw = 1;
+        accelerator_->read_mmio32(static_cast<uint32_t>(nlb0_csr::cmdq_sw), sw);
+        return (sw & 0x1) == 0;
+    };
 
     start_cache_ctrs_ = accelerator_->cache_counters();
     start_fabric_ctrs_ = accelerator_->fabric_counters();
@@ -514,26 +538,18 @@ uint32_t cmdq0::swvalid_thr(cmdq_t &fifo1, cmdq_t &fifo2)
     for (i = 0 ; i < allocations_ ; ++i)
     {
         cmdq_entry_t entry = fifo1_pop();
-        apply(accelerator_, entry);
+        // queue the entry before the device can complete it
+        issued_[i % allocations_] = steady_clock::now();
         fifo2_push(entry);
+        apply(accelerator_, entry);
 
-        loops = 0;
-        uint32_t sw = 1;
-        accelerator_->read_mmio32(static_cast<uint32_t>(nlb0_csr::cmdq_sw), sw);
-        while ((sw & 0x1) != 0)
+        if (!wait.wait_until(cmdq_sw_clear, seconds(1)))
         {
-            ++loops;
-            if (loops >= max_loops)
-            {
-                std::lock_guard<std::mutex> g(print_lock_);
-                cancel_ = true;
-                ++errors_;
-                std::cerr << "swvalid_thr: Timeout waiting for cmdq_sw to be 0." << std::endl;
-                return i;
-            }
-
-            std::this_thread::sleep_for(microseconds(10));
-            accelerator_->read_mmio32(static_cast<uint32_t>(nlb0_csr::cmdq_sw), sw);
+            std::lock_guard<std::mutex> g(print_lock_);
+            cancel_ = true;
+            ++errors_;
+            std::cerr << "swvalid_thr: Timeout waiting for cmdq_sw to be 0." << std::endl;
+            return i;
         }
     }
 
@@ -543,9 +559,18 @@ uint32_t cmdq0::swvalid_thr(cmdq_t &fifo1, cmdq_t &fifo2)
 uint32_t cmdq0::cont_swvalid_thr(cmdq_t &fifo1, cmdq_t &fifo2)
 {
     uint32_t allocations = 0;
-    uint32_t sw;
-    uint32_t loops;
-    const uint32_t max_loops = 1000000;
+    wait_policy wait(wait_mode_);
+
+    auto cmdq_sw_clear = [this]()
+    {
+        uint32_t sw = 1;
+        accelerator_->read_mmio32(static_cast<uint32_t>(nlb0_csr::cmdq_sw), sw);
+        return cancel_ || (sw & 0x1) == 0;
+    };
+    auto entry_ready = [this]()
+    {
+        return cancel_ || !fifo1_is_empty();
+    };
 
     start_cache_ctrs_ = accelerator_->cache_counters();
     start_fabric_ctrs_ = accelerator_->fabric_counters();
@@ -553,49 +578,27 @@ uint32_t cmdq0::cont_swvalid_thr(cmdq_t &fifo1, cmdq_t &fifo2)
     while (!cancel_)
     {
         cmdq_entry_t entry = fifo1_pop();
+        issued_[allocations % allocations_] = steady_clock::now();
+        fifo2_push(entry);
         apply(accelerator_, entry);
         ++allocations;
-        fifo2_push(entry);
 
-        loops = 0;
-        sw = 1;
-        accelerator_->read_mmio32(static_cast<uint32_t>(nlb0_csr::cmdq_sw), sw);
-        while ((sw & 0x1) != 0)
+        if (!wait.wait_until(cmdq_sw_clear, seconds(10)))
         {
-            ++loops;
-            if (loops >= max_loops)
-            {
-                std::lock_guard<std::mutex> g(print_lock_);
-                cancel_ = true;
-                ++errors_;
-                std::cerr << "cont_swvalid_thr: Timeout waiting for cmdq_sw to be 0." << std::endl;
-            }
-
-            std::this_thread::sleep_for(microseconds(10));
-            accelerator_->read_mmio32(static_cast<uint32_t>(nlb0_csr::cmdq_sw), sw);
-            if (cancel_)
-            {
-                return allocations;
-            }
+            std::lock_guard<std::mutex> g(print_lock_);
+            cancel_ = true;
+            ++errors_;
+            std::cerr << "cont_swvalid_thr: Timeout waiting for cmdq_sw to be 0." << std::endl;
+            return allocations;
         }
 
-        loops = 0;
-        while (fifo1_is_empty())
+        if (!wait.wait_until(entry_ready, seconds(10)))
         {
-            ++loops;
-            if (loops >= max_loops)
-            {
-                std::lock_guard<std::mutex> g(print_lock_);
-                cancel_ = true;
-                ++errors_;
-                std::cerr << "cont_swvalid_thr: Timeout waiting for queue items." << std::endl;
-            }
-
-            std::this_thread::sleep_for(microseconds(10));
-            if (cancel_)
-            {
-                return allocations;
-            }
+            std::lock_guard<std::mutex> g(print_lock_);
+            cancel_ = true;
+            ++errors_;
+            std::cerr << "cont_swvalid_thr: Timeout waiting for queue items." << std::endl;
+            return allocations;
         }
     }
 
@@ -604,8 +607,8 @@ uint32_t cmdq0::cont_swvalid_thr(cmdq_t &fifo1, cmdq_t &fifo2)
 
 uint32_t cmdq0::hwvalid_thr(cmdq_t &fifo1, cmdq_t &fifo2)
 {
-    uint32_t hw = 0;
     uint32_t i;
+    wait_policy wait(wait_mode_);
 
     for(i = 0 ; i < allocations_ ; ++i)
     {
@@ -623,13 +626,10 @@ uint32_t cmdq0::hwvalid_thr(cmdq_t &fifo1, cmdq_t &fifo2)
             // Because NLB uses dsm number as zero based,
             // for the first iteration, wait until the status is 1
 
-            while (0 == ((*dsm_status_addr) & 0x1))
+            wait.wait_until([&]() { return cancel_ || 0 != ((*dsm_status_addr) & 0x1); }, no_deadline);
+            if (0 == ((*dsm_status_addr) & 0x1))
             {
-                std::this_thread::sleep_for(microseconds(10));
-                if(cancel_)
-                {
-                    goto out;
-                }
+                goto out;
             }
 
             dsm_tuple_ = dsm_tuple(dsm_);
@@ -638,24 +638,24 @@ uint32_t cmdq0::hwvalid_thr(cmdq_t &fifo1, cmdq_t &fifo2)
         {
             // Otherwise, wait for NLB to write index to dsm.
             // The hardware counter is 15 bits wide.
-            while ((i % max_cmdq_counter) > ((*dsm_status_addr) >> 1))
+            wait.wait_until([&]() { return cancel_ || (i % max_cmdq_counter) <= ((*dsm_status_addr) >> 1); }, no_deadline);
+            if ((i % max_cmdq_counter) > ((*dsm_status_addr) >> 1))
             {
-                std::this_thread::sleep_for(microseconds(10));
-                if(cancel_)
-                {
-                    goto out;
-                }
+                goto out;
             }
 
             dsm_tuple_ += dsm_tuple(dsm_);
         }
 
+        auto completed = steady_clock::now();
+
         if (fifo2_is_empty())
         {
             goto out;
         }
 
         cmdq_entry_t entry(fifo2_pop());
+        cmdq_stats_.record(duration_cast<nanoseconds>(completed - issued_[i % allocations_]));
         bool passed = verify(entry);
         fifo1_push(entry);
 
@@ -681,7 +681,7 @@ out:
 uint32_t cmdq0::cont_hwvalid_thr(cmdq_t &fifo1, cmdq_t &fifo2)
 {
     uint32_t i = 0;
-    uint32_t hw;
+    wait_policy wait(wait_mode_);
 
     while (!cancel_)
     {
@@ -699,13 +699,10 @@ uint32_t cmdq0::cont_hwvalid_thr(cmdq_t &fifo1, cmdq_t &fifo2)
             // Because NLB uses dsm number as zero based,
             // for the first iteration, wait until the status is 1
 
-            while (0 == ((*dsm_status_addr) & 0x1))
+            wait.wait_until([&]() { return cancel_ || 0 != ((*dsm_status_addr) & 0x1); }, no_deadline);
+            if (0 == ((*dsm_status_addr) & 0x1))
             {
-                if (cancel_)
-                {
-                    goto out;
-                }
-                std::this_thread::sleep_for(microseconds(10));
+                goto out;
             }
 
             dsm_tuple_ = dsm_tuple(dsm_);
@@ -714,28 +711,25 @@ uint32_t cmdq0::cont_hwvalid_thr(cmdq_t &fifo1, cmdq_t &fifo2)
         {
             // Otherwise, wait for NLB to write index to dsm.
             // The hardware counter is 15 bits wide.
-            while ((i % max_cmdq_counter) > ((*dsm_status_addr) >> 1))
+            wait.wait_until([&]() { return cancel_ || (i % max_cmdq_counter) <= ((*dsm_status_addr) >> 1); }, no_deadline);
+            if ((i % max_cmdq_counter) > ((*dsm_status_addr) >> 1))
             {
-                if (cancel_)
-                {
-                    goto out;
-                }
-                std::this_thread::sleep_for(microseconds(10));
+                goto out;
             }
 
             dsm_tuple_ += dsm_tuple(dsm_);
         }
 
-        while (fifo2_is_empty())
+        auto completed = steady_clock::now();
+
+        wait.wait_until([this]() { return cancel_ || !fifo2_is_empty(); }, no_deadline);
+        if (fifo2_is_empty())
         {
-            std::this_thread::sleep_for(microseconds(10));
-            if (cancel_)
-            {
-                goto out;
-            }
+            goto out;
         }
 
         cmdq_entry_t entry(fifo2_pop());
+        cmdq_stats_.record(duration_cast<nanoseconds>(completed - issued_[i % allocations_]));
         bool passed = verify(entry);
         fifo1_push(entry);
 
@@ -761,30 +755,20 @@ out:
 
 bool cmdq0::wait_for_done(uint32_t allocations)
 {
-    const uint32_t max_loops = 10000;
-    uint32_t loops = 0;
+    wait_policy wait(wait_mode_);
 
-    while (true)
+    auto idle = [this]()
     {
-        ++loops;
-        if (loops >= max_loops)
-        {
-            return false;
-        }
-
         uint32_t sw = 1;
         uint32_t hw = 1;
 
         accelerator_->read_mmio32(static_cast<uint32_t>(nlb0_csr::cmdq_sw), sw);
         accelerator_->read_mmio32(static_cast<uint32_t>(nlb0_csr::cmdq_hw), hw);
 
-        if ((sw & 0x1) == 0 && (hw & 0x1) == 0)
-        {
-            return true;
-        }
+        return cancel_ || ((sw & 0x1) == 0 && (hw & 0x1) == 0);
+    };
 
-        std::this_thread::sleep_for(microseconds(10));
-    }
+    return wait.wait_until(idle, milliseconds(500)) && !cancel_;
 }
 
 } // end of namespace diag
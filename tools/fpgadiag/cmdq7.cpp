@@ -43,6 +43,10 @@
 using namespace std::chrono;
 using namespace intel::fpga::nlb;
 
+// The hwvalid threads have no deadline of their own: a stuck device times
+// out in swvalid, which sets cancel_.
+static const std::chrono::hours no_deadline(24);
+
 namespace intel
 {
 namespace fpga
@@ -74,6 +78,7 @@ cmdq7::cmdq7()
 , cool_fpga_cache_(false)
 , dsm_size_(MB(4))
 , timeout_(0)
+, wait_mode_(wait_policy::spin_yield)
 , errors_(0)
 , umsg_virt_(nullptr)
 , umsg_size_(0)
@@ -82,7 +87,7 @@ cmdq7::cmdq7()
 {
     options_.add_option<bool>("help",                 'h', intel::utils::option::no_argument,   "Show help", false);
     options_.add_option<std::string>("config",        'c', intel::utils::option::with_argument, "Path to test config file", config_);
-    options_.add_option<std::string>("target",        't', intel::utils::option::with_argument, "one of { fpga, ase }", target_);
+    options_.add_option<std::string>("target",        't', intel::utils::option::with_argument, "one of { fpga, ase, emu }", target_);
     options_.add_option<std::uint32_t>("allocations", 'a', intel::utils::option::with_argument, "Number of FIFO entries",  allocations_);
     options_.add_option<std::uint32_t>("cachelines",  'l', intel::utils::option::with_argument, "Size of each FIFO entry", cachelines_);
     options_.add_option<bool>("cont",                 'L', intel::utils::option::no_argument,   "Enable continuous mode", cont_);
@@ -111,6 +116,7 @@ cmdq7::cmdq7()
     options_.add_option<uint8_t>("function",          'F', intel::utils::option::with_argument, "Function number of PCIe device");
     options_.add_option<uint8_t>("socket-id",         's', intel::utils::option::with_argument, "Socket id encoded in BBS");
     options_.add_option<std::string>("guid",          'g', intel::utils::option::with_argument, "accelerator id to enumerate", guid_);
+    options_.add_option<std::string>("wait-policy",   intel::utils::option::with_argument, "one of { spin, yield, sleep, monitor }", "yield");
     options_.add_option<bool>("suppress-hdr",         'S', intel::utils::option::no_argument,   "Suppress column headers", suppress_header_);
     options_.add_option<bool>("csv",                  'V', intel::utils::option::no_argument,   "Comma separated value format", csv_format_);
 }
@@ -133,7 +139,7 @@ void cmdq7::show_help(std::ostream &os)
 bool cmdq7::setup()
 {
     options_.get_value<std::string>("target", target_);
-    if ((target_ != "fpga") && (target_ != "ase"))
+    if ((target_ != "fpga") && (target_ != "ase") && (target_ != "emu"))
     {
         std::cerr << "Invalid --target: " << target_ << std::endl;
         return false;
@@ -315,8 +321,17 @@ bool cmdq7::setup()
         return false;
     }
 
+    std::string wait_mode;
+    if (options_.get_value<std::string>("wait-policy", wait_mode) &&
+        !wait_policy::parse(wait_mode, wait_mode_))
+    {
+        std::cerr << "Invalid --wait-policy: " << wait_mode << std::endl;
+        return false;
+    }
+
     options_.get_value<bool>("suppress-hdr", suppress_header_);
     options_.get_value<bool>("csv", csv_format_);
+    cmdq_stats_.set_format(suppress_header_, csv_format_);
 
     return true;
 }
@@ -352,6 +367,11 @@ bool cmdq7::run()
     dma_buffer::ptr_t avail = bufs[2];
     uint32_t avail_size = avail->size();
 
+    fifo1_.reset(allocations_);
+    fifo2_.reset(allocations_);
+    issued_.assign(allocations_, steady_clock::time_point());
+    cmdq_stats_.reset();
+
     for (uint32_t i = 0 ; i < allocations_ ; ++i)
     {
         avail_size -= 2 * buffer_size;
@@ -360,7 +380,7 @@ bool cmdq7::run()
         bufs[0]->fill(0xaf);
         bufs[1]->fill(0xbe);
 
-        fifo1_.push_back(std::make_pair(bufs[0], bufs[1]));
+        fifo1_.push(std::make_pair(bufs[0], bufs[1]));
 
         avail = bufs[2];
     }
@@ -426,6 +446,8 @@ bool cmdq7::run()
     std::future<uint32_t> swvalid;
     std::future<uint32_t> hwvalid;
 
+    cmdq_stats_.start();
+
     if (cont_)
     {
         swvalid = std::async(std::launch::async,
@@ -463,6 +485,8 @@ bool cmdq7::run()
         hwvalid.wait();
     }
 
+    cmdq_stats_.stop();
+
     uint32_t allocations = swvalid.get();
     uint32_t iterations = hwvalid.get();
 
@@ -498,6 +522,7 @@ bool cmdq7::run()
                                                  cont_,
                                                  suppress_header_,
                                                  csv_format_);
+        std::cout << cmdq_stats_;
     }
 
     if (errors_ > 0)
@@ -518,9 +543,8 @@ void cmdq7::apply(accelerator::ptr_t accelerator, const cmdq_entry_t &entry)
     out->fill(0);
 
     // Re-initialize the input buffer.
-    const uint32_t InputData = 0xdecafbad;
-    for(size_t i = 0 ; i < inp->size()/sizeof(uint32_t) ; ++i)
-        inp->write(InputData, i);
+    const uint64_t InputData = 0xdecafbaddecafbad;
+    inp->fill_pattern(InputData);
 
     // set input workspace address
     accelerator->write_mmio64(static_cast<uint32_t>(nlb0_csr::src_addr), CACHELINE_ALIGNED_ADDR(inp->iova()));
@@ -537,7 +561,7 @@ bool cmdq7::verify(const cmdq_entry_t &entry)
 {
     dma_buffer::ptr_t inp = entry.first;
     dma_buffer::ptr_t out = entry.second;
-    return 0 == ::memcmp((void *)inp->address(), (void *)out->address(), inp->size());
+    return inp->equal(out, inp->size());
 }
 
 void cmdq7::show_mismatch(const cmdq_entry_t &entry)
@@ -554,25 +578,18 @@ void cmdq7::show_mismatch(const cmdq_entry_t &entry)
     volatile uint32_t *pout = (volatile uint32_t *) out->address();
     volatile uint32_t *pEndout = pout + (out->size() / sizeof(uint32_t));
 
-    while (pin < pEndin)
+    offset = inp->mismatch(out, inp->size()) & ~(sizeof(uint32_t) - 1);
+    if (offset >= inp->size())
     {
-        if (*pin != *pout)
-        {
-            goto print;
-        }
-
-        ++pin;
-        ++pout;
+        return;
     }
 
-    return;
-
-print:
-
-    offset = ((uint8_t *)pin - inp->address());
+    pin  += offset / sizeof(uint32_t);
+    pout += offset / sizeof(uint32_t);
 
     std::cerr << std::endl;
-    std::cerr << "offset: " << offset << " bytes into buffer" << std::endl;
+    std::cerr << "offset: " << offset << " bytes into buffer"
+              << " (cache line " << offset / CL(1) << ")" << std::endl;
     std::cerr << " src:" << (void *)(pin + (offset / sizeof(uint32_t))) << ' ';
     std::cerr << " src phys:0x" << std::hex << std::setfill('0') <<
                 (inp->iova() + offset) << std::endl;
@@ -618,14 +635,20 @@ print_done:
 uint32_t cmdq7::swvalid_thr(cmdq_t &fifo1, cmdq_t &fifo2)
 {
     uint32_t i;
-    uint32_t loops;
-    const uint32_t max_loops = 100000;
+    wait_policy wait(wait_mode_);
     errno_t e;
 
     dma_buffer::microseconds_t timeout(1000000);
     if (target_ == "ase")
         timeout *= 100000;
 
+    auto cmdq_sw_clear = [this]()
+    {
+        uint32_t sw = 1;
+        accelerator_->read_mmio32(static_cast<uint32_t>(nlb0_csr::cmdq_sw), sw);
+        return (sw & 0x1) == 0;
+    };
+
     start_cache_ctrs_ = accelerator_->cache_counters();
     start_fabric_ctrs_ = accelerator_->fabric_counters();
 
@@ -636,6 +659,7 @@ uint32_t cmdq7::swvalid_thr(cmdq_t &fifo1, cmdq_t &fifo2)
             memset((void *)umsg_virt_, 0, umsg_size_);
 
         cmdq_entry_t entry = fifo1_pop();
+        issued_[i % allocations_] = steady_clock::now();
         apply(accelerator_, entry);
 
         // Test flow
@@ -644,7 +668,8 @@ uint32_t cmdq7::swvalid_thr(cmdq_t &fifo1, cmdq_t &fifo2)
         dma_buffer::ptr_t inp = entry.first;
         dma_buffer::ptr_t out = entry.second;
 
-        if (!out->poll<uint32_t>(out->size() - CL(1),
+        if (!out->wait<uint32_t>(out->size() - CL(1),
+                                 wait,
                                  timeout,
                                  HIGH,
                                  HIGH))
@@ -677,6 +702,9 @@ uint32_t cmdq7::swvalid_thr(cmdq_t &fifo1, cmdq_t &fifo2)
         // fence operation
         __sync_synchronize();
 
+        // queue the entry before the device can complete it
+        fifo2_push(entry);
+
         // 3. CPU to FPGA message. Select notice type.
         if (nlb7_notice::csr_write == notice_)
         {
@@ -694,25 +722,13 @@ uint32_t cmdq7::swvalid_thr(cmdq_t &fifo1, cmdq_t &fifo2)
             inp->write<uint32_t>(HIGH, inp->size()+8);
         }
 
-        fifo2_push(entry);
-
-        loops = 0;
-        uint32_t sw = 1;
-        accelerator_->read_mmio32(static_cast<uint32_t>(nlb0_csr::cmdq_sw), sw);
-        while ((sw & 0x1) != 0)
+        if (!wait.wait_until(cmdq_sw_clear, seconds(1)))
         {
-            ++loops;
-            if (loops >= max_loops)
-            {
-                std::lock_guard<std::mutex> g(print_lock_);
-                cancel_ = true;
-                ++errors_;
-                std::cerr << "swvalid_thr: Timeout waiting for cmdq_sw to be 0." << std::endl;
-                return i;
-            }
-
-            std::this_thread::sleep_for(microseconds(10));
-            accelerator_->read_mmio32(static_cast<uint32_t>(nlb0_csr::cmdq_sw), sw);
+            std::lock_guard<std::mutex> g(print_lock_);
+            cancel_ = true;
+            ++errors_;
+            std::cerr << "swvalid_thr: Timeout waiting for cmdq_sw to be 0." << std::endl;
+            return i;
         }
     }
 
@@ -722,15 +738,24 @@ uint32_t cmdq7::swvalid_thr(cmdq_t &fifo1, cmdq_t &fifo2)
 uint32_t cmdq7::cont_swvalid_thr(cmdq_t &fifo1, cmdq_t &fifo2)
 {
     uint32_t allocations = 0;
-    uint32_t sw;
-    uint32_t loops;
-    const uint32_t max_loops = 1000000;
+    wait_policy wait(wait_mode_);
     errno_t e;
 
     dma_buffer::microseconds_t timeout(1000000);
     if (target_ == "ase")
         timeout *= 100000;
 
+    auto cmdq_sw_clear = [this]()
+    {
+        uint32_t sw = 1;
+        accelerator_->read_mmio32(static_cast<uint32_t>(nlb0_csr::cmdq_sw), sw);
+        return cancel_ || (sw & 0x1) == 0;
+    };
+    auto entry_ready = [this]()
+    {
+        return cancel_ || !fifo1_is_empty();
+    };
+
     start_cache_ctrs_ = accelerator_->cache_counters();
     start_fabric_ctrs_ = accelerator_->fabric_counters();
 
@@ -741,6 +766,7 @@ uint32_t cmdq7::cont_swvalid_thr(cmdq_t &fifo1, cmdq_t &fifo2)
             memset((void *)umsg_virt_, 0, umsg_size_);
 
         cmdq_entry_t entry = fifo1_pop();
+        issued_[allocations % allocations_] = steady_clock::now();
         apply(accelerator_, entry);
         ++allocations;
 
@@ -750,7 +776,8 @@ uint32_t cmdq7::cont_swvalid_thr(cmdq_t &fifo1, cmdq_t &fifo2)
         dma_buffer::ptr_t inp = entry.first;
         dma_buffer::ptr_t out = entry.second;
 
-        if (!out->poll<uint32_t>(out->size() - CL(1),
+        if (!out->wait<uint32_t>(out->size() - CL(1),
+                                 wait,
                                  timeout,
                                  HIGH,
                                  HIGH))
@@ -783,6 +810,9 @@ uint32_t cmdq7::cont_swvalid_thr(cmdq_t &fifo1, cmdq_t &fifo2)
         // fence operation
         __sync_synchronize();
 
+        // queue the entry before the device can complete it
+        fifo2_push(entry);
+
         // 3. CPU to FPGA message. Select notice type.
         if (nlb7_notice::csr_write == notice_)
         {
@@ -800,47 +830,22 @@ uint32_t cmdq7::cont_swvalid_thr(cmdq_t &fifo1, cmdq_t &fifo2)
             inp->write<uint32_t>(HIGH, inp->size()+8);
         }
 
-        fifo2_push(entry);
-
-        loops = 0;
-        sw = 1;
-        accelerator_->read_mmio32(static_cast<uint32_t>(nlb0_csr::cmdq_sw), sw);
-        while ((sw & 0x1) != 0)
+        if (!wait.wait_until(cmdq_sw_clear, seconds(10)))
         {
-            ++loops;
-            if (loops >= max_loops)
-            {
-                std::lock_guard<std::mutex> g(print_lock_);
-                cancel_ = true;
-                ++errors_;
-                std::cerr << "cont_swvalid_thr: Timeout waiting for cmdq_sw to be 0." << std::endl;
-            }
-
-            std::this_thread::sleep_for(microseconds(10));
-            accelerator_->read_mmio32(static_cast<uint32_t>(nlb0_csr::cmdq_sw), sw);
-            if (cancel_)
-            {
-                return allocations;
-            }
+            std::lock_guard<std::mutex> g(print_lock_);
+            cancel_ = true;
+            ++errors_;
+            std::cerr << "cont_swvalid_thr: Timeout waiting for cmdq_sw to be 0." << std::endl;
+            return allocations;
         }
 
-        loops = 0;
-        while (fifo1_is_empty())
+        if (!wait.wait_until(entry_ready, seconds(10)))
         {
-            ++loops;
-            if (loops >= max_loops)
-            {
-                std::lock_guard<std::mutex> g(print_lock_);
-                cancel_ = true;
-                ++errors_;
-                std::cerr << "cont_swvalid_thr: Timeout waiting for queue items." << std::endl;
-            }
-
-            std::this_thread::sleep_for(microseconds(10));
-            if (cancel_)
-            {
-                return allocations;
-            }
+            std::lock_guard<std::mutex> g(print_lock_);
+            cancel_ = true;
+            ++errors_;
+            std::cerr << "cont_swvalid_thr: Timeout waiting for queue items." << std::endl;
+            return allocations;
         }
     }
 
@@ -849,8 +854,8 @@ uint32_t cmdq7::cont_swvalid_thr(cmdq_t &fifo1, cmdq_t &fifo2)
 
 uint32_t cmdq7::hwvalid_thr(cmdq_t &fifo1, cmdq_t &fifo2)
 {
-    uint32_t hw = 0;
     uint32_t i;
+    wait_policy wait(wait_mode_);
 
     for(i = 0 ; i < allocations_ ; ++i)
     {
@@ -868,13 +873,10 @@ uint32_t cmdq7::hwvalid_thr(cmdq_t &fifo1, cmdq_t &fifo2)
             // Because NLB uses dsm number as zero based,
             // for the first iteration, wait until the status is 1
 
-            while (0 == ((*dsm_status_addr) & 0x1))
+            wait.wait_until([&]() { return cancel_ || 0 != ((*dsm_status_addr) & 0x1); }, no_deadline);
+            if (0 == ((*dsm_status_addr) & 0x1))
             {
-                std::this_thread::sleep_for(microseconds(10));
-                if(cancel_)
-                {
-                    goto out;
-                }
+                goto out;
             }
 
             dsm_tuple_ = dsm_tuple(dsm_);
@@ -883,24 +885,24 @@ uint32_t cmdq7::hwvalid_thr(cmdq_t &fifo1, cmdq_t &fifo2)
         {
             // Otherwise, wait for NLB to write index to dsm.
             // The hardware counter is 15 bits wide.
-            while ((i % max_cmdq_counter) > ((*dsm_status_addr) >> 1))
+            wait.wait_until([&]() { return cancel_ || (i % max_cmdq_counter) <= ((*dsm_status_addr) >> 1); }, no_deadline);
+            if ((i % max_cmdq_counter) > ((*dsm_status_addr) >> 1))
             {
-                std::this_thread::sleep_for(microseconds(10));
-                if(cancel_)
-                {
-                    goto out;
-                }
+                goto out;
             }
 
             dsm_tuple_ += dsm_tuple(dsm_);
         }
 
+        auto completed = steady_clock::now();
+
         if (fifo2_is_empty())
         {
             goto out;
         }
 
         cmdq_entry_t entry(fifo2_pop());
+        cmdq_stats_.record(duration_cast<nanoseconds>(completed - issued_[i % allocations_]));
         bool passed = verify(entry);
         fifo1_push(entry);
 
@@ -926,7 +928,7 @@ out:
 uint32_t cmdq7::cont_hwvalid_thr(cmdq_t &fifo1, cmdq_t &fifo2)
 {
     uint32_t i = 0;
-    uint32_t hw;
+    wait_policy wait(wait_mode_);
 
     while (!cancel_)
     {
@@ -944,13 +946,10 @@ uint32_t cmdq7::cont_hwvalid_thr(cmdq_t &fifo1, cmdq_t &fifo2)
             // Because NLB uses dsm number as zero based,
             // for the first iteration, wait until the status is 1
 
-            while (0 == ((*dsm_status_addr) & 0x1))
+            wait.wait_until([&]() { return cancel_ || 0 != ((*dsm_status_addr) & 0x1); }, no_deadline);
+            if (0 == ((*dsm_status_addr) & 0x1))
             {
-                if (cancel_)
-                {
-                    goto out;
-                }
-                std::this_thread::sleep_for(microseconds(10));
+                goto out;
             }
 
             dsm_tuple_ = dsm_tuple(dsm_);
@@ -959,28 +958,25 @@ uint32_t cmdq7::cont_hwvalid_thr(cmdq_t &fifo1, cmdq_t &fifo2)
         {
             // Otherwise, wait for NLB to write index to dsm.
             // The hardware counter is 15 bits wide.
-            while ((i % max_cmdq_counter) > ((*dsm_status_addr) >> 1))
+            wait.wait_until([&]() { return cancel_ || (i % max_cmdq_counter) <= ((*dsm_status_addr) >> 1); }, no_deadline);
+            if ((i % max_cmdq_counter) > ((*dsm_status_addr) >> 1))
             {
-                if (cancel_)
-                {
-                    goto out;
-                }
-                std::this_thread::sleep_for(microseconds(10));
+                goto out;
             }
 
             dsm_tuple_ += dsm_tuple(dsm_);
         }
 
-        while (fifo2_is_empty())
+        auto completed = steady_clock::now();
+
+        wait.wait_until([this]() { return cancel_ || !fifo2_is_empty(); }, no_deadline);
+        if (fifo2_is_empty())
         {
-            std::this_thread::sleep_for(microseconds(10));
-            if (cancel_)
-            {
-                goto out;
-            }
+            goto out;
         }
 
         cmdq_entry_t entry(fifo2_pop());
+        cmdq_stats_.record(duration_cast<nanoseconds>(completed - issued_[i % allocations_]));
         bool passed = verify(entry);
         fifo1_push(entry);
 
@@ -1006,30 +1002,20 @@ out:
 
 bool cmdq7::wait_for_done(uint32_t allocations)
 {
-    const uint32_t max_loops = 10000;
-    uint32_t loops = 0;
+    wait_policy wait(wait_mode_);
 
-    while (true)
+    auto idle = [this]()
     {
-        ++loops;
-        if (loops >= max_loops)
-        {
-            return false;
-        }
-
         uint32_t sw = 1;
         uint32_t hw = 1;
 
         accelerator_->read_mmio32(static_cast<uint32_t>(nlb0_csr::cmdq_sw), sw);
         accelerator_->read_mmio32(static_cast<uint32_t>(nlb0_csr::cmdq_hw), hw);
 
-        if ((sw & 0x1) == 0 && (hw & 0x1) == 0)
-        {
-            return true;
-        }
+        return cancel_ || ((sw & 0x1) == 0 && (hw & 0x1) == 0);
+    };
 
-        std::this_thread::sleep_for(microseconds(10));
-    }
+    return wait.wait_until(idle, milliseconds(500)) && !cancel_;
 }
 
 } // end of namespace diag
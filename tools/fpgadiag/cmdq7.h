@@ -27,17 +27,19 @@
 #pragma once
 #include <iostream>
 #include <chrono>
-#include <deque>
+#include <vector>
 #include <atomic>
 #include <mutex>
 #include "nlb.h"
 #include "option_map.h"
 #include "fpga_app/accelerator_app.h"
+#include "fpga_app/spsc_ring.h"
 #include "accelerator.h"
 #include "dma_buffer.h"
 #include "csr.h"
 #include "log.h"
 #include "perf_counters.h"
+#include "wait_policy.h"
 #include "nlb_stats.h"
 
 namespace intel
@@ -107,12 +109,16 @@ private:
     intel::fpga::nlb::dsm_tuple dsm_tuple_;
 
     typedef std::pair< dma_buffer::ptr_t, dma_buffer::ptr_t > cmdq_entry_t;
-    typedef std::deque< cmdq_entry_t > cmdq_t;
+    typedef intel::fpga::spsc_ring< cmdq_entry_t > cmdq_t;
 
+    // fifo1: hwvalid (main thread before start) -> swvalid
+    // fifo2: swvalid -> hwvalid
     cmdq_t fifo1_;
-    std::mutex fifo1_lock_;
     cmdq_t fifo2_;
-    std::mutex fifo2_lock_;
+    wait_policy::mode_t wait_mode_;
+    // submit time of command n, at n % allocations_
+    std::vector<std::chrono::steady_clock::time_point> issued_;
+    intel::fpga::nlb::cmdq_stats cmdq_stats_;
     std::atomic_bool cancel_;
     int errors_;
     volatile uint8_t *umsg_virt_;
@@ -137,41 +143,36 @@ private:
 
     bool wait_for_done(uint32_t allocations);
 
+    // Both rings hold every entry, so push never fails.
     bool fifo1_is_empty()
     {
-        std::lock_guard<std::mutex> g(fifo1_lock_);
         return fifo1_.empty();
     }
     bool fifo2_is_empty()
     {
-        std::lock_guard<std::mutex> g(fifo2_lock_);
         return fifo2_.empty();
     }
 
     cmdq_entry_t fifo1_pop()
     {
-        std::lock_guard<std::mutex> g(fifo1_lock_);
-        cmdq_entry_t e(fifo1_.front());
-        fifo1_.pop_front();
+        cmdq_entry_t e;
+        fifo1_.pop(e);
         return e;
     }
     cmdq_entry_t fifo2_pop()
     {
-        std::lock_guard<std::mutex> g(fifo2_lock_);
-        cmdq_entry_t e(fifo2_.front());
-        fifo2_.pop_front();
+        cmdq_entry_t e;
+        fifo2_.pop(e);
         return e;
     }
 
-    void fifo1_push(cmdq_entry_t e)
+    void fifo1_push(const cmdq_entry_t &e)
     {
-        std::lock_guard<std::mutex> g(fifo1_lock_);
-        fifo1_.push_back(e);
+        fifo1_.push(e);
     }
-    void fifo2_push(cmdq_entry_t e)
+    void fifo2_push(const cmdq_entry_t &e)
     {
-        std::lock_guard<std::mutex> g(fifo2_lock_);
-        fifo2_.push_back(e);
+        fifo2_.push(e);
     }
 
 };
@@ -36,6 +36,10 @@ namespace intel
 namespace fpga
 {
 
+/// @brief One AFU instance of a muxed accelerator.
+/// CSR offsets are moved into the instance's window; MMIO, buffers,
+/// UMsgs and reset go to the wrapped accelerator's own (virtual)
+/// implementation, so any accelerator type can be muxed.
 class accelerator_mux : public accelerator
 {
 public:
@@ -43,6 +47,7 @@ public:
 
     accelerator_mux(accelerator::ptr_t accelerator_ptr, uint32_t count, uint32_t mux_id, buffer_pool::ptr_t pool = buffer_pool::ptr_t(0))
     : accelerator(*accelerator_ptr)
+    , accelerator_(accelerator_ptr)
     , count_(count)
     , mux_id_(mux_id)
     , pool_(pool)
@@ -53,22 +58,22 @@ public:
 
     virtual bool write_mmio32(unsigned int offset, uint32_t value)
     {
-        return accelerator::write_mmio32(mask32_ | offset, value);
+        return accelerator_->write_mmio32(mask32_ | offset, value);
     }
 
     virtual bool write_mmio64(unsigned int offset, uint64_t value)
     {
-        return accelerator::write_mmio64(mask32_ | offset, value);
+        return accelerator_->write_mmio64(mask32_ | offset, value);
     }
 
     virtual bool read_mmio32(unsigned int offset, unsigned int & value)
     {
-        return accelerator::read_mmio32(mask32_ | offset, value);
+        return accelerator_->read_mmio32(mask32_ | offset, value);
     }
 
     virtual bool read_mmio64(unsigned int offset, uint64_t & value)
     {
-        return accelerator::read_mmio64(mask32_ | offset, value);
+        return accelerator_->read_mmio64(mask32_ | offset, value);
     }
 
     virtual dma_buffer::ptr_t allocate_buffer(std::size_t size)
@@ -77,15 +82,33 @@ public:
         {
             return pool_->allocate_buffer(size);
         }
-        return accelerator::allocate_buffer(size);
+        return accelerator_->allocate_buffer(size);
     }
 
+    virtual uint64_t umsg_num()
+    {
+        return accelerator_->umsg_num();
+    }
+
+    virtual bool umsg_set_mask(uint64_t mask)
+    {
+        return accelerator_->umsg_set_mask(mask);
+    }
+
+    virtual uint64_t * umsg_get_ptr()
+    {
+        return accelerator_->umsg_get_ptr();
+    }
+
+    /// A lone instance owns the device and may reset it; with several,
+    /// the device is reset once before they start and never under them.
     virtual bool reset()
     {
-        return true;
+        return count_ == 1 ? accelerator_->reset() : true;
     }
 
 private:
+    accelerator::ptr_t accelerator_;
     uint32_t           count_;
     uint32_t           mux_id_;
     uint32_t           mask32_;
@@ -23,8 +23,13 @@
 // CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
 // ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
+
 #pragma once
 #include <mutex>
+#include <set>
+#include <vector>
+#include <unordered_map>
+#include <ostream>
 #include "dma_buffer.h"
 
 namespace intel
@@ -32,47 +37,255 @@ namespace intel
 namespace fpga
 {
 
+/// @brief Buddy allocator over one pinned dma_buffer.
+/// Blocks are powers of two from one cache line up, aligned to their
+/// size. A buffer returns its block to the pool when its last
+/// reference is dropped.
 class buffer_pool
 {
 public:
     typedef std::shared_ptr<buffer_pool> ptr_t;
 
-    buffer_pool(dma_buffer::ptr_t buffer)
-    : buffer_(buffer)
-    , addr_offset_(0)
-    , iova_offset_(0)
+    struct stats_t
     {
-        if (buffer)
+        std::size_t capacity;     ///< bytes managed by the pool
+        std::size_t allocated;    ///< bytes in live blocks
+        std::size_t requested;    ///< bytes requested by live buffers
+        std::size_t free_bytes;   ///< bytes in free blocks
+        std::size_t largest_free; ///< largest free block
+        std::size_t live;         ///< live buffers
+        std::size_t allocations;  ///< successful allocations
+        std::size_t frees;        ///< buffers returned
+        std::size_t failures;     ///< allocations that did not fit
+
+        /// @brief Fraction of free space not in the largest free block.
+        double external_fragmentation() const
+        {
+            return free_bytes ? 1.0 - double(largest_free) / free_bytes : 0.0;
+        }
+
+        /// @brief Fraction of live blocks lost to rounding up.
+        double internal_fragmentation() const
         {
-            addr_offset_ = const_cast<uint8_t*>(buffer->address());
-            iova_offset_ = buffer->iova();
+            return allocated ? 1.0 - double(requested) / allocated : 0.0;
         }
+
+        /// @brief Fraction of the pool in live blocks.
+        double occupancy() const
+        {
+            return capacity ? double(allocated) / capacity : 0.0;
+        }
+    };
+
+    buffer_pool(dma_buffer::ptr_t buffer)
+    : state_(std::make_shared<state>(buffer))
+    {
     }
 
     dma_buffer::ptr_t allocate_buffer(std::size_t size)
     {
-        std::lock_guard<std::mutex> lock(mutex_);
+        std::size_t offset = 0;
         dma_buffer::ptr_t buffer(0);
-        if (!buffer_ || addr_offset_ + size > buffer_->address() + buffer_->size())
+
+        if (!state_->allocate(size, offset))
         {
             // TODO: Log some sort of error or throw an exception?
             // but for now return a null buffer
             return buffer;
         }
-        buffer.reset(new dma_buffer(buffer_, addr_offset_, iova_offset_, size));
-        addr_offset_ += size;
-        iova_offset_ += size;
+
+        dma_buffer::ptr_t parent = state_->buffer_;
+        std::shared_ptr<state> s = state_;
+        buffer.reset(new dma_buffer(parent,
+                                    const_cast<uint8_t*>(parent->address()) + offset,
+                                    parent->iova() + offset,
+                                    size),
+                     [s, offset](dma_buffer *b)
+                     {
+                         delete b;
+                         s->release(offset);
+                     });
         return buffer;
     }
 
+    stats_t stats() const
+    {
+        return state_->get_stats();
+    }
+
+    friend std::ostream & operator << (std::ostream &os, const stats_t &s)
+    {
+        os << "capacity: " << s.capacity
+           << " allocated: " << s.allocated
+           << " live: " << s.live
+           << " allocations: " << s.allocations
+           << " frees: " << s.frees
+           << " failures: " << s.failures
+           << " occupancy: " << s.occupancy()
+           << " internal frag: " << s.internal_fragmentation()
+           << " external frag: " << s.external_fragmentation();
+        return os;
+    }
+
 private:
-    dma_buffer::ptr_t buffer_;
-    uint8_t          *addr_offset_;
-    uint64_t          iova_offset_;
-    std::mutex        mutex_;
+    static const unsigned min_order = 6; // one cache line
+
+    // Allocator state, shared with the deleters of outstanding buffers
+    // so that it outlives the pool object if needed.
+    struct state
+    {
+        state(dma_buffer::ptr_t buffer)
+        : buffer_(buffer)
+        , stats_()
+        {
+            std::size_t size = buffer ? buffer->size() : 0;
+            std::size_t offset = 0;
+
+            size &= ~((std::size_t(1) << min_order) - 1);
+            stats_.capacity = size;
+            stats_.free_bytes = size;
+
+            // Carve the region into naturally aligned power of two blocks.
+            while (size)
+            {
+                unsigned order = floor_log2(size);
+                add_free(order, offset);
+                offset += std::size_t(1) << order;
+                size -= std::size_t(1) << order;
+            }
+            update_largest();
+        }
+
+        bool allocate(std::size_t size, std::size_t &offset)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            unsigned order = min_order;
+            while ((std::size_t(1) << order) < size)
+            {
+                ++order;
+            }
 
+            unsigned k = order;
+            while (k < free_.size() && free_[k].empty())
+            {
+                ++k;
+            }
+
+            if (!size || k >= free_.size())
+            {
+                ++stats_.failures;
+                return false;
+            }
+
+            offset = *free_[k].begin();
+            free_[k].erase(free_[k].begin());
+
+            // split down, keeping the lower half
+            while (k > order)
+            {
+                --k;
+                add_free(k, offset + (std::size_t(1) << k));
+            }
+
+            live_[offset] = block_t{ order, size };
+            stats_.allocated += std::size_t(1) << order;
+            stats_.requested += size;
+            stats_.free_bytes -= std::size_t(1) << order;
+            ++stats_.live;
+            ++stats_.allocations;
+            update_largest();
+            return true;
+        }
+
+        void release(std::size_t offset)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            auto it = live_.find(offset);
+            if (it == live_.end())
+            {
+                return;
+            }
+
+            unsigned order = it->second.order;
+            stats_.allocated -= std::size_t(1) << order;
+            stats_.requested -= it->second.requested;
+            stats_.free_bytes += std::size_t(1) << order;
+            --stats_.live;
+            ++stats_.frees;
+            live_.erase(it);
+
+            // coalesce with free buddies
+            while (order + 1 < free_.size())
+            {
+                std::size_t buddy = offset ^ (std::size_t(1) << order);
+                auto b = free_[order].find(buddy);
+                if (b == free_[order].end())
+                {
+                    break;
+                }
+                free_[order].erase(b);
+                offset &= ~(std::size_t(1) << order);
+                ++order;
+            }
+            add_free(order, offset);
+            update_largest();
+        }
+
+        stats_t get_stats()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return stats_;
+        }
+
+        static unsigned floor_log2(std::size_t v)
+        {
+            unsigned r = 0;
+            while (v >>= 1)
+            {
+                ++r;
+            }
+            return r;
+        }
+
+        void add_free(unsigned order, std::size_t offset)
+        {
+            if (order >= free_.size())
+            {
+                free_.resize(order + 1);
+            }
+            free_[order].insert(offset);
+        }
+
+        void update_largest()
+        {
+            stats_.largest_free = 0;
+            for (std::size_t k = free_.size(); k > 0; --k)
+            {
+                if (!free_[k - 1].empty())
+                {
+                    stats_.largest_free = std::size_t(1) << (k - 1);
+                    break;
+                }
+            }
+        }
+
+        struct block_t
+        {
+            unsigned order;
+            std::size_t requested;
+        };
+
+        dma_buffer::ptr_t buffer_;
+        std::mutex mutex_;
+        std::vector<std::set<std::size_t>> free_; // free block offsets by order
+        std::unordered_map<std::size_t, block_t> live_;
+        stats_t stats_;
+    };
+
+    std::shared_ptr<state> state_;
 };
 
 } // end of namespace fpga
 } // end of namespace intel
-
@@ -0,0 +1,153 @@
+// Copyright(c) 2017, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace intel
+{
+namespace fpga
+{
+
+/// @brief Bounded lock-free ring for exactly one producer thread and one
+/// consumer thread.
+/// Slots are preallocated; push() and pop() never allocate or lock.
+/// Each side keeps a cached copy of the other side's index so the shared
+/// index is only re-read when the ring looks full (or empty).
+template<typename T>
+class spsc_ring
+{
+public:
+    /// @param capacity minimum number of entries; rounded up to a power of two
+    explicit spsc_ring(std::size_t capacity = 1)
+    : mask_(round_up(capacity) - 1)
+    , slots_(mask_ + 1)
+    , head_(0)
+    , tail_cache_(0)
+    , tail_(0)
+    , head_cache_(0)
+    {
+    }
+
+    /// @brief Drop all entries and resize. Not thread safe; call it
+    /// before the producer and consumer start.
+    void reset(std::size_t capacity)
+    {
+        mask_ = round_up(capacity) - 1;
+        slots_.assign(mask_ + 1, T());
+        head_.store(0, std::memory_order_relaxed);
+        tail_.store(0, std::memory_order_relaxed);
+        tail_cache_ = 0;
+        head_cache_ = 0;
+    }
+
+    /// @brief Producer side. Returns false when the ring is full.
+    bool push(const T &value)
+    {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_cache_ > mask_)
+        {
+            head_cache_ = head_.load(std::memory_order_acquire);
+            if (tail - head_cache_ > mask_)
+            {
+                return false;
+            }
+        }
+        slots_[tail & mask_] = value;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Consumer side. Returns false when the ring is empty.
+    bool pop(T &value)
+    {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_cache_)
+        {
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+            if (head == tail_cache_)
+            {
+                return false;
+            }
+        }
+        value = slots_[head & mask_];
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Consumer side. The ring must not be empty.
+    const T & front() const
+    {
+        return slots_[head_.load(std::memory_order_relaxed) & mask_];
+    }
+
+    /// @brief Exact on the consumer side, a snapshot anywhere else.
+    bool empty() const
+    {
+        return head_.load(std::memory_order_acquire) ==
+               tail_.load(std::memory_order_acquire);
+    }
+
+    std::size_t size() const
+    {
+        return tail_.load(std::memory_order_acquire) -
+               head_.load(std::memory_order_acquire);
+    }
+
+    std::size_t capacity() const
+    {
+        return mask_ + 1;
+    }
+
+private:
+    spsc_ring(const spsc_ring &);
+    spsc_ring & operator=(const spsc_ring &);
+
+    static std::size_t round_up(std::size_t n)
+    {
+        std::size_t p = 1;
+        while (p < n)
+        {
+            p <<= 1;
+        }
+        return p;
+    }
+
+    std::size_t mask_;
+    std::vector<T> slots_;
+
+    // consumer-owned, then producer-owned, each on its own cache line
+    alignas(64) std::atomic<std::size_t> head_;
+    std::size_t tail_cache_;
+    alignas(64) std::atomic<std::size_t> tail_;
+    std::size_t head_cache_;
+};
+
+} // end of namespace fpga
+} // end of namespace intel
@@ -31,6 +31,7 @@
 #include <thread>
 #include "option.h"
 #include "nlb_stats.h"
+#include "utils.h"
 #include <sstream>
 #include <iomanip>
 #include <cmath>
@@ -64,6 +65,10 @@ mtnlb::mtnlb(const std::string & afu_id)
 , dsm_timeout_(FPGA_DSM_TIMEOUT)
 , suppress_header_(false)
 , csv_format_(false)
+, wait_stats_(false)
+, wait_mode_(wait_policy::spin_sleep)
+, numa_bind_(false)
+, thread_stats_(false)
 {
     define_options();
 }
@@ -87,6 +92,10 @@ mtnlb::mtnlb(const std::string & afu_id, const std::string & name)
 , dsm_timeout_(FPGA_DSM_TIMEOUT)
 , suppress_header_(false)
 , csv_format_(false)
+, wait_stats_(false)
+, wait_mode_(wait_policy::spin_sleep)
+, numa_bind_(false)
+, thread_stats_(false)
 {
     define_options();
 }
@@ -97,7 +106,7 @@ void mtnlb::define_options()
     options_.add_option<bool>("help",                'h', option::no_argument,   "Show help message", false);
     options_.add_option<std::string>("mode",         'm', option::with_argument, "mtnlb mode (mt7 or mt8)", mode_);
     options_.add_option<std::string>("config",       'c', option::with_argument, "Path to test config file", config_);
-    options_.add_option<std::string>("target",       't', option::with_argument, "one of { fpga, ase }", target_);
+    options_.add_option<std::string>("target",       't', option::with_argument, "one of { fpga, ase, emu }", target_);
     options_.add_option<uint32_t>("count",           'C', option::with_argument, "number of iterations", 1);
     options_.add_option<uint32_t>("threads",         'T', option::with_argument, "number of threads to spawn - default is 64", 64);
     options_.add_option<uint32_t>("stride",          'e', option::with_argument, "stride number", 1);
@@ -114,6 +123,11 @@ void mtnlb::define_options()
     options_.add_option<uint32_t>("freq",            'k', option::with_argument, "Clock frequence (used for bw measurements)", frequency_);
     options_.add_option<bool>("suppress-hdr",        'S', option::no_argument,   "Suppress column headers", suppress_header_);
     options_.add_option<bool>("csv",                 'V', option::no_argument,   "Comma separated value format", csv_format_);
+    options_.add_option<std::string>("wait-policy",       option::with_argument, "How threads poll the device: one of { spin, yield, sleep, monitor }", "sleep");
+    options_.add_option<bool>("wait-stats",               option::no_argument,   "Print completion wait latency distribution", wait_stats_);
+    options_.add_option<std::string>("cpu-list",          option::with_argument, "Pin thread i to the i-th cpu of a list such as 0-3,8 (round robin)", "");
+    options_.add_option<bool>("numa-bind",                option::no_argument,   "Pin threads and the workspace to the FPGA's NUMA node", numa_bind_);
+    options_.add_option<bool>("thread-stats",             option::no_argument,   "Print round-trip latency for each thread", thread_stats_);
 }
 
 mtnlb::~mtnlb()
@@ -124,7 +138,7 @@ mtnlb::~mtnlb()
 bool mtnlb::setup()
 {
     options_.get_value<std::string>("target", target_);
-    if (target_ == "fpga")
+    if (target_ == "fpga" || target_ == "emu")
     {
         dsm_timeout_ = FPGA_DSM_TIMEOUT;
     }
@@ -247,6 +261,40 @@ bool mtnlb::setup()
     }
 
 
+    std::string cpu_list;
+    options_.get_value<std::string>("cpu-list", cpu_list);
+    options_.get_value<bool>("numa-bind", numa_bind_);
+    cpus_.clear();
+    if (!cpu_list.empty() && numa_bind_)
+    {
+        std::cerr << "--cpu-list and --numa-bind are mutually exclusive" << std::endl;
+        return false;
+    }
+    if (!cpu_list.empty() && !parse_cpu_list(cpu_list, cpus_))
+    {
+        std::cerr << "Invalid --cpu-list: " << cpu_list << std::endl;
+        return false;
+    }
+    if (numa_bind_)
+    {
+        int node = accelerator_->numa_node();
+        if (!numa_node_cpus(node, cpus_))
+        {
+            std::cerr << "No cpus found for NUMA node " << node << std::endl;
+            return false;
+        }
+        log_.info(mode_) << "binding to NUMA node " << node << std::endl;
+    }
+
+    // Restrict this thread before allocating so the workspace pages are
+    // first touched from the selected cpus; the workers inherit the mask
+    // until they are pinned.
+    if (!cpus_.empty() && !set_thread_affinity(pthread_self(), cpus_))
+    {
+        std::cerr << "Failed to set cpu affinity" << std::endl;
+        return false;
+    }
+
     wkspc_ = accelerator_->allocate_buffer(wkspc_size_);
     auto bufs = dma_buffer::split(wkspc_, { dsm_size_, inp_size_, out_size_});
     dsm_ = bufs[0];
@@ -260,6 +308,16 @@ bool mtnlb::setup()
 
     options_.get_value<bool>("suppress-hdr", suppress_header_);
     options_.get_value<bool>("csv", csv_format_);
+    std::string wait_mode;
+    if (options_.get_value<std::string>("wait-policy", wait_mode) &&
+        !wait_policy::parse(wait_mode, wait_mode_))
+    {
+        std::cerr << "Invalid --wait-policy: " << wait_mode << std::endl;
+        return false;
+    }
+    wait_ = wait_policy(wait_mode_);
+    options_.get_value<bool>("wait-stats", wait_stats_);
+    options_.get_value<bool>("thread-stats", thread_stats_);
 
     mode7_args_ = (static_cast<uint64_t>(log_stride) << 32) | (count_ << 11) | thread_count_;
     return true;
@@ -311,20 +369,28 @@ bool mtnlb::run()
         this->work(tid, iter, stride);
     };
 
+    latency_.assign(thread_count_, latency_histogram());
+
     for (uint64_t i = 0; i < thread_count_; ++i)
     {
         threads.push_back(std::thread(thread_fn, i, count_, stride_));
+        if (!cpus_.empty())
+        {
+            set_thread_affinity(threads.back().native_handle(), { cpus_[i % cpus_.size()] });
+        }
     }
     // Read perf counters.
     fpga_cache_counters  start_cache_ctrs  = accelerator_->cache_counters();
     fpga_fabric_counters start_fabric_ctrs = accelerator_->fabric_counters();
 
     // start the threads
+    auto begin = steady_clock::now();
     ready_ = true;
     for( std::thread & t : threads )
     {
         t.join();
     }
+    duration<double> elapsed = steady_clock::now() - begin;
 
     // Read perf counters
     fpga_cache_counters  end_cache_ctrs  = accelerator_->cache_counters();
@@ -344,7 +410,7 @@ bool mtnlb::run()
     log_.debug(mode_) << "Waiting for dsm status bit" << std::endl;
 
     result &= dsm_->wait(static_cast<size_t>(mtnlb_dsm::test_complete),
-                                             dma_buffer::microseconds_t(10),
+                                             wait_,
                                              dsm_timeout_,
                                              0x1,
                                              0x1);
@@ -371,9 +437,74 @@ bool mtnlb::run()
                                                      suppress_header_,
                                                      csv_format_);
 
+    show_latency(std::cout, elapsed);
+
+    if (wait_stats_)
+    {
+        wait_.report(std::cout);
+    }
+
     return result;
 }
 
+void mtnlb::show_latency(std::ostream &os, duration<double> elapsed)
+{
+    const bool csv = csv_format_;
+    const double secs = elapsed.count();
+    latency_histogram all;
+
+    for (const auto & h : latency_)
+    {
+        all += h;
+    }
+
+    if (!suppress_header_)
+    {
+        if (csv)
+        {
+            os << "Thread,Round_Trips,Round_Trips_Per_Sec,Lat_Min_ns,Lat_P50_ns,Lat_P99_ns,Lat_Max_ns" << std::endl;
+        }
+        else
+        {
+                // 012345 012345678901 0123456789012345 012345678901 012345678901 012345678901 012345678901
+            os << "Thread  Round_Trips  Round_Trips/sec  Lat_Min(ns)  Lat_P50(ns)  Lat_P99(ns)  Lat_Max(ns)" << std::endl;
+        }
+    }
+
+    auto row = [&os, csv, secs](const std::string &id, const latency_histogram &h)
+    {
+        std::ostringstream rate;
+        rate << std::fixed << std::setprecision(1) << (secs > 0.0 ? h.count() / secs : 0.0);
+
+        if (csv)
+        {
+            os << id << ',' << h.count() << ',' << rate.str() << ','
+               << h.min() << ',' << h.percentile(50.0) << ','
+               << h.percentile(99.0) << ',' << h.max() << std::endl;
+        }
+        else
+        {
+            os << std::setw(6)  << id                 << ' '
+               << std::setw(12) << h.count()          << ' '
+               << std::setw(16) << rate.str()         << ' '
+               << std::setw(12) << h.min()            << ' '
+               << std::setw(12) << h.percentile(50.0) << ' '
+               << std::setw(12) << h.percentile(99.0) << ' '
+               << std::setw(12) << h.max()            << std::endl;
+        }
+    };
+
+    row("all", all);
+    if (thread_stats_)
+    {
+        for (std::size_t t = 0; t < latency_.size(); ++t)
+        {
+            row(std::to_string(t), latency_[t]);
+        }
+    }
+    os << std::endl;
+}
+
 std::string mtnlb::show_rw()
 {
     uint64_t num_rw;
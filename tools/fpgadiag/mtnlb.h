@@ -32,9 +32,12 @@
 #include "dma_buffer.h"
 #include "csr.h"
 #include "log.h"
+#include "wait_policy.h"
+#include "nlb_stats.h"
 #include <chrono>
 #include <atomic>
 #include <thread>
+#include <vector>
 
 namespace intel
 {
@@ -60,6 +63,7 @@ public:
 
     void show_pending(uint32_t thread_id);
     std::string show_rw();
+    void show_latency(std::ostream &os, std::chrono::duration<double> elapsed);
 
 protected:
     virtual void work(uint64_t thread_id, uint64_t iterations, uint64_t stride) = 0;
@@ -98,6 +102,14 @@ protected:
     std::chrono::microseconds     dsm_timeout_;
     bool suppress_header_;
     bool csv_format_;
+    wait_policy wait_;
+    bool wait_stats_;
+    wait_policy::mode_t wait_mode_;
+    bool numa_bind_;
+    bool thread_stats_;
+    std::vector<int> cpus_;
+    // round trips seen by each worker thread, indexed by thread id
+    std::vector<intel::fpga::nlb::latency_histogram> latency_;
     //void _mode7(uint64_t thread_id, uint64_t iterations, uint64_t stride);
     //void _mode8(uint64_t thread_id, uint64_t iterations, uint64_t stride);
 
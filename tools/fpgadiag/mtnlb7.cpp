@@ -46,6 +46,7 @@ mtnlb7::mtnlb7(const std::string & name)
 : mtnlb(AFUID, "mtnlb7")
 {
     mode_ = "mt7";
+    *options_["mode"] = mode_;
     config_ = "mtnlb7.json";
 }
 
@@ -53,6 +54,7 @@ mtnlb7::mtnlb7()
 : mtnlb(AFUID, "mtnlb7")
 {
     mode_ = "mt7";
+    *options_["mode"] = mode_;
     config_ = "mtnlb7.json";
 }
 
@@ -63,38 +65,37 @@ mtnlb7::~mtnlb7()
 void mtnlb7::work(uint64_t thread_id, uint64_t iterations, uint64_t stride)
 {
     // wait for the signal to start
-    while (!ready_);
+    while (!ready_)
+    {
+        std::this_thread::yield();
+    }
+    wait_policy wait(wait_mode_);
     uint64_t iteration = 1;
     uint64_t offset = 0;
     volatile uint64_t* out_ptr = reinterpret_cast<volatile uint64_t*>(out_->address() + thread_id*stride*cacheline_size);
     volatile uint64_t* inp_ptr = reinterpret_cast<volatile uint64_t*>(inp_->address() + thread_id*stride*cacheline_size);
+    auto sent = steady_clock::now();
 
     while (!cancel_ && iteration < iterations+1)
     {
-        auto begin = system_clock::now();
-        while (!cancel_ && *out_ptr != iteration)
+        if (!wait.wait_until([&]() { return cancel_ || *out_ptr == iteration; }, seconds(1)))
         {
-            if (system_clock::now() - begin >= seconds(1))
-            {
-                log_.error(mode_) << "thread [" << thread_id << "]: timeout waiting for value: " << iteration << std::endl;
-                log_.error(mode_) << "thread [" << thread_id << "]: Expected: " << iteration << ". Got: " << *out_ptr << std::endl;
-                if (!cancel_)
-                {
-                    show_pending(thread_id);
-                    cancel_ = true;
-                    break;
-                }
-            }
-            else
+            log_.error(mode_) << "thread [" << thread_id << "]: timeout waiting for value: " << iteration << std::endl;
+            log_.error(mode_) << "thread [" << thread_id << "]: Expected: " << iteration << ". Got: " << *out_ptr << std::endl;
+            if (!cancel_)
             {
-                std::this_thread::sleep_for(microseconds(10));
+                show_pending(thread_id);
+                cancel_ = true;
             }
         }
 
         if (!cancel_)
         {
+            auto received = steady_clock::now();
+            latency_[thread_id].record(duration_cast<nanoseconds>(received - sent));
             log_.debug(mode_) << "thread [" << thread_id << "]: iteration="<< iteration << std::endl;
             *inp_ptr = iteration++;
+            sent = steady_clock::now();
         }
     }
 
@@ -46,6 +46,7 @@ mtnlb8::mtnlb8(const std::string & name)
 : mtnlb(AFUID, "mtnlb8")
 {
     mode_ = "mt8";
+    *options_["mode"] = mode_;
     config_ = "mtnlb8.json";
 }
 
@@ -53,6 +54,7 @@ mtnlb8::mtnlb8()
 : mtnlb(AFUID, "mtnlb8")
 {
     mode_ = "mt8";
+    *options_["mode"] = mode_;
     config_ = "mtnlb8.json";
 }
 
@@ -63,40 +65,39 @@ mtnlb8::~mtnlb8()
 void mtnlb8::work(uint64_t thread_id, uint64_t iterations, uint64_t stride)
 {
     // wait for the signal to start
-    while (!ready_);
+    while (!ready_)
+    {
+        std::this_thread::yield();
+    }
 
+    wait_policy wait(wait_mode_);
     uint64_t offset = 0;
 
     volatile uint64_t* out_ptr = reinterpret_cast<volatile uint64_t*>(out_->address() + thread_id*stride*cacheline_size);
     uint64_t cpuCount = 2, fpgaCount = 1;
+    auto sent = steady_clock::now();
     while (!cancel_ && fpgaCount <= mtnlb_max_count)
     {
-        auto begin = system_clock::now();
-        while (!cancel_ && *out_ptr != fpgaCount)
+        if (!wait.wait_until([&]() { return cancel_ || *out_ptr == fpgaCount; }, seconds(1)))
         {
-            if (system_clock::now() - begin >= seconds(1))
+            log_.debug(mode_) << "thread [" << thread_id << "]: timeout waiting for value" << std::endl;
+            if (!cancel_)
             {
-                log_.debug(mode_) << "thread [" << thread_id << "]: timeout waiting for value" << std::endl;
-                if (!cancel_)
-                {
-                    // cancel threads
-                    cancel_ = true;
-                    // stop the test
-                    stop_ = true;
-                    log_.warn(mode_)  << "thread [" << thread_id << "]: Timed out waiting for expected value from FPGA" << std::endl;
-                    log_.warn(mode_)  << "thread [" << thread_id << "]: Expected: " << fpgaCount << ". Got: " << *out_ptr << std::endl;
-                    show_pending(thread_id);
-                    return;
-                }
-            }
-            else
-            {
-                std::this_thread::sleep_for(microseconds(10));
+                // cancel threads
+                cancel_ = true;
+                // stop the test
+                stop_ = true;
+                log_.warn(mode_)  << "thread [" << thread_id << "]: Timed out waiting for expected value from FPGA" << std::endl;
+                log_.warn(mode_)  << "thread [" << thread_id << "]: Expected: " << fpgaCount << ". Got: " << *out_ptr << std::endl;
+                show_pending(thread_id);
+                return;
             }
         }
 
         if (!cancel_)
         {
+            auto received = steady_clock::now();
+            latency_[thread_id].record(duration_cast<nanoseconds>(received - sent));
             //log_.info() << "thread [" << thread_id << "]: fpgaCount ="<< *out_ptr << std::endl;
             log_.debug(mode_) << "thread[" << thread_id << "] [FPGA] count is: " << *out_ptr << std::endl;
             fpgaCount += 2;
@@ -104,6 +105,7 @@ void mtnlb8::work(uint64_t thread_id, uint64_t iterations, uint64_t stride)
             {
                 *out_ptr = cpuCount;
             }
+            sent = steady_clock::now();
             log_.debug(mode_) << "thread[" << thread_id << "] [CPU] count is: " << *out_ptr << std::endl;
             //log_.info() << "thread [" << thread_id << "]: cpuCount  ="<< *out_ptr << std::endl;
 
@@ -32,6 +32,7 @@
 #include "option.h"
 #include "option_parser.h"
 #include "accelerator.h"
+#include "nlb_emulator.h"
 
 using namespace intel::fpga;
 using namespace intel::fpga::diag;
@@ -74,8 +75,12 @@ int main(int argc, char* argv[])
 
     logger log;
     option_map::ptr_t filter(new option_map(opts));
+    std::string target = "fpga";
+    opts.get_value("target", target);
 
-    std::vector<accelerator::ptr_t> accelerator_list = accelerator::enumerate({ filter });
+    std::vector<accelerator::ptr_t> accelerator_list = target == "emu" ?
+        intel::fpga::nlb::nlb_emulator::enumerate({ filter }, nlb.afu_id()) :
+        accelerator::enumerate({ filter });
     if (accelerator_list.size() >= 1)
     {
         accelerator::ptr_t accelerator_obj = accelerator_list[0];
@@ -34,6 +34,7 @@
 #include "mtnlb7.h"
 #include "mtnlb8.h"
 #include "nlb_stats.h"
+#include "nlb_emulator.h"
 #include "fpga_app/accelerator_mux.h"
 #include "log.h"
 #include "utils.h"
@@ -125,7 +126,7 @@ int main(int argc, char* argv[])
     opts.add_option<uint8_t>("bus-number",    'B', option::with_argument, "Bus number of PCIe device");
     opts.add_option<uint8_t>("device",        'D', option::with_argument, "Device number of PCIe device");
     opts.add_option<uint8_t>("function",      'F', option::with_argument, "Function number of PCIe device");
-    opts.add_option<std::string>("target",    't', option::with_argument, "Target platform. fpga or ase - default is fpga", "fpga");
+    opts.add_option<std::string>("target",    't', option::with_argument, "Target platform. fpga, ase or emu - default is fpga", "fpga");
     opts.add_option<std::string>("guid",      'G', option::with_argument, "GUID of accelerator to open");
     opts.add_option<std::string>("muxfile",   'm', option::with_argument, "Path to JSON file containing mux sw apps");
 
@@ -157,14 +158,23 @@ int main(int argc, char* argv[])
         *opts["guid"] = apps[0]->afu_id();
     }
 
-    std::vector<accelerator::ptr_t> acceleratorlist = accelerator::enumerate({ std::make_shared<option_map>(opts) });
+    std::string target = "fpga";
+    opts.get_value("target", target);
+    if (target == "emu" && apps.size() > 1)
+    {
+        // The emulator models a single NLB; it does not decode the
+        // per-instance CSR windows of a muxed AFU.
+        log.error("main") << "--target emu supports only one app in the muxfile" << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::vector<accelerator::ptr_t> acceleratorlist = target == "emu" ?
+        nlb::nlb_emulator::enumerate({ std::make_shared<option_map>(opts) }) :
+        accelerator::enumerate({ std::make_shared<option_map>(opts) });
     if (acceleratorlist.size() == 0)
     {
         return EXIT_FAILURE;
     }
 
-    std::string target = "fpga";
-    opts.get_value("target", target);
     bool shared = target == "fpga";
     std::map<std::string, std::future<bool>> futures;
     std::map<std::string, test_result>       results;
@@ -210,6 +220,8 @@ int main(int argc, char* argv[])
     }
 
 
+    log.debug("buffer_pool") << pool->stats() << std::endl;
+
     for(auto & kv : results)
     {
         if (kv.second != test_result::pass)
@@ -59,10 +59,13 @@ nlb0::nlb0()
 , dsm_timeout_(FPGA_DSM_TIMEOUT)
 , suppress_header_(false)
 , csv_format_(false)
+, sample_usec_(0)
+, wait_stats_(false)
+, use_poller_(false)
 {
     options_.add_option<bool>("help",                'h', option::no_argument,   "Show help", false);
     options_.add_option<std::string>("config",       'c', option::with_argument, "Path to test config file", config_);
-    options_.add_option<std::string>("target",       't', option::with_argument, "one of { fpga, ase }", target_);
+    options_.add_option<std::string>("target",       't', option::with_argument, "one of { fpga, ase, emu }", target_);
     options_.add_option<uint32_t>("begin",           'b', option::with_argument, "where 1 <= <value> <= 65535", begin_);
     options_.add_option<uint32_t>("end",             'e', option::with_argument, "where 1 <= <value> <= 65535", end_);
     options_.add_option<uint32_t>("multi-cl",        'U', option::with_argument, "one of {1, 2, 4}", 1);
@@ -86,6 +89,9 @@ nlb0::nlb0()
     options_.add_option<uint32_t>("freq",            'T', option::with_argument, "Clock frequence (used for bw measurements)", frequency_);
     options_.add_option<bool>("suppress-hdr",        'S', option::no_argument,   "Suppress column headers", suppress_header_);
     options_.add_option<bool>("csv",                 'V', option::no_argument,   "Comma separated value format", csv_format_);
+    options_.add_option<std::string>("wait-policy",       option::with_argument, "one of { spin, yield, sleep, monitor, poller }", "sleep");
+    options_.add_option<bool>("wait-stats",               option::no_argument,   "Print completion wait latency distribution", wait_stats_);
+    options_.add_option<uint32_t>("sample-usec",          option::with_argument, "Sample fabric counters every <value> usec and print them after the run", sample_usec_);
 }
 
 nlb0::~nlb0()
@@ -96,7 +102,7 @@ nlb0::~nlb0()
 bool nlb0::setup()
 {
     options_.get_value<std::string>("target", target_);
-    if (target_ == "fpga")
+    if (target_ == "fpga" || target_ == "emu")
     {
         dsm_timeout_ = FPGA_DSM_TIMEOUT;
     }
@@ -298,6 +304,19 @@ bool nlb0::setup()
     }
     options_.get_value<bool>("suppress-hdr", suppress_header_);
     options_.get_value<bool>("csv", csv_format_);
+    std::string wait_mode;
+    wait_policy::mode_t wait_mode_v = wait_policy::spin_sleep;
+    options_.get_value<std::string>("wait-policy", wait_mode);
+    use_poller_ = wait_mode == "poller";
+    if (!use_poller_ && !wait_mode.empty() &&
+        !wait_policy::parse(wait_mode, wait_mode_v))
+    {
+        std::cerr << "Invalid --wait-policy: " << wait_mode << std::endl;
+        return false;
+    }
+    wait_ = wait_policy(wait_mode_v);
+    options_.get_value<bool>("wait-stats", wait_stats_);
+    options_.get_value<uint32_t>("sample-usec", sample_usec_);
 
     return true;
 }
@@ -340,9 +359,12 @@ bool nlb0::run()
     // set the test mode
     accelerator_->write_mmio32(static_cast<uint32_t>(nlb0_csr::cfg), cfg_.value());
 
-    for (size_t i = 0; i < inp->size()/sizeof(size_t); ++i)
+    inp->fill_sequence(0);
+
+    perf_sampler<fpga_fabric_counters> sampler(accelerator_->fabric_counter_group(), 4096);
+    if (sample_usec_)
     {
-        inp->write(i, i);
+        sampler.start(std::chrono::microseconds(sample_usec_));
     }
 
     for (uint32_t i = begin_; i <= end_; i+=step_)
@@ -371,15 +393,19 @@ bool nlb0::run()
             // stop the device
             accelerator_->write_mmio32(static_cast<uint32_t>(nlb0_csr::ctl), 7);
             if (!dsm->wait(static_cast<size_t>(nlb0_dsm::test_complete),
-                           dma_buffer::microseconds_t(10), dsm_timeout_, 0x1, 1))
+                           wait_, dsm_timeout_, 0x1, 1))
             {
                 log_.warn("nlb0") << "test timeout" << std::endl;
             }
         }
         else
         {
-            if (!dsm->wait(static_cast<size_t>(nlb0_dsm::test_complete),
-                        dma_buffer::microseconds_t(10), dsm_timeout_, 0x1, 1))
+            bool done = use_poller_ ?
+                accelerator_->watch(dsm, static_cast<size_t>(nlb0_dsm::test_complete),
+                                    0x1, 1, dsm_timeout_).get() :
+                dsm->wait(static_cast<size_t>(nlb0_dsm::test_complete),
+                          wait_, dsm_timeout_, 0x1, 1);
+            if (!done)
             {
                 log_.warn("nlb0") << "test timeout" << std::endl;
             }
@@ -401,14 +427,27 @@ bool nlb0::run()
                                                  csv_format_);
 
         // verify in and out
-        if (!inp->equal(out, i * cacheline_size))
+        std::size_t offset = inp->mismatch(out, i * cacheline_size);
+        if (offset != i * cacheline_size)
         {
             std::cerr << "Input and output buffer mismatch when testing on "
-                      << i << " cache lines" << std::endl;
+                      << i << " cache lines, first at cache line "
+                      << offset / cacheline_size << std::endl;
             return false;
         }
     }
 
+    if (sample_usec_)
+    {
+        sampler.stop();
+        sampler.write_csv(std::cout);
+    }
+
+    if (wait_stats_)
+    {
+        wait_.report(std::cout);
+    }
+
     return true;
 }
 
@@ -90,6 +90,10 @@ private:
 
     bool suppress_header_;
     bool csv_format_;
+    uint32_t sample_usec_;
+    wait_policy wait_;
+    bool wait_stats_;
+    bool use_poller_;
 };
 
 } // end of namespace diag
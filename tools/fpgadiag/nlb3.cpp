@@ -62,10 +62,12 @@ nlb3::nlb3()
 , dsm_timeout_(FPGA_DSM_TIMEOUT)
 , suppress_header_(false)
 , csv_format_(false)
+, wait_stats_(false)
+, use_poller_(false)
 {
     options_.add_option<bool>("help",                'h', option::no_argument,   "Show help", false);
     options_.add_option<std::string>("config",       'c', option::with_argument, "Path to test config file", config_);
-    options_.add_option<std::string>("target",       't', option::with_argument, "one of { fpga, ase }", target_);
+    options_.add_option<std::string>("target",       't', option::with_argument, "one of { fpga, ase, emu }", target_);
     options_.add_option<std::string>("mode",         'm', option::with_argument, "mode { read, write, trput }", mode_);
     options_.add_option<uint32_t>("begin",           'b', option::with_argument, "where 1 <= <value> <= 65535", begin_);
     options_.add_option<uint32_t>("end",             'e', option::with_argument, "where 1 <= <value> <= 65535", end_);
@@ -95,6 +97,8 @@ nlb3::nlb3()
     options_.add_option<uint32_t>("freq",            'T', option::with_argument, "Clock frequence (used for bw measurements)", frequency_);
     options_.add_option<bool>("suppress-hdr",        'S', option::no_argument,   "Suppress column headers", suppress_header_);
     options_.add_option<bool>("csv",                 'V', option::no_argument,   "Comma separated value format", csv_format_);
+    options_.add_option<std::string>("wait-policy",       option::with_argument, "one of { spin, yield, sleep, monitor, poller }", "sleep");
+    options_.add_option<bool>("wait-stats",               option::no_argument,   "Print completion wait latency distribution", wait_stats_);
 }
 
 nlb3::~nlb3()
@@ -104,7 +108,7 @@ nlb3::~nlb3()
 bool nlb3::setup()
 {
     options_.get_value<std::string>("target", target_);
-    if (target_ == "fpga")
+    if (target_ == "fpga" || target_ == "emu")
     {
         dsm_timeout_ = FPGA_DSM_TIMEOUT;
     }
@@ -394,6 +398,18 @@ bool nlb3::setup()
     }
     options_.get_value<bool>("suppress-hdr", suppress_header_);
     options_.get_value<bool>("csv", csv_format_);
+    std::string wait_mode;
+    wait_policy::mode_t wait_mode_v = wait_policy::spin_sleep;
+    options_.get_value<std::string>("wait-policy", wait_mode);
+    use_poller_ = wait_mode == "poller";
+    if (!use_poller_ && !wait_mode.empty() &&
+        !wait_policy::parse(wait_mode, wait_mode_v))
+    {
+        std::cerr << "Invalid --wait-policy: " << wait_mode << std::endl;
+        return false;
+    }
+    wait_ = wait_policy(wait_mode_v);
+    options_.get_value<bool>("wait-stats", wait_stats_);
 
     return true;
 }
@@ -418,10 +434,10 @@ bool nlb3::run()
     dma_buffer::ptr_t inp = bufs[2];
     dma_buffer::ptr_t out = bufs[3];
 
-    const uint32_t read_data = 0xc0cac01a;
+    const uint64_t read_data = 0xc0cac01ac0cac01a;
 
     dsm->fill(0);
-    inp->fill(read_data);
+    inp->fill_pattern(read_data);
     out->fill(0);
 
     if (!accelerator_->reset())
@@ -526,15 +542,19 @@ bool nlb3::run()
             // stop the device
             accelerator_->write_mmio32(static_cast<uint32_t>(nlb3_csr::ctl), 7);
             if (!dsm->wait(static_cast<size_t>(nlb3_dsm::test_complete),
-                        dma_buffer::microseconds_t(10), dsm_timeout_, 0x1, 1))
+                        wait_, dsm_timeout_, 0x1, 1))
             {
                 log_.warn("nlb3") << "test timeout" << std::endl;
             }
         }
         else
         {
-            if (!dsm->wait(static_cast<size_t>(nlb3_dsm::test_complete),
-                        dma_buffer::microseconds_t(10), dsm_timeout_, 0x1, 1))
+            bool done = use_poller_ ?
+                accelerator_->watch(dsm, static_cast<size_t>(nlb3_dsm::test_complete),
+                                    0x1, 1, dsm_timeout_).get() :
+                dsm->wait(static_cast<size_t>(nlb3_dsm::test_complete),
+                          wait_, dsm_timeout_, 0x1, 1);
+            if (!done)
             {
                 log_.warn("nlb3") << "test timeout" << std::endl;
             }
@@ -556,6 +576,11 @@ bool nlb3::run()
                                                  csv_format_);
     }
 
+    if (wait_stats_)
+    {
+        wait_.report(std::cout);
+    }
+
     return true;
 }
 
@@ -80,6 +80,9 @@ private:
     bool cont_;
     bool suppress_header_;
     bool csv_format_;
+    wait_policy wait_;
+    bool wait_stats_;
+    bool use_poller_;
 
     intel::utils::logger log_;
     intel::utils::option_map options_;
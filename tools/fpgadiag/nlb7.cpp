@@ -34,6 +34,7 @@
 #include "option.h"
 #include "nlb.h"
 #include "nlb_stats.h"
+#include "umsg_doorbell.h"
 #include "safe_string/safe_string.h"
 
 #define USE_UMSG 0
@@ -68,10 +69,12 @@ nlb7::nlb7()
 , dsm_timeout_(FPGA_DSM_TIMEOUT)
 , suppress_headers_(false)
 , csv_format_(false)
+, doorbell_bench_(0)
+, doorbell_batch_(8)
 {
     options_.add_option<bool>("help",                'h', option::no_argument,   "Show help", false);
     options_.add_option<std::string>("config",       'c', option::with_argument, "Path to test config file", config_);
-    options_.add_option<std::string>("target",       't', option::with_argument, "one of { fpga, ase }", target_);
+    options_.add_option<std::string>("target",       't', option::with_argument, "one of { fpga, ase, emu }", target_);
     options_.add_option<uint32_t>("begin",           'b', option::with_argument, "where 1 <= <value> <= 65535", begin_);
     options_.add_option<uint32_t>("end",             'e', option::with_argument, "where 1 <= <value> <= 65535", end_);
     options_.add_option<std::string>("cache-policy", 'p', option::with_argument, "one of { wrline-I, wrline-M, wrpush-I }", "wrline-M");
@@ -89,6 +92,8 @@ nlb7::nlb7()
     options_.add_option<uint32_t>("clock-freq",      'T', option::with_argument, "Clock frequency (used for bw measurements)", frequency_);
     options_.add_option<bool>("suppress-hdr",        'S', option::no_argument,   "Suppress column headers", suppress_headers_);
     options_.add_option<bool>("csv",                 'V', option::no_argument,   "Comma separated value format", csv_format_);
+    options_.add_option<uint32_t>("doorbell-bench",       option::with_argument, "Benchmark <value> UMsg doorbells instead of running the test", doorbell_bench_);
+    options_.add_option<uint32_t>("doorbell-batch",       option::with_argument, "Notifications coalesced per UMsg slot in --doorbell-bench", doorbell_batch_);
 }
 
 nlb7::~nlb7()
@@ -109,7 +114,7 @@ void nlb7::show_help(std::ostream &os)
 bool nlb7::setup()
 {
     options_.get_value<std::string>("target", target_);
-    if (target_ == "fpga")
+    if (target_ == "fpga" || target_ == "emu")
     {
         dsm_timeout_ = FPGA_DSM_TIMEOUT;
     }
@@ -322,6 +327,14 @@ bool nlb7::setup()
     options_.get_value<bool>("suppress-hdr", suppress_headers_);
     options_.get_value<bool>("csv", csv_format_);
 
+    options_.get_value<uint32_t>("doorbell-bench", doorbell_bench_);
+    options_.get_value<uint32_t>("doorbell-batch", doorbell_batch_);
+    if (doorbell_batch_ == 0)
+    {
+        std::cerr << "Invalid --doorbell-batch: 0" << std::endl;
+        return false;
+    }
+
     return true;
 }
 
@@ -349,28 +362,29 @@ bool nlb7::run()
     dma_buffer::ptr_t input = bufs[1];
     dma_buffer::ptr_t output = bufs[2];
 
-    accelerator_->umsg_set_mask(LOW);
+    if (doorbell_bench_ > 0)
+    {
+        return run_doorbell_bench();
+    }
 
+    umsg_doorbell::ptr_t doorbell;
 #if USE_UMSG
-    volatile uint8_t *pUMsgUsrVirt = (volatile uint8_t *) accelerator_->umsg_get_ptr();
-    size_t pagesize = (size_t) sysconf(_SC_PAGESIZE);
-    size_t UMsgBufSize = pagesize * (size_t) accelerator_->umsg_num();
-#else
-    volatile uint8_t *pUMsgUsrVirt = (volatile uint8_t *) NULL;
-    size_t UMsgBufSize = 0;
-#endif
-    if (pUMsgUsrVirt &&
-        (nlb7_notice::umsg_data == notice_) ||
+    if ((nlb7_notice::umsg_data == notice_) ||
         (nlb7_notice::umsg_hint == notice_))
     {
-       if (nlb7_notice::umsg_data == notice_)
-       {
-           accelerator_->umsg_set_mask(LOW);
-       }
-       else
-       {
-           accelerator_->umsg_set_mask(HIGH);
-       }
+        doorbell.reset(new umsg_doorbell(accelerator_,
+                                         nlb7_notice::umsg_data == notice_ ?
+                                         umsg_doorbell::data : umsg_doorbell::hint));
+        if (!doorbell->ready())
+        {
+            std::cerr << "failed to map UMsg region." << std::endl;
+            return false;
+        }
+    }
+    else
+#endif // USE_UMSG
+    {
+        accelerator_->umsg_set_mask(LOW);
     }
 
     if (!accelerator_->reset())
@@ -404,10 +418,6 @@ bool nlb7::run()
         if (target_ == "ase")
             MaxPoll *= 100000;
 
-        // Clear the UMsg address space.
-        if (pUMsgUsrVirt)
-            memset((uint8_t *)pUMsgUsrVirt, 0, UMsgBufSize);
-
         // Zero the output buffer.
         output->fill(0);
 
@@ -455,10 +465,10 @@ bool nlb7::run()
         {
             accelerator_->write_mmio32(static_cast<uint32_t>(nlb7_csr::sw_notice), 0x10101010);
         }
-        else if (pUMsgUsrVirt && ((nlb7_notice::umsg_data == notice_) ||
-                 (nlb7_notice::umsg_hint == notice_)))
+        else if (doorbell)
         {
-            *(uint32_t *)pUMsgUsrVirt = HIGH;
+            // the doorbell orders the copy above before the UMsg
+            doorbell->ring(0, HIGH);
         }
         else
         { // poll
@@ -619,6 +629,60 @@ bool nlb7::run()
     return res;
 }
 
+bool nlb7::run_doorbell_bench()
+{
+    // Keep the AFU in reset; only the host side of the doorbell is measured.
+    accelerator_->write_mmio32(static_cast<uint32_t>(nlb7_csr::ctl), 0);
+
+    umsg_doorbell::ptr_t doorbell(new umsg_doorbell(accelerator_));
+    if (!doorbell->ready())
+    {
+        std::cerr << "failed to map UMsg region." << std::endl;
+        return false;
+    }
+
+    const std::size_t slots = doorbell->slots();
+    const std::size_t batch = slots * doorbell_batch_;
+
+    // one line write per notification
+    auto start = high_resolution_clock::now();
+    for (uint32_t i = 0; i < doorbell_bench_; ++i)
+    {
+        doorbell->ring(i % slots, i + 1);
+    }
+    auto single = duration_cast<nanoseconds>(high_resolution_clock::now() - start);
+    uint64_t single_lines = doorbell->lines_written();
+
+    // doorbell_batch_ notifications per slot per line write
+    start = high_resolution_clock::now();
+    for (uint32_t i = 0; i < doorbell_bench_; ++i)
+    {
+        doorbell->post(i % slots, i + 1, (i / slots) % 8);
+        if ((i + 1) % batch == 0)
+        {
+            doorbell->flush();
+        }
+    }
+    doorbell->flush();
+    auto coalesced = duration_cast<nanoseconds>(high_resolution_clock::now() - start);
+    uint64_t coalesced_lines = doorbell->lines_written() - single_lines;
+
+    std::string sep = csv_format_ ? "," : " ";
+    if (!suppress_headers_)
+    {
+        std::cout << "Doorbell" << sep << "Messages" << sep << "Lines"
+                  << sep << "Elapsed (ns)" << sep << "ns/Message" << std::endl;
+    }
+    std::cout << "single" << sep << doorbell_bench_ << sep << single_lines
+              << sep << single.count() << sep
+              << static_cast<double>(single.count()) / doorbell_bench_ << std::endl;
+    std::cout << "coalesced" << sep << doorbell_bench_ << sep << coalesced_lines
+              << sep << coalesced.count() << sep
+              << static_cast<double>(coalesced.count()) / doorbell_bench_ << std::endl;
+
+    return accelerator_->reset();
+}
+
 } // end of namespace diag
 } // end of namespace fpga
 } // end of namespace intel
@@ -62,6 +62,8 @@ public:
     void show_help(std::ostream &os);
 
 private:
+    bool run_doorbell_bench();
+
     enum nlb7_notice
     {
         poll,
@@ -96,6 +98,8 @@ private:
     std::chrono::microseconds dsm_timeout_;
     bool suppress_headers_;
     bool csv_format_;
+    uint32_t doorbell_bench_;
+    uint32_t doorbell_batch_;
 };
 
 } // end of namespace diag
@@ -32,6 +32,7 @@
 #include "option.h"
 #include "option_parser.h"
 #include "accelerator.h"
+#include "nlb_emulator.h"
 
 using namespace intel::fpga;
 using namespace intel::fpga::diag;
@@ -78,7 +79,9 @@ int main(int argc, char* argv[])
     opts.get_value("target", target);
     bool shared = target == "fpga";
 
-    std::vector<accelerator::ptr_t> accelerator_list = accelerator::enumerate({ filter });
+    std::vector<accelerator::ptr_t> accelerator_list = target == "emu" ?
+        intel::fpga::nlb::nlb_emulator::enumerate({ filter }) :
+        accelerator::enumerate({ filter });
     if (accelerator_list.size() >= 1)
     {
         accelerator::ptr_t accelerator_obj = accelerator_list[0];
@@ -48,13 +48,10 @@ nlb_cache_cool::nlb_cache_cool(const std::string & target,
 , cool_buf_(cool_buf)
 , cmdq_(cmdq)
 {
-    const uint32_t cool_data = 0xc001c001;
+    const uint64_t cool_data = 0xc001c001c001c001;
 
-    volatile uint32_t *pCool    = (volatile uint32_t *) cool_buf_->address();
-    volatile uint32_t *pEndCool = pCool + (cool_buf_->size() / sizeof(uint32_t));
-
-    for ( ; pCool < pEndCool ; ++pCool)
-        *pCool = cool_data;
+    // streamed, so cooling does not pull the buffer into the host cache
+    cool_buf_->fill_pattern(cool_data, true);
 }
 
 bool nlb_cache_cool::cool()
@@ -0,0 +1,686 @@
+// Copyright(c) 2017, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include <sys/mman.h>
+#include <unistd.h>
+#include <string.h>
+#include <strings.h>
+#include <uuid/uuid.h>
+#include <chrono>
+#include "nlb.h"
+#include "fpga_app/fpga_common.h"
+#include "nlb_emulator.h"
+
+using namespace intel::utils;
+
+namespace intel
+{
+namespace fpga
+{
+namespace nlb
+{
+
+static const std::string nlb0_afu_id  = "D8424DC4-A4A3-C413-F89E-433683F9040B";
+static const std::string mtnlb8_afu_id = "2D9C88FE-2BE5-4105-8A1A-EEEC94364467";
+
+static const uint32_t sw_flag      = 0xffffffff;
+static const uint32_t mt_mask      = static_cast<uint32_t>(nlb_mode::mt);
+static const uint32_t notice_mask  = static_cast<uint32_t>(nlb0_ctl::umsg_hint);
+
+void nlb_emulator::memory_map::add(uint64_t iova, std::size_t size)
+{
+    std::lock_guard<std::mutex> g(lock_);
+    ranges_[iova] = size;
+}
+
+void nlb_emulator::memory_map::remove(uint64_t iova)
+{
+    std::lock_guard<std::mutex> g(lock_);
+    ranges_.erase(iova);
+}
+
+uint8_t * nlb_emulator::memory_map::translate(uint64_t iova, std::size_t size)
+{
+    std::lock_guard<std::mutex> g(lock_);
+    auto it = ranges_.upper_bound(iova);
+    if (it == ranges_.begin())
+    {
+        return nullptr;
+    }
+    --it;
+    if (iova + size > it->first + it->second)
+    {
+        return nullptr;
+    }
+    return reinterpret_cast<uint8_t*>(iova);
+}
+
+fpga_properties nlb_emulator::properties(const std::string & guid)
+{
+    fpga_properties props = nullptr;
+    fpga_guid g;
+
+    if (FPGA_OK != fpgaGetProperties(nullptr, &props))
+    {
+        return nullptr;
+    }
+
+    if (uuid_parse(guid.c_str(), g) == 0)
+    {
+        fpgaPropertiesSetGUID(props, g);
+    }
+    fpgaPropertiesSetObjectType(props, FPGA_ACCELERATOR);
+    fpgaPropertiesSetBus(props, 0);
+    fpgaPropertiesSetDevice(props, 0);
+    fpgaPropertiesSetFunction(props, 0);
+    fpgaPropertiesSetSocketID(props, 0);
+    return props;
+}
+
+nlb_emulator::nlb_emulator(const std::string & guid)
+: accelerator(shared_token(), properties(guid), "", fpga_resource::ptr_t())
+, guid_(guid)
+, mt8_(strcasecmp(guid.c_str(), mtnlb8_afu_id.c_str()) == 0)
+, open_(false)
+, memory_(std::make_shared<memory_map>())
+, csrs_(mmio_size / sizeof(uint64_t), 0)
+, umsg_(nullptr)
+, umsg_stride_(static_cast<std::size_t>(sysconf(_SC_PAGESIZE)))
+, busy_(false)
+, busy_cmdq_(false)
+, shutdown_(false)
+, cmdq_index_(0)
+, abort_(false)
+, stop_(false)
+, notice_(false)
+, num_reads_(0)
+, num_writes_(0)
+{
+}
+
+nlb_emulator::~nlb_emulator()
+{
+    release();
+}
+
+std::vector<accelerator::ptr_t> nlb_emulator::enumerate(std::vector<option_map::ptr_t> options,
+                                                        const std::string & afu_id)
+{
+    std::string guid = afu_id.empty() ? nlb0_afu_id : afu_id;
+    for (const auto & opts : options)
+    {
+        std::string g;
+        if (opts && opts->get_value<std::string>("guid", g) && !g.empty())
+        {
+            guid = g;
+            break;
+        }
+    }
+    return { accelerator::ptr_t(new nlb_emulator(guid)) };
+}
+
+bool nlb_emulator::is_open()
+{
+    return open_;
+}
+
+bool nlb_emulator::open(bool)
+{
+    if (open_)
+    {
+        return false;
+    }
+
+    void *p = mmap(nullptr, num_umsgs * umsg_stride_, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED)
+    {
+        return false;
+    }
+    umsg_ = static_cast<uint8_t*>(p);
+
+    shutdown_ = false;
+    thread_ = std::thread(&nlb_emulator::run, this);
+    poller_.reset(new completion_poller(nullptr));
+    open_ = true;
+    return true;
+}
+
+bool nlb_emulator::close()
+{
+    if (!open_)
+    {
+        return false;
+    }
+    release();
+    return true;
+}
+
+void nlb_emulator::release()
+{
+    if (!open_)
+    {
+        return;
+    }
+
+    poller_.reset();
+    {
+        std::lock_guard<std::mutex> g(lock_);
+        shutdown_ = true;
+        abort_ = true;
+    }
+    cv_.notify_all();
+    thread_.join();
+
+    munmap(umsg_, num_umsgs * umsg_stride_);
+    umsg_ = nullptr;
+    open_ = false;
+}
+
+bool nlb_emulator::ready()
+{
+    return open_;
+}
+
+bool nlb_emulator::reset()
+{
+    if (!open_)
+    {
+        return false;
+    }
+    device_reset();
+    std::lock_guard<std::mutex> g(lock_);
+    std::fill(csrs_.begin(), csrs_.end(), 0);
+    return true;
+}
+
+dma_buffer::ptr_t nlb_emulator::allocate_buffer(std::size_t size)
+{
+    dma_buffer::ptr_t buffer;
+    void *p = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED)
+    {
+        return buffer;
+    }
+
+    uint8_t *virt = static_cast<uint8_t*>(p);
+    uint64_t iova = reinterpret_cast<uint64_t>(virt);
+    std::shared_ptr<memory_map> memory = memory_;
+
+    memory->add(iova, size);
+    buffer.reset(new dma_buffer(nullptr, 0, virt, iova, size),
+                 [memory, p, size](dma_buffer *b)
+                 {
+                     memory->remove(reinterpret_cast<uint64_t>(p));
+                     delete b;
+                     munmap(p, size);
+                 });
+    return buffer;
+}
+
+uint64_t nlb_emulator::umsg_num()
+{
+    return umsg_ ? num_umsgs : 0;
+}
+
+bool nlb_emulator::umsg_set_mask(uint64_t)
+{
+    return umsg_ != nullptr;
+}
+
+uint64_t * nlb_emulator::umsg_get_ptr()
+{
+    return reinterpret_cast<uint64_t*>(umsg_);
+}
+
+bool nlb_emulator::write_mmio32(uint32_t offset, uint32_t value)
+{
+    if (!open_ || offset + sizeof(uint32_t) > mmio_size)
+    {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> g(lock_);
+        uint64_t &csr = csrs_[offset / sizeof(uint64_t)];
+        if (offset & 0x4)
+        {
+            csr = (csr & 0xffffffffULL) | (static_cast<uint64_t>(value) << 32);
+        }
+        else
+        {
+            csr = (csr & ~0xffffffffULL) | value;
+        }
+    }
+    csr_written(offset & ~0x7);
+    return true;
+}
+
+bool nlb_emulator::write_mmio64(uint32_t offset, uint64_t value)
+{
+    if (!open_ || (offset & 0x7) || offset + sizeof(uint64_t) > mmio_size)
+    {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> g(lock_);
+        csrs_[offset / sizeof(uint64_t)] = value;
+    }
+    csr_written(offset);
+    return true;
+}
+
+bool nlb_emulator::read_mmio32(uint32_t offset, uint32_t & value)
+{
+    uint64_t v;
+    if (!read_mmio64(offset & ~0x7, v))
+    {
+        return false;
+    }
+    value = static_cast<uint32_t>((offset & 0x4) ? v >> 32 : v);
+    return true;
+}
+
+bool nlb_emulator::read_mmio64(uint32_t offset, uint64_t & value)
+{
+    if (!open_ || offset + sizeof(uint64_t) > mmio_size)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> g(lock_);
+    switch (static_cast<mtnlb_csr>(offset))
+    {
+        case mtnlb_csr::cmdq_sw:
+            value = (!queue_.empty() && queue_.back().cmdq) ? 1 : 0;
+            break;
+        case mtnlb_csr::cmdq_hw:
+            value = busy_cmdq_ ? 1 : 0;
+            break;
+        case mtnlb_csr::num_rw:
+            value = (static_cast<uint64_t>(num_reads_) << 32) | num_writes_;
+            break;
+        case mtnlb_csr::io_pending:
+            value = 0;
+            break;
+        default:
+            value = csrs_[offset / sizeof(uint64_t)];
+            break;
+    }
+    return true;
+}
+
+void nlb_emulator::csr_written(uint32_t offset)
+{
+    std::unique_lock<std::mutex> lk(lock_);
+    uint64_t value = csrs_[offset / sizeof(uint64_t)];
+
+    job_t job;
+    job.cfg        = static_cast<uint32_t>(csrs_[static_cast<uint32_t>(nlb0_csr::cfg) / sizeof(uint64_t)]);
+    job.src        = csrs_[static_cast<uint32_t>(nlb0_csr::src_addr) / sizeof(uint64_t)] << LOG2_CL;
+    job.dst        = csrs_[static_cast<uint32_t>(nlb0_csr::dst_addr) / sizeof(uint64_t)] << LOG2_CL;
+    job.num_lines  = static_cast<uint32_t>(csrs_[static_cast<uint32_t>(nlb0_csr::num_lines) / sizeof(uint64_t)]);
+    job.strides    = static_cast<uint32_t>(csrs_[static_cast<uint32_t>(nlb3_csr::strided_acs) / sizeof(uint64_t)]);
+    job.mode7_args = csrs_[static_cast<uint32_t>(mtnlb_csr::mode7_args) / sizeof(uint64_t)];
+    job.dsm_base   = csrs_[static_cast<uint32_t>(nlb0_dsm::basel) / sizeof(uint64_t)];
+    job.cmdq       = false;
+
+    switch (static_cast<nlb0_csr>(offset))
+    {
+        case nlb0_csr::ctl:
+            switch (value & 0x7)
+            {
+                case 0:
+                    lk.unlock();
+                    device_reset();
+                    return;
+                case 3:
+                    stop_ = false;
+                    queue_.push_back(job);
+                    cv_.notify_one();
+                    break;
+                case 7:
+                    stop_ = true;
+                    break;
+                default:
+                    break;
+            }
+            break;
+
+        case nlb0_csr::cmdq_sw:
+            if (value & 0x1)
+            {
+                job.cmdq = true;
+                queue_.push_back(job);
+                cv_.notify_one();
+            }
+            break;
+
+        default:
+            if (offset == static_cast<uint32_t>(nlb7_csr::sw_notice))
+            {
+                notice_ = true;
+            }
+            break;
+    }
+}
+
+void nlb_emulator::device_reset()
+{
+    std::unique_lock<std::mutex> lk(lock_);
+    queue_.clear();
+    abort_ = true;
+    idle_cv_.wait(lk, [this] { return !busy_; });
+    abort_ = false;
+    stop_ = false;
+    notice_ = false;
+    cmdq_index_ = 0;
+    num_reads_ = 0;
+    num_writes_ = 0;
+}
+
+void nlb_emulator::run()
+{
+    std::unique_lock<std::mutex> lk(lock_);
+    while (true)
+    {
+        cv_.wait(lk, [this] { return shutdown_ || !queue_.empty(); });
+        if (shutdown_)
+        {
+            break;
+        }
+
+        job_t job = queue_.front();
+        queue_.pop_front();
+        busy_ = true;
+        busy_cmdq_ = job.cmdq;
+        lk.unlock();
+
+        execute(job);
+
+        lk.lock();
+        busy_ = false;
+        busy_cmdq_ = false;
+        idle_cv_.notify_all();
+    }
+}
+
+void nlb_emulator::execute(const job_t & job)
+{
+    typedef std::chrono::steady_clock clock_t;
+
+    uint8_t *dsm = memory_->translate(job.dsm_base, CL(4));
+    if (dsm == nullptr)
+    {
+        return;
+    }
+
+    if (job.cmdq)
+    {
+        // Counters are reported per queued job.
+        num_reads_ = 0;
+        num_writes_ = 0;
+    }
+
+    uint32_t mode = job.cfg & static_cast<uint32_t>(nlb0_ctl::mask);
+    bool cont = (job.cfg & static_cast<uint32_t>(nlb0_ctl::cont)) != 0;
+    bool ok = true;
+    clock_t::time_point begin = clock_t::now();
+
+    if ((job.cfg & mt_mask) == mt_mask)
+    {
+        ok = mt_test(job);
+    }
+    else if (mode == static_cast<uint32_t>(nlb0_ctl::sw))
+    {
+        ok = sw_test(job);
+    }
+    else
+    {
+        bool rd = mode != static_cast<uint32_t>(nlb0_ctl::write);
+        bool wr = mode != static_cast<uint32_t>(nlb0_ctl::read);
+        do
+        {
+            ok = lines(job, rd, wr);
+        } while (ok && cont && !cancelled());
+    }
+
+    if (abort_)
+    {
+        return;
+    }
+
+    uint64_t usec = std::chrono::duration_cast<std::chrono::microseconds>(
+                        clock_t::now() - begin).count();
+
+    *reinterpret_cast<volatile uint64_t*>(dsm + static_cast<uint32_t>(nlb0_dsm::num_clocks)) =
+        usec * (DEFAULT_FREQ / MHZ(1));
+    *reinterpret_cast<volatile uint32_t*>(dsm + static_cast<uint32_t>(nlb0_dsm::num_reads)) = num_reads_;
+    *reinterpret_cast<volatile uint32_t*>(dsm + static_cast<uint32_t>(nlb0_dsm::num_writes)) = num_writes_;
+    *reinterpret_cast<volatile uint32_t*>(dsm + static_cast<uint32_t>(nlb0_dsm::start_overhead)) = 0;
+    *reinterpret_cast<volatile uint32_t*>(dsm + static_cast<uint32_t>(nlb0_dsm::end_overhead)) = 0;
+    *reinterpret_cast<volatile uint32_t*>(dsm + static_cast<uint32_t>(nlb0_dsm::test_error)) = ok ? 0 : 1;
+
+    // Queued jobs alternate between two status words and report the
+    // zero-based job index, the way the cmdq AFUs do.
+    uint32_t offset = static_cast<uint32_t>(nlb0_dsm::test_complete);
+    uint32_t status = 1;
+    if (job.cmdq)
+    {
+        uint32_t index = cmdq_index_++;
+        offset += (index % 2) * static_cast<uint32_t>(nlb0_dsm::test_complete);
+        status |= (index % max_cmdq_counter) << 1;
+    }
+    __atomic_store_n(reinterpret_cast<uint32_t*>(dsm + offset), status, __ATOMIC_RELEASE);
+}
+
+bool nlb_emulator::lines(const job_t & job, bool read, bool write)
+{
+    uint32_t mcl = ((job.cfg >> 5) & 0x3) + 1;
+    uint64_t span = (static_cast<uint64_t>(job.num_lines + mcl - 1) / mcl) * (mcl + job.strides) * CL(1);
+    uint8_t *src = read ? memory_->translate(job.src, span) : nullptr;
+    uint8_t *dst = write ? memory_->translate(job.dst, span) : nullptr;
+
+    if ((read && !src) || (write && !dst))
+    {
+        return false;
+    }
+
+    volatile uint64_t sink = 0;
+    for (uint32_t i = 0; i < job.num_lines; ++i)
+    {
+        uint64_t offset = (static_cast<uint64_t>(i / mcl) * (mcl + job.strides) + i % mcl) * CL(1);
+        if (read && write)
+        {
+            memcpy(dst + offset, src + offset, CL(1));
+        }
+        else if (read)
+        {
+            sink += *reinterpret_cast<const uint64_t*>(src + offset);
+        }
+        else
+        {
+            memset(dst + offset, static_cast<int>(i), CL(1));
+        }
+    }
+
+    if (read)
+    {
+        num_reads_ += job.num_lines;
+    }
+    if (write)
+    {
+        num_writes_ += job.num_lines;
+    }
+    return true;
+}
+
+bool nlb_emulator::sw_test(const job_t & job)
+{
+    std::size_t size = CL(job.num_lines);
+    uint8_t *src = memory_->translate(job.src, size + CL(1));
+    uint8_t *dst = memory_->translate(job.dst, size + CL(1));
+    if (!src || !dst)
+    {
+        return false;
+    }
+
+    // 1. copy src to dst and raise the flag after the data
+    memcpy(dst, src, size);
+    num_reads_ += job.num_lines;
+    num_writes_ += job.num_lines + 1;
+
+    notice_ = false;
+    memset(umsg_, 0, CL(1));
+    __atomic_store_n(reinterpret_cast<uint32_t*>(dst + size), sw_flag, __ATOMIC_RELEASE);
+
+    // 2. wait for the host to copy dst back and notify us
+    if (!wait_notice(job, reinterpret_cast<volatile uint32_t*>(src + size)))
+    {
+        return false;
+    }
+
+    // 3. read the returned data
+    volatile uint64_t sink = 0;
+    for (std::size_t offset = 0; offset < size; offset += CL(1))
+    {
+        sink += *reinterpret_cast<const uint64_t*>(src + offset);
+    }
+    num_reads_ += job.num_lines;
+    return true;
+}
+
+bool nlb_emulator::wait_notice(const job_t & job, volatile uint32_t *poll_flag)
+{
+    uint32_t notice = job.cfg & notice_mask;
+    volatile uint64_t *umsg = reinterpret_cast<volatile uint64_t*>(umsg_);
+
+    while (!abort_)
+    {
+        if (notice == static_cast<uint32_t>(nlb0_ctl::umsg_poll))
+        {
+            if (*poll_flag == sw_flag)
+            {
+                return true;
+            }
+        }
+        else if (notice == static_cast<uint32_t>(nlb0_ctl::csr_write))
+        {
+            if (notice_.exchange(false))
+            {
+                return true;
+            }
+        }
+        else
+        {
+            for (std::size_t i = 0; i < CL(1) / sizeof(uint64_t); ++i)
+            {
+                if (umsg[i] != 0)
+                {
+                    return true;
+                }
+            }
+        }
+        std::this_thread::yield();
+    }
+    return false;
+}
+
+bool nlb_emulator::mt_test(const job_t & job)
+{
+    uint32_t threads = job.mode7_args & mtnlb_max_threads;
+    uint32_t count = (job.mode7_args >> 11) & mtnlb_max_count;
+    uint64_t stride = CL(1ULL << (job.mode7_args >> 32));
+
+    uint8_t *out = memory_->translate(job.dst, threads * stride);
+    uint8_t *inp = mt8_ ? out : memory_->translate(job.src, threads * stride);
+    if (!out || !inp)
+    {
+        return false;
+    }
+
+    // mt7: the device writes 1..count to each thread's output line and
+    // waits for the thread to echo each value to its input line.
+    // mt8: device and thread take turns on one line, the device writing
+    // odd values and the thread the even ones.
+    uint32_t last = mt8_ ? mtnlb_max_count : count;
+    std::vector<uint32_t> next(threads, 1);
+    uint32_t remaining = threads;
+
+    for (uint32_t t = 0; t < threads; ++t)
+    {
+        *reinterpret_cast<volatile uint64_t*>(out + t * stride) = 1;
+        ++num_writes_;
+    }
+
+    while (remaining > 0 && !cancelled())
+    {
+        bool progress = false;
+        for (uint32_t t = 0; t < threads; ++t)
+        {
+            if (next[t] > last)
+            {
+                continue;
+            }
+
+            volatile uint64_t *in = reinterpret_cast<volatile uint64_t*>(inp + t * stride);
+            uint64_t expect = mt8_ ? next[t] + 1 : next[t];
+            if (*in != expect)
+            {
+                continue;
+            }
+            ++num_reads_;
+            progress = true;
+
+            next[t] += mt8_ ? 2 : 1;
+            if (next[t] > last)
+            {
+                --remaining;
+                continue;
+            }
+            *reinterpret_cast<volatile uint64_t*>(out + t * stride) = next[t];
+            ++num_writes_;
+        }
+        if (!progress)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    // Like the hardware, report completion only once told to stop.
+    while (!cancelled())
+    {
+        std::this_thread::yield();
+    }
+    return true;
+}
+
+} // end of namespace nlb
+} // end of namespace fpga
+} // end of namespace intel
@@ -0,0 +1,163 @@
+// Copyright(c) 2017, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#pragma once
+#include <map>
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <condition_variable>
+#include "accelerator.h"
+
+namespace intel
+{
+namespace fpga
+{
+namespace nlb
+{
+
+/// @brief Software model of the NLB AFUs, selected with --target emu.
+///
+/// Buffers are anonymous memory whose IO address is their virtual
+/// address. Writes to the CSRs in nlb.h program a device thread that
+/// runs the lpbk1, read, write, trput and sw tests (continuous or
+/// queued through cmdq_sw) and the mt7/mt8 handshakes directly on host
+/// memory, and posts completions and counters to the DSM the way the
+/// hardware does. Performance counters read as zero.
+class nlb_emulator : public accelerator
+{
+public:
+    typedef std::shared_ptr<nlb_emulator> ptr_t;
+
+    nlb_emulator(const std::string & guid);
+    virtual ~nlb_emulator();
+
+    /// @brief One emulated accelerator, with the guid of the first
+    /// option map that has one, else afu_id, else the nlb0 guid.
+    static std::vector<accelerator::ptr_t> enumerate(std::vector<intel::utils::option_map::ptr_t> options,
+                                                     const std::string & afu_id = "");
+
+    virtual bool is_open();
+
+    virtual bool open(bool shared);
+
+    virtual bool close();
+
+    virtual bool write_mmio32(uint32_t offset, uint32_t value);
+
+    virtual bool write_mmio64(uint32_t offset, uint64_t value);
+
+    virtual bool read_mmio32(uint32_t offset, uint32_t & value);
+
+    virtual bool read_mmio64(uint32_t offset, uint64_t & value);
+
+    virtual bool reset();
+
+    virtual bool ready();
+
+    virtual void release();
+
+    virtual dma_buffer::ptr_t allocate_buffer(std::size_t size);
+
+    virtual uint64_t umsg_num();
+
+    virtual bool umsg_set_mask(uint64_t mask);
+
+    virtual uint64_t * umsg_get_ptr();
+
+private:
+    nlb_emulator(const nlb_emulator &);
+    nlb_emulator & operator = (const nlb_emulator &);
+
+    /// IO address ranges of the live buffers, shared with their deleters
+    class memory_map
+    {
+    public:
+        void add(uint64_t iova, std::size_t size);
+        void remove(uint64_t iova);
+        uint8_t * translate(uint64_t iova, std::size_t size);
+
+    private:
+        std::mutex lock_;
+        std::map<uint64_t, std::size_t> ranges_;
+    };
+
+    static fpga_properties properties(const std::string & guid);
+
+    struct job_t
+    {
+        uint32_t cfg;
+        uint64_t src;
+        uint64_t dst;
+        uint32_t num_lines;
+        uint32_t strides;
+        uint64_t mode7_args;
+        uint64_t dsm_base;
+        bool cmdq;
+    };
+
+    static const std::size_t mmio_size = 0x1000;
+    static const std::size_t num_umsgs = 8;
+
+    void csr_written(uint32_t offset);
+    void device_reset();
+    void run();
+    void execute(const job_t & job);
+    bool lines(const job_t & job, bool read, bool write);
+    bool sw_test(const job_t & job);
+    bool mt_test(const job_t & job);
+    bool wait_notice(const job_t & job, volatile uint32_t *poll_flag);
+    bool cancelled() const { return abort_ || stop_; }
+
+    std::string guid_;
+    bool mt8_;
+    bool open_;
+    std::shared_ptr<memory_map> memory_;
+    std::vector<uint64_t> csrs_;
+    uint8_t *umsg_;
+    std::size_t umsg_stride_;
+
+    std::mutex lock_;
+    std::condition_variable cv_;
+    std::condition_variable idle_cv_;
+    std::deque<job_t> queue_;
+    bool busy_;
+    bool busy_cmdq_;
+    bool shutdown_;
+    uint32_t cmdq_index_;
+    std::atomic<bool> abort_;
+    std::atomic<bool> stop_;
+    std::atomic<bool> notice_;
+    std::atomic<uint32_t> num_reads_;
+    std::atomic<uint32_t> num_writes_;
+    std::thread thread_;
+};
+
+} // end of namespace nlb
+} // end of namespace fpga
+} // end of namespace intel
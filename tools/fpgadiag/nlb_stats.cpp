@@ -26,6 +26,7 @@
 
 #include <sstream>
 #include <iomanip>
+#include <limits>
 #include "nlb_stats.h"
 
 namespace intel
@@ -264,6 +265,177 @@ std::string nlb_stats::write_bandwidth() const
     return oss.str();
 }
 
+latency_histogram::latency_histogram()
+{
+    reset();
+}
+
+void latency_histogram::reset()
+{
+    hist_.fill(0);
+    count_ = 0;
+    min_ns_ = std::numeric_limits<uint64_t>::max();
+    max_ns_ = 0;
+    total_ns_ = 0;
+}
+
+std::size_t latency_histogram::bucket(uint64_t ns)
+{
+    if (ns < (1ULL << sub_bits))
+    {
+        return ns;
+    }
+    std::size_t msb = 63 - __builtin_clzll(ns);
+    std::size_t sub = (ns >> (msb - sub_bits)) & ((1 << sub_bits) - 1);
+    return ((msb - sub_bits + 1) << sub_bits) + sub;
+}
+
+uint64_t latency_histogram::bucket_limit(std::size_t b)
+{
+    if (b < (1ULL << sub_bits))
+    {
+        return b + 1;
+    }
+    std::size_t shift = (b >> sub_bits) - 1;
+    uint64_t sub = b & ((1 << sub_bits) - 1);
+    return (((1ULL << sub_bits) + sub + 1) << shift);
+}
+
+void latency_histogram::record(std::chrono::nanoseconds latency)
+{
+    uint64_t ns = latency.count() > 0 ? latency.count() : 0;
+
+    ++hist_[bucket(ns)];
+    ++count_;
+    if (ns < min_ns_)
+        min_ns_ = ns;
+    if (ns > max_ns_)
+        max_ns_ = ns;
+    total_ns_ += ns;
+}
+
+latency_histogram & latency_histogram::operator += (const latency_histogram &rhs)
+{
+    for (std::size_t b = 0; b < num_buckets; ++b)
+    {
+        hist_[b] += rhs.hist_[b];
+    }
+    count_ += rhs.count_;
+    if (rhs.min_ns_ < min_ns_)
+        min_ns_ = rhs.min_ns_;
+    if (rhs.max_ns_ > max_ns_)
+        max_ns_ = rhs.max_ns_;
+    total_ns_ += rhs.total_ns_;
+    return *this;
+}
+
+uint64_t latency_histogram::percentile(double p) const
+{
+    if (!count_)
+    {
+        return 0;
+    }
+
+    uint64_t rank = static_cast<uint64_t>(p / 100.0 * count_ + 0.5);
+    uint64_t seen = 0;
+
+    if (rank < 1)
+    {
+        rank = 1;
+    }
+
+    for (std::size_t b = 0; b < num_buckets; ++b)
+    {
+        seen += hist_[b];
+        if (seen >= rank)
+        {
+            uint64_t limit = bucket_limit(b) - 1;
+            return limit < max_ns_ ? limit : max_ns_;
+        }
+    }
+    return max_ns_;
+}
+
+cmdq_stats::cmdq_stats()
+: suppress_hdr_(false)
+, csv_(false)
+{
+    reset();
+}
+
+void cmdq_stats::reset()
+{
+    start_ = stop_ = std::chrono::steady_clock::now();
+    latency_.reset();
+}
+
+void cmdq_stats::start()
+{
+    start_ = std::chrono::steady_clock::now();
+}
+
+void cmdq_stats::stop()
+{
+    stop_ = std::chrono::steady_clock::now();
+}
+
+void cmdq_stats::set_format(bool suppress_hdr, bool csv)
+{
+    suppress_hdr_ = suppress_hdr;
+    csv_ = csv;
+}
+
+double cmdq_stats::commands_per_sec() const
+{
+    double secs = std::chrono::duration<double>(stop_ - start_).count();
+    return secs > 0.0 ? commands() / secs : 0.0;
+}
+
+std::ostream & operator << (std::ostream &os, const cmdq_stats &stats)
+{
+    const latency_histogram &lat = stats.latency_;
+    std::ostringstream rate;
+
+    rate.precision(1);
+    rate.setf(std::ios::fixed, std::ios::floatfield);
+    rate << stats.commands_per_sec();
+
+    if (stats.csv_)
+    {
+        if (!stats.suppress_hdr_)
+        {
+            os << "Commands,Commands_Per_Sec,Lat_Min_ns,Lat_Avg_ns,Lat_P50_ns,Lat_P99_ns,Lat_Max_ns" << std::endl;
+        }
+
+        os << lat.count()            << ','
+           << rate.str()             << ','
+           << lat.min()              << ','
+           << lat.mean()             << ','
+           << lat.percentile(50.0)   << ','
+           << lat.percentile(99.0)   << ','
+           << lat.max()              << std::endl;
+    }
+    else
+    {
+        if (!stats.suppress_hdr_)
+        {
+                // 0123456789 01234567890123 012345678901 012345678901 012345678901 012345678901 012345678901
+            os << "  Commands   Commands/sec  Lat_Min(ns)  Lat_Avg(ns)  Lat_P50(ns)  Lat_P99(ns)  Lat_Max(ns)" << std::endl;
+        }
+
+        os << std::setw(10) << lat.count()          << ' '
+           << std::setw(14) << rate.str()           << ' '
+           << std::setw(12) << lat.min()            << ' '
+           << std::setw(12) << lat.mean()           << ' '
+           << std::setw(12) << lat.percentile(50.0) << ' '
+           << std::setw(12) << lat.percentile(99.0) << ' '
+           << std::setw(12) << lat.max()
+           << std::endl     << std::endl;
+    }
+
+    return os;
+}
+
 dsm_tuple::dsm_tuple()
 : raw_ticks_(0)
 , start_overhead_(0)
@@ -26,6 +26,8 @@
 
 #pragma once
 #include <iostream>
+#include <array>
+#include <chrono>
 #include "dma_buffer.h"
 #include "perf_counters.h"
 
@@ -65,6 +67,67 @@ private:
     std::string write_bandwidth() const;
 };
 
+/// @brief Latency histogram: log2 buckets with eight linear sub-buckets,
+/// so percentiles are within 12.5% of the true value.
+/// Not thread safe; give each recording thread its own and merge them
+/// with +=.
+class latency_histogram
+{
+public:
+    latency_histogram();
+
+    void reset();
+    void record(std::chrono::nanoseconds latency);
+    latency_histogram & operator += (const latency_histogram &rhs);
+
+    uint64_t count() const { return count_; }
+    uint64_t min() const { return count_ ? min_ns_ : 0; }
+    uint64_t mean() const { return count_ ? total_ns_ / count_ : 0; }
+    uint64_t max() const { return max_ns_; }
+    uint64_t percentile(double p) const;
+
+private:
+    static const std::size_t sub_bits = 3;
+    static const std::size_t num_buckets = (64 - sub_bits + 1) << sub_bits;
+
+    static std::size_t bucket(uint64_t ns);
+    static uint64_t bucket_limit(std::size_t b);
+
+    std::array<uint64_t, num_buckets> hist_;
+    uint64_t count_;
+    uint64_t min_ns_;
+    uint64_t max_ns_;
+    uint64_t total_ns_;
+};
+
+/// @brief Host-side command rate and per-command latency of a cmdq run,
+/// from the submitting MMIO write to the completion being seen in the DSM.
+/// record() is called by a single thread.
+class cmdq_stats
+{
+public:
+    cmdq_stats();
+
+    void reset();
+    void start();
+    void stop();
+    void record(std::chrono::nanoseconds latency) { latency_.record(latency); }
+
+    uint64_t commands() const { return latency_.count(); }
+    double commands_per_sec() const;
+
+    void set_format(bool suppress_hdr, bool csv);
+
+friend std::ostream & operator << (std::ostream &os, const cmdq_stats &stats);
+
+private:
+    std::chrono::steady_clock::time_point start_;
+    std::chrono::steady_clock::time_point stop_;
+    latency_histogram latency_;
+    bool suppress_hdr_;
+    bool csv_;
+};
+
 class dsm_tuple
 {
 public:
@@ -0,0 +1,160 @@
+// Copyright(c) 2017, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include "option.h"
+#include "option_parser.h"
+#include "queue_pair.h"
+
+using namespace intel::fpga;
+using namespace intel::utils;
+
+// Drives a queue_pair against the software loopback device and reports
+// throughput and submit-to-reap latency. No accelerator is needed.
+int main(int argc, char* argv[])
+{
+    option_parser parser;
+    option_map opts;
+
+    opts.add_option<bool>("help",          'h', option::no_argument,   "Show help", false);
+    opts.add_option<uint32_t>("depth",     'd', option::with_argument, "Ring entries (power of two)", 256);
+    opts.add_option<uint32_t>("batch",     'b', option::with_argument, "Submissions per doorbell", 8);
+    opts.add_option<uint32_t>("inflight",  'i', option::with_argument, "Entries kept outstanding (0 = depth - 1)", 0);
+    opts.add_option<uint64_t>("count",     'c', option::with_argument, "Entries to submit", 1000000);
+    opts.add_option<uint32_t>("service-nsec", option::with_argument, "Loopback time per entry in nanoseconds", 0);
+
+    parser.parse_args(argc, argv, opts);
+
+    bool show_help = false;
+    opts.get_value<bool>("help", show_help);
+    if (show_help)
+    {
+        opts.show_help("qpbench", std::cout);
+        return 100;
+    }
+
+    uint32_t depth = 0, batch = 0, inflight = 0, service_nsec = 0;
+    uint64_t count = 0;
+    opts.get_value<uint32_t>("depth", depth);
+    opts.get_value<uint32_t>("batch", batch);
+    opts.get_value<uint32_t>("inflight", inflight);
+    opts.get_value<uint64_t>("count", count);
+    opts.get_value<uint32_t>("service-nsec", service_nsec);
+
+    if (depth < 2 || depth > 65536 || (depth & (depth - 1)) != 0)
+    {
+        std::cerr << "Invalid --depth: " << depth << std::endl;
+        return 1;
+    }
+    if (inflight == 0 || inflight > depth - 1)
+    {
+        inflight = depth - 1;
+    }
+
+    dma_buffer::ptr_t buffer = queue_loopback::allocate(queue_pair::buffer_size(depth));
+    queue_loopback::ptr_t device(new queue_loopback(buffer, depth,
+                                 std::chrono::nanoseconds(service_nsec)));
+    queue_pair qp(buffer, depth, device, batch);
+    if (!qp.ready())
+    {
+        std::cerr << "Error: could not create queue pair" << std::endl;
+        return 2;
+    }
+
+    typedef std::chrono::steady_clock clock_t;
+    std::vector<clock_t::time_point> issued(depth);
+    std::vector<uint64_t> latency;
+    std::vector<queue_pair::cq_entry> done(depth);
+    latency.reserve(count);
+
+    queue_pair::sq_entry entry = {};
+    uint64_t next = 0, errors = 0;
+    clock_t::time_point begin = clock_t::now();
+
+    while (qp.completed() < count)
+    {
+        while (next < count && qp.outstanding() < inflight)
+        {
+            uint32_t slot;
+            entry.qword[0] = next;
+            if (!qp.submit(entry, &slot))
+            {
+                break;
+            }
+            issued[slot] = clock_t::now();
+            ++next;
+        }
+        if (next == count || qp.outstanding() >= inflight)
+        {
+            qp.flush();
+        }
+
+        uint64_t expected = qp.completed();
+        uint32_t n = qp.reap(done.data(), depth);
+        if (n == 0)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        clock_t::time_point now = clock_t::now();
+        for (uint32_t i = 0; i < n; ++i, ++expected)
+        {
+            if (done[i].result != expected)
+            {
+                ++errors;
+            }
+            latency.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                now - issued[done[i].slot]).count());
+        }
+    }
+
+    double secs = std::chrono::duration<double>(clock_t::now() - begin).count();
+    std::sort(latency.begin(), latency.end());
+    auto pct = [&latency](double p)
+    {
+        return latency.empty() ? 0 : latency[static_cast<std::size_t>(p * (latency.size() - 1))];
+    };
+
+    std::cout << "depth " << depth << ", batch " << batch
+              << ", inflight " << inflight << std::endl
+              << "entries         " << qp.completed() << std::endl
+              << "errors          " << errors << std::endl
+              << "Mentries/s      " << std::fixed << std::setprecision(3)
+                                    << qp.completed() / secs / 1e6 << std::endl
+              << "sq doorbells    " << qp.sq_doorbells() << std::endl
+              << "cq doorbells    " << qp.cq_doorbells() << std::endl
+              << "latency ns p50  " << pct(0.50) << std::endl
+              << "latency ns p99  " << pct(0.99) << std::endl
+              << "latency ns max  " << pct(1.0) << std::endl;
+
+    return errors == 0 ? 0 : 3;
+}
@@ -38,6 +38,7 @@ namespace fpga
 accelerator::accelerator(shared_token token, fpga_properties props,
           const std::string &par_sysfs, fpga_resource::ptr_t parent)
 : fpga_resource(token, props, parent)
+, poller_()
 , status_(accelerator::unknown)
 , parent_sysfs_(par_sysfs)
 {
@@ -45,8 +46,11 @@ accelerator::accelerator(shared_token token, fpga_properties props,
 
 accelerator::accelerator(const accelerator & other)
 : fpga_resource(other)
+, poller_(other.poller_)
 , status_(other.status_)
 , parent_sysfs_(other.parent_sysfs_)
+, cache_group_(other.cache_group_)
+, fabric_group_(other.fabric_group_)
 {
 
 }
@@ -57,6 +61,9 @@ accelerator & accelerator::operator=(const accelerator & other)
     {
         status_ = other.status_;
         parent_sysfs_ = other.parent_sysfs_;
+        cache_group_ = other.cache_group_;
+        fabric_group_ = other.fabric_group_;
+        poller_ = other.poller_;
         fpga_resource::operator=(other);
     }
     return *this;
@@ -68,12 +75,18 @@ fpga_resource::type_t accelerator::type()
 
 bool accelerator::open(bool shared)
 {
-    return fpga_resource::open(shared) &&
-           FPGA_OK == fpgaMapMMIO(handle_, 0, NULL);
+    if (fpga_resource::open(shared) &&
+        FPGA_OK == fpgaMapMMIO(handle_, 0, NULL))
+    {
+        poller_.reset(new completion_poller(handle_));
+        return true;
+    }
+    return false;
 }
 
 bool accelerator::close()
 {
+    poller_.reset();
     return FPGA_OK == fpgaUnmapMMIO(handle_, 0) &&
            fpga_resource::close();
 }
@@ -170,6 +183,7 @@ void accelerator::release()
 {
     if (handle_ != nullptr)
     {
+        poller_.reset();
         fpgaClose(handle_);
         handle_ = nullptr;
         status_ = status_t::released;
@@ -219,14 +233,63 @@ uint64_t * accelerator::umsg_get_ptr()
     return NULL;
 }
 
+std::future<bool> accelerator::submit(std::function<bool()> start,
+                                      dma_buffer::ptr_t dsm,
+                                      std::size_t offset,
+                                      uint32_t mask,
+                                      uint32_t value,
+                                      std::chrono::microseconds timeout)
+{
+    if (!start())
+    {
+        std::promise<bool> failed;
+        failed.set_value(false);
+        return failed.get_future();
+    }
+    return watch(dsm, offset, mask, value, timeout);
+}
+
+std::future<bool> accelerator::watch(dma_buffer::ptr_t dsm,
+                                     std::size_t offset,
+                                     uint32_t mask,
+                                     uint32_t value,
+                                     std::chrono::microseconds timeout)
+{
+    if (!poller_)
+    {
+        std::promise<bool> failed;
+        failed.set_value(false);
+        return failed.get_future();
+    }
+    return poller_->watch(dsm, offset, mask, value, timeout);
+}
+
 fpga_cache_counters accelerator::cache_counters() const
 {
-    return fpga_cache_counters(parent_sysfs_);
+    return fpga_cache_counters(cache_counter_group());
 }
 
 fpga_fabric_counters accelerator::fabric_counters() const
 {
-    return fpga_fabric_counters(parent_sysfs_);
+    return fpga_fabric_counters(fabric_counter_group());
+}
+
+perf_counter_group::ptr_t accelerator::cache_counter_group() const
+{
+    if (!cache_group_)
+    {
+        cache_group_ = fpga_cache_counters::open(parent_sysfs_);
+    }
+    return cache_group_;
+}
+
+perf_counter_group::ptr_t accelerator::fabric_counter_group() const
+{
+    if (!fabric_group_)
+    {
+        fabric_group_ = fpga_fabric_counters::open(parent_sysfs_);
+    }
+    return fabric_group_;
 }
 
 } // end of namespace fpga
@@ -26,6 +26,8 @@
 
 #pragma once
 #include <memory>
+#include <functional>
+#include <future>
 #include <opae/fpga.h>
 #include "option_map.h"
 #include "fpga_resource.h"
@@ -33,6 +35,7 @@
 #include "dma_buffer.h"
 #include "perf_counters.h"
 #include "mmio.h"
+#include "completion_poller.h"
 
 namespace intel
 {
@@ -83,21 +86,54 @@ public:
 
     virtual uint64_t * umsg_get_ptr();
 
+    /// @brief Start an AFU job and return a future for its completion.
+    /// @param start   kicks off the job (e.g. CSR writes); false fails the job
+    /// @param dsm     buffer holding the job's completion word
+    /// @param offset  byte offset of the uint32_t completion word
+    /// @param mask    bits of the completion word to compare
+    /// @param value   value the masked word takes on completion
+    /// @param timeout the future yields false if this expires first
+    /// Completion words of all outstanding jobs are watched by one
+    /// completion_poller per open device.
+    virtual std::future<bool> submit(std::function<bool()> start,
+                                     dma_buffer::ptr_t dsm,
+                                     std::size_t offset,
+                                     uint32_t mask,
+                                     uint32_t value,
+                                     std::chrono::microseconds timeout);
+
+    /// @brief Like submit(), for a job that has already been started.
+    std::future<bool> watch(dma_buffer::ptr_t dsm,
+                            std::size_t offset,
+                            uint32_t mask,
+                            uint32_t value,
+                            std::chrono::microseconds timeout);
+
     fpga_cache_counters cache_counters() const;
 
     fpga_fabric_counters fabric_counters() const;
 
+    /// @brief The cache counter files, opened on first use and
+    /// shared by every snapshot taken through this accelerator.
+    perf_counter_group::ptr_t cache_counter_group() const;
+
+    /// @brief The fabric counter files, opened on first use.
+    perf_counter_group::ptr_t fabric_counter_group() const;
+
 protected:
     accelerator(const accelerator & other);
     accelerator & operator=(const accelerator & other);
 
-private:
-
     accelerator(shared_token token, fpga_properties props,
          const std::string &par_sysfs, fpga_resource::ptr_t parent);
 
+    completion_poller::ptr_t poller_;
+
+private:
     status_t status_;
     std::string parent_sysfs_;
+    mutable perf_counter_group::ptr_t cache_group_;
+    mutable perf_counter_group::ptr_t fabric_group_;
 };
 
 } // end of namespace fpga
@@ -0,0 +1,180 @@
+// Copyright(c) 2017, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <poll.h>
+#include <unistd.h>
+#include "completion_poller.h"
+
+namespace intel
+{
+namespace fpga
+{
+
+completion_poller::completion_poller(fpga_handle handle,
+                                     std::chrono::microseconds interval)
+: handle_(handle)
+, interval_(interval)
+, event_(-1)
+, stop_(false)
+{
+}
+
+completion_poller::~completion_poller()
+{
+    {
+        std::lock_guard<std::mutex> g(lock_);
+        stop_ = true;
+    }
+    cv_.notify_one();
+
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+
+    for (auto &job : jobs_)
+    {
+        job.done.set_value(false);
+    }
+
+    if (event_ != -1)
+    {
+        fpgaUnregisterEvent(handle_, FPGA_EVENT_INTERRUPT);
+        fpgaDestroyEventHandle(&event_);
+    }
+}
+
+std::future<bool> completion_poller::watch(dma_buffer::ptr_t buffer,
+                                           std::size_t offset,
+                                           uint32_t mask,
+                                           uint32_t value,
+                                           std::chrono::microseconds timeout)
+{
+    job_t job;
+    job.buffer = buffer;
+    job.offset = offset;
+    job.mask = mask;
+    job.value = value;
+    job.deadline = clock_t::now() + timeout;
+    std::future<bool> f = job.done.get_future();
+
+    {
+        std::lock_guard<std::mutex> g(lock_);
+        jobs_.push_back(std::move(job));
+
+        if (!thread_.joinable())
+        {
+            // Interrupts are optional; without them the poller
+            // rescans every interval_.
+            fpga_event_handle eh;
+            if (handle_ && FPGA_OK == fpgaCreateEventHandle(&eh))
+            {
+                if (FPGA_OK == fpgaRegisterEvent(handle_, FPGA_EVENT_INTERRUPT, eh, 0))
+                {
+                    event_ = eh;
+                }
+                else
+                {
+                    fpgaDestroyEventHandle(&eh);
+                }
+            }
+            thread_ = std::thread(&completion_poller::run, this);
+        }
+    }
+    cv_.notify_one();
+
+    return f;
+}
+
+std::size_t completion_poller::outstanding()
+{
+    std::lock_guard<std::mutex> g(lock_);
+    return jobs_.size();
+}
+
+void completion_poller::sleep()
+{
+    if (event_ != -1)
+    {
+        struct pollfd pfd = { event_, POLLIN, 0 };
+        struct timespec ts = { 0, static_cast<long>(interval_.count() * 1000) };
+        if (ppoll(&pfd, 1, &ts, nullptr) > 0)
+        {
+            // consume the event count; the scan decides what completed
+            uint64_t count;
+            ssize_t n = ::read(event_, &count, sizeof(count));
+            (void)n;
+        }
+    }
+    else
+    {
+        std::this_thread::sleep_for(interval_);
+    }
+}
+
+void completion_poller::run()
+{
+    std::unique_lock<std::mutex> lock(lock_);
+
+    while (!stop_)
+    {
+        if (jobs_.empty())
+        {
+            cv_.wait(lock, [this]{ return stop_ || !jobs_.empty(); });
+            continue;
+        }
+
+        clock_t::time_point now = clock_t::now();
+        for (auto it = jobs_.begin(); it != jobs_.end(); )
+        {
+            uint32_t word = *reinterpret_cast<volatile uint32_t *>(it->buffer->address() + it->offset);
+            if ((word & it->mask) == it->value)
+            {
+                it->done.set_value(true);
+                it = jobs_.erase(it);
+            }
+            else if (now >= it->deadline)
+            {
+                it->done.set_value(false);
+                it = jobs_.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        if (!jobs_.empty())
+        {
+            lock.unlock();
+            sleep();
+            lock.lock();
+        }
+    }
+}
+
+} // end of namespace fpga
+} // end of namespace intel
@@ -0,0 +1,102 @@
+// Copyright(c) 2017, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+#include <list>
+#include <mutex>
+#include <thread>
+#include <future>
+#include <condition_variable>
+#include <opae/fpga.h>
+#include "dma_buffer.h"
+
+namespace intel
+{
+namespace fpga
+{
+
+/// @brief One thread per device that watches the completion words of
+/// all outstanding AFU jobs and completes their futures.
+/// The thread is started with the first job. Between scans it sleeps
+/// on the AFU interrupt event when the driver provides one, and for a
+/// fixed interval otherwise.
+class completion_poller
+{
+public:
+    typedef std::shared_ptr<completion_poller> ptr_t;
+
+    /// @param handle   open accelerator handle, used for interrupts
+    /// @param interval longest time between two scans
+    completion_poller(fpga_handle handle,
+                      std::chrono::microseconds interval = std::chrono::microseconds(5));
+    ~completion_poller();
+
+    /// @brief Complete the returned future with true once
+    /// (word & mask) == value, where word is the uint32_t at offset in
+    /// buffer, or with false after timeout.
+    std::future<bool> watch(dma_buffer::ptr_t buffer,
+                            std::size_t offset,
+                            uint32_t mask,
+                            uint32_t value,
+                            std::chrono::microseconds timeout);
+
+    /// @brief Number of jobs not yet completed.
+    std::size_t outstanding();
+
+    /// @brief Whether scans are driven by AFU interrupts.
+    bool interrupts() const { return event_ != -1; }
+
+private:
+    completion_poller(const completion_poller &);
+    completion_poller & operator = (const completion_poller &);
+
+    typedef std::chrono::steady_clock clock_t;
+
+    struct job_t
+    {
+        dma_buffer::ptr_t buffer;
+        std::size_t offset;
+        uint32_t mask;
+        uint32_t value;
+        clock_t::time_point deadline;
+        std::promise<bool> done;
+    };
+
+    void run();
+    void sleep();
+
+    fpga_handle handle_;
+    std::chrono::microseconds interval_;
+    fpga_event_handle event_;
+    std::list<job_t> jobs_;
+    std::mutex lock_;
+    std::condition_variable cv_;
+    bool stop_;
+    std::thread thread_;
+};
+
+} // end of namespace fpga
+} // end of namespace intel
@@ -32,6 +32,8 @@
 #include <chrono>
 #include <thread>
 #include <opae/fpga.h>
+#include "wait_policy.h"
+#include "memops.h"
 
 namespace intel
 {
@@ -102,6 +104,19 @@ public:
         ::memset(virtual_address_, value, size_);
     }
 
+    /// @brief Fill with a repeating 64-bit pattern.
+    /// @param stream bypass the host caches (non-temporal stores)
+    void fill_pattern(uint64_t pattern, bool stream = false)
+    {
+        memops::fill64(virtual_address_, size_, pattern, stream);
+    }
+
+    /// @brief Fill with consecutive 64-bit values starting at start.
+    void fill_sequence(uint64_t start, bool stream = false)
+    {
+        memops::fill_sequence64(virtual_address_, size_, start, stream);
+    }
+
     template<typename T>
     void write(const T& value, std::size_t offset = 0)
     {
@@ -123,7 +138,14 @@ public:
 
     bool equal(dma_buffer::ptr_t other, size_t size) const
     {
-        return ::memcmp(virtual_address_, other.get()->virtual_address_, size) == 0;
+        return mismatch(other, size) == size;
+    }
+
+    /// @brief Byte offset of the first difference from other within
+    /// size bytes, or size if they are equal.
+    std::size_t mismatch(dma_buffer::ptr_t other, size_t size) const
+    {
+        return memops::mismatch(virtual_address_, other.get()->virtual_address_, size);
     }
 
     typedef std::chrono::microseconds microseconds_t;
@@ -131,20 +153,18 @@ public:
     template<typename T>
     bool poll(std::size_t offset, microseconds_t timeout, T mask, T value) const
     {
-        time_point_t start = std::chrono::high_resolution_clock::now();
-        microseconds_t elapsed;
+        wait_policy policy(wait_policy::spin);
+        return wait(offset, policy, timeout, mask, value);
+    }
 
-        do
+    template<typename T>
+    bool wait(std::size_t offset, wait_policy &policy, microseconds_t timeout, T mask, T value) const
+    {
+        if ((offset + sizeof(T) > size_) || (virtual_address_ == nullptr))
         {
-            if ((read<T>(offset) & mask) == value)
-                return true;
-
-            elapsed = std::chrono::duration_cast<microseconds_t>(
-                        std::chrono::high_resolution_clock::now() - start);
-
-        }while(elapsed < timeout);
-
-        return false;
+            return false;
+        }
+        return policy.wait(reinterpret_cast<volatile T*>(virtual_address_ + offset), mask, value, timeout);
     }
 
     template<typename T>
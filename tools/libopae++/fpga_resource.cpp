@@ -28,6 +28,7 @@
 #include "property_map.h"
 #include <opae/fpga.h>
 #include <uuid/uuid.h>
+#include <fstream>
 
 namespace intel
 {
@@ -253,5 +254,27 @@ uint8_t fpga_resource::socket_id()
     return socket_id_;
 }
 
+int fpga_resource::numa_node()
+{
+    // The token's sysfs path is a port or FME under intel-fpga-dev.N;
+    // either it or its parent links to the PCI device
+    const std::string sysfs = token_ ? sysfs_path_from_token(*token_) : "";
+    const char * const links[] = { "/device/numa_node", "/../device/numa_node" };
+
+    if (!sysfs.empty())
+    {
+        for (const char *link : links)
+        {
+            int node = -1;
+            std::ifstream f(sysfs + link);
+            if ((f >> node) && node >= 0)
+            {
+                return node;
+            }
+        }
+    }
+    return socket_id_;
+}
+
 } // end of namespace fpga
 } // end of namespace intel
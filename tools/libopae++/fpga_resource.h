@@ -75,6 +75,11 @@ public:
 
     virtual uint8_t socket_id();
 
+    /// @brief NUMA node the device is attached to, read through the
+    /// resource's own sysfs device link, or the socket id when sysfs
+    /// does not report one.
+    virtual int numa_node();
+
     static std::string sysfs_path_from_token(fpga_token t);
 
 protected:
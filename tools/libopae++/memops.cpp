@@ -0,0 +1,338 @@
+// Copyright(c) 2017, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <cstring>
+#include "memops.h"
+#if defined(__x86_64__)
+#include <immintrin.h>
+#define MEMOPS_X86 1
+#endif
+
+namespace intel
+{
+namespace fpga
+{
+namespace memops
+{
+
+namespace
+{
+
+const std::size_t line = 64;
+
+// Scalar head/tail helpers. dst is 8-byte aligned wherever they are used
+// on a qword boundary; the final partial qword is written bytewise.
+inline void put_tail(uint8_t *p, std::size_t n, uint64_t v)
+{
+    std::memcpy(p, &v, n);
+}
+
+void fill64_scalar(uint8_t *p, std::size_t size, uint64_t pattern, bool)
+{
+    std::size_t i = 0;
+    for ( ; i + 8 <= size ; i += 8)
+    {
+        std::memcpy(p + i, &pattern, 8);
+    }
+    put_tail(p + i, size - i, pattern);
+}
+
+void fill_sequence64_scalar(uint8_t *p, std::size_t size, uint64_t v, bool)
+{
+    std::size_t i = 0;
+    for ( ; i + 8 <= size ; i += 8, ++v)
+    {
+        std::memcpy(p + i, &v, 8);
+    }
+    put_tail(p + i, size - i, v);
+}
+
+std::size_t mismatch_scalar(const uint8_t *a, const uint8_t *b, std::size_t size)
+{
+    std::size_t i = 0;
+    for ( ; i + 8 <= size ; i += 8)
+    {
+        uint64_t x, y;
+        std::memcpy(&x, a + i, 8);
+        std::memcpy(&y, b + i, 8);
+        if (x != y)
+        {
+            break;
+        }
+    }
+    for ( ; i < size ; ++i)
+    {
+        if (a[i] != b[i])
+        {
+            break;
+        }
+    }
+    return i;
+}
+
+#if MEMOPS_X86
+
+// Scalar up to the first cache line boundary. Returns the bytes handled,
+// which is a multiple of 8 when p is 8-byte aligned.
+inline std::size_t head_bytes(const uint8_t *p, std::size_t size)
+{
+    std::size_t h = (line - (reinterpret_cast<uintptr_t>(p) & (line - 1))) & (line - 1);
+    return h < size ? h : size;
+}
+
+__attribute__((target("avx2")))
+void fill64_avx2(uint8_t *p, std::size_t size, uint64_t pattern, bool stream)
+{
+    std::size_t h = head_bytes(p, size);
+    fill64_scalar(p, h, pattern, false);
+    p += h;
+    size -= h;
+
+    const __m256i v = _mm256_set1_epi64x(pattern);
+    std::size_t n = size & ~(line - 1);
+    if (stream)
+    {
+        for (std::size_t i = 0 ; i < n ; i += line)
+        {
+            _mm256_stream_si256(reinterpret_cast<__m256i *>(p + i), v);
+            _mm256_stream_si256(reinterpret_cast<__m256i *>(p + i + 32), v);
+        }
+        _mm_sfence();
+    }
+    else
+    {
+        for (std::size_t i = 0 ; i < n ; i += line)
+        {
+            _mm256_store_si256(reinterpret_cast<__m256i *>(p + i), v);
+            _mm256_store_si256(reinterpret_cast<__m256i *>(p + i + 32), v);
+        }
+    }
+    fill64_scalar(p + n, size - n, pattern, false);
+}
+
+__attribute__((target("avx2")))
+void fill_sequence64_avx2(uint8_t *p, std::size_t size, uint64_t s, bool stream)
+{
+    std::size_t h = head_bytes(p, size);
+    fill_sequence64_scalar(p, h, s, false);
+    p += h;
+    size -= h;
+    s += h / 8;
+
+    __m256i v0 = _mm256_set_epi64x(s + 3, s + 2, s + 1, s);
+    __m256i v1 = _mm256_set_epi64x(s + 7, s + 6, s + 5, s + 4);
+    const __m256i step = _mm256_set1_epi64x(8);
+    std::size_t n = size & ~(line - 1);
+    for (std::size_t i = 0 ; i < n ; i += line)
+    {
+        if (stream)
+        {
+            _mm256_stream_si256(reinterpret_cast<__m256i *>(p + i), v0);
+            _mm256_stream_si256(reinterpret_cast<__m256i *>(p + i + 32), v1);
+        }
+        else
+        {
+            _mm256_store_si256(reinterpret_cast<__m256i *>(p + i), v0);
+            _mm256_store_si256(reinterpret_cast<__m256i *>(p + i + 32), v1);
+        }
+        v0 = _mm256_add_epi64(v0, step);
+        v1 = _mm256_add_epi64(v1, step);
+    }
+    if (stream)
+    {
+        _mm_sfence();
+    }
+    fill_sequence64_scalar(p + n, size - n, s + n / 8, false);
+}
+
+__attribute__((target("avx2")))
+std::size_t mismatch_avx2(const uint8_t *a, const uint8_t *b, std::size_t size)
+{
+    std::size_t n = size & ~(line - 1);
+    std::size_t i = 0;
+    for ( ; i < n ; i += line)
+    {
+        __m256i x0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+        __m256i y0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+        __m256i x1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i + 32));
+        __m256i y1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i + 32));
+        __m256i eq = _mm256_and_si256(_mm256_cmpeq_epi8(x0, y0), _mm256_cmpeq_epi8(x1, y1));
+        if (static_cast<uint32_t>(_mm256_movemask_epi8(eq)) != 0xffffffffu)
+        {
+            break;
+        }
+    }
+    return i + mismatch_scalar(a + i, b + i, size - i);
+}
+
+__attribute__((target("avx512f")))
+void fill64_avx512(uint8_t *p, std::size_t size, uint64_t pattern, bool stream)
+{
+    std::size_t h = head_bytes(p, size);
+    fill64_scalar(p, h, pattern, false);
+    p += h;
+    size -= h;
+
+    const __m512i v = _mm512_set1_epi64(pattern);
+    std::size_t n = size & ~(line - 1);
+    if (stream)
+    {
+        for (std::size_t i = 0 ; i < n ; i += line)
+        {
+            _mm512_stream_si512(reinterpret_cast<__m512i *>(p + i), v);
+        }
+        _mm_sfence();
+    }
+    else
+    {
+        for (std::size_t i = 0 ; i < n ; i += line)
+        {
+            _mm512_store_si512(reinterpret_cast<__m512i *>(p + i), v);
+        }
+    }
+    fill64_scalar(p + n, size - n, pattern, false);
+}
+
+__attribute__((target("avx512f")))
+void fill_sequence64_avx512(uint8_t *p, std::size_t size, uint64_t s, bool stream)
+{
+    std::size_t h = head_bytes(p, size);
+    fill_sequence64_scalar(p, h, s, false);
+    p += h;
+    size -= h;
+    s += h / 8;
+
+    __m512i v = _mm512_set_epi64(s + 7, s + 6, s + 5, s + 4, s + 3, s + 2, s + 1, s);
+    const __m512i step = _mm512_set1_epi64(8);
+    std::size_t n = size & ~(line - 1);
+    for (std::size_t i = 0 ; i < n ; i += line)
+    {
+        if (stream)
+        {
+            _mm512_stream_si512(reinterpret_cast<__m512i *>(p + i), v);
+        }
+        else
+        {
+            _mm512_store_si512(reinterpret_cast<__m512i *>(p + i), v);
+        }
+        v = _mm512_add_epi64(v, step);
+    }
+    if (stream)
+    {
+        _mm_sfence();
+    }
+    fill_sequence64_scalar(p + n, size - n, s + n / 8, false);
+}
+
+__attribute__((target("avx512f")))
+std::size_t mismatch_avx512(const uint8_t *a, const uint8_t *b, std::size_t size)
+{
+    std::size_t n = size & ~(line - 1);
+    std::size_t i = 0;
+    for ( ; i < n ; i += line)
+    {
+        __m512i x = _mm512_loadu_si512(a + i);
+        __m512i y = _mm512_loadu_si512(b + i);
+        if (_mm512_cmpneq_epi64_mask(x, y))
+        {
+            break;
+        }
+    }
+    return i + mismatch_scalar(a + i, b + i, size - i);
+}
+
+#endif // MEMOPS_X86
+
+struct dispatch_t
+{
+    void (*fill64)(uint8_t *, std::size_t, uint64_t, bool);
+    void (*fill_sequence64)(uint8_t *, std::size_t, uint64_t, bool);
+    std::size_t (*mismatch)(const uint8_t *, const uint8_t *, std::size_t);
+    const char *isa;
+};
+
+const dispatch_t & dispatch()
+{
+    static const dispatch_t d = []()
+    {
+#if MEMOPS_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f"))
+        {
+            return dispatch_t{ fill64_avx512, fill_sequence64_avx512, mismatch_avx512, "avx512" };
+        }
+        if (__builtin_cpu_supports("avx2"))
+        {
+            return dispatch_t{ fill64_avx2, fill_sequence64_avx2, mismatch_avx2, "avx2" };
+        }
+#endif // MEMOPS_X86
+        return dispatch_t{ fill64_scalar, fill_sequence64_scalar, mismatch_scalar, "scalar" };
+    }();
+    return d;
+}
+
+} // end of anonymous namespace
+
+void fill64(void *dst, std::size_t size, uint64_t pattern, bool stream)
+{
+    uint8_t *p = static_cast<uint8_t *>(dst);
+
+    // The vector paths keep qword phase with the buffer start.
+    if (reinterpret_cast<uintptr_t>(p) & 7)
+    {
+        fill64_scalar(p, size, pattern, stream);
+        return;
+    }
+    dispatch().fill64(p, size, pattern, stream);
+}
+
+void fill_sequence64(void *dst, std::size_t size, uint64_t start, bool stream)
+{
+    uint8_t *p = static_cast<uint8_t *>(dst);
+
+    if (reinterpret_cast<uintptr_t>(p) & 7)
+    {
+        fill_sequence64_scalar(p, size, start, stream);
+        return;
+    }
+    dispatch().fill_sequence64(p, size, start, stream);
+}
+
+std::size_t mismatch(const void *a, const void *b, std::size_t size)
+{
+    return dispatch().mismatch(static_cast<const uint8_t *>(a),
+                               static_cast<const uint8_t *>(b),
+                               size);
+}
+
+const char * isa()
+{
+    return dispatch().isa;
+}
+
+} // end of namespace memops
+} // end of namespace fpga
+} // end of namespace intel
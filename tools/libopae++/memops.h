@@ -0,0 +1,57 @@
+// Copyright(c) 2017, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+namespace intel
+{
+namespace fpga
+{
+namespace memops
+{
+
+/// @brief Fill size bytes at dst with a repeating 64-bit pattern
+/// (byte k of dst is byte k % 8 of pattern).
+/// @param stream use non-temporal stores, bypassing the host caches
+void fill64(void *dst, std::size_t size, uint64_t pattern, bool stream = false);
+
+/// @brief Fill dst with consecutive 64-bit values start, start + 1, ...
+/// @param stream use non-temporal stores, bypassing the host caches
+void fill_sequence64(void *dst, std::size_t size, uint64_t start, bool stream = false);
+
+/// @brief Byte offset of the first difference between a and b,
+/// or size if the two ranges are equal.
+std::size_t mismatch(const void *a, const void *b, std::size_t size);
+
+/// @brief Name of the instruction set selected at run time
+/// ("avx512", "avx2" or "scalar").
+const char * isa();
+
+} // end of namespace memops
+} // end of namespace fpga
+} // end of namespace intel
@@ -24,8 +24,9 @@
 // ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
-#include <iostream>
-#include <fstream>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstdlib>
 #include "perf_counters.h"
 
 namespace intel
@@ -33,184 +34,177 @@ namespace intel
 namespace fpga
 {
 
-fpga_cache_counters::fpga_cache_counters()
-: sysfspath_("")
+perf_counter_group::perf_counter_group(const std::string &dir,
+                                       const char * const names[],
+                                       std::size_t count)
+: freeze_fd_(-1)
+, fds_(count, -1)
 {
+    freeze_fd_ = ::open((dir + "/freeze").c_str(), O_WRONLY);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (names[i])
+        {
+            fds_[i] = ::open((dir + "/" + names[i]).c_str(), O_RDONLY);
+        }
+    }
 }
 
-fpga_cache_counters::fpga_cache_counters(std::string sysfspath)
-: sysfspath_(sysfspath)
+perf_counter_group::~perf_counter_group()
 {
-    ctr_map_ = read_counters();
+    if (freeze_fd_ >= 0)
+        ::close(freeze_fd_);
+    for (int fd : fds_)
+    {
+        if (fd >= 0)
+            ::close(fd);
+    }
 }
 
-fpga_cache_counters::fpga_cache_counters(const fpga_cache_counters &other)
-: sysfspath_(other.sysfspath_)
-, ctr_map_(other.ctr_map_)
+bool perf_counter_group::freeze(bool f)
 {
+    const char *v = f ? "1\n" : "0\n";
+    return freeze_fd_ >= 0 && pwrite(freeze_fd_, v, 2, 0) == 2;
 }
 
-fpga_cache_counters & fpga_cache_counters::operator = (const fpga_cache_counters &other)
+uint64_t perf_counter_group::read_fd(int fd)
 {
-    if (&other != this)
+    char buf[32];
+
+    if (fd < 0)
+        return (uint64_t)-1;
+
+    ssize_t n = pread(fd, buf, sizeof(buf) - 1, 0);
+    if (n <= 0)
+        return (uint64_t)-1;
+    buf[n] = '\0';
+
+    return std::strtoull(buf, nullptr, 16);
+}
+
+void perf_counter_group::read(uint64_t *values)
+{
+    std::lock_guard<std::mutex> g(lock_);
+
+    bool frozen = freeze(true);
+    for (std::size_t i = 0; i < fds_.size(); ++i)
     {
-        sysfspath_ = other.sysfspath_;
-        ctr_map_ = other.ctr_map_;
+        values[i] = read_fd(fds_[i]);
+    }
+    if (frozen)
+    {
+        freeze(false);
     }
-    return *this;
 }
 
-uint64_t fpga_cache_counters::operator [] (fpga_cache_counters::ctr_t c) const
+static const char * const cache_counter_names[fpga_cache_counters::num_counters] =
 {
-    const_ctr_map_iter_t iter = ctr_map_.find(c);
-    if (ctr_map_.end() == iter)
-        return (uint64_t)-1;
-    return iter->second;
+    "read_hit",
+    "write_hit",
+    "read_miss",
+    "write_miss",
+    nullptr,
+    "hold_request",
+    "data_write_port_contention",
+    "tag_write_port_contention",
+    "tx_req_stall",
+    "rx_req_stall",
+    "rx_eviction"
+};
+
+fpga_cache_counters::fpga_cache_counters()
+{
+    ctrs_.fill((uint64_t)-1);
 }
 
-std::string fpga_cache_counters::name(fpga_cache_counters::ctr_t c) const
+fpga_cache_counters::fpga_cache_counters(std::string sysfspath)
 {
-#define CASE(x) case x : return #x
-    switch(c)
-    {
-        CASE(read_hit);
-        CASE(write_hit);
-        CASE(read_miss);
-        CASE(write_miss);
-        CASE(hold_request);
-        CASE(data_write_port_contention);
-        CASE(tag_write_port_contention);
-        CASE(tx_req_stall);
-        CASE(rx_req_stall);
-        CASE(rx_eviction);
-        default: return "";
-    }
-#undef CASE
+    open(sysfspath)->read(ctrs_.data());
 }
 
-fpga_cache_counters operator - (const fpga_cache_counters &l,
-                                const fpga_cache_counters &r)
+fpga_cache_counters::fpga_cache_counters(perf_counter_group::ptr_t group)
 {
-    fpga_cache_counters ctrs;
-    fpga_cache_counters::ctr_t c;
-
-    c = fpga_cache_counters::ctr_t::read_hit;
-    ctrs.ctr_map_.insert(std::make_pair(c, l[c] - r[c]));
-    c = fpga_cache_counters::ctr_t::write_hit;
-    ctrs.ctr_map_.insert(std::make_pair(c, l[c] - r[c]));
-    c = fpga_cache_counters::ctr_t::read_miss;
-    ctrs.ctr_map_.insert(std::make_pair(c, l[c] - r[c]));
-    c = fpga_cache_counters::ctr_t::write_miss;
-    ctrs.ctr_map_.insert(std::make_pair(c, l[c] - r[c]));
-    c = fpga_cache_counters::ctr_t::hold_request;
-    ctrs.ctr_map_.insert(std::make_pair(c, l[c] - r[c]));
-    c = fpga_cache_counters::ctr_t::data_write_port_contention;
-    ctrs.ctr_map_.insert(std::make_pair(c, l[c] - r[c]));
-    c = fpga_cache_counters::ctr_t::tag_write_port_contention;
-    ctrs.ctr_map_.insert(std::make_pair(c, l[c] - r[c]));
-    c = fpga_cache_counters::ctr_t::tx_req_stall;
-    ctrs.ctr_map_.insert(std::make_pair(c, l[c] - r[c]));
-    c = fpga_cache_counters::ctr_t::rx_req_stall;
-    ctrs.ctr_map_.insert(std::make_pair(c, l[c] - r[c]));
-    c = fpga_cache_counters::ctr_t::rx_eviction;
-    ctrs.ctr_map_.insert(std::make_pair(c, l[c] - r[c]));
+    group->read(ctrs_.data());
+}
 
-    return ctrs;
+fpga_cache_counters::fpga_cache_counters(const fpga_cache_counters &other)
+: ctrs_(other.ctrs_)
+{
 }
 
-void fpga_cache_counters::freeze(bool f)
+fpga_cache_counters & fpga_cache_counters::operator = (const fpga_cache_counters &other)
 {
-    std::string fr = sysfspath_ + "/perf/cache/freeze";
-    std::ofstream of;
-    of.open(fr);
-    if (of)
+    if (&other != this)
     {
-        of << (f ? "1" : "0") << std::endl;
+        ctrs_ = other.ctrs_;
     }
-    of.close();
+    return *this;
 }
 
-fpga_cache_counters::ctr_map_t fpga_cache_counters::read_counters()
+uint64_t fpga_cache_counters::operator [] (fpga_cache_counters::ctr_t c) const
 {
-    ctr_t c;
-    ctr_map_t m;
-
-    freeze(true);
-
-    c = ctr_t::read_hit;
-    m.insert(std::make_pair(c, read_counter(c)));
-    c = ctr_t::write_hit;
-    m.insert(std::make_pair(c, read_counter(c)));
-    c = ctr_t::read_miss;
-    m.insert(std::make_pair(c, read_counter(c)));
-    c = ctr_t::write_miss;
-    m.insert(std::make_pair(c, read_counter(c)));
-    c = ctr_t::hold_request;
-    m.insert(std::make_pair(c, read_counter(c)));
-    c = ctr_t::data_write_port_contention;
-    m.insert(std::make_pair(c, read_counter(c)));
-    c = ctr_t::tag_write_port_contention;
-    m.insert(std::make_pair(c, read_counter(c)));
-    c = ctr_t::tx_req_stall;
-    m.insert(std::make_pair(c, read_counter(c)));
-    c = ctr_t::rx_req_stall;
-    m.insert(std::make_pair(c, read_counter(c)));
-    c = ctr_t::rx_eviction;
-    m.insert(std::make_pair(c, read_counter(c)));
-
-    freeze(false);
-
-    return m;
+    if (c >= num_counters || !cache_counter_names[c])
+        return (uint64_t)-1;
+    return ctrs_[c];
 }
 
-uint64_t fpga_cache_counters::read_counter(fpga_cache_counters::ctr_t c)
+std::string fpga_cache_counters::name(fpga_cache_counters::ctr_t c) const
 {
-    std::string ctr(sysfspath_ + "/perf/cache/");
+    if (c >= num_counters || !cache_counter_names[c])
+        return "";
+    return cache_counter_names[c];
+}
 
-#define CASE(x) case x : ctr += #x; break
-    switch(c)
-    {
-        CASE(read_hit);
-        CASE(write_hit);
-        CASE(read_miss);
-        CASE(write_miss);
-        CASE(hold_request);
-        CASE(data_write_port_contention);
-        CASE(tag_write_port_contention);
-        CASE(tx_req_stall);
-        CASE(rx_req_stall);
-        CASE(rx_eviction);
-        default : return (uint64_t)-1;
-    }
-#undef CASE
+perf_counter_group::ptr_t fpga_cache_counters::open(const std::string &sysfspath)
+{
+    return perf_counter_group::ptr_t(
+        new perf_counter_group(sysfspath + "/perf/cache",
+                               cache_counter_names, num_counters));
+}
+
+fpga_cache_counters operator - (const fpga_cache_counters &l,
+                                const fpga_cache_counters &r)
+{
+    fpga_cache_counters ctrs;
 
-    std::ifstream inf;
-    inf.open(ctr);
-    if (inf)
+    for (std::size_t c = 0; c < fpga_cache_counters::num_counters; ++c)
     {
-        uint64_t u = 0;
-        inf >> std::hex >> u;
-        return u;
+        ctrs.ctrs_[c] = l.ctrs_[c] - r.ctrs_[c];
     }
 
-    return (uint64_t)-1;
+    return ctrs;
 }
 
 
+static const char * const fabric_counter_names[fpga_fabric_counters::num_counters] =
+{
+    "mmio_read",
+    "mmio_write",
+    "pcie0_read",
+    "pcie0_write",
+    "pcie1_read",
+    "pcie1_write",
+    "upi_read",
+    "upi_write"
+};
+
 fpga_fabric_counters::fpga_fabric_counters()
-: sysfspath_("")
 {
+    ctrs_.fill((uint64_t)-1);
 }
 
 fpga_fabric_counters::fpga_fabric_counters(std::string sysfspath)
-: sysfspath_(sysfspath)
 {
-    ctr_map_ = read_counters();
+    open(sysfspath)->read(ctrs_.data());
+}
+
+fpga_fabric_counters::fpga_fabric_counters(perf_counter_group::ptr_t group)
+{
+    group->read(ctrs_.data());
 }
 
 fpga_fabric_counters::fpga_fabric_counters(const fpga_fabric_counters &other)
-: sysfspath_(other.sysfspath_)
-, ctr_map_(other.ctr_map_)
+: ctrs_(other.ctrs_)
 {
 }
 
@@ -218,136 +212,44 @@ fpga_fabric_counters & fpga_fabric_counters::operator = (const fpga_fabric_count
 {
     if (&other != this)
     {
-        sysfspath_ = other.sysfspath_;
-        ctr_map_ = other.ctr_map_;
+        ctrs_ = other.ctrs_;
     }
     return *this;
 }
 
 uint64_t fpga_fabric_counters::operator [] (fpga_fabric_counters::ctr_t c) const
 {
-    const_ctr_map_iter_t iter = ctr_map_.find(c);
-    if (ctr_map_.end() == iter)
+    if (c >= num_counters)
         return (uint64_t)-1;
-    return iter->second;
+    return ctrs_[c];
 }
 
 std::string fpga_fabric_counters::name(fpga_fabric_counters::ctr_t c) const
 {
-#define CASE(x) case x : return #x
-    switch(c)
-    {
-        CASE(mmio_read);
-        CASE(mmio_write);
-        CASE(pcie0_read);
-        CASE(pcie0_write);
-        CASE(pcie1_read);
-        CASE(pcie1_write);
-        CASE(upi_read);
-        CASE(upi_write);
-        default: return "";
-    }
-#undef CASE
-}
-
-fpga_fabric_counters operator - (const fpga_fabric_counters &l,
-                                const fpga_fabric_counters &r)
-{
-    fpga_fabric_counters ctrs;
-    fpga_fabric_counters::ctr_t c;
-
-    c = fpga_fabric_counters::ctr_t::mmio_read;
-    ctrs.ctr_map_.insert(std::make_pair(c, l[c] - r[c]));
-    c = fpga_fabric_counters::ctr_t::mmio_write;
-    ctrs.ctr_map_.insert(std::make_pair(c, l[c] - r[c]));
-    c = fpga_fabric_counters::ctr_t::pcie0_read;
-    ctrs.ctr_map_.insert(std::make_pair(c, l[c] - r[c]));
-    c = fpga_fabric_counters::ctr_t::pcie0_write;
-    ctrs.ctr_map_.insert(std::make_pair(c, l[c] - r[c]));
-    c = fpga_fabric_counters::ctr_t::pcie1_read;
-    ctrs.ctr_map_.insert(std::make_pair(c, l[c] - r[c]));
-    c = fpga_fabric_counters::ctr_t::pcie1_write;
-    ctrs.ctr_map_.insert(std::make_pair(c, l[c] - r[c]));
-    c = fpga_fabric_counters::ctr_t::upi_read;
-    ctrs.ctr_map_.insert(std::make_pair(c, l[c] - r[c]));
-    c = fpga_fabric_counters::ctr_t::upi_write;
-    ctrs.ctr_map_.insert(std::make_pair(c, l[c] - r[c]));
-
-    return ctrs;
-}
-
-void fpga_fabric_counters::freeze(bool f)
-{
-    std::string fr = sysfspath_ + "/perf/fabric/freeze";
-    std::ofstream of;
-    of.open(fr);
-    if (of)
-    {
-        of << (f ? "1" : "0") << std::endl;
-    }
-    of.close();
+    if (c >= num_counters)
+        return "";
+    return fabric_counter_names[c];
 }
 
-fpga_fabric_counters::ctr_map_t fpga_fabric_counters::read_counters()
+perf_counter_group::ptr_t fpga_fabric_counters::open(const std::string &sysfspath)
 {
-    ctr_t c;
-    ctr_map_t m;
-
-    freeze(true);
-
-    c = ctr_t::mmio_read;
-    m.insert(std::make_pair(c, read_counter(c)));
-    c = ctr_t::mmio_write;
-    m.insert(std::make_pair(c, read_counter(c)));
-    c = ctr_t::pcie0_read;
-    m.insert(std::make_pair(c, read_counter(c)));
-    c = ctr_t::pcie0_write;
-    m.insert(std::make_pair(c, read_counter(c)));
-    c = ctr_t::pcie1_read;
-    m.insert(std::make_pair(c, read_counter(c)));
-    c = ctr_t::pcie1_write;
-    m.insert(std::make_pair(c, read_counter(c)));
-    c = ctr_t::upi_read;
-    m.insert(std::make_pair(c, read_counter(c)));
-    c = ctr_t::upi_write;
-    m.insert(std::make_pair(c, read_counter(c)));
-
-    freeze(false);
-
-    return m;
+    return perf_counter_group::ptr_t(
+        new perf_counter_group(sysfspath + "/perf/fabric",
+                               fabric_counter_names, num_counters));
 }
 
-uint64_t fpga_fabric_counters::read_counter(fpga_fabric_counters::ctr_t c)
+fpga_fabric_counters operator - (const fpga_fabric_counters &l,
+                                 const fpga_fabric_counters &r)
 {
-    std::string ctr(sysfspath_ + "/perf/fabric/");
-
-#define CASE(x) case x : ctr += #x; break
-    switch(c)
-    {
-        CASE(mmio_read);
-        CASE(mmio_write);
-        CASE(pcie0_read);
-        CASE(pcie0_write);
-        CASE(pcie1_read);
-        CASE(pcie1_write);
-        CASE(upi_read);
-        CASE(upi_write);
-        default : return (uint64_t)-1;
-    }
-#undef CASE
+    fpga_fabric_counters ctrs;
 
-    std::ifstream inf;
-    inf.open(ctr);
-    if (inf)
+    for (std::size_t c = 0; c < fpga_fabric_counters::num_counters; ++c)
     {
-        uint64_t u = 0;
-        inf >> std::hex >> u;
-        return u;
+        ctrs.ctrs_[c] = l.ctrs_[c] - r.ctrs_[c];
     }
 
-    return (uint64_t)-1;
+    return ctrs;
 }
 
 } // end of namespace fpga
 } // end of namespace intel
-
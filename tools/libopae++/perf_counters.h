@@ -26,13 +26,55 @@
 
 #pragma once
 #include <string>
-#include <map>
+#include <array>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <ostream>
+#include <cstdint>
 
 namespace intel
 {
 namespace fpga
 {
 
+/// @brief Open sysfs files of one perf counter group (perf/cache or
+/// perf/fabric) under <sysfspath>. The files stay open for the life of
+/// the group, and read() takes all counters under a single freeze with
+/// one pread() each.
+class perf_counter_group
+{
+public:
+    typedef std::shared_ptr<perf_counter_group> ptr_t;
+
+    /// @param dir       counter group directory
+    /// @param names     counter file names, indexed by counter enum;
+    ///                  nullptr for reserved indices
+    /// @param count     number of entries in names
+    perf_counter_group(const std::string &dir,
+                       const char * const names[],
+                       std::size_t count);
+    ~perf_counter_group();
+
+    /// @brief Read every counter into values[0..count).
+    /// Reserved or unreadable counters read as (uint64_t)-1.
+    void read(uint64_t *values);
+
+private:
+    perf_counter_group(const perf_counter_group &);
+    perf_counter_group & operator = (const perf_counter_group &);
+
+    bool freeze(bool f);
+    uint64_t read_fd(int fd);
+
+    std::mutex lock_;
+    int freeze_fd_;
+    std::vector<int> fds_;
+};
+
 class fpga_cache_counters
 {
 public:
@@ -51,30 +93,28 @@ public:
        rx_eviction
     };
 
+    static const std::size_t num_counters = rx_eviction + 1;
+
     fpga_cache_counters();
     fpga_cache_counters(std::string sysfspath);
+    fpga_cache_counters(perf_counter_group::ptr_t group);
     fpga_cache_counters(const fpga_cache_counters &other);
     fpga_cache_counters & operator = (const fpga_cache_counters &other);
 
     uint64_t operator [] (ctr_t c) const;
     std::string name(ctr_t c) const;
 
+    /// @brief Open the cache counter files of the FME at sysfspath.
+    static perf_counter_group::ptr_t open(const std::string &sysfspath);
+
     friend fpga_cache_counters operator - (const fpga_cache_counters &l,
                                            const fpga_cache_counters &r);
 
 protected:
-    typedef std::map<ctr_t, uint64_t> ctr_map_t;
-    typedef ctr_map_t::iterator ctr_map_iter_t;
-    typedef ctr_map_t::const_iterator const_ctr_map_iter_t;
-
-    void freeze(bool f);
-
-    ctr_map_t read_counters();
-    uint64_t read_counter(ctr_t c);
+    typedef std::array<uint64_t, num_counters> ctr_array_t;
 
 private:
-    std::string sysfspath_;
-    ctr_map_t ctr_map_;
+    ctr_array_t ctrs_;
 };
 
 class fpga_fabric_counters
@@ -92,32 +132,146 @@ public:
        upi_write
     };
 
+    static const std::size_t num_counters = upi_write + 1;
+
     fpga_fabric_counters();
     fpga_fabric_counters(std::string sysfspath);
+    fpga_fabric_counters(perf_counter_group::ptr_t group);
     fpga_fabric_counters(const fpga_fabric_counters &other);
     fpga_fabric_counters & operator = (const fpga_fabric_counters &other);
 
     uint64_t operator [] (ctr_t c) const;
     std::string name(ctr_t c) const;
 
+    /// @brief Open the fabric counter files of the FME at sysfspath.
+    static perf_counter_group::ptr_t open(const std::string &sysfspath);
+
     friend fpga_fabric_counters operator - (const fpga_fabric_counters &l,
                                             const fpga_fabric_counters &r);
 
 protected:
-    typedef std::map<ctr_t, uint64_t> ctr_map_t;
-    typedef ctr_map_t::iterator ctr_map_iter_t;
-    typedef ctr_map_t::const_iterator const_ctr_map_iter_t;
+    typedef std::array<uint64_t, num_counters> ctr_array_t;
+
+private:
+    ctr_array_t ctrs_;
+};
+
+/// @brief Background sampler that snapshots a counter group at a fixed
+/// period into a ring of the most recent <capacity> samples.
+/// Counters is fpga_cache_counters or fpga_fabric_counters.
+template <typename Counters>
+class perf_sampler
+{
+public:
+    typedef std::chrono::steady_clock clock_t;
+
+    struct sample_t
+    {
+        clock_t::time_point time;
+        Counters counters;
+    };
+
+    perf_sampler(perf_counter_group::ptr_t group, std::size_t capacity)
+    : group_(group)
+    , ring_(capacity ? capacity : 1)
+    , next_(0)
+    , count_(0)
+    , running_(false)
+    {
+    }
+
+    ~perf_sampler()
+    {
+        stop();
+    }
+
+    /// @brief Start sampling every period on a background thread.
+    void start(std::chrono::microseconds period)
+    {
+        if (running_.exchange(true))
+            return;
+        thread_ = std::thread([this, period]()
+        {
+            auto next = clock_t::now();
+            while (running_)
+            {
+                record();
+                next += period;
+                std::this_thread::sleep_until(next);
+            }
+        });
+    }
+
+    /// @brief Stop the sampling thread, keeping the recorded samples.
+    void stop()
+    {
+        running_ = false;
+        if (thread_.joinable())
+            thread_.join();
+    }
+
+    /// @brief Take one sample on the calling thread.
+    void record()
+    {
+        sample_t s = { clock_t::now(), Counters(group_) };
+        std::lock_guard<std::mutex> g(lock_);
+        ring_[next_] = s;
+        next_ = (next_ + 1) % ring_.size();
+        if (count_ < ring_.size())
+            ++count_;
+    }
 
-    void freeze(bool f);
+    /// @brief Recorded samples, oldest first.
+    std::vector<sample_t> samples()
+    {
+        std::lock_guard<std::mutex> g(lock_);
+        std::vector<sample_t> v;
+        v.reserve(count_);
+        std::size_t first = (next_ + ring_.size() - count_) % ring_.size();
+        for (std::size_t i = 0; i < count_; ++i)
+            v.push_back(ring_[(first + i) % ring_.size()]);
+        return v;
+    }
+
+    /// @brief Write the samples as CSV: time (us since the first sample)
+    /// followed by the per-interval delta of every counter.
+    void write_csv(std::ostream &os)
+    {
+        std::vector<sample_t> v = samples();
+        Counters names;
 
-    ctr_map_t read_counters();
-    uint64_t read_counter(ctr_t c);
+        os << "Time (us)";
+        for (std::size_t c = 0; c < Counters::num_counters; ++c)
+        {
+            std::string n = names.name(static_cast<typename Counters::ctr_t>(c));
+            if (!n.empty())
+                os << "," << n;
+        }
+        os << std::endl;
+
+        for (std::size_t i = 1; i < v.size(); ++i)
+        {
+            Counters d = v[i].counters - v[i-1].counters;
+            os << std::chrono::duration_cast<std::chrono::microseconds>(v[i].time - v[0].time).count();
+            for (std::size_t c = 0; c < Counters::num_counters; ++c)
+            {
+                typename Counters::ctr_t ct = static_cast<typename Counters::ctr_t>(c);
+                if (!names.name(ct).empty())
+                    os << "," << d[ct];
+            }
+            os << std::endl;
+        }
+    }
 
 private:
-    std::string sysfspath_;
-    ctr_map_t ctr_map_;
+    perf_counter_group::ptr_t group_;
+    std::vector<sample_t> ring_;
+    std::size_t next_;
+    std::size_t count_;
+    std::mutex lock_;
+    std::atomic<bool> running_;
+    std::thread thread_;
 };
 
 } // end of namespace fpga
 } // end of namespace intel
-
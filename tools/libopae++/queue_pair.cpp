@@ -0,0 +1,312 @@
+// Copyright(c) 2017, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include "queue_pair.h"
+
+namespace intel
+{
+namespace fpga
+{
+
+static_assert(sizeof(queue_pair::sq_entry) == queue_pair::cache_line,
+              "SQ entries must be one cache line");
+static_assert(sizeof(queue_pair::cq_entry) == 16,
+              "CQ entries must be 16 bytes");
+
+mmio_queue_doorbell::mmio_queue_doorbell(accelerator::ptr_t accelerator,
+                                         uint32_t sq_tail_offset,
+                                         uint32_t cq_head_offset)
+: accelerator_(accelerator)
+, sq_tail_offset_(sq_tail_offset)
+, cq_head_offset_(cq_head_offset)
+{
+}
+
+bool mmio_queue_doorbell::sq_tail(uint32_t tail)
+{
+    return accelerator_->write_mmio32(sq_tail_offset_, tail);
+}
+
+bool mmio_queue_doorbell::cq_head(uint32_t head)
+{
+    return accelerator_->write_mmio32(cq_head_offset_, head);
+}
+
+umsg_queue_doorbell::umsg_queue_doorbell(umsg_doorbell::ptr_t umsg, std::size_t slot)
+: umsg_(umsg)
+, slot_(slot)
+{
+}
+
+bool umsg_queue_doorbell::sq_tail(uint32_t tail)
+{
+    return umsg_->post(slot_, (1ULL << 32) | tail, 0) && umsg_->flush() == 1;
+}
+
+bool umsg_queue_doorbell::cq_head(uint32_t head)
+{
+    return umsg_->post(slot_, (1ULL << 32) | head, 1) && umsg_->flush() == 1;
+}
+
+std::size_t queue_pair::cq_offset(uint32_t depth)
+{
+    return static_cast<std::size_t>(depth) * sizeof(sq_entry);
+}
+
+std::size_t queue_pair::buffer_size(uint32_t depth)
+{
+    std::size_t cq_bytes = static_cast<std::size_t>(depth) * sizeof(cq_entry);
+    cq_bytes = (cq_bytes + cache_line - 1) & ~(cache_line - 1);
+    return cq_offset(depth) + cq_bytes;
+}
+
+queue_pair::queue_pair(dma_buffer::ptr_t buffer,
+                       uint32_t depth,
+                       queue_doorbell::ptr_t doorbell,
+                       uint32_t batch)
+: buffer_(buffer)
+, doorbell_(doorbell)
+, ring_(nullptr)
+, sq_(nullptr)
+, cq_(nullptr)
+, depth_(depth)
+, mask_(depth - 1)
+, batch_(std::max<uint32_t>(1, std::min<uint32_t>(batch, depth - 1)))
+, sq_tail_(0)
+, sq_head_(0)
+, sq_rung_(0)
+, cq_head_(0)
+, cq_rung_(0)
+, phase_(1)
+, submitted_(0)
+, completed_(0)
+, sq_doorbells_(0)
+, cq_doorbells_(0)
+{
+    if (depth < 2 || depth > 65536 || (depth & mask_) != 0 ||
+        !buffer_ || !doorbell_ ||
+        buffer_->size() < buffer_size(depth) ||
+        (reinterpret_cast<uintptr_t>(buffer_->address()) & (cache_line - 1)) != 0)
+    {
+        return;
+    }
+
+    ring_ = const_cast<uint8_t*>(buffer_->address());
+    ::memset(ring_, 0, buffer_size(depth));
+    sq_ = reinterpret_cast<sq_entry*>(ring_);
+    cq_ = reinterpret_cast<volatile cq_entry*>(ring_ + cq_offset(depth));
+}
+
+bool queue_pair::submit(const sq_entry &entry, uint32_t *slot)
+{
+    if (space() == 0)
+    {
+        // Entries held back for batching may be what the device
+        // needs to make progress.
+        flush();
+        return false;
+    }
+
+    sq_[sq_tail_] = entry;
+    if (slot != nullptr)
+    {
+        *slot = sq_tail_;
+    }
+    sq_tail_ = (sq_tail_ + 1) & mask_;
+    ++submitted_;
+
+    if (((sq_tail_ - sq_rung_) & mask_) >= batch_)
+    {
+        return flush();
+    }
+    return true;
+}
+
+bool queue_pair::flush()
+{
+    if (sq_rung_ == sq_tail_)
+    {
+        return true;
+    }
+
+    // The SQ entries must be visible before the doorbell.
+    __sync_synchronize();
+
+    sq_rung_ = sq_tail_;
+    ++sq_doorbells_;
+    return doorbell_->sq_tail(sq_tail_);
+}
+
+uint32_t queue_pair::reap(cq_entry *out, uint32_t max)
+{
+    uint32_t n = 0;
+
+    while (n < max)
+    {
+        volatile cq_entry *e = cq_ + cq_head_;
+        if ((__atomic_load_n(&e->phase, __ATOMIC_ACQUIRE) & 1) != phase_)
+        {
+            break;
+        }
+
+        out[n].result  = e->result;
+        out[n].sq_head = e->sq_head;
+        out[n].slot    = e->slot;
+        out[n].status  = e->status;
+        out[n].phase   = phase_;
+        sq_head_ = e->sq_head & mask_;
+
+        cq_head_ = (cq_head_ + 1) & mask_;
+        if (cq_head_ == 0)
+        {
+            phase_ ^= 1;
+        }
+        ++n;
+    }
+
+    completed_ += n;
+
+    if (n > 0 && ((cq_head_ - cq_rung_) & mask_) >= batch_)
+    {
+        cq_rung_ = cq_head_;
+        ++cq_doorbells_;
+        doorbell_->cq_head(cq_head_);
+    }
+
+    return n;
+}
+
+queue_loopback::queue_loopback(dma_buffer::ptr_t buffer,
+                               uint32_t depth,
+                               std::chrono::nanoseconds service_time)
+: buffer_(buffer)
+, depth_(depth)
+, service_time_(service_time)
+, sq_tail_(0)
+, cq_head_(0)
+, processed_(0)
+, stop_(false)
+, thread_(&queue_loopback::run, this)
+{
+}
+
+queue_loopback::~queue_loopback()
+{
+    stop_ = true;
+    thread_.join();
+}
+
+bool queue_loopback::sq_tail(uint32_t tail)
+{
+    sq_tail_.store(tail, std::memory_order_release);
+    return true;
+}
+
+bool queue_loopback::cq_head(uint32_t head)
+{
+    // The host never has more than depth - 1 entries in flight, so the
+    // CQ cannot overflow and the head is only recorded.
+    cq_head_.store(head, std::memory_order_relaxed);
+    return true;
+}
+
+dma_buffer::ptr_t queue_loopback::allocate(std::size_t size)
+{
+    size = (size + queue_pair::cache_line - 1) & ~(queue_pair::cache_line - 1);
+    void *p = nullptr;
+    if (posix_memalign(&p, queue_pair::cache_line, size) != 0)
+    {
+        return dma_buffer::ptr_t();
+    }
+    ::memset(p, 0, size);
+
+    uint8_t *virt = static_cast<uint8_t*>(p);
+    return dma_buffer::ptr_t(new dma_buffer(nullptr, 0, virt, reinterpret_cast<uint64_t>(virt), size),
+                             [p](dma_buffer *b)
+                             {
+                                 delete b;
+                                 ::free(p);
+                             });
+}
+
+void queue_loopback::run()
+{
+    typedef std::chrono::steady_clock clock_t;
+
+    uint32_t mask = depth_ - 1;
+    uint32_t sq_head = 0;
+    uint32_t cq_tail = 0;
+    uint16_t phase = 1;
+    uint8_t *ring = const_cast<uint8_t*>(buffer_->address());
+    const queue_pair::sq_entry *sq = reinterpret_cast<const queue_pair::sq_entry*>(ring);
+    volatile queue_pair::cq_entry *cq =
+        reinterpret_cast<volatile queue_pair::cq_entry*>(ring + queue_pair::cq_offset(depth_));
+
+    while (!stop_.load(std::memory_order_relaxed))
+    {
+        uint32_t tail = sq_tail_.load(std::memory_order_acquire);
+        if (sq_head == tail)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        while (sq_head != tail)
+        {
+            uint64_t result = sq[sq_head].qword[0];
+
+            if (service_time_.count() > 0)
+            {
+                clock_t::time_point until = clock_t::now() + service_time_;
+                while (clock_t::now() < until);
+            }
+
+            uint32_t slot = sq_head;
+            sq_head = (sq_head + 1) & mask;
+
+            volatile queue_pair::cq_entry *e = cq + cq_tail;
+            e->result  = result;
+            e->sq_head = static_cast<uint16_t>(sq_head);
+            e->slot    = static_cast<uint16_t>(slot);
+            e->status  = 0;
+            __atomic_store_n(&e->phase, phase, __ATOMIC_RELEASE);
+
+            cq_tail = (cq_tail + 1) & mask;
+            if (cq_tail == 0)
+            {
+                phase ^= 1;
+            }
+            processed_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+} // end of namespace fpga
+} // end of namespace intel
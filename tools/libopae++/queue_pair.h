@@ -0,0 +1,237 @@
+// Copyright(c) 2017, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#pragma once
+#include <cstdint>
+#include <atomic>
+#include <thread>
+#include <memory>
+#include <chrono>
+#include "accelerator.h"
+#include "dma_buffer.h"
+#include "umsg_doorbell.h"
+
+namespace intel
+{
+namespace fpga
+{
+
+/// @brief How the host tells the device that the SQ tail or the
+/// CQ head of a queue_pair moved.
+class queue_doorbell
+{
+public:
+    typedef std::shared_ptr<queue_doorbell> ptr_t;
+
+    virtual ~queue_doorbell() {}
+
+    virtual bool sq_tail(uint32_t tail) = 0;
+    virtual bool cq_head(uint32_t head) = 0;
+};
+
+/// @brief Doorbells as 32-bit writes to two AFU CSRs.
+class mmio_queue_doorbell : public queue_doorbell
+{
+public:
+    mmio_queue_doorbell(accelerator::ptr_t accelerator,
+                        uint32_t sq_tail_offset,
+                        uint32_t cq_head_offset);
+
+    virtual bool sq_tail(uint32_t tail);
+    virtual bool cq_head(uint32_t head);
+
+private:
+    accelerator::ptr_t accelerator_;
+    uint32_t sq_tail_offset_;
+    uint32_t cq_head_offset_;
+};
+
+/// @brief Doorbells as writes to one UMsg line.
+/// qword 0 carries the SQ tail and qword 1 the CQ head, each with
+/// bit 32 set to mark it valid.
+class umsg_queue_doorbell : public queue_doorbell
+{
+public:
+    umsg_queue_doorbell(umsg_doorbell::ptr_t umsg, std::size_t slot);
+
+    virtual bool sq_tail(uint32_t tail);
+    virtual bool cq_head(uint32_t head);
+
+private:
+    umsg_doorbell::ptr_t umsg_;
+    std::size_t slot_;
+};
+
+/// @brief Submission and completion rings sharing one pinned buffer.
+///
+/// The submission queue (SQ) holds depth 64-byte entries starting at
+/// offset 0; the completion queue (CQ) holds depth 16-byte entries
+/// starting at the next cache line. The host owns the SQ tail and the
+/// CQ head, the device owns the SQ head and the CQ tail.
+///
+/// The host never reads a device register. It learns the SQ head from
+/// the sq_head field of each completion, and it recognises new
+/// completions by their phase bit, which the device writes last and
+/// inverts every time its CQ tail wraps. Doorbells are rung once per
+/// batch submissions (or on flush()) and once per batch completions.
+class queue_pair
+{
+public:
+    typedef std::shared_ptr<queue_pair> ptr_t;
+
+    struct sq_entry
+    {
+        uint64_t qword[8];
+    };
+
+    struct cq_entry
+    {
+        uint64_t result;
+        uint16_t sq_head;   ///< device SQ head after this entry
+        uint16_t slot;      ///< SQ slot of the completed entry
+        uint16_t status;
+        uint16_t phase;     ///< bit 0 is the phase bit
+    };
+
+    static const std::size_t cache_line = 64;
+
+    /// @brief Bytes needed for a queue pair of depth entries.
+    static std::size_t buffer_size(uint32_t depth);
+    static std::size_t cq_offset(uint32_t depth);
+
+    /// @param buffer pinned memory of at least buffer_size(depth) bytes
+    /// @param depth  ring entries, a power of two no larger than 65536
+    /// @param batch  submissions (and completions) per doorbell
+    queue_pair(dma_buffer::ptr_t buffer,
+               uint32_t depth,
+               queue_doorbell::ptr_t doorbell,
+               uint32_t batch = 1);
+
+    bool ready() const { return ring_ != nullptr; }
+
+    uint32_t depth() const { return depth_; }
+    uint64_t sq_iova() const { return buffer_->iova(); }
+    uint64_t cq_iova() const { return buffer_->iova() + cq_offset(depth_); }
+
+    /// @brief SQ entries that can be submitted before a completion
+    /// has to be reaped.
+    uint32_t space() const
+    {
+        return depth_ - 1 - ((sq_tail_ - sq_head_) & mask_);
+    }
+
+    /// @brief Entries submitted and not yet reaped.
+    uint32_t outstanding() const
+    {
+        return static_cast<uint32_t>(submitted_ - completed_);
+    }
+
+    /// @brief Copy entry into the next SQ slot.
+    /// @param slot receives the SQ slot used, echoed in the completion
+    /// @return false when the SQ is full
+    bool submit(const sq_entry &entry, uint32_t *slot = nullptr);
+
+    /// @brief Ring the SQ doorbell for entries not yet announced.
+    bool flush();
+
+    /// @brief Move up to max new completions into out.
+    /// @return the number of completions moved
+    uint32_t reap(cq_entry *out, uint32_t max);
+
+    uint64_t submitted() const    { return submitted_; }
+    uint64_t completed() const    { return completed_; }
+    uint64_t sq_doorbells() const { return sq_doorbells_; }
+    uint64_t cq_doorbells() const { return cq_doorbells_; }
+
+private:
+    queue_pair(const queue_pair &);
+    queue_pair & operator = (const queue_pair &);
+
+    dma_buffer::ptr_t buffer_;
+    queue_doorbell::ptr_t doorbell_;
+    uint8_t *ring_;
+    sq_entry *sq_;
+    volatile cq_entry *cq_;
+    uint32_t depth_;
+    uint32_t mask_;
+    uint32_t batch_;
+    uint32_t sq_tail_;
+    uint32_t sq_head_;
+    uint32_t sq_rung_;
+    uint32_t cq_head_;
+    uint32_t cq_rung_;
+    uint16_t phase_;
+    uint64_t submitted_;
+    uint64_t completed_;
+    uint64_t sq_doorbells_;
+    uint64_t cq_doorbells_;
+};
+
+/// @brief Software model of a device serving a queue_pair.
+///
+/// Its doorbells only record the new SQ tail and CQ head. A thread
+/// consumes SQ entries up to the recorded tail and posts one completion
+/// per entry, echoing qword 0 as the result, after spinning for the
+/// configured service time. Use it as the doorbell of a queue_pair to
+/// measure host-side throughput and latency without hardware.
+class queue_loopback : public queue_doorbell
+{
+public:
+    typedef std::shared_ptr<queue_loopback> ptr_t;
+
+    queue_loopback(dma_buffer::ptr_t buffer,
+                   uint32_t depth,
+                   std::chrono::nanoseconds service_time = std::chrono::nanoseconds(0));
+    virtual ~queue_loopback();
+
+    virtual bool sq_tail(uint32_t tail);
+    virtual bool cq_head(uint32_t head);
+
+    /// @brief Cache-line aligned host memory shaped like a pinned
+    /// buffer, for running the loopback without an accelerator.
+    static dma_buffer::ptr_t allocate(std::size_t size);
+
+    uint64_t processed() const { return processed_.load(std::memory_order_relaxed); }
+
+private:
+    queue_loopback(const queue_loopback &);
+    queue_loopback & operator = (const queue_loopback &);
+
+    void run();
+
+    dma_buffer::ptr_t buffer_;
+    uint32_t depth_;
+    std::chrono::nanoseconds service_time_;
+    std::atomic<uint32_t> sq_tail_;
+    std::atomic<uint32_t> cq_head_;
+    std::atomic<uint64_t> processed_;
+    std::atomic<bool> stop_;
+    std::thread thread_;
+};
+
+} // end of namespace fpga
+} // end of namespace intel
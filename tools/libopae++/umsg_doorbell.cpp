@@ -0,0 +1,233 @@
+// Copyright(c) 2017, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include <unistd.h>
+#include <algorithm>
+#include "umsg_doorbell.h"
+#if defined(__x86_64__)
+#include <cpuid.h>
+#include <immintrin.h>
+#define DOORBELL_X86 1
+#endif
+
+namespace intel
+{
+namespace fpga
+{
+
+namespace
+{
+
+typedef void (*store_line_t)(volatile void *dst, const void *src);
+
+#if DOORBELL_X86
+
+bool have_movdir64b()
+{
+    unsigned int eax, ebx, ecx, edx;
+    return __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) &&
+           (ecx & (1u << 28));
+}
+
+// MOVDIR64B (%rsi), %rdi: one 64-byte direct store, atomic for the line.
+// Encoded directly so no -mmovdir64b is needed.
+void store_line_movdir64b(volatile void *dst, const void *src)
+{
+    __asm__ volatile(".byte 0x66, 0x0f, 0x38, 0xf8, 0x3e"
+                     : : "D"(dst), "S"(src) : "memory");
+}
+
+__attribute__((target("avx512f")))
+void store_line_avx512(volatile void *dst, const void *src)
+{
+    _mm512_store_si512(const_cast<void *>(dst), _mm512_loadu_si512(src));
+}
+
+// Eight non-temporal stores to one line fill a single write-combining
+// buffer, which the core evicts as one full-line write on the sfence in
+// flush(). That is the usual behavior but not an architectural guarantee:
+// an interrupt between the stores can split the line.
+void store_line_wc(volatile void *dst, const void *src)
+{
+    long long *d = reinterpret_cast<long long *>(const_cast<void *>(dst));
+    const long long *q = static_cast<const long long *>(src);
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        _mm_stream_si64(d + i, q[i]);
+    }
+}
+
+#else
+
+void store_line_qwords(volatile void *dst, const void *src)
+{
+    volatile uint64_t *d = static_cast<volatile uint64_t *>(dst);
+    const uint64_t *q = static_cast<const uint64_t *>(src);
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        d[i] = q[i];
+    }
+}
+
+#endif // DOORBELL_X86
+
+store_line_t store_line()
+{
+    static const store_line_t f = []()
+    {
+#if DOORBELL_X86
+        if (have_movdir64b())
+        {
+            return store_line_movdir64b;
+        }
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f"))
+        {
+            return store_line_avx512;
+        }
+        return store_line_wc;
+#else
+        return store_line_qwords;
+#endif // DOORBELL_X86
+    }();
+    return f;
+}
+
+} // end of anonymous namespace
+
+umsg_doorbell::umsg_doorbell(accelerator::ptr_t accelerator, mode_t mode)
+: accelerator_(accelerator)
+, mode_(mode)
+, base_(nullptr)
+, num_slots_(0)
+, stride_(static_cast<std::size_t>(sysconf(_SC_PAGESIZE)))
+, dirty_(0)
+, payload_(0)
+, hint_mask_(0)
+, posted_(0)
+, lines_written_(0)
+{
+    uint64_t *p = accelerator_->umsg_get_ptr();
+    if (p == nullptr)
+    {
+        return;
+    }
+
+    // The hint mask is a bitmap with one bit per UMsg.
+    num_slots_ = std::min<std::size_t>(accelerator_->umsg_num(), 64);
+    if (num_slots_ == 0)
+    {
+        return;
+    }
+
+    base_ = reinterpret_cast<volatile uint8_t*>(p);
+    pending_.resize(num_slots_, line_t());
+
+    uint64_t all = num_slots_ == 64 ? ~0ULL : (1ULL << num_slots_) - 1;
+    hint_mask_ = mode_ == hint ? all : 0;
+    accelerator_->umsg_set_mask(hint_mask_);
+}
+
+bool umsg_doorbell::post(std::size_t slot, uint64_t value, std::size_t qword)
+{
+    if (slot >= num_slots_ || qword >= qwords_per_line)
+    {
+        return false;
+    }
+
+    pending_[slot].qword[qword] |= value;
+    dirty_ |= 1ULL << slot;
+    payload_ |= 1ULL << slot;
+    ++posted_;
+    return true;
+}
+
+bool umsg_doorbell::post(std::size_t slot)
+{
+    if (slot >= num_slots_)
+    {
+        return false;
+    }
+
+    dirty_ |= 1ULL << slot;
+    ++posted_;
+    return true;
+}
+
+std::size_t umsg_doorbell::flush()
+{
+    if (dirty_ == 0)
+    {
+        return 0;
+    }
+
+    if (mode_ == auto_mode)
+    {
+        // Reprogram the hint mask only for slots whose mode changed.
+        uint64_t mask = (hint_mask_ & ~dirty_) | (dirty_ & ~payload_);
+        if (mask != hint_mask_)
+        {
+            accelerator_->umsg_set_mask(mask);
+            hint_mask_ = mask;
+        }
+    }
+
+    // Order prior buffer writes before the doorbells.
+    __sync_synchronize();
+
+    const store_line_t store = store_line();
+    std::size_t lines = 0;
+    uint64_t dirty = dirty_;
+    while (dirty)
+    {
+        std::size_t slot = __builtin_ctzll(dirty);
+        dirty &= dirty - 1;
+
+        line_t &src = pending_[slot];
+        store(base_ + slot * stride_, &src);
+        src = line_t();
+        ++lines;
+    }
+
+#if DOORBELL_X86
+    // Drain the weakly ordered line stores
+    _mm_sfence();
+#endif
+
+    dirty_ = 0;
+    payload_ = 0;
+    lines_written_ += lines;
+    return lines;
+}
+
+bool umsg_doorbell::ring(std::size_t slot, uint64_t value)
+{
+    return post(slot, value) && flush() == 1;
+}
+
+} // end of namespace fpga
+} // end of namespace intel
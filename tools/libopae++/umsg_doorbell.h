@@ -0,0 +1,111 @@
+// Copyright(c) 2017, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "accelerator.h"
+
+namespace intel
+{
+namespace fpga
+{
+
+/// @brief Coalescing doorbell over the UMsg region of an accelerator.
+///
+/// Notifications are staged per UMsg slot and each pending slot is
+/// written once on flush(), however many were posted. The line goes out
+/// as a single 64-byte MOVDIR64B or AVX-512 store where the CPU has one.
+/// Otherwise it is written with non-temporal stores and an sfence; the
+/// write-combining buffer normally evicts it as one full-line write,
+/// but the hardware may see a partial line if the stores are
+/// interrupted.
+class umsg_doorbell
+{
+public:
+    typedef std::shared_ptr<umsg_doorbell> ptr_t;
+
+    enum mode_t
+    {
+        /// hint mode for slots whose pending notifications carry no
+        /// payload, data mode otherwise
+        auto_mode = 0,
+        data,
+        hint
+    };
+
+    umsg_doorbell(accelerator::ptr_t accelerator, mode_t mode = auto_mode);
+
+    /// @brief true when the UMsg region is mapped
+    bool ready() const { return base_ != nullptr; }
+
+    std::size_t slots() const { return num_slots_; }
+
+    /// @brief Stage a notification carrying a payload.
+    /// The value is OR'ed into qword `qword` of the slot's line,
+    /// so several posts to one slot coalesce into one line write.
+    bool post(std::size_t slot, uint64_t value, std::size_t qword = 0);
+
+    /// @brief Stage a notification without payload.
+    bool post(std::size_t slot);
+
+    /// @brief Write every slot with a pending notification.
+    /// All stores issued before flush(), including DMA buffer writes,
+    /// are globally visible before the first UMsg line is written.
+    /// @return the number of UMsg lines written
+    std::size_t flush();
+
+    /// @brief post() and flush() a single notification.
+    bool ring(std::size_t slot, uint64_t value);
+
+    uint64_t posted() const        { return posted_; }
+    uint64_t lines_written() const { return lines_written_; }
+
+private:
+    static const std::size_t qwords_per_line = 8;
+
+    struct line_t
+    {
+        uint64_t qword[qwords_per_line];
+    };
+
+    accelerator::ptr_t accelerator_;
+    mode_t mode_;
+    volatile uint8_t *base_;
+    std::size_t num_slots_;
+    std::size_t stride_;
+    std::vector<line_t> pending_;
+    uint64_t dirty_;
+    uint64_t payload_;
+    uint64_t hint_mask_;
+    uint64_t posted_;
+    uint64_t lines_written_;
+};
+
+} // end of namespace fpga
+} // end of namespace intel
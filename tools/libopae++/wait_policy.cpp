@@ -0,0 +1,170 @@
+// Copyright(c) 2017, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <limits>
+#include <iomanip>
+#include "wait_policy.h"
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+namespace intel
+{
+namespace fpga
+{
+
+wait_policy::wait_policy(mode_t mode,
+                         std::chrono::nanoseconds spin_time,
+                         std::chrono::microseconds sleep_time)
+: mode_(mode)
+, spin_ticks_(spin_time.count() * ticks_per_us() / 1000)
+, sleep_(sleep_time)
+{
+    if (mode_ == monitor && !have_waitpkg())
+    {
+        mode_ = spin_yield;
+    }
+    reset_stats();
+}
+
+bool wait_policy::parse(const std::string &name, mode_t &mode)
+{
+    if (name == "spin")
+        mode = spin;
+    else if (name == "yield")
+        mode = spin_yield;
+    else if (name == "sleep")
+        mode = spin_sleep;
+    else if (name == "monitor")
+        mode = monitor;
+    else
+        return false;
+    return true;
+}
+
+const char * wait_policy::name(mode_t mode)
+{
+    switch (mode)
+    {
+        case spin:       return "spin";
+        case spin_yield: return "yield";
+        case spin_sleep: return "sleep";
+        case monitor:    return "monitor";
+        default:         return "";
+    }
+}
+
+uint64_t wait_policy::ticks_per_us()
+{
+    static const uint64_t tpus = []()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        auto t0 = std::chrono::steady_clock::now();
+        uint64_t c0 = __rdtsc();
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        auto t1 = std::chrono::steady_clock::now();
+        uint64_t c1 = __rdtsc();
+        uint64_t us = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+        uint64_t r = us ? (c1 - c0) / us : 0;
+        return r ? r : uint64_t(1);
+#else
+        return uint64_t(1000);
+#endif
+    }();
+    return tpus;
+}
+
+bool wait_policy::have_waitpkg()
+{
+#if defined(__x86_64__)
+    unsigned int a, b, c, d;
+    if (__get_cpuid_count(7, 0, &a, &b, &c, &d))
+    {
+        return c & (1u << 5);
+    }
+#endif
+    return false;
+}
+
+void wait_policy::record(uint64_t elapsed, bool done)
+{
+    uint64_t ns = elapsed * 1000 / ticks_per_us();
+    std::size_t b = 0;
+
+    while (b + 1 < num_buckets && (ns >> (b + 1)))
+    {
+        ++b;
+    }
+
+    ++hist_[b];
+    ++waits_;
+    if (!done)
+        ++timeouts_;
+    if (ns < min_ns_)
+        min_ns_ = ns;
+    if (ns > max_ns_)
+        max_ns_ = ns;
+    total_ns_ += ns;
+}
+
+void wait_policy::reset_stats()
+{
+    hist_.fill(0);
+    waits_ = 0;
+    timeouts_ = 0;
+    min_ns_ = std::numeric_limits<uint64_t>::max();
+    max_ns_ = 0;
+    total_ns_ = 0;
+}
+
+void wait_policy::report(std::ostream &os) const
+{
+    os << "Wait policy: " << name(mode_)
+       << ", waits: " << waits_
+       << ", timeouts: " << timeouts_ << std::endl;
+
+    if (!waits_)
+        return;
+
+    os << "Wait (ns) min: " << min_ns_
+       << ", mean: " << total_ns_ / waits_
+       << ", max: " << max_ns_ << std::endl;
+
+    uint64_t seen = 0;
+    for (std::size_t b = 0; b < num_buckets; ++b)
+    {
+        if (!hist_[b])
+            continue;
+        seen += hist_[b];
+        os << "  < " << std::setw(12) << (uint64_t(1) << (b + 1)) << " ns: "
+           << std::setw(10) << hist_[b]
+           << "  (" << std::fixed << std::setprecision(1)
+           << 100.0 * seen / waits_ << "%)" << std::endl;
+    }
+}
+
+} // end of namespace fpga
+} // end of namespace intel
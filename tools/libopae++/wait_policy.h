@@ -0,0 +1,236 @@
+// Copyright(c) 2017, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+#include <cstdint>
+#include <array>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <ostream>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace intel
+{
+namespace fpga
+{
+
+/// @brief How a thread waits for a value in host memory (typically a
+/// DSM completion flag) to be written by the device.
+/// Deadlines are kept in TSC ticks, and the time every wait took is kept
+/// in a log2 histogram for report().
+class wait_policy
+{
+public:
+    enum mode_t
+    {
+        spin = 0,    ///< pause-spin until done
+        spin_yield,  ///< spin, then yield between checks
+        spin_sleep,  ///< spin, then sleep between checks
+        monitor      ///< spin, then UMONITOR/UMWAIT (spin_yield without WAITPKG)
+    };
+
+    /// @param mode       wait mode
+    /// @param spin_time  time to pause-spin before backing off
+    /// @param sleep_time sleep between checks in spin_sleep mode
+    wait_policy(mode_t mode = spin_sleep,
+                std::chrono::nanoseconds spin_time = std::chrono::microseconds(2),
+                std::chrono::microseconds sleep_time = std::chrono::microseconds(10));
+
+    /// @brief Parse one of { spin, yield, sleep, monitor }.
+    static bool parse(const std::string &name, mode_t &mode);
+
+    static const char * name(mode_t mode);
+
+    /// @brief The mode actually used (monitor may fall back).
+    mode_t mode() const { return mode_; }
+
+    template<typename T>
+    bool wait(volatile T *addr, T mask, T value, std::chrono::microseconds timeout)
+    {
+        const uint64_t start = ticks();
+        const uint64_t deadline = start + timeout.count() * ticks_per_us();
+        const uint64_t spin_end = start + spin_ticks_;
+        uint64_t now = start;
+
+        for (;;)
+        {
+            if ((*addr & mask) == value)
+            {
+                record(ticks() - start, true);
+                return true;
+            }
+
+            now = ticks();
+            if (now >= deadline)
+            {
+                record(now - start, false);
+                return false;
+            }
+
+            if (mode_ == spin || now < spin_end)
+            {
+                relax();
+                continue;
+            }
+
+            switch (mode_)
+            {
+                case spin_yield:
+                    std::this_thread::yield();
+                    break;
+                case spin_sleep:
+                    std::this_thread::sleep_for(sleep_);
+                    break;
+                case monitor:
+                    // arm the monitor before the last check so a write
+                    // landing in between still ends the wait
+                    umonitor(addr);
+                    if ((*addr & mask) != value)
+                    {
+                        umwait(deadline);
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    /// @brief Wait until done() returns true, for conditions that are not
+    /// a single word in host memory (MMIO reads, queue state).
+    /// monitor mode backs off like spin_yield since there is no address
+    /// to arm.
+    template<typename Pred>
+    bool wait_until(Pred done, std::chrono::microseconds timeout)
+    {
+        const uint64_t start = ticks();
+        const uint64_t deadline = start + timeout.count() * ticks_per_us();
+        const uint64_t spin_end = start + spin_ticks_;
+        uint64_t now = start;
+
+        for (;;)
+        {
+            if (done())
+            {
+                record(ticks() - start, true);
+                return true;
+            }
+
+            now = ticks();
+            if (now >= deadline)
+            {
+                record(now - start, false);
+                return false;
+            }
+
+            if (mode_ == spin || now < spin_end)
+            {
+                relax();
+            }
+            else if (mode_ == spin_sleep)
+            {
+                std::this_thread::sleep_for(sleep_);
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    /// @brief Print the number of waits, timeouts and the wait time
+    /// distribution.
+    void report(std::ostream &os) const;
+
+    void reset_stats();
+
+    /// @brief TSC ticks per microsecond, calibrated once per process.
+    static uint64_t ticks_per_us();
+
+    static bool have_waitpkg();
+
+private:
+    static uint64_t ticks()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+    }
+
+    static void relax()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        _mm_pause();
+#endif
+    }
+
+    // Encoded directly so no -mwaitpkg is needed; only reached when
+    // have_waitpkg() is true.
+    static void umonitor(volatile void *addr)
+    {
+#if defined(__x86_64__)
+        __asm__ volatile(".byte 0xf3, 0x0f, 0xae, 0xf0" : : "a"(addr) : "memory");
+#else
+        (void)addr;
+#endif
+    }
+
+    static void umwait(uint64_t deadline)
+    {
+#if defined(__x86_64__)
+        // C0.2 state (ecx = 0), wake at the TSC deadline at the latest
+        __asm__ volatile(".byte 0xf2, 0x0f, 0xae, 0xf1"
+                         : : "c"(0), "a"((uint32_t)deadline), "d"((uint32_t)(deadline >> 32))
+                         : "cc", "memory");
+#else
+        (void)deadline;
+#endif
+    }
+
+    void record(uint64_t elapsed, bool done);
+
+    static const std::size_t num_buckets = 40;
+
+    mode_t mode_;
+    uint64_t spin_ticks_;
+    std::chrono::microseconds sleep_;
+
+    std::array<uint64_t, num_buckets> hist_; // bucket i: [2^i, 2^(i+1)) ns
+    uint64_t waits_;
+    uint64_t timeouts_;
+    uint64_t min_ns_;
+    uint64_t max_ns_;
+    uint64_t total_ns_;
+};
+
+} // end of namespace fpga
+} // end of namespace intel
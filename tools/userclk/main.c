@@ -113,6 +113,7 @@ int main( int argc, char** argv )
 	uint64_t userclk_high              = 0;
 	uint64_t userclk_low               = 0;
 	fpga_token fme_token               = NULL;
+	struct timespec ts_start, ts_end;
 
 	// Parse command line
 	if ( argc < 2 ) {
@@ -190,12 +191,18 @@ int main( int argc, char** argv )
 		userclkCmdLine.freq_low  > 0) {
 
 		// set user clock
+		clock_gettime(CLOCK_MONOTONIC, &ts_start);
 		result = set_userclock(sysfs_path, userclkCmdLine.freq_high, userclkCmdLine.freq_high);
+		clock_gettime(CLOCK_MONOTONIC, &ts_end);
 		if (result != FPGA_OK) {
 			FPGA_ERR("Failed to set user clock ");
 			goto out_destroy_prop;
 		}
 
+		printf("User clock set in %.3f ms\n",
+			(ts_end.tv_sec - ts_start.tv_sec) * 1e3 +
+			(ts_end.tv_nsec - ts_start.tv_nsec) / 1e6);
+
 		// read user clock
 		result = get_userclock(sysfs_path, &userclk_high, &userclk_low);
 		if (result != FPGA_OK) {